@@ -0,0 +1,116 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Atomic operations, spin-locks, and thread-local storage for the library's
+ * internal use.  They use compiler intrinsics, so no thread library is
+ * needed.  With a compiler that has neither the GCC nor the Microsoft
+ * intrinsics, they're ordinary operations and variables and the library is only
+ * thread-compatible.
+ *
+ * Counts and locks are of type "long"; pointers are of any pointer type.
+ */
+#ifndef UT_ATOMICS_H_INCLUDED
+#define UT_ATOMICS_H_INCLUDED
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/*
+ * Increments or decrements a count and returns the new value.
+ */
+#   define UT_INCREMENT(count)	__atomic_add_fetch(&(count), 1, __ATOMIC_RELAXED)
+#   define UT_DECREMENT(count)	__atomic_sub_fetch(&(count), 1, __ATOMIC_ACQ_REL)
+/*
+ * Returns the value of a count or pointer.  Subsequent reads aren't reordered
+ * before it.
+ */
+#   define UT_LOAD_LONG(count)	__atomic_load_n(&(count), __ATOMIC_ACQUIRE)
+#   define UT_LOAD_POINTER(ptr)	__atomic_load_n(&(ptr), __ATOMIC_ACQUIRE)
+/*
+ * Sets a pointer.  Previous writes aren't reordered after it.
+ */
+#   define UT_STORE_POINTER(ptr, value) \
+	__atomic_store_n(&(ptr), value, __ATOMIC_RELEASE)
+/*
+ * Sets a count or pointer to "desired" if it equals "expected".  Returns
+ * non-zero if and only if it was set.
+ */
+#   define UT_CAS_LONG(count, expected, desired) \
+	__sync_bool_compare_and_swap(&(count), expected, desired)
+#   define UT_CAS_POINTER(ptr, expected, desired) \
+	__sync_bool_compare_and_swap(&(ptr), expected, desired)
+/*
+ * Tells the processor that the thread is spinning.
+ */
+#   if defined(__x86_64__) || defined(__i386__)
+#	define UT_PAUSE()	__builtin_ia32_pause()
+#   elif defined(__aarch64__) || defined(__arm__)
+#	define UT_PAUSE()	__asm__ __volatile__("yield")
+#   else
+#	define UT_PAUSE()	((void)0)
+#   endif
+/*
+ * Acquires and releases a spin-lock.  A lock is initially zero.  A waiting
+ * thread only reads the lock until it's released, so waiters don't contend
+ * for its cache-line.
+ */
+#   define UT_LOCK(lock) \
+	while (__atomic_exchange_n(&(lock), 1, __ATOMIC_ACQUIRE)) \
+	    while (__atomic_load_n(&(lock), __ATOMIC_RELAXED)) UT_PAUSE()
+#   define UT_UNLOCK(lock)	__atomic_store_n(&(lock), 0, __ATOMIC_RELEASE)
+/*
+ * Storage-class of a variable that has one instance per thread.
+ */
+#   define UT_THREAD_LOCAL	__thread
+
+#elif defined(_MSC_VER)
+
+/*
+ * Volatile accesses have acquire and release semantics with Microsoft's
+ * compiler.
+ */
+#   include <intrin.h>
+#   define UT_INCREMENT(count)	_InterlockedIncrement(&(count))
+#   define UT_DECREMENT(count)	_InterlockedDecrement(&(count))
+#   define UT_LOAD_LONG(count)	(*(volatile long*)&(count))
+#   define UT_LOAD_POINTER(ptr)	(*(void* volatile*)&(ptr))
+#   define UT_STORE_POINTER(ptr, value) \
+	(void)_InterlockedExchangePointer((void* volatile*)&(ptr), value)
+#   define UT_CAS_LONG(count, expected, desired) \
+	(_InterlockedCompareExchange(&(count), desired, expected) == (expected))
+#   define UT_CAS_POINTER(ptr, expected, desired) \
+	(_InterlockedCompareExchangePointer((void* volatile*)&(ptr), \
+	    desired, expected) == (void*)(expected))
+#   if defined(_M_IX86) || defined(_M_X64)
+#	define UT_PAUSE()	_mm_pause()
+#   else
+#	define UT_PAUSE()	((void)0)
+#   endif
+#   define UT_LOCK(lock) \
+	while (_InterlockedExchange(&(lock), 1)) \
+	    while (*(volatile long*)&(lock)) UT_PAUSE()
+#   define UT_UNLOCK(lock)	_InterlockedExchange(&(lock), 0)
+#   define UT_THREAD_LOCAL	__declspec(thread)
+
+#else
+
+#   define UT_INCREMENT(count)	(++(count))
+#   define UT_DECREMENT(count)	(--(count))
+#   define UT_LOAD_LONG(count)	(count)
+#   define UT_LOAD_POINTER(ptr)	(ptr)
+#   define UT_STORE_POINTER(ptr, value)	((ptr) = (value))
+#   define UT_CAS_LONG(count, expected, desired) \
+	((count) == (expected) ? ((count) = (desired), 1) : 0)
+#   define UT_CAS_POINTER(ptr, expected, desired) \
+	((ptr) == (expected) ? ((ptr) = (desired), 1) : 0)
+#   define UT_LOCK(lock)	((void)0)
+#   define UT_UNLOCK(lock)	((void)0)
+#   define UT_THREAD_LOCAL
+
+#endif
+
+#endif
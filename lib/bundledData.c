@@ -0,0 +1,5027 @@
+/*
+ * The bundled unit database.  Generated by "makeBundledData" from
+ * "udunits2.xml".  Don't edit.
+ */
+
+#include <stddef.h>
+
+#include "udunits2.h"
+#include "bundledDb.h"
+
+static const BundledUnit units[] = {
+    {BU_BASE, -1, 0, 1, 0},	/* 0: meter */
+    {BU_BASE, -1, 0, 1, 0},	/* 1: kilogram */
+    {BU_BASE, -1, 0, 1, 0},	/* 2: second */
+    {BU_BASE, -1, 0, 1, 0},	/* 3: ampere */
+    {BU_BASE, -1, 0, 1, 0},	/* 4: kelvin */
+    {BU_BASE, -1, 0, 1, 0},	/* 5: mole */
+    {BU_BASE, -1, 0, 1, 0},	/* 6: candela */
+    {BU_DIMENSIONLESS, -1, 0, 1, 0},	/* 7: radian */
+    {BU_PRODUCT, 0, 1, 1, 0},	/* 8: steradian */
+    {BU_PRODUCT, 1, 1, 1, 0},	/* 9: hertz */
+    {BU_GALILEAN, 1, 0, 0.001, 0},	/* 10: gram */
+    {BU_PRODUCT, 2, 3, 1, 0},	/* 11: newton */
+    {BU_PRODUCT, 5, 3, 1, 0},	/* 12: pascal */
+    {BU_PRODUCT, 8, 3, 1, 0},	/* 13: joule */
+    {BU_PRODUCT, 11, 3, 1, 0},	/* 14: watt */
+    {BU_PRODUCT, 14, 2, 1, 0},	/* 15: coulomb */
+    {BU_PRODUCT, 16, 4, 1, 0},	/* 16: volt */
+    {BU_PRODUCT, 20, 4, 1, 0},	/* 17: farad */
+    {BU_PRODUCT, 24, 4, 1, 0},	/* 18: ohm */
+    {BU_PRODUCT, 28, 4, 1, 0},	/* 19: siemens */
+    {BU_PRODUCT, 32, 4, 1, 0},	/* 20: weber */
+    {BU_PRODUCT, 36, 3, 1, 0},	/* 21: tesla */
+    {BU_PRODUCT, 39, 4, 1, 0},	/* 22: henry */
+    {BU_GALILEAN, 4, 0, 1, 273.14999999999998},	/* 23: degree_Celsius */
+    {BU_PRODUCT, 43, 2, 1, 0},	/* 24: lumen */
+    {BU_PRODUCT, 45, 3, 1, 0},	/* 25: lux */
+    {BU_PRODUCT, 48, 2, 1, 0},	/* 26: katal */
+    {BU_PRODUCT, 50, 2, 1, 0},	/* 27: gray */
+    {BU_GALILEAN, 2, 0, 60, 0},	/* 28: minute */
+    {BU_GALILEAN, 2, 0, 3600, 0},	/* 29: hour */
+    {BU_GALILEAN, 2, 0, 86400, 0},	/* 30: day */
+    {BU_PRODUCT, 52, 0, 1, 0},	/* 31 */
+    {BU_GALILEAN, 31, 0, 3.1415926535897931, 0},	/* 32 */
+    {BU_GALILEAN, 7, 0, 0.017453292519943295, 0},	/* 33: arc_degree */
+    {BU_GALILEAN, 7, 0, 0.00029088820866572158, 0},	/* 34: arc_minute */
+    {BU_GALILEAN, 7, 0, 4.8481368110953598e-06, 0},	/* 35: arc_second */
+    {BU_PRODUCT, 52, 1, 1, 0},	/* 36 */
+    {BU_GALILEAN, 36, 0, 0.0010000000000000002, 0},	/* 37: liter */
+    {BU_GALILEAN, 1, 0, 1000, 0},	/* 38: metric_ton */
+    {BU_GALILEAN, 13, 0, 1.6021773299999999e-19, 0},	/* 39: electronvolt */
+    {BU_GALILEAN, 1, 0, 1.6605402e-27, 0},	/* 40: unified_atomic_mass_unit */
+    {BU_GALILEAN, 0, 0, 149597900000, 0},	/* 41 */
+    {BU_GALILEAN, 0, 0, 1852, 0},	/* 42 */
+    {BU_PRODUCT, 53, 2, 1, 0},	/* 43 */
+    {BU_GALILEAN, 43, 0, 0.51444444444444448, 0},	/* 44 */
+    {BU_GALILEAN, 0, 0, 1e-10, 0},	/* 45 */
+    {BU_PRODUCT, 55, 1, 1, 0},	/* 46 */
+    {BU_GALILEAN, 46, 0, 100, 0},	/* 47 */
+    {BU_GALILEAN, 46, 0, 10000, 0},	/* 48 */
+    {BU_GALILEAN, 46, 0, 1.0000000000000001e-28, 0},	/* 49 */
+    {BU_GALILEAN, 12, 0, 100000, 0},	/* 50 */
+    {BU_PRODUCT, 56, 2, 1, 0},	/* 51 */
+    {BU_GALILEAN, 51, 0, 0.01, 0},	/* 52 */
+    {BU_GALILEAN, 9, 0, 37000000000, 0},	/* 53 */
+    {BU_PRODUCT, 58, 3, 1, 0},	/* 54 */
+    {BU_GALILEAN, 54, 0, 0.00025799999999999998, 0},	/* 55 */
+    {BU_GALILEAN, 27, 0, 0.01, 0},	/* 56 */
+    {BU_PRODUCT, 61, 1, 1, 0},	/* 57 */
+    {BU_GALILEAN, 57, 0, 6.0221417899999999e+23, 0},	/* 58 */
+    {BU_GALILEAN, 31, 0, 0.01, 0},	/* 59 */
+    {BU_GALILEAN, 31, 0, 9.9999999999999995e-07, 0},	/* 60 */
+    {BU_GALILEAN, 31, 0, 1.0000000000000001e-09, 0},	/* 61 */
+    {BU_GALILEAN, 31, 0, 9.9999999999999998e-13, 0},	/* 62 */
+    {BU_GALILEAN, 31, 0, 1.0000000000000001e-15, 0},	/* 63 */
+    {BU_GALILEAN, 7, 0, 0.015707963267948967, 0},	/* 64 */
+    {BU_GALILEAN, 7, 0, 6.2831853071795862, 0},	/* 65 */
+    {BU_GALILEAN, 7, 0, -0.017453292519943295, 0},	/* 66 */
+    {BU_GALILEAN, 1, 0, 0.029166669999999999, 0},	/* 67 */
+    {BU_GALILEAN, 1, 0, 0.02834952, 0},	/* 68 */
+    {BU_GALILEAN, 1, 0, 0.45359237000000002, 0},	/* 69 */
+    {BU_GALILEAN, 1, 0, 0.00020000000000000001, 0},	/* 70 */
+    {BU_GALILEAN, 1, 0, 6.4798909999999995e-05, 0},	/* 71 */
+    {BU_GALILEAN, 1, 0, 50.802349999999997, 0},	/* 72 */
+    {BU_GALILEAN, 1, 0, 0.0015551740000000001, 0},	/* 73 */
+    {BU_GALILEAN, 1, 0, 45.35924, 0},	/* 74 */
+    {BU_GALILEAN, 1, 0, 14.5939, 0},	/* 75 */
+    {BU_GALILEAN, 1, 0, 0.031103479999999999, 0},	/* 76 */
+    {BU_GALILEAN, 1, 0, 0.37324170000000001, 0},	/* 77 */
+    {BU_GALILEAN, 1, 0, 0.0012959781999999998, 0},	/* 78 */
+    {BU_GALILEAN, 1, 0, 0.0038879345999999998, 0},	/* 79 */
+    {BU_GALILEAN, 1, 0, 0.001771845, 0},	/* 80 */
+    {BU_GALILEAN, 1, 0, 0.031103476799999998, 0},	/* 81 */
+    {BU_GALILEAN, 1, 0, 0.37324172159999996, 0},	/* 82 */
+    {BU_GALILEAN, 1, 0, 42.637682779999999, 0},	/* 83 */
+    {BU_GALILEAN, 1, 0, 907.18474000000003, 0},	/* 84 */
+    {BU_GALILEAN, 1, 0, 1016.0469088000001, 0},	/* 85 */
+    {BU_GALILEAN, 0, 0, 1.0000000000000001e-15, 0},	/* 86 */
+    {BU_GALILEAN, 0, 0, 9460730000000000, 0},	/* 87 */
+    {BU_GALILEAN, 0, 0, 9.9999999999999995e-07, 0},	/* 88 */
+    {BU_GALILEAN, 0, 0, 2.5400000000000001e-05, 0},	/* 89 */
+    {BU_GALILEAN, 0, 0, 30856780000000000, 0},	/* 90 */
+    {BU_GALILEAN, 0, 0, 0.00035145979999999999, 0},	/* 91 */
+    {BU_GALILEAN, 0, 0, 20.11684, 0},	/* 92 */
+    {BU_GALILEAN, 0, 0, 0.0042175175999999998, 0},	/* 93 */
+    {BU_GALILEAN, 0, 0, 0.30480060960121919, 0},	/* 94 */
+    {BU_GALILEAN, 0, 0, 0.9144018288036575, 0},	/* 95 */
+    {BU_GALILEAN, 0, 0, 1609.3472186944373, 0},	/* 96 */
+    {BU_GALILEAN, 0, 0, 5.0292100584201167, 0},	/* 97 */
+    {BU_GALILEAN, 0, 0, 201.16840233680466, 0},	/* 98 */
+    {BU_GALILEAN, 0, 0, 1.828803657607315, 0},	/* 99 */
+    {BU_GALILEAN, 0, 0, 0.025400000000000002, 0},	/* 100 */
+    {BU_GALILEAN, 0, 0, 0.30480000000000002, 0},	/* 101 */
+    {BU_GALILEAN, 0, 0, 0.9144000000000001, 0},	/* 102 */
+    {BU_GALILEAN, 0, 0, 1609.3440000000001, 0},	/* 103 */
+    {BU_GALILEAN, 0, 0, 0.00035277777777777781, 0},	/* 104 */
+    {BU_GALILEAN, 0, 0, 0.0084666666666666675, 0},	/* 105 */
+    {BU_GALILEAN, 0, 0, 58.471308000000008, 0},	/* 106 */
+    {BU_PRODUCT, 62, 2, 1, 0},	/* 107 */
+    {BU_GALILEAN, 107, 0, 6.2831853071795862, 0},	/* 108 */
+    {BU_GALILEAN, 107, 0, 0.10471975511965977, 0},	/* 109 */
+    {BU_PRODUCT, 64, 2, 1, 0},	/* 110 */
+    {BU_GALILEAN, 110, 0, 1.111111e-07, 0},	/* 111 */
+    {BU_GALILEAN, 110, 0, 9.9999999999999995e-07, 0},	/* 112 */
+    {BU_PRODUCT, 66, 2, 1, 0},	/* 113 */
+    {BU_GALILEAN, 113, 0, 5.72135e-11, 0},	/* 114 */
+    {BU_GALILEAN, 113, 0, 5.7452500000000001e-11, 0},	/* 115 */
+    {BU_GALILEAN, 46, 0, 5.0670750000000003e-10, 0},	/* 116 */
+    {BU_GALILEAN, 46, 0, 9.8692330000000009e-13, 0},	/* 117 */
+    {BU_GALILEAN, 46, 0, 4046.8726098742518, 0},	/* 118 */
+    {BU_GALILEAN, 36, 0, 1233.489, 0},	/* 119 */
+    {BU_GALILEAN, 36, 0, 0.0023597370000000002, 0},	/* 120 */
+    {BU_GALILEAN, 36, 0, 0.035239069999999997, 0},	/* 121 */
+    {BU_GALILEAN, 36, 0, 0.0088097674999999993, 0},	/* 122 */
+    {BU_GALILEAN, 36, 0, 0.00454609, 0},	/* 123 */
+    {BU_GALILEAN, 36, 0, 0.0044048840000000004, 0},	/* 124 */
+    {BU_GALILEAN, 36, 0, 1.0000000000000002e-06, 0},	/* 125 */
+    {BU_GALILEAN, 36, 0, 2.8316849999999998, 0},	/* 126 */
+    {BU_GALILEAN, 36, 0, 0.0011012210000000001, 0},	/* 127 */
+    {BU_GALILEAN, 36, 0, 0.00055061050000000005, 0},	/* 128 */
+    {BU_GALILEAN, 36, 0, 0.0037854120000000002, 0},	/* 129 */
+    {BU_GALILEAN, 36, 0, 0.158987304, 0},	/* 130 */
+    {BU_GALILEAN, 36, 0, 0.039746825999999999, 0},	/* 131 */
+    {BU_GALILEAN, 36, 0, 0.00094635300000000004, 0},	/* 132 */
+    {BU_GALILEAN, 36, 0, 0.00047317650000000002, 0},	/* 133 */
+    {BU_GALILEAN, 36, 0, 0.00023658825000000001, 0},	/* 134 */
+    {BU_GALILEAN, 36, 0, 0.000118294125, 0},	/* 135 */
+    {BU_GALILEAN, 36, 0, 2.9573531250000001e-05, 0},	/* 136 */
+    {BU_GALILEAN, 36, 0, 1.4786765625000001e-05, 0},	/* 137 */
+    {BU_GALILEAN, 36, 0, 3.6966914062500001e-06, 0},	/* 138 */
+    {BU_GALILEAN, 36, 0, 4.9289218750000002e-06, 0},	/* 139 */
+    {BU_GALILEAN, 36, 0, 0.0011365225, 0},	/* 140 */
+    {BU_GALILEAN, 36, 0, 0.00056826125, 0},	/* 141 */
+    {BU_GALILEAN, 36, 0, 0.000284130625, 0},	/* 142 */
+    {BU_GALILEAN, 36, 0, 0.0001420653125, 0},	/* 143 */
+    {BU_GALILEAN, 36, 0, 2.8413062500000002e-05, 0},	/* 144 */
+    {BU_GALILEAN, 36, 0, 9.9999999999999988e-19, 0},	/* 145 */
+    {BU_LOG, 145, 0, 10, 0},	/* 146 */
+    {BU_GALILEAN, 2, 0, 1e-08, 0},	/* 147 */
+    {BU_GALILEAN, 2, 0, 86164.089999999997, 0},	/* 148 */
+    {BU_GALILEAN, 2, 0, 3590.1700000000001, 0},	/* 149 */
+    {BU_GALILEAN, 2, 0, 59.836170000000003, 0},	/* 150 */
+    {BU_GALILEAN, 2, 0, 0.99726959999999998, 0},	/* 151 */
+    {BU_GALILEAN, 2, 0, 31558150, 0},	/* 152 */
+    {BU_GALILEAN, 2, 0, 31556925.9747, 0},	/* 153 */
+    {BU_GALILEAN, 2, 0, 2551442.8895999999, 0},	/* 154 */
+    {BU_GALILEAN, 2, 0, 31536000, 0},	/* 155 */
+    {BU_GALILEAN, 2, 0, 31622400, 0},	/* 156 */
+    {BU_GALILEAN, 2, 0, 31557600, 0},	/* 157 */
+    {BU_GALILEAN, 2, 0, 31556952, 0},	/* 158 */
+    {BU_GALILEAN, 2, 0, 2360591.5104, 0},	/* 159 */
+    {BU_GALILEAN, 2, 0, 2360584.6847999999, 0},	/* 160 */
+    {BU_GALILEAN, 2, 0, 1209600, 0},	/* 161 */
+    {BU_GALILEAN, 2, 0, 604800, 0},	/* 162 */
+    {BU_GALILEAN, 2, 0, 0.01, 0},	/* 163 */
+    {BU_GALILEAN, 2, 0, 31556925974700000, 0},	/* 164 */
+    {BU_GALILEAN, 2, 0, 2629743.8312249999, 0},	/* 165 */
+    {BU_PRODUCT, 68, 2, 1, 0},	/* 166 */
+    {BU_GALILEAN, 166, 0, 1000000, 0},	/* 167 */
+    {BU_GALILEAN, 51, 0, 9.8066499999999994, 0},	/* 168 */
+    {BU_PRODUCT, 70, 3, 1, 0},	/* 169 */
+    {BU_GALILEAN, 169, 0, 9806.6499999999996, 0},	/* 170 */
+    {BU_GALILEAN, 169, 0, 9806.3754137999986, 0},	/* 171 */
+    {BU_GALILEAN, 169, 0, 9796.8531566499987, 0},	/* 172 */
+    {BU_GALILEAN, 169, 0, 133322.387415, 0},	/* 173 */
+    {BU_GALILEAN, 169, 0, 132946.79272, 0},	/* 174 */
+    {BU_GALILEAN, 11, 0, 1.0000000000000001e-05, 0},	/* 175 */
+    {BU_GALILEAN, 11, 0, 0.0098066500000000001, 0},	/* 176 */
+    {BU_GALILEAN, 11, 0, 9.8066499999999994, 0},	/* 177 */
+    {BU_GALILEAN, 11, 0, 0.27801389999999998, 0},	/* 178 */
+    {BU_GALILEAN, 11, 0, 4.4482216152604996, 0},	/* 179 */
+    {BU_GALILEAN, 11, 0, 0.13825499999999999, 0},	/* 180 */
+    {BU_GALILEAN, 11, 0, 8896.4432305209994, 0},	/* 181 */
+    {BU_GALILEAN, 11, 0, 4448.2216152604997, 0},	/* 182 */
+    {BU_GALILEAN, 12, 0, 101325, 0},	/* 183 */
+    {BU_GALILEAN, 12, 0, 98066.5, 0},	/* 184 */
+    {BU_GALILEAN, 12, 0, 98.066500000000005, 0},	/* 185 */
+    {BU_GALILEAN, 12, 0, 249.08193551052, 0},	/* 186 */
+    {BU_GALILEAN, 12, 0, 248.84007017891, 0},	/* 187 */
+    {BU_GALILEAN, 12, 0, 2989.0669200000002, 0},	/* 188 */
+    {BU_GALILEAN, 12, 0, 1333.22387415, 0},	/* 189 */
+    {BU_GALILEAN, 12, 0, 133.32238741500001, 0},	/* 190 */
+    {BU_GALILEAN, 12, 0, 3386.3886403410006, 0},	/* 191 */
+    {BU_GALILEAN, 12, 0, 3376.8485350880001, 0},	/* 192 */
+    {BU_GALILEAN, 12, 0, 6894.757293168359, 0},	/* 193 */
+    {BU_GALILEAN, 12, 0, 6894757.2931683594, 0},	/* 194 */
+    {BU_GALILEAN, 12, 0, 0.10000000000000001, 0},	/* 195 */
+    {BU_GALILEAN, 12, 0, 2.0000000000000002e-05, 0},	/* 196 */
+    {BU_LOG, 196, 0, 10, 0},	/* 197 */
+    {BU_PRODUCT, 73, 3, 1, 0},	/* 198 */
+    {BU_GALILEAN, 198, 0, 0.10000000000000001, 0},	/* 199 */
+    {BU_PRODUCT, 76, 2, 1, 0},	/* 200 */
+    {BU_GALILEAN, 200, 0, 0.0001, 0},	/* 201 */
+    {BU_PRODUCT, 78, 3, 1, 0},	/* 202 */
+    {BU_GALILEAN, 202, 0, 10, 0},	/* 203 */
+    {BU_GALILEAN, 13, 0, 9.9999999999999995e-08, 0},	/* 204 */
+    {BU_GALILEAN, 13, 0, 1055.05585262, 0},	/* 205 */
+    {BU_GALILEAN, 13, 0, 105506000, 0},	/* 206 */
+    {BU_GALILEAN, 13, 0, 4.1840000000000002, 0},	/* 207 */
+    {BU_GALILEAN, 13, 0, 4.1867999999999999, 0},	/* 208 */
+    {BU_GALILEAN, 27, 0, 4184000, 0},	/* 209 */
+    {BU_GALILEAN, 13, 0, 4184000000, 0},	/* 210 */
+    {BU_GALILEAN, 13, 0, 105480400, 0},	/* 211 */
+    {BU_GALILEAN, 13, 0, 3600, 0},	/* 212 */
+    {BU_GALILEAN, 13, 0, 1.6021773299999999e-10, 0},	/* 213 */
+    {BU_GALILEAN, 14, 0, 9809.5, 0},	/* 214 */
+    {BU_GALILEAN, 14, 0, 745.69989999999996, 0},	/* 215 */
+    {BU_GALILEAN, 14, 0, 735.49900000000002, 0},	/* 216 */
+    {BU_GALILEAN, 14, 0, 746, 0},	/* 217 */
+    {BU_GALILEAN, 14, 0, 746.04300000000001, 0},	/* 218 */
+    {BU_GALILEAN, 14, 0, 745.70000000000005, 0},	/* 219 */
+    {BU_GALILEAN, 14, 0, 3516.8528420666667, 0},	/* 220 */
+    {BU_LOG, 14, 0, 10, 0},	/* 221 */
+    {BU_GALILEAN, 14, 0, 0.001, 0},	/* 222 */
+    {BU_LOG, 222, 0, 10, 0},	/* 223 */
+    {BU_PRODUCT, 81, 3, 1, 0},	/* 224 */
+    {BU_GALILEAN, 224, 0, 0.155, 0},	/* 225 */
+    {BU_GALILEAN, 3, 0, 10, 0},	/* 226 */
+    {BU_GALILEAN, 3, 0, 0.79577469999999995, 0},	/* 227 */
+    {BU_GALILEAN, 3, 0, 3.3356400000000002e-10, 0},	/* 228 */
+    {BU_GALILEAN, 17, 0, 1000000000, 0},	/* 229 */
+    {BU_GALILEAN, 22, 0, 1.0000000000000001e-09, 0},	/* 230 */
+    {BU_GALILEAN, 19, 0, 1000000000, 0},	/* 231 */
+    {BU_GALILEAN, 18, 0, 1.0000000000000001e-09, 0},	/* 232 */
+    {BU_GALILEAN, 16, 0, 1e-08, 0},	/* 233 */
+    {BU_GALILEAN, 15, 0, 1.602176487e-19, 0},	/* 234 */
+    {BU_GALILEAN, 15, 0, 96495.699999999997, 0},	/* 235 */
+    {BU_GALILEAN, 15, 0, 96521.899999999994, 0},	/* 236 */
+    {BU_GALILEAN, 15, 0, 96485.309999999998, 0},	/* 237 */
+    {BU_GALILEAN, 21, 0, 1.0000000000000001e-09, 0},	/* 238 */
+    {BU_GALILEAN, 21, 0, 0.0001, 0},	/* 239 */
+    {BU_GALILEAN, 20, 0, 1e-08, 0},	/* 240 */
+    {BU_PRODUCT, 84, 2, 1, 0},	/* 241 */
+    {BU_GALILEAN, 241, 0, 79.577470000000005, 0},	/* 242 */
+    {BU_GALILEAN, 15, 0, 3.3356400000000002e-10, 0},	/* 243 */
+    {BU_GALILEAN, 17, 0, 1.1126499999999999e-12, 0},	/* 244 */
+    {BU_GALILEAN, 22, 0, 898755400000, 0},	/* 245 */
+    {BU_GALILEAN, 19, 0, 1.1126499999999999e-12, 0},	/* 246 */
+    {BU_GALILEAN, 18, 0, 898755400000, 0},	/* 247 */
+    {BU_GALILEAN, 16, 0, 299.79250000000002, 0},	/* 248 */
+    {BU_GALILEAN, 20, 0, 1.256637e-07, 0},	/* 249 */
+    {BU_LOG, 16, 0, 10, 0},	/* 250 */
+    {BU_GALILEAN, 16, 0, 0.77500000000000002, 0},	/* 251 */
+    {BU_LOG, 251, 0, 10, 0},	/* 252 */
+    {BU_GALILEAN, 16, 0, 9.9999999999999995e-07, 0},	/* 253 */
+    {BU_LOG, 253, 0, 10, 0},	/* 254 */
+    {BU_GALILEAN, 4, 0, 0.55555555555555558, 0},	/* 255 */
+    {BU_GALILEAN, 4, 0, 0.55555555555555558, 459.67000000000002},	/* 256 */
+    {BU_GALILEAN, 25, 0, 0.1076391, 0},	/* 257 */
+    {BU_PRODUCT, 86, 2, 1, 0},	/* 258 */
+    {BU_GALILEAN, 258, 0, 3.4262589999999999, 0},	/* 259 */
+    {BU_GALILEAN, 258, 0, 3183.098861837907, 0},	/* 260 */
+    {BU_GALILEAN, 258, 0, 10000, 0},	/* 261 */
+    {BU_GALILEAN, 25, 0, 10000, 0},	/* 262 */
+    {BU_PRODUCT, 88, 2, 1, 0},	/* 263 */
+    {BU_GALILEAN, 263, 0, 41840, 0},	/* 264 */
+    {BU_GALILEAN, 258, 0, 0.31830988618379069, 0},	/* 265 */
+    {BU_PRODUCT, 90, 1, 1, 0},	/* 266 */
+    {BU_GALILEAN, 266, 0, 100, 0},	/* 267 */
+    {BU_GALILEAN, 2, 0, 7401600, 0},	/* 268 */
+    {BU_GALILEAN, 2, 0, 616800, 0},	/* 269 */
+    {BU_PRODUCT, 91, 4, 1, 0},	/* 270 */
+    {BU_GALILEAN, 270, 0, 9.9999999999999995e-07, 0},	/* 271 */
+    {BU_GALILEAN, 31, 0, 8, 0},	/* 272 */
+    {BU_PRODUCT, 95, 2, 1, 0},	/* 273 */
+    {BU_GALILEAN, 273, 0, 0.00044619999999999995, 0},	/* 274 */
+    {BU_GALILEAN, 5, 0, 1.6605387831627259e-24, 0},	/* 275: molecule */
+};
+
+static const BundledFactor factors[] = {
+    {7, 2}, {2, -1}, {0, 1}, {1, 1}, {2, -2}, {0, -1},
+    {1, 1}, {2, -2}, {0, 2}, {1, 1}, {2, -2}, {0, 2},
+    {1, 1}, {2, -3}, {2, 1}, {3, 1}, {0, 2}, {1, 1},
+    {2, -3}, {3, -1}, {0, -2}, {1, -1}, {2, 4}, {3, 2},
+    {0, 2}, {1, 1}, {2, -3}, {3, -2}, {0, -2}, {1, -1},
+    {2, 3}, {3, 2}, {0, 2}, {1, 1}, {2, -2}, {3, -1},
+    {1, 1}, {2, -2}, {3, -1}, {0, 2}, {1, 1}, {2, -2},
+    {3, -2}, {6, 1}, {7, 2}, {0, -2}, {6, 1}, {7, 2},
+    {2, -1}, {5, 1}, {0, 2}, {2, -2}, {0, 3}, {0, 1},
+    {2, -1}, {0, 2}, {0, 1}, {2, -2}, {1, -1}, {2, 1},
+    {3, 1}, {5, -1}, {2, -1}, {7, 1}, {0, -1}, {1, 1},
+    {0, -1}, {2, 1}, {0, 3}, {2, -1}, {0, -2}, {1, 1},
+    {2, -2}, {0, -1}, {1, 1}, {2, -1}, {0, 2}, {2, -1},
+    {0, 1}, {1, -1}, {2, 1}, {1, -1}, {2, 3}, {4, 1},
+    {0, -1}, {3, 1}, {0, -2}, {6, 1}, {1, 1}, {2, -2},
+    {0, -1}, {0, 2}, {1, -1}, {2, -1}, {4, 1}, {0, -2},
+    {5, 1},
+    {-1, 0}
+};
+
+static const BundledId names[] = {
+    {"langley", 264},
+    {"waters\302\24060f", 172},
+    {"hours", 29},
+    {"rotation\240per\240second", 108},
+    {"us\240survey\240mile", 96},
+    {"ec\240therms", 206},
+    {"degrees\302\240w", 66},
+    {"furlong", 98},
+    {"dry_quart", 127},
+    {"apounce", 81},
+    {"work\302\240month", 269},
+    {"international\302\240inch", 100},
+    {"us\240liquid\240pints", 133},
+    {"international_yards", 102},
+    {"degree\302\240e", 33},
+    {"us\302\240liquid\302\240quart", 132},
+    {"thermochemical_calories", 207},
+    {"avoirdupois_ounces", 68},
+    {"faradays", 237},
+    {"sidereal\240days", 148},
+    {"quarts", 132},
+    {"tnt", 209},
+    {"langleys", 264},
+    {"circle", 65},
+    {"chemical\240faraday", 235},
+    {"darcy", 117},
+    {"knot\240internationals", 44},
+    {"millimeters\302\240hg\302\2400c", 190},
+    {"meters", 0},
+    {"hertzes", 9},
+    {"thermochemical\240calories", 207},
+    {"volt", 16},
+    {"us_liquid_ounces", 136},
+    {"rotations", 65},
+    {"refrigeration\240ton", 220},
+    {"big\240points", 104},
+    {"gill", 135},
+    {"force\302\240kilograms", 177},
+    {"inches\302\240h2o\302\24060f", 187},
+    {"kaysers", 267},
+    {"feet", 101},
+    {"us\302\240survey\302\240yards", 95},
+    {"bar", 50},
+    {"force\302\240gram", 176},
+    {"waters\2404c", 171},
+    {"teaspoon", 139},
+    {"gregorian\240year", 158},
+    {"waters_60f", 172},
+    {"foot\302\240water", 188},
+    {"degree\302\240f", 256},
+    {"force_ounces", 178},
+    {"degrees\302\240t", 33},
+    {"printers\302\240point", 91},
+    {"waters\302\24039f", 171},
+    {"amps", 3},
+    {"circular\302\240mils", 116},
+    {"yards", 102},
+    {"long\240hundredweights", 72},
+    {"knot_internationals", 44},
+    {"kilogram_force", 177},
+    {"us_liquid_gills", 135},
+    {"us\240dry\240quart", 127},
+    {"degs\240f", 256},
+    {"eons", 164},
+    {"angular\240second", 35},
+    {"foot_h2o", 188},
+    {"uk_liquid_cups", 142},
+    {"metric_horsepowers", 216},
+    {"knot\302\240internationals", 44},
+    {"fluid\302\240drams", 138},
+    {"international\240mile", 103},
+    {"barn", 49},
+    {"printers_points", 91},
+    {"degrees\240t", 33},
+    {"roentgens", 55},
+    {"sidereal\302\240year", 152},
+    {"sieverts", 27},
+    {"coulombs", 15},
+    {"degreen", 33},
+    {"sidereal\302\240months", 159},
+    {"meter", 0},
+    {"degs\302\240f", 256},
+    {"octets", 272},
+    {"printers\240point", 91},
+    {"fermis", 86},
+    {"inches_h2o_60f", 187},
+    {"potential\302\240vorticity\302\240unit", 271},
+    {"arc_degree", 33},
+    {"fermi", 86},
+    {"work\302\240months", 269},
+    {"week", 162},
+    {"statamperes", 228},
+    {"us\302\240dry\302\240quarts", 127},
+    {"siemens", 19},
+    {"us\302\240liquid\302\240ounce", 136},
+    {"drams", 80},
+    {"statcoulombs", 243},
+    {"work\240month", 269},
+    {"grams\240force", 176},
+    {"mercuries_0c", 173},
+    {"chemical_faradays", 235},
+    {"inches\240h2o\24039f", 186},
+    {"uk\302\240fluid\302\240ounces", 144},
+    {"common\240years", 155},
+    {"pascals", 12},
+    {"arc_seconds", 35},
+    {"electron_volts", 39},
+    {"liquid\302\240pint", 133},
+    {"kilograms\240force", 177},
+    {"degree_t", 33},
+    {"degreer", 255},
+    {"poise", 199},
+    {"force\302\240ounce", 178},
+    {"uk\302\240horsepower", 219},
+    {"inch_h2o_39f", 186},
+    {"rotations\302\240per\302\240second", 108},
+    {"lux", 25},
+    {"gausses", 239},
+    {"avoirdupois\240ounces", 68},
+    {"uk_liquid_ounce", 144},
+    {"liquid\240quarts", 132},
+    {"acre\302\240foot", 119},
+    {"kelvin", 4},
+    {"lamberts", 260},
+    {"inch\302\240h2o\302\24039f", 186},
+    {"arcseconds", 35},
+    {"feet\240water", 188},
+    {"kilograms", 1},
+    {"force\302\240pounds", 179},
+    {"ton_of_refrigeration", 220},
+    {"sidereal\240hours", 149},
+    {"waters\24039f", 171},
+    {"julian\240years", 157},
+    {"standard_free_falls", 168},
+    {"atomic\240mass\240unit", 40},
+    {"sec", 2},
+    {"us\240dry\240pints", 128},
+    {"rods", 97},
+    {"it_btu", 205},
+    {"printers\302\240pica", 93},
+    {"force\240pounds", 179},
+    {"printers\302\240picas", 93},
+    {"common\302\240year", 155},
+    {"arcmins", 34},
+    {"btus", 205},
+    {"molecule", 275},
+    {"liquid\240ounce", 136},
+    {"degs_k", 4},
+    {"amus", 40},
+    {"standard\302\240free\302\240falls", 168},
+    {"kips", 182},
+    {"degree\302\240c", 23},
+    {"printers_pica", 93},
+    {"pascal", 12},
+    {"kilograms\302\240force", 177},
+    {"us_liquid_quart", 132},
+    {"degree\240n", 33},
+    {"us_liquid_cups", 134},
+    {"tnts", 209},
+    {"conventional\302\240waters", 170},
+    {"us\302\240fluid\302\240ounce", 136},
+    {"us_liquid_pint", 133},
+    {"angular_second", 35},
+    {"us\302\240therm", 211},
+    {"physical\240faradays", 236},
+    {"degs_c", 23},
+    {"nmiles", 42},
+    {"physical_faraday", 236},
+    {"it\240calories", 208},
+    {"avoirdupois_ounce", 68},
+    {"liquid_pints", 133},
+    {"arc\240seconds", 35},
+    {"watthours", 212},
+    {"degrees_north", 33},
+    {"conventional_mercuries", 173},
+    {"voltampere", 14},
+    {"\345ngstr\366m", 45},
+    {"liters", 37},
+    {"perches", 97},
+    {"work\302\240year", 268},
+    {"astronomical_units", 41},
+    {"short_hundredweights", 74},
+    {"electric\240horsepowers", 217},
+    {"degree\240w", 66},
+    {"atomic\302\240mass\302\240units", 40},
+    {"sidereal_year", 152},
+    {"degrees\240rankine", 255},
+    {"fluid_drams", 138},
+    {"mile", 103},
+    {"liquid\240quart", 132},
+    {"unified_atomic_mass_unit", 40},
+    {"dry\240pints", 128},
+    {"degree\302\240n", 33},
+    {"liquid\240gills", 135},
+    {"board\240feet", 120},
+    {"faraday", 237},
+    {"long\302\240ton", 85},
+    {"unit\240pole", 249},
+    {"leap\240years", 156},
+    {"arc\302\240minute", 34},
+    {"force\240gram", 176},
+    {"troy\302\240ounce", 76},
+    {"tropical_year", 153},
+    {"degreesr", 255},
+    {"mercuries\302\24032f", 173},
+    {"us_dry_quarts", 127},
+    {"potential\240vorticity\240unit", 271},
+    {"potential_vorticity_units", 271},
+    {"tonne", 38},
+    {"us_liquid_cup", 134},
+    {"conventional_waters", 170},
+    {"uk_liquid_pint", 141},
+    {"seconds", 2},
+    {"water\240horsepower", 218},
+    {"canadian\240liquid\240gallon", 123},
+    {"register_ton", 126},
+    {"short\302\240tons", 84},
+    {"kilogram", 1},
+    {"mercuries\2400c", 173},
+    {"sidereal\302\240second", 151},
+    {"angular\302\240degrees", 33},
+    {"electric_horsepowers", 217},
+    {"metric\240horsepowers", 216},
+    {"degree\302\240r", 255},
+    {"tons\302\240of\302\240refrigeration", 220},
+    {"abohm", 232},
+    {"light\302\240years", 87},
+    {"bit", 31},
+    {"pounds", 69},
+    {"month", 165},
+    {"abvolt", 233},
+    {"julian_years", 157},
+    {"arc_minutes", 34},
+    {"work_years", 268},
+    {"dry\240quart", 127},
+    {"microns", 88},
+    {"dry\302\240pint", 128},
+    {"sverdrup", 167},
+    {"hectare", 48},
+    {"troy\302\240ounces", 76},
+    {"unified\240atomic\240mass\240units", 40},
+    {"katal", 26},
+    {"degreef", 256},
+    {"millimeters\240hg", 190},
+    {"deg_c", 23},
+    {"degrees\302\240f", 256},
+    {"mercury\24060f", 174},
+    {"degrees\302\240east", 33},
+    {"us\240dry\240quarts", 127},
+    {"fluid\302\240ounces", 136},
+    {"long\240ton", 85},
+    {"arc\302\240seconds", 35},
+    {"avoirdupois_pounds", 69},
+    {"torr", 190},
+    {"kilogram\240force", 177},
+    {"sidereal_minutes", 150},
+    {"liquid\302\240quart", 132},
+    {"degreesc", 23},
+    {"work_month", 269},
+    {"inch", 100},
+    {"us_dry_pints", 128},
+    {"liquid\240gallon", 129},
+    {"ounce\302\240force", 178},
+    {"footcandles", 257},
+    {"work\302\240years", 268},
+    {"liquid\302\240quarts", 132},
+    {"us\302\240dry\302\240gallons", 124},
+    {"mercuries_60f", 174},
+    {"metric_tons", 38},
+    {"uk_fluid_ounce", 144},
+    {"bars", 50},
+    {"biot", 226},
+    {"mercury_32f", 173},
+    {"water\302\24039f", 171},
+    {"rod", 97},
+    {"atmospheres", 183},
+    {"unit\302\240poles", 249},
+    {"liquid\240cups", 134},
+    {"deg\302\240c", 23},
+    {"degree\240t", 33},
+    {"abampere", 226},
+    {"uk\240liquid\240cups", 142},
+    {"\345ngstr\366ms", 45},
+    {"us\240statute\240mile", 96},
+    {"angular\302\240seconds", 35},
+    {"dry\240quarts", 127},
+    {"stokes", 201},
+    {"register_tons", 126},
+    {"international\240yard", 102},
+    {"sidereal_second", 151},
+    {"gallon", 129},
+    {"degrees_f", 256},
+    {"degr", 255},
+    {"percents", 59},
+    {"chemical_faraday", 235},
+    {"us_survey_mile", 96},
+    {"grades", 64},
+    {"millimeter\240hg", 190},
+    {"pond", 176},
+    {"years", 153},
+    {"metric_horsepower", 216},
+    {"nautical\302\240miles", 42},
+    {"dynes", 175},
+    {"uk\302\240liquid\302\240cups", 142},
+    {"octet", 272},
+    {"tablespoon", 137},
+    {"circular_mils", 116},
+    {"pi", 32},
+    {"printers_point", 91},
+    {"rotations\240per\240second", 108},
+    {"long\302\240hundredweight", 72},
+    {"inch\240hg\24032f", 191},
+    {"light_years", 87},
+    {"printers\240pica", 93},
+    {"assay_tons", 67},
+    {"standard\302\240atmosphere", 183},
+    {"degs\302\240c", 23},
+    {"percent", 59},
+    {"arc\302\240degrees", 33},
+    {"liquid\302\240gallons", 129},
+    {"nautical_miles", 42},
+    {"millimeters_hg_0c", 190},
+    {"angular\302\240second", 35},
+    {"short\240tons", 84},
+    {"stathenry", 245},
+    {"degrees_w", 66},
+    {"us_liquid_gallons", 129},
+    {"uk\240liquid\240pint", 141},
+    {"troy\240ounces", 76},
+    {"mercury\302\2400c", 173},
+    {"kilograms_force", 177},
+    {"curie", 53},
+    {"degree_rankine", 255},
+    {"abamperes", 226},
+    {"angular_minutes", 34},
+    {"us\302\240liquid\302\240cups", 134},
+    {"uk_liquid_gallons", 123},
+    {"nmile", 42},
+    {"uk_liquid_pints", 141},
+    {"rotations_per_second", 108},
+    {"degreet", 33},
+    {"deg\302\240f", 256},
+    {"weeks", 162},
+    {"baries", 195},
+    {"apothecary_ounce", 76},
+    {"uk\302\240liquid\302\240gill", 143},
+    {"sidereal\302\240days", 148},
+    {"avoirdupois\240pounds", 69},
+    {"degrees\240east", 33},
+    {"acre_foot", 119},
+    {"angular\240minutes", 34},
+    {"pounds\240force", 179},
+    {"water_4c", 171},
+    {"technical\240atmosphere", 184},
+    {"inches\302\240hg\302\24032f", 191},
+    {"gregorian_years", 158},
+    {"big_points", 104},
+    {"deg_f", 256},
+    {"uk\240liquid\240quarts", 140},
+    {"arcminute", 34},
+    {"perms_0c", 114},
+    {"moles", 5},
+    {"sidereal\302\240hour", 149},
+    {"degrees_east", 33},
+    {"arcsecs", 35},
+    {"acre\302\240feet", 119},
+    {"metre", 0},
+    {"international_feet", 101},
+    {"degree\240e", 33},
+    {"refrigeration\302\240tons", 220},
+    {"us\240survey\240feet", 94},
+    {"pounds_force", 179},
+    {"stilbs", 261},
+    {"tons", 84},
+    {"international\240knot", 44},
+    {"barrel", 130},
+    {"uk\302\240liquid\302\240pint", 141},
+    {"angular\240degree", 33},
+    {"us_liquid_quarts", 132},
+    {"ampere", 3},
+    {"weber", 20},
+    {"fluid_dram", 138},
+    {"millimeter_hg", 190},
+    {"sidereal\302\240seconds", 151},
+    {"fahrenheit", 256},
+    {"long_ton", 85},
+    {"avoirdupois\302\240pound", 69},
+    {"angular_degree", 33},
+    {"luxes", 25},
+    {"phot", 262},
+    {"circular_mil", 116},
+    {"dyne", 175},
+    {"circles", 65},
+    {"footlambert", 259},
+    {"degrees_k", 4},
+    {"slug", 75},
+    {"international_inch", 100},
+    {"boiler_horsepowers", 214},
+    {"lunar_month", 154},
+    {"bags", 83},
+    {"troy_ounce", 76},
+    {"degrees_rankine", 255},
+    {"us\302\240liquid\302\240gills", 135},
+    {"degree\240east", 33},
+    {"canadian\302\240liquid\302\240gallons", 123},
+    {"acre_feet", 119},
+    {"stilb", 261},
+    {"candela", 6},
+    {"sidereal_month", 159},
+    {"statampere", 228},
+    {"quart", 132},
+    {"therms", 211},
+    {"ec\240therm", 206},
+    {"hertz", 9},
+    {"leap_years", 156},
+    {"candle", 6},
+    {"shakes", 147},
+    {"degrees\240n", 33},
+    {"apothecary\240pound", 77},
+    {"degree\240r", 255},
+    {"us\302\240statute\302\240miles", 96},
+    {"degree\302\240east", 33},
+    {"liquid\240gallons", 129},
+    {"dry\302\240pints", 128},
+    {"farads", 17},
+    {"us\302\240liquid\302\240pint", 133},
+    {"light\240years", 87},
+    {"uk\240liquid\240ounce", 144},
+    {"sidereal\302\240minutes", 150},
+    {"tons\240tnt", 210},
+    {"footlamberts", 259},
+    {"henries", 22},
+    {"counts", 31},
+    {"amperes", 3},
+    {"rem", 56},
+    {"us\302\240survey\302\240yard", 95},
+    {"liquid\302\240cup", 134},
+    {"refrigeration\302\240ton", 220},
+    {"uk\240liquid\240gallon", 123},
+    {"international_miles", 103},
+    {"uk\240horsepowers", 219},
+    {"chain", 92},
+    {"international_inches", 100},
+    {"apothecary_pounds", 77},
+    {"us\240dry\240gallon", 124},
+    {"us_dry_quart", 127},
+    {"days", 30},
+    {"apounces", 81},
+    {"horsepower", 215},
+    {"avogadro\302\240constants", 58},
+    {"force", 168},
+    {"knots", 44},
+    {"degreese", 33},
+    {"turn", 65},
+    {"liquid\240cup", 134},
+    {"gregorian\240years", 158},
+    {"canadian_liquid_gallon", 123},
+    {"fathom", 99},
+    {"water_horsepowers", 218},
+    {"molecs", 275},
+    {"joule", 13},
+    {"perms\302\2400c", 114},
+    {"inch_hg_32f", 191},
+    {"gram_force", 176},
+    {"millimeter\302\240hg\302\2400c", 190},
+    {"force\240ton", 181},
+    {"dry\302\240quart", 127},
+    {"apothecary\302\240pound", 77},
+    {"degree_f", 256},
+    {"electronvolt", 39},
+    {"us_survey_miles", 96},
+    {"avogadro_constants", 58},
+    {"rhes", 203},
+    {"minute", 28},
+    {"pound\302\240force", 179},
+    {"long\240hundredweight", 72},
+    {"candles", 6},
+    {"grays", 27},
+    {"degree\302\240fahrenheit", 256},
+    {"apdram", 79},
+    {"c12\240faraday", 237},
+    {"tropical\240years", 153},
+    {"mercuries\302\24060f", 174},
+    {"dobsons", 274},
+    {"day", 30},
+    {"voltamperes", 14},
+    {"angular\240seconds", 35},
+    {"dynamics", 168},
+    {"it\302\240btus", 205},
+    {"\303\245ngstr\303\266m", 45},
+    {"liquid\302\240ounce", 136},
+    {"force\302\240ounces", 178},
+    {"deg\240k", 4},
+    {"fluid\240drams", 138},
+    {"degreew", 66},
+    {"degrees\302\240kelvin", 4},
+    {"uk_liquid_quart", 140},
+    {"gal", 52},
+    {"arc\240degree", 33},
+    {"technical\302\240atmosphere", 184},
+    {"force\240ounces", 178},
+    {"grams_force", 176},
+    {"international_yard", 102},
+    {"force\240ounce", 178},
+    {"gram\302\240force", 176},
+    {"mercury_60f", 174},
+    {"inches\302\240h2o\302\24039f", 186},
+    {"cycle", 65},
+    {"ton\240tnt", 210},
+    {"unit_poles", 249},
+    {"degreee", 33},
+    {"firkins", 131},
+    {"julian_year", 157},
+    {"tons_tnt", 210},
+    {"knot\240international", 44},
+    {"siemenses", 19},
+    {"fathoms", 99},
+    {"angular\302\240minute", 34},
+    {"liquid_quart", 132},
+    {"technical\240atmospheres", 184},
+    {"inch\240hg\24060f", 192},
+    {"revolution", 65},
+    {"us\302\240dry\302\240pints", 128},
+    {"liquid_ounces", 136},
+    {"dry_pints", 128},
+    {"short\302\240hundredweights", 74},
+    {"degf", 256},
+    {"degreesw", 66},
+    {"force\302\240kilogram", 177},
+    {"perch", 97},
+    {"fahrenheits", 256},
+    {"unified_atomic_mass_units", 40},
+    {"kelvins", 4},
+    {"water_60f", 172},
+    {"angular_degrees", 33},
+    {"conventional_water", 170},
+    {"astronomical\302\240units", 41},
+    {"liquid\302\240cups", 134},
+    {"electron\240volts", 39},
+    {"international\302\240yards", 102},
+    {"radian", 7},
+    {"abhenry", 230},
+    {"unit\302\240pole", 249},
+    {"liquid\240pint", 133},
+    {"atomic_mass_units", 40},
+    {"bushels", 121},
+    {"lunar\302\240month", 154},
+    {"appounds", 82},
+    {"nucs", 275},
+    {"refrigeration\240tons", 220},
+    {"stathenries", 245},
+    {"printers\302\240points", 91},
+    {"degrees\302\240west", 66},
+    {"tropical_years", 153},
+    {"becquerels", 9},
+    {"angular_minute", 34},
+    {"henry", 22},
+    {"avoirdupois\240pound", 69},
+    {"barns", 49},
+    {"degrees\240north", 33},
+    {"avogadro\302\240constant", 58},
+    {"mercury\2400c", 173},
+    {"common_year", 155},
+    {"arpentlins", 106},
+    {"us_dry_gallons", 124},
+    {"einstein", 5},
+    {"force\302\240pound", 179},
+    {"degree_north", 33},
+    {"barie", 195},
+    {"avogadro\240constant", 58},
+    {"circular\240mils", 116},
+    {"joules", 13},
+    {"troy\302\240pound", 77},
+    {"bauds", 9},
+    {"chemical\302\240faradays", 235},
+    {"sidereal\240hour", 149},
+    {"international\240foot", 101},
+    {"lunar\240month", 154},
+    {"leap\302\240year", 156},
+    {"force_gram", 176},
+    {"degrees\240fahrenheit", 256},
+    {"troy_pounds", 77},
+    {"unit\240poles", 249},
+    {"tex", 112},
+    {"degree\240north", 33},
+    {"feet_h2o", 188},
+    {"sidereal_seconds", 151},
+    {"degrees\240r", 255},
+    {"gram", 10},
+    {"conventional\302\240water", 170},
+    {"julian\302\240years", 157},
+    {"nucleon", 275},
+    {"pennyweights", 73},
+    {"us\240therms", 211},
+    {"technical_atmosphere", 184},
+    {"degrees_t", 33},
+    {"degree\302\240west", 66},
+    {"pis", 32},
+    {"angular\302\240minutes", 34},
+    {"degree", 33},
+    {"gallons", 129},
+    {"statmho", 246},
+    {"register\302\240ton", 126},
+    {"electron\240volt", 39},
+    {"us\240liquid\240quarts", 132},
+    {"inch_hg_60f", 192},
+    {"arc\240minute", 34},
+    {"barleycorns", 105},
+    {"uk\240fluid\240ounce", 144},
+    {"unified\302\240atomic\302\240mass\302\240units", 40},
+    {"statcoulomb", 243},
+    {"degrees_n", 33},
+    {"lunar\240months", 154},
+    {"tropical\240year", 153},
+    {"inches\302\240hg", 191},
+    {"grams", 10},
+    {"chemical\240faradays", 235},
+    {"dynamic", 168},
+    {"electron\302\240volt", 39},
+    {"gamma", 238},
+    {"c12\302\240faradays", 237},
+    {"uk\302\240liquid\302\240ounces", 144},
+    {"perm\302\24023c", 115},
+    {"feet_water", 188},
+    {"c12\302\240faraday", 237},
+    {"angular\302\240degree", 33},
+    {"c12\240faradays", 237},
+    {"tropical_month", 160},
+    {"us\302\240fluid\302\240ounces", 136},
+    {"cycles", 65},
+    {"metric\240horsepower", 216},
+    {"feet\302\240water", 188},
+    {"uk_liquid_gallon", 123},
+    {"statvolts", 248},
+    {"long_tons", 85},
+    {"degc", 23},
+    {"electric\302\240horsepowers", 217},
+    {"steres", 36},
+    {"it\240btu", 205},
+    {"waters", 170},
+    {"electronvolts", 39},
+    {"astronomical\240units", 41},
+    {"international\240inches", 100},
+    {"board\240foot", 120},
+    {"register\240tons", 126},
+    {"uk_liquid_quarts", 140},
+    {"stere", 36},
+    {"circular\302\240mil", 116},
+    {"unit_pole", 249},
+    {"us_survey_yards", 95},
+    {"apdrams", 79},
+    {"arc\302\240second", 35},
+    {"ton\302\240of\302\240refrigeration", 220},
+    {"foot\240water", 188},
+    {"troy_ounces", 76},
+    {"barleycorn", 105},
+    {"technical\302\240atmospheres", 184},
+    {"dry\302\240quarts", 127},
+    {"perms_23c", 115},
+    {"sidereal\302\240month", 159},
+    {"uk\302\240liquid\302\240quart", 140},
+    {"firkin", 131},
+    {"assay\302\240tons", 67},
+    {"uk\240liquid\240ounces", 144},
+    {"physical\302\240faradays", 236},
+    {"standard\302\240atmospheres", 183},
+    {"water\240horsepowers", 218},
+    {"liquid_ounce", 136},
+    {"common_years", 155},
+    {"metric\302\240tons", 38},
+    {"apostilb", 265},
+    {"millimeters\302\240hg", 190},
+    {"oersted", 242},
+    {"standard\302\240free\302\240fall", 168},
+    {"inches_hg_60f", 192},
+    {"degree_w", 66},
+    {"cup", 134},
+    {"astronomical_unit", 41},
+    {"leap_year", 156},
+    {"sidereal\240month", 159},
+    {"uk\302\240liquid\302\240cup", 142},
+    {"uk\302\240fluid\302\240ounce", 144},
+    {"tablespoons", 137},
+    {"gravities", 168},
+    {"dram", 80},
+    {"apothecary\302\240pounds", 77},
+    {"arcminutes", 34},
+    {"assay\240ton", 67},
+    {"degree\240rankine", 255},
+    {"metric\302\240horsepower", 216},
+    {"apothecary\240ounce", 76},
+    {"pecks", 122},
+    {"roentgen", 55},
+    {"arc\302\240minutes", 34},
+    {"dry_quarts", 127},
+    {"barrels", 130},
+    {"becquerel", 9},
+    {"us\302\240liquid\302\240quarts", 132},
+    {"liquid_gill", 135},
+    {"inch\302\240hg\302\24032f", 191},
+    {"uk\240liquid\240gill", 143},
+    {"uk\302\240liquid\302\240pints", 141},
+    {"arc\302\240degree", 33},
+    {"conventional\240mercury", 173},
+    {"gregorian_year", 158},
+    {"gilberts", 227},
+    {"metres", 0},
+    {"gravity", 168},
+    {"board_foot", 120},
+    {"standard_free_fall", 168},
+    {"degreesn", 33},
+    {"eon", 164},
+    {"ounces\302\240force", 178},
+    {"troy\302\240pounds", 77},
+    {"degree\240true", 33},
+    {"degrees\302\240fahrenheit", 256},
+    {"picas", 93},
+    {"angular_seconds", 35},
+    {"us\302\240survey\302\240feet", 94},
+    {"standard_atmosphere", 183},
+    {"liquid\240ounces", 136},
+    {"degree\240k", 4},
+    {"force\302\240ton", 181},
+    {"sidereal_months", 159},
+    {"us\302\240survey\302\240foot", 94},
+    {"lunar\302\240months", 154},
+    {"long\240tons", 85},
+    {"pounds\302\240force", 179},
+    {"degree_c", 23},
+    {"abmho", 231},
+    {"gray", 27},
+    {"degk", 4},
+    {"sidereal\240year", 152},
+    {"avogadro\240constants", 58},
+    {"waters_4c", 171},
+    {"shaft\240horsepowers", 215},
+    {"international\302\240knots", 44},
+    {"nit", 258},
+    {"us_liquid_pints", 133},
+    {"texes", 112},
+    {"mercury\302\24032f", 173},
+    {"short_tons", 84},
+    {"force_kilograms", 177},
+    {"board_feet", 120},
+    {"uk_liquid_cup", 142},
+    {"blondels", 265},
+    {"us\302\240dry\302\240quart", 127},
+    {"statfarad", 244},
+    {"short\240ton", 84},
+    {"refrigeration_ton", 220},
+    {"us\240survey\240miles", 96},
+    {"degs\240k", 4},
+    {"jiffy", 163},
+    {"conventional\302\240mercury", 173},
+    {"uk\240liquid\240cup", 142},
+    {"mercury\302\24060f", 174},
+    {"waters\24060f", 172},
+    {"appound", 82},
+    {"therm", 211},
+    {"uk\240fluid\240ounces", 144},
+    {"standard\240atmosphere", 183},
+    {"inch\302\240hg", 191},
+    {"degree_kelvin", 4},
+    {"degree_celsius", 23},
+    {"degs\240r", 255},
+    {"degree\240kelvin", 4},
+    {"year", 153},
+    {"inch_hg", 191},
+    {"degree_east", 33},
+    {"angular\240minute", 34},
+    {"international\302\240foot", 101},
+    {"electric_horsepower", 217},
+    {"metric_ton", 38},
+    {"water", 170},
+    {"sievert", 27},
+    {"statohms", 247},
+    {"us\240survey\240yards", 95},
+    {"force\240grams", 176},
+    {"degrees\240e", 33},
+    {"degree\302\240kelvin", 4},
+    {"degsc", 23},
+    {"lunar_months", 154},
+    {"arcsecond", 35},
+    {"sidereal\302\240years", 152},
+    {"degrees\240f", 256},
+    {"electron_volt", 39},
+    {"ec\302\240therm", 206},
+    {"electric\302\240horsepower", 217},
+    {"perms\24023c", 115},
+    {"bits", 31},
+    {"foot", 101},
+    {"metric\240ton", 38},
+    {"molecules", 275},
+    {"inches_hg_32f", 191},
+    {"degrees\240kelvin", 4},
+    {"rotation", 65},
+    {"carats", 70},
+    {"molec", 275},
+    {"degrees\302\240r", 255},
+    {"einsteins", 5},
+    {"tons_force", 181},
+    {"millimeter\240hg\2400c", 190},
+    {"knot_international", 44},
+    {"us_statute_miles", 96},
+    {"liter", 37},
+    {"standard\240atmospheres", 183},
+    {"farad", 17},
+    {"calories", 208},
+    {"international\240miles", 103},
+    {"electric\240horsepower", 217},
+    {"long_hundredweight", 72},
+    {"work_year", 268},
+    {"uk\302\240liquid\302\240gills", 143},
+    {"pound", 69},
+    {"acre\240feet", 119},
+    {"metric\240tons", 38},
+    {"us\240liquid\240gills", 135},
+    {"liquid\302\240gill", 135},
+    {"assay\240tons", 67},
+    {"mercuries\24060f", 174},
+    {"atmosphere", 183},
+    {"inch\302\240hg\302\24060f", 192},
+    {"us\240therm", 211},
+    {"inches\240h2o\24060f", 187},
+    {"refrigeration_tons", 220},
+    {"arcsec", 35},
+    {"liquid\240pints", 133},
+    {"amu", 40},
+    {"tropical\302\240month", 160},
+    {"common\240year", 155},
+    {"arc_second", 35},
+    {"liquid_cups", 134},
+    {"fluid_ounce", 136},
+    {"international\302\240feet", 101},
+    {"statfarads", 244},
+    {"inches\240hg\24032f", 191},
+    {"us\302\240liquid\302\240pints", 133},
+    {"boiler\240horsepowers", 214},
+    {"mercuries\302\2400c", 173},
+    {"water\302\24060f", 172},
+    {"water_horsepower", 218},
+    {"volts", 16},
+    {"it\240calorie", 208},
+    {"international\240feet", 101},
+    {"light\240year", 87},
+    {"degrees_true", 33},
+    {"gilbert", 227},
+    {"us\240liquid\240ounce", 136},
+    {"assay_ton", 67},
+    {"us_therm", 211},
+    {"us\302\240liquid\302\240gallon", 129},
+    {"degree\302\240rankine", 255},
+    {"liquid\302\240pints", 133},
+    {"us\240liquid\240ounces", 136},
+    {"degrees\302\240c", 23},
+    {"liquid_pint", 133},
+    {"degree\240f", 256},
+    {"uk\302\240horsepowers", 219},
+    {"c12_faradays", 237},
+    {"uk\302\240liquid\302\240ounce", 144},
+    {"baryes", 195},
+    {"degree_e", 33},
+    {"light\302\240year", 87},
+    {"international_knot", 44},
+    {"sverdrups", 167},
+    {"steradians", 8},
+    {"ohms", 18},
+    {"us\302\240liquid\302\240gallons", 129},
+    {"grain", 71},
+    {"maxwells", 240},
+    {"ares", 47},
+    {"hectares", 48},
+    {"avogadro_constant", 58},
+    {"force_kilogram", 177},
+    {"btu", 205},
+    {"shaft\302\240horsepower", 215},
+    {"tons\240of\240refrigeration", 220},
+    {"boiler\302\240horsepower", 214},
+    {"mil", 89},
+    {"ton\302\240tnt", 210},
+    {"degs\240c", 23},
+    {"international\302\240inches", 100},
+    {"degree\302\240t", 33},
+    {"degsf", 256},
+    {"dry\240pint", 128},
+    {"board\302\240foot", 120},
+    {"lumens", 24},
+    {"coulomb", 15},
+    {"deg_r", 255},
+    {"force_pound", 179},
+    {"kilogram\302\240force", 177},
+    {"celsius", 23},
+    {"second", 2},
+    {"inches\240hg", 191},
+    {"ton_tnt", 210},
+    {"us\302\240liquid\302\240gill", 135},
+    {"conventional\240water", 170},
+    {"degrees_kelvin", 4},
+    {"foot_water", 188},
+    {"ton\240force", 181},
+    {"international\240yards", 102},
+    {"tropical\240months", 160},
+    {"barye", 195},
+    {"tesla", 21},
+    {"boiler_horsepower", 214},
+    {"water\302\240horsepowers", 218},
+    {"tropical\302\240year", 153},
+    {"sidereal_hours", 149},
+    {"big\302\240point", 104},
+    {"tropical\302\240months", 160},
+    {"sidereal\240minute", 150},
+    {"c12_faraday", 237},
+    {"atomic\302\240mass\302\240unit", 40},
+    {"us\302\240therms", 211},
+    {"deniers", 111},
+    {"metric\302\240ton", 38},
+    {"force\302\240tons", 181},
+    {"sidereal_day", 148},
+    {"fluid\302\240dram", 138},
+    {"us\240liquid\240quart", 132},
+    {"pound\240force", 179},
+    {"turns", 65},
+    {"deg\240r", 255},
+    {"sidereal_days", 148},
+    {"julian\302\240year", 157},
+    {"angstrom", 45},
+    {"denier", 111},
+    {"pound_force", 179},
+    {"bag", 83},
+    {"common\302\240years", 155},
+    {"bytes", 272},
+    {"astronomical\302\240unit", 41},
+    {"gregorian\302\240years", 158},
+    {"water\302\2404c", 171},
+    {"grains", 71},
+    {"standard_atmospheres", 183},
+    {"force\240kilograms", 177},
+    {"apostilbs", 265},
+    {"degreesk", 4},
+    {"fortnight", 161},
+    {"degs\302\240r", 255},
+    {"standard\240free\240fall", 168},
+    {"footcandle", 257},
+    {"watthour", 212},
+    {"webers", 20},
+    {"steradian", 8},
+    {"katals", 26},
+    {"perm_23c", 115},
+    {"degs_f", 256},
+    {"byte", 272},
+    {"pints", 133},
+    {"lambert", 260},
+    {"liquid_gallons", 129},
+    {"physical\240faraday", 236},
+    {"fluid\302\240ounce", 136},
+    {"us_dry_pint", 128},
+    {"degrees\240true", 33},
+    {"degrees\240k", 4},
+    {"torrs", 190},
+    {"physical_faradays", 236},
+    {"water\2404c", 171},
+    {"force\240pound", 179},
+    {"perms\302\24023c", 115},
+    {"unified\240atomic\240mass\240unit", 40},
+    {"uk_liquid_ounces", 144},
+    {"stokeses", 201},
+    {"thermochemical_calorie", 207},
+    {"register\302\240tons", 126},
+    {"avoirdupois_pound", 69},
+    {"degrees\302\240celsius", 23},
+    {"liquid\302\240ounces", 136},
+    {"international\302\240mile", 103},
+    {"us\240dry\240pint", 128},
+    {"work\240years", 268},
+    {"nautical\240miles", 42},
+    {"deg_k", 4},
+    {"us_therms", 211},
+    {"us\302\240statute\302\240mile", 96},
+    {"amp", 3},
+    {"uk\302\240liquid\302\240gallon", 123},
+    {"liquid_gallon", 129},
+    {"statvolt", 248},
+    {"dry_pint", 128},
+    {"us\240fluid\240ounce", 136},
+    {"arpentlin", 106},
+    {"degree\302\240w", 66},
+    {"printers\240points", 91},
+    {"atomic\240mass\240units", 40},
+    {"uk\240liquid\240gallons", 123},
+    {"ec_therms", 206},
+    {"miles", 103},
+    {"slugs", 75},
+    {"degrees\240west", 66},
+    {"gram\240force", 176},
+    {"newton", 11},
+    {"uk\240liquid\240pints", 141},
+    {"sidereal\302\240hours", 149},
+    {"short\240hundredweights", 74},
+    {"nuc", 275},
+    {"atomicmassunits", 40},
+    {"sidereal\240years", 152},
+    {"degree\302\240true", 33},
+    {"uk\240horsepower", 219},
+    {"force_pounds", 179},
+    {"angular\240degrees", 33},
+    {"pica", 93},
+    {"water\24039f", 171},
+    {"us_survey_yard", 95},
+    {"nautical_mile", 42},
+    {"atomic_mass_unit", 40},
+    {"degreec", 23},
+    {"potential\302\240vorticity\302\240units", 271},
+    {"ergs", 204},
+    {"revolutions", 65},
+    {"calorie", 208},
+    {"it_calorie", 208},
+    {"long\302\240hundredweights", 72},
+    {"degrees\302\240e", 33},
+    {"force\302\240grams", 176},
+    {"liquid\302\240gallon", 129},
+    {"avoirdupois\302\240ounce", 68},
+    {"feet\302\240h2o", 188},
+    {"us\302\240liquid\302\240ounces", 136},
+    {"canadian\240liquid\240gallons", 123},
+    {"long\302\240tons", 85},
+    {"conventional_mercury", 173},
+    {"arcdeg", 33},
+    {"chains", 92},
+    {"circular\240mil", 116},
+    {"poles", 97},
+    {"ec\302\240therms", 206},
+    {"degree_fahrenheit", 256},
+    {"force_tons", 181},
+    {"abohms", 232},
+    {"secs", 2},
+    {"poundal", 180},
+    {"big_point", 104},
+    {"geopotential", 168},
+    {"ton_force", 181},
+    {"tropical\302\240years", 153},
+    {"register\240ton", 126},
+    {"waters_39f", 171},
+    {"degree_k", 4},
+    {"clos", 225},
+    {"work\240year", 268},
+    {"knot", 44},
+    {"international\302\240miles", 103},
+    {"tropical\240month", 160},
+    {"us\240survey\240foot", 94},
+    {"newtons", 11},
+    {"force_grams", 176},
+    {"geopotentials", 168},
+    {"gals", 52},
+    {"tons\302\240tnt", 210},
+    {"us\302\240dry\302\240pint", 128},
+    {"shake", 147},
+    {"degrees\302\240north", 33},
+    {"degrees", 33},
+    {"light_year", 87},
+    {"thermochemical\302\240calories", 207},
+    {"short_ton", 84},
+    {"us\302\240liquid\302\240cup", 134},
+    {"pint", 133},
+    {"water\24060f", 172},
+    {"teslas", 21},
+    {"liquid_quarts", 132},
+    {"pennyweight", 73},
+    {"troy\240pound", 77},
+    {"celsiuses", 23},
+    {"international_knots", 44},
+    {"apothecary\240pounds", 77},
+    {"knot\302\240international", 44},
+    {"hour", 29},
+    {"radians", 7},
+    {"ponds", 176},
+    {"statohm", 247},
+    {"international\240knots", 44},
+    {"apothecary\240ounces", 76},
+    {"parsecs", 90},
+    {"watt", 14},
+    {"feet\240h2o", 188},
+    {"degree\240fahrenheit", 256},
+    {"cups", 134},
+    {"conventional\240waters", 170},
+    {"it\302\240btu", 205},
+    {"us_liquid_gallon", 129},
+    {"it_btus", 205},
+    {"grams\302\240force", 176},
+    {"degrees\302\240true", 33},
+    {"furlongs", 98},
+    {"dobson", 274},
+    {"degree\240west", 66},
+    {"sidereal\240seconds", 151},
+    {"unified\302\240atomic\302\240mass\302\240unit", 40},
+    {"leap\302\240years", 156},
+    {"physical\302\240faraday", 236},
+    {"us\240liquid\240gallon", 129},
+    {"arc_minute", 34},
+    {"degrees\302\240n", 33},
+    {"\303\245ngstr\303\266ms", 45},
+    {"perm\24023c", 115},
+    {"standard\240free\240falls", 168},
+    {"inch_h2o_60f", 187},
+    {"degreest", 33},
+    {"short\240hundredweight", 74},
+    {"printers_picas", 93},
+    {"jiffies", 163},
+    {"maxwell", 240},
+    {"biots", 226},
+    {"us_liquid_gill", 135},
+    {"tons\302\240force", 181},
+    {"tons\240force", 181},
+    {"acre\240foot", 119},
+    {"degreek", 4},
+    {"degrees\240celsius", 23},
+    {"international\302\240knot", 44},
+    {"degrees_fahrenheit", 256},
+    {"foot\302\240h2o", 188},
+    {"litre", 37},
+    {"leap\240year", 156},
+    {"fluid\240ounce", 136},
+    {"tropical_months", 160},
+    {"thermochemical\240calorie", 207},
+    {"ounce_force", 178},
+    {"apothecary\302\240ounces", 76},
+    {"inch\302\240h2o\302\24060f", 187},
+    {"are", 47},
+    {"water_39f", 171},
+    {"degsk", 4},
+    {"degree_n", 33},
+    {"international\240inch", 100},
+    {"abhenries", 230},
+    {"inch\240h2o\24039f", 186},
+    {"tons_of_refrigeration", 220},
+    {"julian\240year", 157},
+    {"inches", 100},
+    {"teaspoons", 139},
+    {"avoirdupois\240ounce", 68},
+    {"us\302\240dry\302\240gallon", 124},
+    {"it\302\240calorie", 208},
+    {"degrees_celsius", 23},
+    {"chemical\302\240faraday", 235},
+    {"footh2o", 188},
+    {"technical_atmospheres", 184},
+    {"poundals", 180},
+    {"us\240liquid\240gill", 135},
+    {"degree\302\240celsius", 23},
+    {"liquid\240gill", 135},
+    {"nits", 258},
+    {"us_survey_feet", 94},
+    {"us_dry_gallon", 124},
+    {"scruple", 78},
+    {"gammas", 238},
+    {"millimeters_hg", 190},
+    {"international_mile", 103},
+    {"us_fluid_ounces", 136},
+    {"troy_pound", 77},
+    {"mercury_0c", 173},
+    {"force_ton", 181},
+    {"degree\240celsius", 23},
+    {"parsec", 90},
+    {"bushel", 121},
+    {"poises", 199},
+    {"thermochemical\302\240calorie", 207},
+    {"sidereal_hour", 149},
+    {"uk_horsepower", 219},
+    {"degs_r", 255},
+    {"arc\240degrees", 33},
+    {"micron", 88},
+    {"rems", 56},
+    {"shaft\302\240horsepowers", 215},
+    {"perm_0c", 114},
+    {"feeth2o", 188},
+    {"pole", 97},
+    {"abmhos", 231},
+    {"board\302\240feet", 120},
+    {"printers\240picas", 93},
+    {"deg\240c", 23},
+    {"mercuries_32f", 173},
+    {"sidereal\240second", 151},
+    {"inches\240hg\24060f", 192},
+    {"degree_r", 255},
+    {"us\240dry\240gallons", 124},
+    {"inch\240hg", 191},
+    {"short\302\240hundredweight", 74},
+    {"ounces\240force", 178},
+    {"ounce\240force", 178},
+    {"fluid_ounces", 136},
+    {"uk\302\240liquid\302\240quarts", 140},
+    {"uk\302\240liquid\302\240gallons", 123},
+    {"troy\240ounce", 76},
+    {"shaft_horsepower", 215},
+    {"nautical\302\240mile", 42},
+    {"watts", 14},
+    {"degree\240c", 23},
+    {"degree\302\240k", 4},
+    {"minutes", 28},
+    {"degrees\240c", 23},
+    {"us\240liquid\240cup", 134},
+    {"degree_west", 66},
+    {"mils", 89},
+    {"degreesf", 256},
+    {"horsepowers", 215},
+    {"fortnights", 161},
+    {"ec_therm", 206},
+    {"big\240point", 104},
+    {"work\240months", 269},
+    {"sidereal_minute", 150},
+    {"conventional\240mercuries", 173},
+    {"erg", 204},
+    {"short\302\240ton", 84},
+    {"candelas", 6},
+    {"abvolts", 233},
+    {"ounces_force", 178},
+    {"abfarad", 229},
+    {"arc\240second", 35},
+    {"deg\302\240k", 4},
+    {"kayser", 267},
+    {"us_survey_foot", 94},
+    {"us\240liquid\240gallons", 129},
+    {"blondel", 265},
+    {"uk_horsepowers", 219},
+    {"carat", 70},
+    {"us\240survey\240yard", 95},
+    {"water\302\240horsepower", 218},
+    {"big\302\240points", 104},
+    {"atomicmassunit", 40},
+    {"millimeter\302\240hg", 190},
+    {"conventional\302\240mercuries", 173},
+    {"kip", 182},
+    {"apothecary_ounces", 76},
+    {"inches_h2o_39f", 186},
+    {"litres", 37},
+    {"angstroms", 45},
+    {"sidereal\240months", 159},
+    {"international\302\240yard", 102},
+    {"canadian_liquid_gallons", 123},
+    {"liquid_cup", 134},
+    {"tonnes", 38},
+    {"force_ounce", 178},
+    {"mercuries\24032f", 173},
+    {"forces", 168},
+    {"perm\302\2400c", 114},
+    {"nucleons", 275},
+    {"deg\240f", 256},
+    {"mole", 5},
+    {"apothecary_pound", 77},
+    {"degree_true", 33},
+    {"us\240statute\240miles", 96},
+    {"potential\240vorticity\240units", 271},
+    {"grade", 64},
+    {"short_hundredweight", 74},
+    {"ton", 84},
+    {"degree\302\240north", 33},
+    {"sidereal\240minutes", 150},
+    {"us\302\240survey\302\240mile", 96},
+    {"rhe", 203},
+    {"metric\302\240horsepowers", 216},
+    {"gauss", 239},
+    {"shaft_horsepowers", 215},
+    {"baud", 9},
+    {"foot\240h2o", 188},
+    {"degrees\302\240rankine", 255},
+    {"scruples", 78},
+    {"long_hundredweights", 72},
+    {"avoirdupois\302\240pounds", 69},
+    {"boiler\302\240horsepowers", 214},
+    {"rotation_per_second", 108},
+    {"troy\240pounds", 77},
+    {"liquid_gills", 135},
+    {"gills", 135},
+    {"millimeters\240hg\2400c", 190},
+    {"yard", 102},
+    {"abfarads", 229},
+    {"it\240btus", 205},
+    {"acre", 118},
+    {"peck", 122},
+    {"darcies", 117},
+    {"international_foot", 101},
+    {"degrees_e", 33},
+    {"rotation\302\240per\302\240second", 108},
+    {"ton\240of\240refrigeration", 220},
+    {"fluid\240ounces", 136},
+    {"canadian\302\240liquid\302\240gallon", 123},
+    {"months", 165},
+    {"us_fluid_ounce", 136},
+    {"degs\302\240k", 4},
+    {"nautical\240mile", 42},
+    {"arcdegs", 33},
+    {"statmhos", 246},
+    {"it_calories", 208},
+    {"degrees_west", 66},
+    {"us_liquid_ounce", 136},
+    {"arc\240minutes", 34},
+    {"gregorian\302\240year", 158},
+    {"inches_hg", 191},
+    {"mercury\24032f", 173},
+    {"uk\240liquid\240quart", 140},
+    {"force\240kilogram", 177},
+    {"lumen", 24},
+    {"liquid\302\240gills", 135},
+    {"uk_fluid_ounces", 144},
+    {"clo", 225},
+    {"degrees\240w", 66},
+    {"ohm", 18},
+    {"inch\240h2o\24060f", 187},
+    {"apothecary\302\240ounce", 76},
+    {"electron\302\240volts", 39},
+    {"work_months", 269},
+    {"avoirdupois\302\240ounces", 68},
+    {"phots", 262},
+    {"oersteds", 242},
+    {"sidereal\240day", 148},
+    {"force\240tons", 181},
+    {"us\302\240survey\302\240miles", 96},
+    {"boiler\240horsepower", 214},
+    {"count", 31},
+    {"uk_liquid_gill", 143},
+    {"perm\2400c", 114},
+    {"acres", 118},
+    {"curies", 53},
+    {"uk\240liquid\240gills", 143},
+    {"it\302\240calories", 208},
+    {"us\240liquid\240cups", 134},
+    {"arc_degrees", 33},
+    {"sidereal_years", 152},
+    {"sidereal\302\240day", 148},
+    {"potential_vorticity_unit", 271},
+    {"degrees\302\240k", 4},
+    {"inches\302\240hg\302\24060f", 192},
+    {"astronomical\240unit", 41},
+    {"sidereal\302\240minute", 150},
+    {"us\240fluid\240ounces", 136},
+    {"ton\302\240force", 181},
+    {"perms\2400c", 114},
+    {"millimeter_hg_0c", 190},
+    {"deg\302\240r", 255},
+    {"degrees_r", 255},
+    {"uk_liquid_gills", 143},
+    {"degsr", 255},
+    {"degrees_c", 23},
+    {"us\240liquid\240pint", 133},
+    {"assay\302\240ton", 67},
+    {"arcmin", 34},
+    {"fluid\240dram", 138},
+    {"shaft\240horsepower", 215},
+    {"waters\302\2404c", 171},
+    {"us_statute_mile", 96},
+    {NULL, -1}
+};
+
+static const int namesDisplacements[] = {
+    187, 0, 45, 25, 5, 235, 2, 3, -176, 668,
+    2, -210, 1, -217, 23, 3, -256, 32, -329, -378,
+    2, 10, 2, 8, 386, 73, 0, 4, 20, 0,
+    19, 18, 591, 344, 66, 12, 0, 0, 0, 20,
+    18, 1, 0, 30, 249, 91, 307, 12, 34, 7,
+    1, 19, 57, 1, 2, 1, 463, 2, 0, 27,
+    333, 3, 3, 30, 12, 54, 8, 205, 23, 0,
+    0, 222, 1, 74, -458, 189, 0, 10, 0, 13,
+    1, 46, 152, 6, 258, 58, 103, 0, 514, 71,
+    -555, 0, 9, 578, -617, 187, 5, 778, 19, 2,
+    -730, 48, 460, 179, 26, -755, 57, 13, 4, 207,
+    780, 0, 3, 2, 30, 32, 21, 15, 0, 10,
+    28, 0, 21, 9, 558, 0, 145, 2, -780, -790,
+    109, 271, 170, 5, 41, 12, 32, 0, 44, 0,
+    0, 231, 1146, 143, 219, 5, 1, -942, 158, 187,
+    1, 301, 58, 86, -982, 86, 276, 0, 7, 0,
+    214, 73, 150, 43, -1036, 31, 561, 2, 49, 0,
+    -1038, 0, 96, 6, 2, -1059, 265, 204, 40, 481,
+    135, 306, 5, 0, 0, 451, 13, 317, 320, 846,
+    152, 302, 147, 303, 0, 144, 1, 24, 232, 109,
+    548, 259, 6, 79, 719, 292, 1, 2, 1, 47,
+    -1060, 58, 4, 2, 88, 4, 0, 157, 34, 8,
+    546, 1, 308, 3, 0, 19, 371, 75, -1144, 339,
+    1, 2, 2, 1, 713, 1216, 498, 3, 298, 919,
+    0, 46, 4, 721, 225, 27, 23, 58, 836, 5,
+    4, 313, 535, 66, 144, 36, 231, 35, 33, 21,
+    11, -1151, 882, 3, 23, 624, 73, 380, 14, 69,
+    543, 81, 17, 2, 0, 0, 207, 25, 7, 54,
+    262, 43, 17, 9, 23, -1188, 209, -1222, 4, 64,
+    2575, 69, 440, 5724, -1233, 222, 4047, -1266, 1499, -1326,
+    86, 1106, 1391, 5, 310, 12, 1, 1193, 9, 1,
+    12, 24, 6, 2952, 3, 4, 10166, 39, 21, 2797,
+    2, 3098, 156, 30, 3772, 14, 0, 391, 386, 109,
+    656, 24, 995, 10, 1486, 105, 0, 82,
+};
+
+static const BundledId symbols[] = {
+    {"mi", 103},
+    {"B\302\240SPL", 197},
+    {"\342\204\203", 23},
+    {"\342\200\263", 35},
+    {"\260C", 23},
+    {"\342\204\211", 256},
+    {"d", 30},
+    {"cm\302\240Hg", 189},
+    {"J", 13},
+    {"B_SPL", 197},
+    {"lx", 25},
+    {"bev", 213},
+    {"%", 59},
+    {"B\265V", 254},
+    {"ppt", 62},
+    {"BZ", 146},
+    {"ksi", 194},
+    {"bbl", 130},
+    {"bu", 121},
+    {"ua", 41},
+    {"Gy", 27},
+    {"Tblsp", 137},
+    {"tbsp", 137},
+    {"cm\302\240H2O", 185},
+    {"in\302\240Hg", 191},
+    {"m", 0},
+    {"cm\240Hg", 189},
+    {"Tbsp", 137},
+    {"l", 37},
+    {"S", 19},
+    {"h2o", 170},
+    {"psi", 193},
+    {"fth2o", 188},
+    {"St", 201},
+    {"'", 34},
+    {"g", 10},
+    {"rps", 108},
+    {"R", 55},
+    {"\302\260", 33},
+    {"ftH2O", 188},
+    {"lb", 69},
+    {"Hz", 9},
+    {"\302\260F", 256},
+    {"\342\204\246", 18},
+    {"cmHg", 189},
+    {"A", 3},
+    {"cm_Hg", 189},
+    {"ppmv", 60},
+    {"nt", 258},
+    {"mm_Hg", 190},
+    {"ppq", 63},
+    {"u", 40},
+    {"floz", 136},
+    {"pk", 122},
+    {"F", 17},
+    {"in_Hg", 191},
+    {"rad", 7},
+    {"gp", 168},
+    {"BV", 250},
+    {"T", 21},
+    {"a", 47},
+    {"K", 4},
+    {"ppbv", 61},
+    {"cm_H2O", 185},
+    {"B\240SPL", 197},
+    {"N", 11},
+    {"ph", 262},
+    {"bps", 9},
+    {"at", 184},
+    {"cm\240H2O", 185},
+    {"cal", 208},
+    {"kt", 44},
+    {"\302\260K", 4},
+    {"kgf", 177},
+    {"inHg", 191},
+    {"tblsp", 137},
+    {"V", 16},
+    {"\342\200\262", 34},
+    {"Ci", 53},
+    {"\342\204\253", 45},
+    {"rpm", 109},
+    {"atm", 183},
+    {"pt", 133},
+    {"gr", 71},
+    {"min", 28},
+    {"ozf", 178},
+    {"H2O", 170},
+    {"Wb", 20},
+    {"Bv", 252},
+    {"lm", 24},
+    {"\260F", 256},
+    {"\260K", 4},
+    {"e", 234},
+    {"h", 29},
+    {"\303\205", 45},
+    {"lbf", 179},
+    {"ft", 101},
+    {"ppqv", 63},
+    {"t", 38},
+    {"s", 2},
+    {"in\240Hg", 191},
+    {"pptv", 62},
+    {"ppm", 60},
+    {"hp", 215},
+    {"mm\240hg", 190},
+    {"cd", 6},
+    {"Bq", 9},
+    {"sb", 261},
+    {"mm\240Hg", 190},
+    {"\302\260R", 255},
+    {"mmHg", 190},
+    {"mol", 5},
+    {"kg", 1},
+    {"Hg", 173},
+    {"thm", 211},
+    {"kat", 26},
+    {"b", 49},
+    {"mm_hg", 190},
+    {"B\302\265V", 254},
+    {"\305", 45},
+    {"W", 14},
+    {"PVU", 271},
+    {"tsp", 139},
+    {"\260", 33},
+    {"hr", 29},
+    {"VA", 14},
+    {"Pa", 12},
+    {"yd", 102},
+    {"C", 15},
+    {"mm\302\240Hg", 190},
+    {"mmhg", 190},
+    {"yr", 153},
+    {"Tbl", 137},
+    {"dr", 80},
+    {"\042", 35},
+    {"eV", 39},
+    {"ppb", 61},
+    {"\260R", 255},
+    {"\302\260C", 23},
+    {"\316\251", 18},
+    {"cmH2O", 185},
+    {"mm\302\240hg", 190},
+    {"Bd", 9},
+    {"oz", 136},
+    {"Sv", 27},
+    {"cc", 125},
+    {"H", 22},
+    {"cps", 108},
+    {"DU", 274},
+    {"Bm", 223},
+    {"Oe", 242},
+    {"fldr", 138},
+    {"BW", 221},
+    {"\317\200", 32},
+    {"L", 37},
+    {"kts", 44},
+    {"in", 100},
+    {"gf", 176},
+    {"sr", 8},
+    {NULL, -1}
+};
+
+static const int symbolsDisplacements[] = {
+    37, 395, 0, 12, 37, 17, 46, 7, 64, 126,
+    2, -1, 31, -38, 45, 19, 5, 251, -90, 21,
+    3, 338, 2, 38, 0, 183, 0, 62, 1356, -95,
+    1399, 135, 1, 283, 126, 91, 425, 33, 265, 34,
+};
+
+static const BundledUnitId unitNames[] = {
+    {0, UT_ASCII, "meter"},
+    {1, UT_ASCII, "kilogram"},
+    {2, UT_ASCII, "second"},
+    {3, UT_ASCII, "ampere"},
+    {4, UT_ASCII, "kelvin"},
+    {5, UT_ASCII, "mole"},
+    {6, UT_ASCII, "candela"},
+    {7, UT_ASCII, "radian"},
+    {8, UT_ASCII, "steradian"},
+    {9, UT_ASCII, "hertz"},
+    {10, UT_ASCII, "gram"},
+    {11, UT_ASCII, "newton"},
+    {12, UT_ASCII, "pascal"},
+    {13, UT_ASCII, "joule"},
+    {14, UT_ASCII, "watt"},
+    {15, UT_ASCII, "coulomb"},
+    {16, UT_ASCII, "volt"},
+    {17, UT_ASCII, "farad"},
+    {18, UT_ASCII, "ohm"},
+    {19, UT_ASCII, "siemens"},
+    {20, UT_ASCII, "weber"},
+    {21, UT_ASCII, "tesla"},
+    {22, UT_ASCII, "henry"},
+    {23, UT_ASCII, "degree_Celsius"},
+    {23, UT_LATIN1, "degree\240Celsius"},
+    {23, UT_UTF8, "degree\302\240Celsius"},
+    {24, UT_ASCII, "lumen"},
+    {25, UT_ASCII, "lux"},
+    {26, UT_ASCII, "katal"},
+    {27, UT_ASCII, "gray"},
+    {28, UT_ASCII, "minute"},
+    {29, UT_ASCII, "hour"},
+    {30, UT_ASCII, "day"},
+    {33, UT_ASCII, "arc_degree"},
+    {33, UT_LATIN1, "arc\240degree"},
+    {33, UT_UTF8, "arc\302\240degree"},
+    {34, UT_ASCII, "arc_minute"},
+    {34, UT_LATIN1, "arc\240minute"},
+    {34, UT_UTF8, "arc\302\240minute"},
+    {35, UT_ASCII, "arc_second"},
+    {35, UT_LATIN1, "arc\240second"},
+    {35, UT_UTF8, "arc\302\240second"},
+    {37, UT_ASCII, "liter"},
+    {38, UT_ASCII, "metric_ton"},
+    {38, UT_LATIN1, "metric\240ton"},
+    {38, UT_UTF8, "metric\302\240ton"},
+    {39, UT_ASCII, "electronvolt"},
+    {40, UT_ASCII, "unified_atomic_mass_unit"},
+    {40, UT_LATIN1, "unified\240atomic\240mass\240unit"},
+    {40, UT_UTF8, "unified\302\240atomic\302\240mass\302\240unit"},
+    {275, UT_ASCII, "molecule"},
+    {-1, UT_ASCII, NULL}
+};
+
+static const BundledUnitId unitSymbols[] = {
+    {0, UT_ASCII, "m"},
+    {1, UT_ASCII, "kg"},
+    {2, UT_ASCII, "s"},
+    {3, UT_ASCII, "A"},
+    {4, UT_ASCII, "K"},
+    {5, UT_ASCII, "mol"},
+    {6, UT_ASCII, "cd"},
+    {7, UT_ASCII, "rad"},
+    {8, UT_ASCII, "sr"},
+    {9, UT_ASCII, "Hz"},
+    {10, UT_ASCII, "g"},
+    {11, UT_ASCII, "N"},
+    {12, UT_ASCII, "Pa"},
+    {13, UT_ASCII, "J"},
+    {14, UT_ASCII, "W"},
+    {15, UT_ASCII, "C"},
+    {16, UT_ASCII, "V"},
+    {17, UT_ASCII, "F"},
+    {18, UT_UTF8, "\316\251"},
+    {19, UT_ASCII, "S"},
+    {20, UT_ASCII, "Wb"},
+    {21, UT_ASCII, "T"},
+    {22, UT_ASCII, "H"},
+    {23, UT_LATIN1, "\260C"},
+    {23, UT_UTF8, "\302\260C"},
+    {24, UT_ASCII, "lm"},
+    {25, UT_ASCII, "lx"},
+    {26, UT_ASCII, "kat"},
+    {27, UT_ASCII, "Gy"},
+    {28, UT_ASCII, "min"},
+    {29, UT_ASCII, "h"},
+    {30, UT_ASCII, "d"},
+    {33, UT_LATIN1, "\260"},
+    {33, UT_UTF8, "\302\260"},
+    {34, UT_ASCII, "'"},
+    {34, UT_UTF8, "\342\200\262"},
+    {35, UT_ASCII, "\042"},
+    {35, UT_UTF8, "\342\200\263"},
+    {37, UT_ASCII, "L"},
+    {38, UT_ASCII, "t"},
+    {39, UT_ASCII, "eV"},
+    {40, UT_ASCII, "u"},
+    {-1, UT_ASCII, NULL}
+};
+
+static const TrieNode trieNodes[] = {
+    {-1, -1, -1, 0}, {2934, -1, 41, 121}, {89, -1, -1, 111}, {4, -1, -1, 116},
+    {5, -1, -1, 116}, {-1, -1, 0, 97}, {-1, -1, 1, 89}, {8, -1, 39, 122},
+    {86, -1, -1, 101}, {10, -1, -1, 116}, {11, -1, -1, 116}, {-1, -1, 2, 97},
+    {-1, -1, 3, 90}, {4104, -1, 1374, 101}, {15, -1, -1, 120}, {-1, -1, 4, 97},
+    {-1, -1, 5, 69}, {4696, -1, 33, 112}, {2094, -1, -1, 101}, {20, -1, -1, 116},
+    {-1, -1, 6, 97}, {5158, -1, 7, 80}, {4198, -1, 215, 116}, {3709, -1, -1, 101},
+    {25, -1, -1, 114}, {-1, -1, 8, 97}, {2609, -1, 9, 84}, {5060, -1, 75, 103},
+    {2494, -1, -1, 105}, {30, -1, -1, 103}, {-1, -1, 10, 97}, {335, -1, 11, 71},
+    {4773, -1, 25, 109}, {3264, -1, -1, 101}, {35, -1, -1, 103}, {-1, -1, 12, 97},
+    {-1, -1, 13, 77}, {4046, -1, 15, 107}, {3665, -1, -1, 105}, {40, -1, -1, 108},
+    {99, -1, 14, 111}, {4342, -1, 17, 104}, {240, -1, -1, 101}, {44, -1, -1, 99},
+    {870, -1, -1, 116}, {-1, -1, 16, 111}, {5174, -1, 21, 100}, {1956, -1, -1, 101},
+    {49, -1, -1, 107}, {-1, -1, 18, 97}, {2024, 47, 19, 97}, {52, 48, -1, 99},
+    {-1, -1, 20, 105}, {4731, -1, 23, 99}, {977, -1, -1, 101}, {56, -1, -1, 110},
+    {57, -1, -1, 116}, {-1, -1, 22, 105}, {342, 33, 634, 105}, {1839, -1, 543, 108},
+    {61, -1, -1, 108}, {3912, -1, 24, 105}, {63, 59, -1, 99}, {64, -1, -1, 114},
+    {1559, -1, 26, 111}, {303, -1, -1, 194}, {-1, -1, 27, 181}, {217, -1, -1, 206},
+    {-1, -1, 28, 188}, {2647, -1, 29, 117}, {5188, -1, 31, 110}, {732, -1, -1, 97},
+    {73, -1, -1, 110}, {-1, -1, 30, 111}, {2440, 18, 146, 105}, {1613, -1, -1, 99},
+    {-1, -1, 32, 111}, {2552, -1, 35, 102}, {1801, -1, -1, 101}, {80, -1, -1, 109},
+    {81, -1, -1, 116}, {-1, -1, 34, 111}, {4611, -1, 37, 97}, {3700, -1, 1150, 116},
+    {85, -1, -1, 116}, {-1, -1, 36, 111}, {87, 9, -1, 112}, {88, -1, -1, 116},
+    {-1, -1, 38, 111}, {90, 3, -1, 99}, {91, -1, -1, 116}, {-1, -1, 40, 111},
+    {96, 34, -1, 116}, {94, -1, -1, 101}, {95, -1, 42, 114}, {-1, -1, 43, 115},
+    {533, 93, -1, 114}, {98, -1, 44, 101}, {-1, -1, 45, 115}, {100, -1, -1, 103},
+    {101, -1, -1, 114}, {102, -1, -1, 97}, {3412, -1, 46, 109}, {3431, -1, 47, 115},
+    {3438, 38, 48, 103}, {5011, -1, 51, 115}, {107, -1, -1, 101}, {900, -1, 298, 99},
+    {109, -1, -1, 111}, {110, -1, -1, 110}, {111, -1, 49, 100}, {-1, -1, 50, 115},
+    {699, 83, -1, 109}, {901, -1, 300, 112}, {115, -1, -1, 101}, {116, -1, -1, 114},
+    {117, -1, 52, 101}, {-1, -1, 53, 115}, {-1, -1, 54, 65}, {120, 104, -1, 101},
+    {121, -1, -1, 108}, {122, -1, -1, 118}, {123, -1, -1, 105}, {124, -1, 55, 110},
+    {-1, -1, 56, 115}, {-1, -1, 57, 75}, {3109, 58, -1, 111}, {128, -1, 60, 108},
+    {5182, -1, 58, 101}, {-1, -1, 59, 115}, {4192, 54, -1, 97}, {2098, -1, -1, 110},
+    {959, -1, -1, 100}, {134, -1, -1, 101}, {135, -1, -1, 108}, {136, -1, 61, 97},
+    {-1, -1, 62, 115}, {-1, 130, 63, 100}, {4078, -1, -1, 114}, {140, -1, -1, 97},
+    {141, -1, 66, 100}, {142, -1, -1, 105}, {143, -1, -1, 97}, {144, -1, 64, 110},
+    {-1, -1, 65, 115}, {5007, 106, -1, 116}, {147, -1, -1, 101}, {2185, -1, -1, 114},
+    {149, -1, -1, 97}, {150, -1, -1, 100}, {151, -1, -1, 105}, {152, -1, -1, 97},
+    {153, -1, 67, 110}, {-1, -1, 68, 115}, {-1, 145, 69, 114}, {156, 43, -1, 114},
+    {157, -1, -1, 116}, {158, -1, 70, 122}, {159, -1, -1, 101}, {-1, -1, 71, 115},
+    {3340, -1, 111, 72}, {-1, -1, 72, 122}, {3029, 28, 465, 114}, {3162, -1, -1, 97},
+    {3573, -1, 73, 109}, {3592, -1, 74, 115}, {167, 71, -1, 101}, {168, -1, -1, 119},
+    {169, -1, -1, 116}, {170, -1, -1, 111}, {171, -1, 76, 110}, {-1, -1, 77, 115},
+    {-1, -1, 78, 78}, {1562, 74, -1, 97}, {175, -1, -1, 115}, {176, -1, -1, 99},
+    {177, -1, -1, 97}, {178, -1, 79, 108}, {-1, -1, 80, 115}, {-1, -1, 81, 97},
+    {3099, -1, -1, 106}, {182, -1, -1, 111}, {183, -1, -1, 117}, {184, -1, -1, 108},
+    {185, -1, 82, 101}, {-1, -1, 83, 115}, {-1, -1, 84, 74}, {5061, -1, -1, 119},
+    {189, -1, -1, 97}, {3201, -1, -1, 116}, {4239, -1, 85, 116}, {-1, -1, 86, 115},
+    {235, -1, 87, 87}, {3169, 137, -1, 111}, {5160, -1, -1, 117}, {196, -1, -1, 108},
+    {197, -1, -1, 111}, {198, -1, -1, 109}, {199, -1, 88, 98}, {-1, -1, 89, 115},
+    {887, -1, 90, 67}, {202, -1, -1, 118}, {203, -1, -1, 111}, {204, -1, -1, 108},
+    {4245, -1, 91, 116}, {-1, -1, 92, 115}, {4252, -1, 93, 86}, {4906, 78, -1, 97},
+    {209, -1, -1, 114}, {210, -1, -1, 97}, {4761, -1, 94, 100}, {-1, -1, 95, 115},
+    {-1, -1, 96, 70}, {5165, -1, -1, 111}, {215, -1, -1, 104}, {216, -1, 97, 109},
+    {-1, -1, 98, 115}, {-1, 68, 99, 169}, {441, -1, -1, 226}, {4905, -1, -1, 132},
+    {-1, -1, 100, 166}, {2812, 154, -1, 105}, {336, -1, -1, 101}, {224, -1, -1, 109},
+    {225, -1, -1, 101}, {226, -1, -1, 110}, {227, -1, 101, 115}, {228, -1, -1, 101},
+    {-1, -1, 102, 115}, {4077, -1, 103, 83}, {3096, 188, -1, 101}, {232, -1, -1, 98},
+    {233, -1, -1, 101}, {234, -1, 104, 114}, {-1, -1, 105, 115}, {-1, -1, 106, 98},
+    {237, 24, -1, 115}, {238, -1, -1, 108}, {239, -1, 107, 97}, {-1, -1, 108, 115},
+    {241, 155, -1, 110}, {243, -1, -1, 114}, {-1, -1, 109, 121}, {244, 242, -1, 105},
+    {245, -1, -1, 101}, {-1, -1, 110, 115}, {4977, 51, -1, 103}, {248, -1, 1442, 114},
+    {249, -1, -1, 101}, {4975, -1, 163, 101}, {4915, -1, -1, 95}, {252, -1, 337, 99},
+    {253, -1, -1, 101}, {254, -1, -1, 108}, {255, -1, -1, 115}, {256, -1, -1, 105},
+    {257, -1, -1, 117}, {-1, -1, 112, 115}, {4925, 250, -1, 160}, {260, -1, 338, 99},
+    {261, -1, -1, 101}, {262, -1, -1, 108}, {263, -1, -1, 115}, {264, -1, -1, 105},
+    {265, -1, -1, 117}, {-1, -1, 113, 115}, {267, 258, -1, 194}, {4935, -1, -1, 160},
+    {269, -1, 339, 99}, {270, -1, -1, 101}, {271, -1, -1, 108}, {272, -1, -1, 115},
+    {273, -1, -1, 105}, {274, -1, -1, 117}, {-1, -1, 114, 115}, {4976, 266, 164, 115},
+    {4945, -1, -1, 95}, {278, -1, 340, 99}, {279, -1, -1, 101}, {280, -1, -1, 108},
+    {281, -1, -1, 115}, {282, -1, -1, 105}, {283, -1, -1, 117}, {-1, -1, 115, 115},
+    {4955, 276, -1, 160}, {286, -1, 341, 99}, {287, -1, -1, 101}, {288, -1, -1, 108},
+    {289, -1, -1, 115}, {290, -1, -1, 105}, {291, -1, -1, 117}, {-1, -1, 116, 115},
+    {293, 284, -1, 194}, {4965, -1, -1, 160}, {295, -1, 342, 99}, {296, -1, -1, 101},
+    {297, -1, -1, 108}, {298, -1, -1, 115}, {299, -1, -1, 105}, {300, -1, -1, 117},
+    {-1, -1, 117, 115}, {4903, -1, 155, 176}, {-1, -1, 118, 67}, {4904, 66, 156, 176},
+    {-1, -1, 119, 67}, {5000, -1, 208, 108}, {2935, -1, -1, 117}, {308, -1, -1, 109},
+    {309, -1, -1, 101}, {310, -1, 120, 110}, {-1, -1, 121, 115}, {-1, 306, 122, 109},
+    {313, 307, 123, 120}, {314, -1, -1, 101}, {-1, -1, 124, 115}, {-1, 311, 125, 120},
+    {5038, 119, -1, 97}, {318, -1, 128, 116}, {319, -1, -1, 97}, {320, -1, 126, 108},
+    {-1, -1, 127, 115}, {5170, -1, 285, 98}, {4244, -1, -1, 101}, {324, -1, -1, 99},
+    {325, -1, -1, 113}, {326, -1, -1, 117}, {327, -1, -1, 101}, {328, -1, -1, 114},
+    {329, -1, -1, 101}, {330, -1, 129, 108}, {-1, -1, 130, 115}, {4846, -1, -1, 66},
+    {-1, -1, 131, 113}, {334, 164, 132, 121}, {-1, -1, 133, 115}, {-1, -1, 134, 121},
+    {337, 223, -1, 118}, {338, -1, -1, 101}, {339, -1, -1, 114}, {340, -1, 135, 116},
+    {-1, -1, 136, 115}, {-1, -1, 137, 118}, {343, 62, 140, 110}, {344, -1, -1, 117},
+    {345, -1, -1, 116}, {346, -1, 138, 101}, {-1, -1, 139, 115}, {4333, 42, -1, 111},
+    {349, -1, -1, 117}, {350, -1, 141, 114}, {-1, -1, 142, 115}, {-1, 347, 143, 114},
+    {353, -1, 144, 121}, {-1, -1, 145, 115}, {-1, 75, 147, 115}, {356, -1, -1, 207},
+    {-1, -1, 148, 128}, {1873, 112, -1, 114}, {516, -1, -1, 99}, {472, -1, -1, 95},
+    {361, -1, -1, 100}, {362, -1, -1, 101}, {363, -1, -1, 103}, {364, -1, -1, 114},
+    {365, -1, -1, 101}, {381, -1, 149, 101}, {478, 359, -1, 160}, {368, -1, -1, 100},
+    {369, -1, -1, 101}, {370, -1, -1, 103}, {371, -1, -1, 114}, {372, -1, -1, 101},
+    {382, -1, 150, 101}, {374, 366, -1, 194}, {484, -1, -1, 160}, {376, -1, -1, 100},
+    {377, -1, -1, 101}, {378, -1, -1, 103}, {379, -1, -1, 114}, {380, -1, -1, 101},
+    {383, -1, 151, 101}, {-1, -1, 152, 115}, {-1, -1, 153, 115}, {-1, -1, 154, 115},
+    {385, 357, -1, 110}, {839, -1, -1, 103}, {387, -1, -1, 117}, {388, -1, -1, 108},
+    {389, -1, -1, 97}, {404, -1, -1, 114}, {495, -1, -1, 95}, {392, -1, -1, 100},
+    {393, -1, -1, 101}, {394, -1, -1, 103}, {395, -1, -1, 114}, {396, -1, -1, 101},
+    {412, -1, 157, 101}, {501, 390, -1, 160}, {399, -1, -1, 100}, {400, -1, -1, 101},
+    {401, -1, -1, 103}, {402, -1, -1, 114}, {403, -1, -1, 101}, {413, -1, 158, 101},
+    {405, 397, -1, 194}, {507, -1, -1, 160}, {407, -1, -1, 100}, {408, -1, -1, 101},
+    {409, -1, -1, 103}, {410, -1, -1, 114}, {411, -1, -1, 101}, {414, -1, 159, 101},
+    {-1, -1, 160, 115}, {-1, -1, 161, 115}, {-1, -1, 162, 115}, {416, 373, -1, 100},
+    {417, -1, -1, 101}, {418, -1, 165, 103}, {-1, -1, 166, 115}, {420, 360, -1, 109},
+    {421, -1, -1, 105}, {422, -1, -1, 110}, {423, -1, -1, 117}, {424, -1, -1, 116},
+    {437, -1, 167, 101}, {426, 367, -1, 109}, {427, -1, -1, 105}, {428, -1, -1, 110},
+    {429, -1, -1, 117}, {430, -1, -1, 116}, {438, -1, 168, 101}, {432, 375, -1, 109},
+    {433, -1, -1, 105}, {434, -1, -1, 110}, {435, -1, -1, 117}, {436, -1, -1, 116},
+    {439, -1, 169, 101}, {-1, -1, 170, 115}, {-1, -1, 171, 115}, {-1, -1, 172, 115},
+    {-1, -1, 173, 39}, {494, 219, -1, 128}, {-1, -1, 174, 178}, {444, 391, -1, 109},
+    {445, -1, -1, 105}, {446, -1, -1, 110}, {447, -1, -1, 117}, {448, -1, -1, 116},
+    {461, -1, 175, 101}, {450, 398, -1, 109}, {451, -1, -1, 105}, {452, -1, -1, 110},
+    {453, -1, -1, 117}, {454, -1, -1, 116}, {462, -1, 176, 101}, {456, 406, -1, 109},
+    {457, -1, -1, 105}, {458, -1, -1, 110}, {459, -1, -1, 117}, {460, -1, -1, 116},
+    {463, -1, 177, 101}, {-1, -1, 178, 115}, {-1, -1, 179, 115}, {-1, -1, 180, 115},
+    {465, 415, -1, 109}, {466, -1, -1, 105}, {471, -1, 183, 110}, {468, -1, -1, 117},
+    {469, -1, -1, 116}, {470, -1, 181, 101}, {-1, -1, 182, 115}, {-1, 467, 184, 115},
+    {473, 419, -1, 115}, {474, -1, -1, 101}, {475, -1, -1, 99}, {476, -1, -1, 111},
+    {477, -1, -1, 110}, {490, -1, 185, 100}, {479, 425, -1, 115}, {480, -1, -1, 101},
+    {481, -1, -1, 99}, {482, -1, -1, 111}, {483, -1, -1, 110}, {491, -1, 186, 100},
+    {485, 431, -1, 115}, {486, -1, -1, 101}, {487, -1, -1, 99}, {488, -1, -1, 111},
+    {489, -1, -1, 110}, {492, -1, 187, 100}, {-1, -1, 188, 115}, {-1, -1, 189, 115},
+    {-1, -1, 190, 115}, {-1, -1, 191, 34}, {-1, 442, 192, 179}, {496, 443, -1, 115},
+    {497, -1, -1, 101}, {498, -1, -1, 99}, {499, -1, -1, 111}, {500, -1, -1, 110},
+    {513, -1, 193, 100}, {502, 449, -1, 115}, {503, -1, -1, 101}, {504, -1, -1, 99},
+    {505, -1, -1, 111}, {506, -1, -1, 110}, {514, -1, 194, 100}, {508, 455, -1, 115},
+    {509, -1, -1, 101}, {510, -1, -1, 99}, {511, -1, -1, 111}, {512, -1, -1, 110},
+    {515, -1, 195, 100}, {-1, -1, 196, 115}, {-1, -1, 197, 115}, {-1, -1, 198, 115},
+    {517, 464, -1, 115}, {518, -1, -1, 101}, {523, -1, 201, 99}, {520, -1, -1, 111},
+    {521, -1, -1, 110}, {522, -1, 199, 100}, {-1, -1, 200, 115}, {-1, 519, 202, 115},
+    {2323, 315, -1, 105}, {530, -1, -1, 116}, {527, -1, -1, 101}, {528, -1, 203, 114},
+    {-1, -1, 204, 115}, {-1, -1, 205, 76}, {531, 526, -1, 114}, {532, -1, 206, 101},
+    {-1, -1, 207, 115}, {534, 97, -1, 105}, {543, -1, -1, 99}, {4343, -1, -1, 95},
+    {537, -1, -1, 116}, {538, -1, -1, 111}, {548, -1, 209, 110}, {4353, 535, -1, 160},
+    {541, -1, -1, 116}, {542, -1, -1, 111}, {549, -1, 210, 110}, {544, 539, -1, 194},
+    {4363, -1, -1, 160}, {546, -1, -1, 116}, {547, -1, -1, 111}, {550, -1, 211, 110},
+    {-1, -1, 212, 115}, {-1, -1, 213, 115}, {-1, -1, 214, 115}, {4008, 23, -1, 111},
+    {3639, -1, 525, 110}, {554, -1, -1, 110}, {555, -1, 216, 101}, {-1, -1, 217, 115},
+    {557, 14, -1, 108}, {558, -1, -1, 101}, {559, -1, -1, 99}, {560, -1, -1, 116},
+    {4376, -1, -1, 114}, {562, -1, -1, 111}, {579, -1, -1, 110}, {564, -1, -1, 118},
+    {565, -1, -1, 111}, {566, -1, -1, 108}, {567, -1, 218, 116}, {-1, -1, 219, 115},
+    {-1, 556, 220, 86}, {570, 563, -1, 95}, {571, -1, -1, 118}, {572, -1, -1, 111},
+    {573, -1, -1, 108}, {585, -1, 221, 116}, {575, 569, -1, 160}, {576, -1, -1, 118},
+    {577, -1, -1, 111}, {578, -1, -1, 108}, {586, -1, 222, 116}, {580, 574, -1, 194},
+    {581, -1, -1, 160}, {582, -1, -1, 118}, {583, -1, -1, 111}, {584, -1, -1, 108},
+    {587, -1, 223, 116}, {-1, -1, 224, 115}, {-1, -1, 225, 115}, {-1, -1, 226, 115},
+    {589, -1, -1, 110}, {4824, -1, -1, 105}, {591, -1, -1, 102}, {592, -1, -1, 105},
+    {593, -1, -1, 101}, {628, -1, -1, 100}, {595, -1, -1, 95}, {596, -1, -1, 97},
+    {597, -1, -1, 116}, {598, -1, -1, 111}, {599, -1, -1, 109}, {600, -1, -1, 105},
+    {601, -1, -1, 99}, {602, -1, -1, 95}, {603, -1, -1, 109}, {604, -1, -1, 97},
+    {605, -1, -1, 115}, {606, -1, -1, 115}, {607, -1, -1, 95}, {608, -1, -1, 117},
+    {609, -1, -1, 110}, {610, -1, -1, 105}, {648, -1, 227, 116}, {612, 594, -1, 160},
+    {613, -1, -1, 97}, {614, -1, -1, 116}, {615, -1, -1, 111}, {616, -1, -1, 109},
+    {617, -1, -1, 105}, {618, -1, -1, 99}, {619, -1, -1, 160}, {620, -1, -1, 109},
+    {621, -1, -1, 97}, {622, -1, -1, 115}, {623, -1, -1, 115}, {624, -1, -1, 160},
+    {625, -1, -1, 117}, {626, -1, -1, 110}, {627, -1, -1, 105}, {649, -1, 228, 116},
+    {629, 611, -1, 194}, {630, -1, -1, 160}, {631, -1, -1, 97}, {632, -1, -1, 116},
+    {633, -1, -1, 111}, {634, -1, -1, 109}, {635, -1, -1, 105}, {636, -1, -1, 99},
+    {637, -1, -1, 194}, {638, -1, -1, 160}, {639, -1, -1, 109}, {640, -1, -1, 97},
+    {641, -1, -1, 115}, {642, -1, -1, 115}, {643, -1, -1, 194}, {644, -1, -1, 160},
+    {645, -1, -1, 117}, {646, -1, -1, 110}, {647, -1, -1, 105}, {650, -1, 229, 116},
+    {-1, -1, 230, 115}, {-1, -1, 231, 115}, {-1, -1, 232, 115}, {652, 84, -1, 111},
+    {653, -1, -1, 109}, {654, -1, -1, 105}, {690, -1, -1, 99}, {656, -1, -1, 95},
+    {657, -1, -1, 109}, {658, -1, -1, 97}, {659, -1, -1, 115}, {660, -1, -1, 115},
+    {661, -1, -1, 95}, {662, -1, -1, 117}, {663, -1, -1, 110}, {664, -1, -1, 105},
+    {687, -1, 233, 116}, {666, 655, -1, 160}, {667, -1, -1, 109}, {668, -1, -1, 97},
+    {669, -1, -1, 115}, {670, -1, -1, 115}, {671, -1, -1, 160}, {672, -1, -1, 117},
+    {673, -1, -1, 110}, {674, -1, -1, 105}, {688, -1, 234, 116}, {676, 665, -1, 194},
+    {677, -1, -1, 160}, {678, -1, -1, 109}, {679, -1, -1, 97}, {680, -1, -1, 115},
+    {681, -1, -1, 115}, {682, -1, -1, 194}, {683, -1, -1, 160}, {684, -1, -1, 117},
+    {685, -1, -1, 110}, {686, -1, -1, 105}, {689, -1, 235, 116}, {-1, -1, 236, 115},
+    {-1, -1, 237, 115}, {-1, -1, 238, 115}, {691, 675, -1, 109}, {692, -1, -1, 97},
+    {693, -1, -1, 115}, {694, -1, -1, 115}, {695, -1, -1, 117}, {696, -1, -1, 110},
+    {697, -1, -1, 105}, {698, -1, 239, 116}, {-1, -1, 240, 115}, {700, 113, 241, 117},
+    {-1, -1, 242, 115}, {1194, 384, -1, 115}, {703, -1, -1, 116}, {704, -1, -1, 114},
+    {705, -1, -1, 111}, {706, -1, -1, 110}, {707, -1, -1, 111}, {708, -1, -1, 109},
+    {709, -1, -1, 105}, {710, -1, -1, 99}, {711, -1, -1, 97}, {722, -1, -1, 108},
+    {713, -1, -1, 95}, {714, -1, -1, 117}, {715, -1, -1, 110}, {716, -1, -1, 105},
+    {728, -1, 243, 116}, {718, 712, -1, 160}, {719, -1, -1, 117}, {720, -1, -1, 110},
+    {721, -1, -1, 105}, {729, -1, 244, 116}, {723, 717, -1, 194}, {724, -1, -1, 160},
+    {725, -1, -1, 117}, {726, -1, -1, 110}, {727, -1, -1, 105}, {730, -1, 245, 116},
+    {-1, -1, 246, 115}, {-1, -1, 247, 115}, {-1, -1, 248, 115}, {-1, 588, 249, 97},
+    {733, 72, -1, 117}, {734, -1, -1, 116}, {735, -1, -1, 105}, {736, -1, -1, 99},
+    {737, -1, -1, 97}, {748, -1, -1, 108}, {739, -1, -1, 95}, {740, -1, -1, 109},
+    {741, -1, -1, 105}, {742, -1, -1, 108}, {754, -1, 250, 101}, {744, 738, -1, 160},
+    {745, -1, -1, 109}, {746, -1, -1, 105}, {747, -1, -1, 108}, {755, -1, 251, 101},
+    {749, 743, -1, 194}, {750, -1, -1, 160}, {751, -1, -1, 109}, {752, -1, -1, 105},
+    {753, -1, -1, 108}, {756, -1, 252, 101}, {-1, -1, 253, 115}, {-1, -1, 254, 115},
+    {-1, -1, 255, 115}, {4084, -1, -1, 105}, {4042, -1, 607, 110}, {760, -1, -1, 116},
+    {761, -1, -1, 101}, {762, -1, -1, 114}, {763, -1, -1, 110}, {764, -1, -1, 97},
+    {765, -1, -1, 116}, {766, -1, -1, 105}, {767, -1, -1, 111}, {768, -1, -1, 110},
+    {769, -1, -1, 97}, {780, -1, -1, 108}, {1824, -1, -1, 95}, {772, -1, -1, 107},
+    {773, -1, -1, 110}, {774, -1, -1, 111}, {786, -1, 256, 116}, {1828, 770, -1, 160},
+    {777, -1, -1, 107}, {778, -1, -1, 110}, {779, -1, -1, 111}, {787, -1, 257, 116},
+    {781, 775, -1, 194}, {1832, -1, -1, 160}, {783, -1, -1, 107}, {784, -1, -1, 110},
+    {785, -1, -1, 111}, {788, -1, 258, 116}, {-1, -1, 259, 115}, {-1, -1, 260, 115},
+    {-1, -1, 261, 115}, {790, 316, -1, 110}, {791, -1, -1, 111}, {838, -1, 268, 116},
+    {793, -1, -1, 95}, {794, -1, -1, 105}, {795, -1, -1, 110}, {796, -1, -1, 116},
+    {797, -1, -1, 101}, {798, -1, -1, 114}, {799, -1, -1, 110}, {800, -1, -1, 97},
+    {801, -1, -1, 116}, {802, -1, -1, 105}, {803, -1, -1, 111}, {804, -1, -1, 110},
+    {805, -1, -1, 97}, {835, -1, 262, 108}, {807, 792, -1, 160}, {808, -1, -1, 105},
+    {809, -1, -1, 110}, {810, -1, -1, 116}, {811, -1, -1, 101}, {812, -1, -1, 114},
+    {813, -1, -1, 110}, {814, -1, -1, 97}, {815, -1, -1, 116}, {816, -1, -1, 105},
+    {817, -1, -1, 111}, {818, -1, -1, 110}, {819, -1, -1, 97}, {836, -1, 263, 108},
+    {821, 806, -1, 194}, {822, -1, -1, 160}, {823, -1, -1, 105}, {824, -1, -1, 110},
+    {825, -1, -1, 116}, {826, -1, -1, 101}, {827, -1, -1, 114}, {828, -1, -1, 110},
+    {829, -1, -1, 97}, {830, -1, -1, 116}, {831, -1, -1, 105}, {832, -1, -1, 111},
+    {833, -1, -1, 110}, {834, -1, -1, 97}, {837, -1, 264, 108}, {-1, -1, 265, 115},
+    {-1, -1, 266, 115}, {-1, -1, 267, 115}, {-1, 820, 269, 115}, {840, 386, -1, 115},
+    {841, -1, -1, 116}, {842, -1, -1, 114}, {843, -1, -1, 111}, {844, -1, 270, 109},
+    {-1, -1, 271, 115}, {846, -1, -1, 229}, {847, -1, -1, 110}, {848, -1, -1, 103},
+    {849, -1, -1, 115}, {850, -1, -1, 116}, {851, -1, -1, 114}, {852, -1, -1, 246},
+    {863, -1, 272, 109}, {866, -1, -1, 195}, {855, -1, -1, 165}, {856, -1, -1, 110},
+    {857, -1, -1, 103}, {858, -1, -1, 115}, {859, -1, -1, 116}, {860, -1, -1, 114},
+    {861, -1, -1, 195}, {862, -1, -1, 182}, {864, -1, 273, 109}, {-1, -1, 274, 115},
+    {-1, -1, 275, 115}, {-1, -1, 276, 197}, {-1, 854, 277, 133}, {-1, 220, 278, 171},
+    {869, 358, 279, 101}, {-1, -1, 280, 115}, {871, 45, -1, 97}, {872, -1, -1, 114},
+    {873, -1, 281, 101}, {-1, -1, 282, 115}, {1506, 322, -1, 97}, {4051, -1, 286, 114},
+    {877, -1, 283, 110}, {-1, -1, 284, 115}, {-1, 876, 287, 115}, {4768, 162, -1, 97},
+    {2352, -1, 288, 108}, {-1, -1, 289, 115}, {2468, 193, -1, 117}, {884, -1, -1, 114},
+    {885, -1, -1, 105}, {886, -1, 290, 101}, {-1, -1, 291, 115}, {-1, -1, 292, 105},
+    {1735, 139, -1, 111}, {890, -1, -1, 101}, {891, -1, -1, 110}, {892, -1, -1, 116},
+    {893, -1, -1, 103}, {894, -1, -1, 101}, {895, -1, 293, 110}, {-1, -1, 294, 115},
+    {-1, -1, 295, 82}, {4481, 888, -1, 101}, {899, -1, 296, 109}, {-1, -1, 297, 115},
+    {-1, 108, 299, 115}, {-1, 114, 301, 115}, {-1, 302, 302, 75}, {-1, 304, 303, 75},
+    {905, 251, 310, 107}, {906, -1, -1, 101}, {907, -1, -1, 108}, {908, -1, -1, 118},
+    {909, -1, -1, 105}, {-1, -1, 304, 110}, {911, 259, 311, 107}, {912, -1, -1, 101},
+    {913, -1, -1, 108}, {914, -1, -1, 118}, {915, -1, -1, 105}, {-1, -1, 305, 110},
+    {917, 268, 312, 107}, {918, -1, -1, 101}, {919, -1, -1, 108}, {920, -1, -1, 118},
+    {921, -1, -1, 105}, {-1, -1, 306, 110}, {923, 277, 313, 107}, {924, -1, -1, 101},
+    {925, -1, -1, 108}, {926, -1, -1, 118}, {927, -1, -1, 105}, {-1, -1, 307, 110},
+    {929, 285, 314, 107}, {930, -1, -1, 101}, {931, -1, -1, 108}, {932, -1, -1, 118},
+    {933, -1, -1, 105}, {-1, -1, 308, 110}, {935, 294, 315, 107}, {936, -1, -1, 101},
+    {937, -1, -1, 108}, {938, -1, -1, 118}, {939, -1, -1, 105}, {-1, -1, 309, 110},
+    {-1, 275, 316, 107}, {-1, 292, 317, 107}, {4979, 247, -1, 95}, {-1, -1, 318, 107},
+    {4980, 942, -1, 160}, {-1, -1, 319, 107}, {947, 944, -1, 194}, {4981, -1, -1, 160},
+    {-1, -1, 320, 107}, {4978, 946, -1, 115}, {4982, -1, -1, 95}, {-1, -1, 321, 107},
+    {4983, 950, -1, 160}, {-1, -1, 322, 107}, {955, 952, -1, 194}, {4984, -1, -1, 160},
+    {-1, -1, 323, 107}, {-1, 949, 324, 107}, {-1, 954, 325, 107}, {960, 133, -1, 108},
+    {961, -1, 326, 101}, {-1, -1, 327, 115}, {963, 568, -1, 105}, {964, -1, -1, 110},
+    {965, -1, -1, 115}, {966, -1, -1, 116}, {967, -1, -1, 101}, {968, -1, -1, 105},
+    {969, -1, 328, 110}, {-1, -1, 329, 115}, {971, 875, -1, 117}, {972, -1, 330, 100},
+    {-1, -1, 331, 115}, {-1, 332, 332, 100}, {975, 874, -1, 112}, {-1, -1, 333, 115},
+    {-1, 867, 334, 131}, {978, 55, -1, 108}, {979, -1, -1, 115}, {980, -1, -1, 105},
+    {981, -1, -1, 117}, {982, -1, 335, 115}, {983, -1, -1, 101}, {-1, -1, 336, 115},
+    {-1, 940, 343, 99}, {-1, 941, 344, 99}, {-1, 943, 345, 99}, {-1, 945, 346, 99},
+    {-1, 948, 347, 99}, {-1, 951, 348, 99}, {-1, 953, 349, 99}, {-1, 956, 350, 99},
+    {-1, 957, 351, 99}, {-1, 958, 352, 99}, {995, 789, 353, 116}, {-1, -1, 354, 115},
+    {997, 701, -1, 118}, {1213, -1, -1, 111}, {999, -1, -1, 103}, {1000, -1, -1, 97},
+    {1001, -1, -1, 100}, {1002, -1, -1, 114}, {1021, -1, -1, 111}, {1004, -1, -1, 95},
+    {1005, -1, -1, 99}, {1006, -1, -1, 111}, {1007, -1, -1, 110}, {1008, -1, -1, 115},
+    {1009, -1, -1, 116}, {1010, -1, -1, 97}, {1011, -1, -1, 110}, {1031, -1, 355, 116},
+    {1013, 1003, -1, 160}, {1014, -1, -1, 99}, {1015, -1, -1, 111}, {1016, -1, -1, 110},
+    {1017, -1, -1, 115}, {1018, -1, -1, 116}, {1019, -1, -1, 97}, {1020, -1, -1, 110},
+    {1032, -1, 356, 116}, {1022, 1012, -1, 194}, {1023, -1, -1, 160}, {1024, -1, -1, 99},
+    {1025, -1, -1, 111}, {1026, -1, -1, 110}, {1027, -1, -1, 115}, {1028, -1, -1, 116},
+    {1029, -1, -1, 97}, {1030, -1, -1, 110}, {1033, -1, 357, 116}, {-1, -1, 358, 115},
+    {-1, -1, 359, 115}, {-1, -1, 360, 115}, {1964, 19, -1, 114}, {1740, -1, -1, 99},
+    {1037, -1, -1, 101}, {1038, -1, -1, 110}, {1039, -1, 361, 116}, {-1, -1, 362, 115},
+    {-1, -1, 363, 37}, {1048, 173, -1, 112}, {1043, -1, 364, 109}, {-1, -1, 365, 118},
+    {1045, 1042, 366, 98}, {-1, -1, 367, 118}, {1047, 1044, 368, 116}, {-1, -1, 369, 118},
+    {1049, 1046, 370, 113}, {-1, -1, 371, 118}, {1051, 333, -1, 100}, {1052, -1, 372, 101},
+    {-1, -1, 373, 115}, {1054, 882, -1, 105}, {1055, -1, -1, 114}, {2004, -1, -1, 99},
+    {1057, -1, -1, 108}, {1058, -1, 374, 101}, {-1, -1, 375, 115}, {1060, 1053, -1, 121},
+    {1061, -1, -1, 99}, {1062, -1, -1, 108}, {1063, -1, 376, 101}, {-1, -1, 377, 115},
+    {1065, 551, -1, 117}, {1066, -1, -1, 114}, {1067, -1, 378, 110}, {-1, -1, 379, 115},
+    {1069, 898, -1, 118}, {1070, -1, -1, 111}, {1071, -1, -1, 108}, {1072, -1, -1, 117},
+    {1073, -1, -1, 116}, {1074, -1, -1, 105}, {1075, -1, -1, 111}, {1076, -1, 380, 110},
+    {-1, -1, 381, 115}, {1078, 889, -1, 116}, {1079, -1, -1, 97}, {1080, -1, -1, 116},
+    {1081, -1, -1, 105}, {1082, -1, -1, 111}, {1903, -1, 382, 110}, {1938, -1, 383, 115},
+    {1085, 904, 390, 110}, {1086, -1, -1, 111}, {1087, -1, -1, 114}, {1088, -1, -1, 116},
+    {-1, -1, 384, 104}, {1090, 910, 391, 110}, {1091, -1, -1, 111}, {1092, -1, -1, 114},
+    {1093, -1, -1, 116}, {-1, -1, 385, 104}, {1095, 916, 392, 110}, {1096, -1, -1, 111},
+    {1097, -1, -1, 114}, {1098, -1, -1, 116}, {-1, -1, 386, 104}, {1100, 922, 393, 110},
+    {1101, -1, -1, 111}, {1102, -1, -1, 114}, {1103, -1, -1, 116}, {-1, -1, 387, 104},
+    {1105, 928, 394, 110}, {1106, -1, -1, 111}, {1107, -1, -1, 114}, {1108, -1, -1, 116},
+    {-1, -1, 388, 104}, {1110, 934, 395, 110}, {1111, -1, -1, 111}, {1112, -1, -1, 114},
+    {1113, -1, -1, 116}, {-1, -1, 389, 104}, {-1, 984, 396, 110}, {-1, 985, 397, 110},
+    {1117, 1084, 404, 101}, {1118, -1, -1, 97}, {1119, -1, -1, 115}, {-1, -1, 398, 116},
+    {1121, 1089, 405, 101}, {1122, -1, -1, 97}, {1123, -1, -1, 115}, {-1, -1, 399, 116},
+    {1125, 1094, 406, 101}, {1126, -1, -1, 97}, {1127, -1, -1, 115}, {-1, -1, 400, 116},
+    {1129, 1099, 407, 101}, {1130, -1, -1, 97}, {1131, -1, -1, 115}, {-1, -1, 401, 116},
+    {1133, 1104, 408, 101}, {1134, -1, -1, 97}, {1135, -1, -1, 115}, {-1, -1, 402, 116},
+    {1137, 1109, 409, 101}, {1138, -1, -1, 97}, {1139, -1, -1, 115}, {-1, -1, 403, 116},
+    {-1, 1114, 410, 101}, {-1, 1115, 411, 101}, {1143, 1116, 418, 116}, {1144, -1, -1, 114},
+    {1145, -1, -1, 117}, {-1, -1, 412, 101}, {1147, 1120, 419, 116}, {1148, -1, -1, 114},
+    {1149, -1, -1, 117}, {-1, -1, 413, 101}, {1151, 1124, 420, 116}, {1152, -1, -1, 114},
+    {1153, -1, -1, 117}, {-1, -1, 414, 101}, {1155, 1128, 421, 116}, {1156, -1, -1, 114},
+    {1157, -1, -1, 117}, {-1, -1, 415, 101}, {1159, 1132, 422, 116}, {1160, -1, -1, 114},
+    {1161, -1, -1, 117}, {-1, -1, 416, 101}, {1163, 1136, 423, 116}, {1164, -1, -1, 114},
+    {1165, -1, -1, 117}, {-1, -1, 417, 101}, {-1, 1140, 424, 116}, {-1, 1141, 425, 116},
+    {1169, 1142, 432, 119}, {1170, -1, -1, 101}, {1171, -1, -1, 115}, {-1, -1, 426, 116},
+    {1173, 1146, 433, 119}, {1174, -1, -1, 101}, {1175, -1, -1, 115}, {-1, -1, 427, 116},
+    {1177, 1150, 434, 119}, {1178, -1, -1, 101}, {1179, -1, -1, 115}, {-1, -1, 428, 116},
+    {1181, 1154, 435, 119}, {1182, -1, -1, 101}, {1183, -1, -1, 115}, {-1, -1, 429, 116},
+    {1185, 1158, 436, 119}, {1186, -1, -1, 101}, {1187, -1, -1, 115}, {-1, -1, 430, 116},
+    {1189, 1162, 437, 119}, {1190, -1, -1, 101}, {1191, -1, -1, 115}, {-1, -1, 431, 116},
+    {-1, 1166, 438, 119}, {-1, 1167, 439, 119}, {1195, 702, -1, 115}, {1196, -1, -1, 97},
+    {1205, -1, -1, 121}, {1198, -1, -1, 95}, {1199, -1, -1, 116}, {1200, -1, -1, 111},
+    {1210, -1, 440, 110}, {1202, 1197, -1, 160}, {1203, -1, -1, 116}, {1204, -1, -1, 111},
+    {1211, -1, 441, 110}, {1206, 1201, -1, 194}, {1207, -1, -1, 160}, {1208, -1, -1, 116},
+    {1209, -1, -1, 111}, {1212, -1, 442, 110}, {-1, -1, 443, 115}, {-1, -1, 444, 115},
+    {-1, -1, 445, 115}, {1214, 998, -1, 105}, {1215, -1, -1, 114}, {1216, -1, -1, 100},
+    {1217, -1, -1, 117}, {1218, -1, -1, 112}, {1219, -1, -1, 111}, {1220, -1, -1, 105},
+    {1233, -1, -1, 115}, {1243, -1, -1, 95}, {1223, -1, -1, 111}, {1224, -1, -1, 117},
+    {1225, -1, -1, 110}, {1226, -1, -1, 99}, {1240, -1, 446, 101}, {1248, 1221, -1, 160},
+    {1229, -1, -1, 111}, {1230, -1, -1, 117}, {1231, -1, -1, 110}, {1232, -1, -1, 99},
+    {1241, -1, 447, 101}, {1234, 1227, -1, 194}, {1253, -1, -1, 160}, {1236, -1, -1, 111},
+    {1237, -1, -1, 117}, {1238, -1, -1, 110}, {1239, -1, -1, 99}, {1242, -1, 448, 101},
+    {-1, -1, 449, 115}, {-1, -1, 450, 115}, {-1, -1, 451, 115}, {1244, 1222, -1, 112},
+    {1245, -1, -1, 111}, {1246, -1, -1, 117}, {1247, -1, -1, 110}, {1258, -1, 452, 100},
+    {1249, 1228, -1, 112}, {1250, -1, -1, 111}, {1251, -1, -1, 117}, {1252, -1, -1, 110},
+    {1259, -1, 453, 100}, {1254, 1235, -1, 112}, {1255, -1, -1, 111}, {1256, -1, -1, 117},
+    {1257, -1, -1, 110}, {1260, -1, 454, 100}, {-1, -1, 455, 115}, {-1, -1, 456, 115},
+    {-1, -1, 457, 115}, {5101, 1041, -1, 111}, {1263, -1, -1, 117}, {1264, -1, -1, 110},
+    {3558, -1, 458, 100}, {3550, -1, 459, 115}, {3557, 524, 460, 98}, {1268, 131, -1, 114},
+    {1269, -1, -1, 97}, {1270, -1, 461, 116}, {-1, -1, 462, 115}, {1272, 1050, -1, 105},
+    {1273, -1, 463, 110}, {-1, -1, 464, 115}, {1275, 1266, -1, 111}, {1276, -1, -1, 110},
+    {1305, -1, -1, 103}, {1521, -1, -1, 95}, {1279, -1, -1, 104}, {1280, -1, -1, 117},
+    {1281, -1, -1, 110}, {1282, -1, -1, 100}, {1283, -1, -1, 114}, {1284, -1, -1, 101},
+    {1285, -1, -1, 100}, {1286, -1, -1, 119}, {1287, -1, -1, 101}, {1288, -1, -1, 105},
+    {1289, -1, -1, 103}, {1290, -1, -1, 104}, {1320, -1, 466, 116}, {1524, 1277, -1, 160},
+    {1293, -1, -1, 104}, {1294, -1, -1, 117}, {1295, -1, -1, 110}, {1296, -1, -1, 100},
+    {1297, -1, -1, 114}, {1298, -1, -1, 101}, {1299, -1, -1, 100}, {1300, -1, -1, 119},
+    {1301, -1, -1, 101}, {1302, -1, -1, 105}, {1303, -1, -1, 103}, {1304, -1, -1, 104},
+    {1321, -1, 467, 116}, {1306, 1291, -1, 194}, {1527, -1, -1, 160}, {1308, -1, -1, 104},
+    {1309, -1, -1, 117}, {1310, -1, -1, 110}, {1311, -1, -1, 100}, {1312, -1, -1, 114},
+    {1313, -1, -1, 101}, {1314, -1, -1, 100}, {1315, -1, -1, 119}, {1316, -1, -1, 101},
+    {1317, -1, -1, 105}, {1318, -1, -1, 103}, {1319, -1, -1, 104}, {1322, -1, 468, 116},
+    {-1, -1, 469, 115}, {-1, -1, 470, 115}, {-1, -1, 471, 115}, {1324, 1034, -1, 110},
+    {1325, -1, -1, 110}, {1326, -1, -1, 121}, {1327, -1, -1, 119}, {1328, -1, -1, 101},
+    {1329, -1, -1, 105}, {1330, -1, -1, 103}, {1331, -1, -1, 104}, {1332, -1, 472, 116},
+    {-1, -1, 473, 115}, {2808, 221, -1, 104}, {1335, -1, -1, 111}, {1336, -1, -1, 114},
+    {1365, -1, -1, 116}, {1508, -1, -1, 95}, {1339, -1, -1, 104}, {1340, -1, -1, 117},
+    {1341, -1, -1, 110}, {1342, -1, -1, 100}, {1343, -1, -1, 114}, {1344, -1, -1, 101},
+    {1345, -1, -1, 100}, {1346, -1, -1, 119}, {1347, -1, -1, 101}, {1348, -1, -1, 105},
+    {1349, -1, -1, 103}, {1350, -1, -1, 104}, {1380, -1, 474, 116}, {1511, 1337, -1, 160},
+    {1353, -1, -1, 104}, {1354, -1, -1, 117}, {1355, -1, -1, 110}, {1356, -1, -1, 100},
+    {1357, -1, -1, 114}, {1358, -1, -1, 101}, {1359, -1, -1, 100}, {1360, -1, -1, 119},
+    {1361, -1, -1, 101}, {1362, -1, -1, 105}, {1363, -1, -1, 103}, {1364, -1, -1, 104},
+    {1381, -1, 475, 116}, {1366, 1351, -1, 194}, {1514, -1, -1, 160}, {1368, -1, -1, 104},
+    {1369, -1, -1, 117}, {1370, -1, -1, 110}, {1371, -1, -1, 100}, {1372, -1, -1, 114},
+    {1373, -1, -1, 101}, {1374, -1, -1, 100}, {1375, -1, -1, 119}, {1376, -1, -1, 101},
+    {1377, -1, -1, 105}, {1378, -1, -1, 103}, {1379, -1, -1, 104}, {1382, -1, 476, 116},
+    {-1, -1, 477, 115}, {-1, -1, 478, 115}, {-1, -1, 479, 115}, {1384, 1333, -1, 108},
+    {1385, -1, -1, 117}, {1386, -1, 480, 103}, {-1, -1, 481, 115}, {1388, 1064, -1, 114},
+    {2906, -1, -1, 111}, {1402, -1, -1, 121}, {1443, -1, -1, 95}, {1392, -1, -1, 111},
+    {1393, -1, -1, 117}, {1394, -1, -1, 110}, {1395, -1, -1, 99}, {1409, -1, 482, 101},
+    {1448, 1390, -1, 160}, {1398, -1, -1, 111}, {1399, -1, -1, 117}, {1400, -1, -1, 110},
+    {1401, -1, -1, 99}, {1410, -1, 483, 101}, {1403, 1396, -1, 194}, {1453, -1, -1, 160},
+    {1405, -1, -1, 111}, {1406, -1, -1, 117}, {1407, -1, -1, 110}, {1408, -1, -1, 99},
+    {1411, -1, 484, 101}, {-1, -1, 485, 115}, {-1, -1, 486, 115}, {-1, -1, 487, 115},
+    {1500, 996, -1, 112}, {5032, -1, -1, 111}, {1415, -1, -1, 116}, {1416, -1, -1, 104},
+    {1417, -1, -1, 101}, {1418, -1, -1, 99}, {1419, -1, -1, 97}, {1420, -1, -1, 114},
+    {1433, -1, -1, 121}, {1461, -1, -1, 95}, {1423, -1, -1, 111}, {1424, -1, -1, 117},
+    {1425, -1, -1, 110}, {1426, -1, -1, 99}, {1440, -1, 488, 101}, {1466, 1421, -1, 160},
+    {1429, -1, -1, 111}, {1430, -1, -1, 117}, {1431, -1, -1, 110}, {1432, -1, -1, 99},
+    {1441, -1, 489, 101}, {1434, 1427, -1, 194}, {1471, -1, -1, 160}, {1436, -1, -1, 111},
+    {1437, -1, -1, 117}, {1438, -1, -1, 110}, {1439, -1, -1, 99}, {1442, -1, 490, 101},
+    {-1, -1, 491, 115}, {-1, -1, 492, 115}, {-1, -1, 493, 115}, {1444, 1391, -1, 112},
+    {1445, -1, -1, 111}, {1446, -1, -1, 117}, {1447, -1, -1, 110}, {1458, -1, 494, 100},
+    {1449, 1397, -1, 112}, {1450, -1, -1, 111}, {1451, -1, -1, 117}, {1452, -1, -1, 110},
+    {1459, -1, 495, 100}, {1454, 1404, -1, 112}, {1455, -1, -1, 111}, {1456, -1, -1, 117},
+    {1457, -1, -1, 110}, {1460, -1, 496, 100}, {-1, -1, 497, 115}, {-1, -1, 498, 115},
+    {-1, -1, 499, 115}, {1462, 1422, -1, 112}, {1463, -1, -1, 111}, {1464, -1, -1, 117},
+    {1465, -1, -1, 110}, {1476, -1, 500, 100}, {1467, 1428, -1, 112}, {1468, -1, -1, 111},
+    {1469, -1, -1, 117}, {1470, -1, -1, 110}, {1477, -1, 501, 100}, {1472, 1435, -1, 112},
+    {1473, -1, -1, 111}, {1474, -1, -1, 117}, {1475, -1, -1, 110}, {1478, -1, 502, 100},
+    {-1, -1, 503, 115}, {-1, -1, 504, 115}, {-1, -1, 505, 115}, {1480, 1383, -1, 99},
+    {1481, -1, -1, 114}, {1482, -1, -1, 117}, {1483, -1, -1, 112}, {1484, -1, -1, 108},
+    {1485, -1, 506, 101}, {-1, -1, 507, 115}, {1487, 1413, -1, 100}, {1488, -1, -1, 114},
+    {1489, -1, -1, 97}, {1490, -1, 508, 109}, {-1, -1, 509, 115}, {2227, 50, 512, 114},
+    {1493, -1, -1, 97}, {1494, -1, 510, 109}, {-1, -1, 511, 115}, {1496, 1414, -1, 117},
+    {1497, -1, -1, 110}, {1498, -1, -1, 99}, {1499, -1, 513, 101}, {-1, -1, 514, 115},
+    {1501, 1486, -1, 112}, {1502, -1, -1, 111}, {1503, -1, -1, 117}, {1504, -1, -1, 110},
+    {1505, -1, 515, 100}, {-1, -1, 516, 115}, {1507, 970, 517, 103}, {-1, -1, 518, 115},
+    {1509, 1338, -1, 116}, {1510, -1, -1, 111}, {1517, -1, 519, 110}, {1512, 1352, -1, 116},
+    {1513, -1, -1, 111}, {1518, -1, 520, 110}, {1515, 1367, -1, 116}, {1516, -1, -1, 111},
+    {1519, -1, 521, 110}, {-1, -1, 522, 115}, {-1, -1, 523, 115}, {-1, -1, 524, 115},
+    {3658, 553, 526, 115}, {1522, 1278, -1, 116}, {1523, -1, -1, 111}, {1530, -1, 527, 110},
+    {1525, 1292, -1, 116}, {1526, -1, -1, 111}, {1531, -1, 528, 110}, {1528, 1307, -1, 116},
+    {1529, -1, -1, 111}, {1532, -1, 529, 110}, {-1, -1, 530, 115}, {-1, -1, 531, 115},
+    {-1, -1, 532, 115}, {1534, 79, -1, 114}, {1535, -1, -1, 109}, {1536, -1, 533, 105},
+    {-1, -1, 534, 115}, {1538, 525, -1, 103}, {1539, -1, -1, 104}, {1550, -1, -1, 116},
+    {1541, -1, -1, 95}, {1542, -1, -1, 121}, {1543, -1, -1, 101}, {1544, -1, -1, 97},
+    {1556, -1, 535, 114}, {1546, 1540, -1, 160}, {1547, -1, -1, 121}, {1548, -1, -1, 101},
+    {1549, -1, -1, 97}, {1557, -1, 536, 114}, {1551, 1545, -1, 194}, {1552, -1, -1, 160},
+    {1553, -1, -1, 121}, {1554, -1, -1, 101}, {1555, -1, -1, 97}, {1558, -1, 537, 114},
+    {-1, -1, 538, 115}, {-1, -1, 539, 115}, {-1, -1, 540, 115}, {1560, -1, 541, 110},
+    {-1, -1, 542, 115}, {-1, 60, 544, 115}, {1563, 174, -1, 114}, {1564, -1, -1, 115},
+    {1565, -1, -1, 101}, {1566, -1, 545, 99}, {-1, -1, 546, 115}, {1568, 1261, -1, 114},
+    {1569, -1, -1, 105}, {1570, -1, -1, 110}, {1571, -1, -1, 116}, {1572, -1, -1, 101},
+    {1573, -1, -1, 114}, {1586, -1, -1, 115}, {1575, -1, -1, 95}, {1601, -1, -1, 112},
+    {1577, -1, -1, 111}, {1578, -1, -1, 105}, {1579, -1, -1, 110}, {1593, -1, 547, 116},
+    {1581, 1574, -1, 160}, {1604, -1, -1, 112}, {1583, -1, -1, 111}, {1584, -1, -1, 105},
+    {1585, -1, -1, 110}, {1594, -1, 548, 116}, {1587, 1580, -1, 194}, {1588, -1, -1, 160},
+    {1607, -1, -1, 112}, {1590, -1, -1, 111}, {1591, -1, -1, 105}, {1592, -1, -1, 110},
+    {1595, -1, 549, 116}, {-1, -1, 550, 115}, {-1, -1, 551, 115}, {-1, -1, 552, 115},
+    {4662, 1059, -1, 104}, {1598, -1, -1, 97}, {1599, -1, -1, 105}, {1600, -1, 553, 110},
+    {-1, -1, 554, 115}, {1602, 1576, -1, 105}, {1603, -1, -1, 99}, {1610, -1, 555, 97},
+    {1605, 1582, -1, 105}, {1606, -1, -1, 99}, {1611, -1, 556, 97}, {1608, 1589, -1, 105},
+    {1609, -1, -1, 99}, {1612, -1, 557, 97}, {-1, -1, 558, 115}, {-1, -1, 559, 115},
+    {-1, -1, 560, 115}, {1614, 76, 561, 97}, {-1, -1, 562, 115}, {1616, 166, -1, 109},
+    {1617, -1, -1, 105}, {1618, -1, -1, 108}, {1619, -1, 563, 101}, {-1, -1, 564, 115},
+    {1645, 731, -1, 115}, {4219, -1, -1, 95}, {1698, -1, -1, 115}, {1624, -1, -1, 117},
+    {1625, -1, -1, 114}, {1626, -1, -1, 118}, {1627, -1, -1, 101}, {1628, -1, -1, 121},
+    {1683, -1, -1, 95}, {1659, -1, -1, 102}, {1631, -1, -1, 111}, {1632, -1, -1, 111},
+    {-1, -1, 565, 116}, {4224, 1621, -1, 160}, {1709, -1, -1, 115}, {1636, -1, -1, 117},
+    {1637, -1, -1, 114}, {1638, -1, -1, 118}, {1639, -1, -1, 101}, {1640, -1, -1, 121},
+    {1687, -1, -1, 160}, {1662, -1, -1, 102}, {1643, -1, -1, 111}, {1644, -1, -1, 111},
+    {-1, -1, 566, 116}, {1646, 1633, -1, 194}, {4229, -1, -1, 160}, {1720, -1, -1, 115},
+    {1649, -1, -1, 117}, {1650, -1, -1, 114}, {1651, -1, -1, 118}, {1652, -1, -1, 101},
+    {1653, -1, -1, 121}, {1654, -1, -1, 194}, {1691, -1, -1, 160}, {1665, -1, -1, 102},
+    {1657, -1, -1, 111}, {1658, -1, -1, 111}, {-1, -1, 567, 116}, {1660, 1630, -1, 101},
+    {1661, -1, -1, 101}, {-1, -1, 568, 116}, {1663, 1642, -1, 101}, {1664, -1, -1, 101},
+    {-1, -1, 569, 116}, {1666, 1656, -1, 101}, {1667, -1, -1, 101}, {-1, -1, 570, 116},
+    {1669, 1629, -1, 121}, {1670, -1, -1, 97}, {1671, -1, -1, 114}, {1680, -1, 571, 100},
+    {1673, 1641, -1, 121}, {1674, -1, -1, 97}, {1675, -1, -1, 114}, {1681, -1, 572, 100},
+    {1677, 1655, -1, 121}, {1678, -1, -1, 97}, {1679, -1, -1, 114}, {1682, -1, 573, 100},
+    {-1, -1, 574, 115}, {-1, -1, 575, 115}, {-1, -1, 576, 115}, {1684, 1668, -1, 109},
+    {1685, -1, -1, 105}, {1686, -1, -1, 108}, {1695, -1, 577, 101}, {1688, 1672, -1, 109},
+    {1689, -1, -1, 105}, {1690, -1, -1, 108}, {1696, -1, 578, 101}, {1692, 1676, -1, 109},
+    {1693, -1, -1, 105}, {1694, -1, -1, 108}, {1697, -1, 579, 101}, {-1, -1, 580, 115},
+    {-1, -1, 581, 115}, {-1, -1, 582, 115}, {1699, 1623, -1, 116}, {1700, -1, -1, 97},
+    {1701, -1, -1, 116}, {1702, -1, -1, 117}, {1703, -1, -1, 116}, {1704, -1, -1, 101},
+    {1705, -1, -1, 95}, {1706, -1, -1, 109}, {1707, -1, -1, 105}, {1708, -1, -1, 108},
+    {1732, -1, 583, 101}, {1710, 1635, -1, 116}, {1711, -1, -1, 97}, {1712, -1, -1, 116},
+    {1713, -1, -1, 117}, {1714, -1, -1, 116}, {1715, -1, -1, 101}, {1716, -1, -1, 160},
+    {1717, -1, -1, 109}, {1718, -1, -1, 105}, {1719, -1, -1, 108}, {1733, -1, 584, 101},
+    {1721, 1648, -1, 116}, {1722, -1, -1, 97}, {1723, -1, -1, 116}, {1724, -1, -1, 117},
+    {1725, -1, -1, 116}, {1726, -1, -1, 101}, {1727, -1, -1, 194}, {1728, -1, -1, 160},
+    {1729, -1, -1, 109}, {1730, -1, -1, 105}, {1731, -1, -1, 108}, {1734, -1, 585, 101},
+    {-1, -1, 586, 115}, {-1, -1, 587, 115}, {-1, -1, 588, 115}, {1736, 1077, 589, 100},
+    {-1, -1, 590, 115}, {1738, 1262, -1, 108}, {1739, -1, 591, 101}, {-1, -1, 592, 115},
+    {1741, 1036, 593, 104}, {1742, -1, -1, 101}, {-1, -1, 594, 115}, {1744, 207, -1, 117},
+    {1745, -1, -1, 114}, {1746, -1, -1, 108}, {1747, -1, -1, 111}, {1748, -1, -1, 110},
+    {1749, -1, 595, 103}, {-1, -1, 596, 115}, {1751, 208, -1, 116}, {1752, -1, -1, 104},
+    {1753, -1, -1, 111}, {1754, -1, 597, 109}, {-1, -1, 598, 115}, {1756, 771, -1, 105},
+    {1757, -1, -1, 110}, {1758, -1, -1, 99}, {1767, -1, 599, 104}, {1760, 776, -1, 105},
+    {1761, -1, -1, 110}, {1762, -1, -1, 99}, {1769, -1, 600, 104}, {1764, 782, -1, 105},
+    {1765, -1, -1, 110}, {1766, -1, -1, 99}, {1771, -1, 601, 104}, {1768, -1, -1, 101},
+    {-1, -1, 602, 115}, {1770, -1, -1, 101}, {-1, -1, 603, 115}, {1772, -1, -1, 101},
+    {-1, -1, 604, 115}, {1774, 759, -1, 99}, {3786, -1, 605, 104}, {1776, -1, -1, 101},
+    {3812, -1, 606, 115}, {1789, 1755, -1, 102}, {1779, -1, -1, 111}, {1780, -1, -1, 111},
+    {-1, -1, 608, 116}, {1792, 1759, -1, 102}, {1783, -1, -1, 111}, {1784, -1, -1, 111},
+    {-1, -1, 609, 116}, {1795, 1763, -1, 102}, {1787, -1, -1, 111}, {1788, -1, -1, 111},
+    {-1, -1, 610, 116}, {1790, 1778, -1, 101}, {1791, -1, -1, 101}, {-1, -1, 611, 116},
+    {1793, 1782, -1, 101}, {1794, -1, -1, 101}, {-1, -1, 612, 116}, {1796, 1786, -1, 101},
+    {1797, -1, -1, 101}, {-1, -1, 613, 116}, {3088, 1743, -1, 111}, {1800, -1, -1, 111},
+    {4992, -1, 614, 116}, {1802, 1533, -1, 101}, {3899, -1, 615, 116}, {3905, 1798, 616, 116},
+    {1805, 1777, -1, 121}, {1806, -1, -1, 97}, {1807, -1, -1, 114}, {1816, -1, 617, 100},
+    {1809, 1781, -1, 121}, {1810, -1, -1, 97}, {1811, -1, -1, 114}, {1817, -1, 618, 100},
+    {1813, 1785, -1, 121}, {1814, -1, -1, 97}, {1815, -1, -1, 114}, {1818, -1, 619, 100},
+    {-1, -1, 620, 115}, {-1, -1, 621, 115}, {-1, -1, 622, 115}, {1820, 2, -1, 97},
+    {1821, -1, -1, 114}, {1822, -1, 623, 100}, {-1, -1, 624, 115}, {-1, 1819, 625, 100},
+    {1825, 1804, -1, 109}, {1826, -1, -1, 105}, {1827, -1, -1, 108}, {1836, -1, 626, 101},
+    {1829, 1808, -1, 109}, {1830, -1, -1, 105}, {1831, -1, -1, 108}, {1837, -1, 627, 101},
+    {1833, 1812, -1, 109}, {1834, -1, -1, 105}, {1835, -1, -1, 108}, {1838, -1, 628, 101},
+    {-1, -1, 629, 115}, {-1, -1, 630, 115}, {-1, -1, 631, 115}, {1840, 1561, 632, 101},
+    {-1, -1, 633, 115}, {5163, 974, -1, 105}, {1855, -1, -1, 103}, {1844, -1, -1, 95},
+    {1845, -1, -1, 112}, {1846, -1, -1, 111}, {1847, -1, -1, 105}, {1848, -1, -1, 110},
+    {1862, -1, 635, 116}, {1850, 1843, -1, 160}, {1851, -1, -1, 112}, {1852, -1, -1, 111},
+    {1853, -1, -1, 105}, {1854, -1, -1, 110}, {1863, -1, 636, 116}, {1856, 1849, -1, 194},
+    {1857, -1, -1, 160}, {1858, -1, -1, 112}, {1859, -1, -1, 111}, {1860, -1, -1, 105},
+    {1861, -1, -1, 110}, {1864, -1, 637, 116}, {-1, -1, 638, 115}, {-1, -1, 639, 115},
+    {-1, -1, 640, 115}, {1866, 878, -1, 108}, {1867, -1, -1, 101}, {1868, -1, -1, 121},
+    {1869, -1, -1, 99}, {1870, -1, -1, 111}, {1871, -1, -1, 114}, {1872, -1, 641, 110},
+    {-1, -1, 642, 115}, {1874, 868, -1, 112}, {1875, -1, -1, 101}, {1876, -1, -1, 110},
+    {1877, -1, -1, 116}, {1878, -1, -1, 108}, {1879, -1, -1, 105}, {1880, -1, 643, 110},
+    {-1, -1, 644, 115}, {1882, 1083, -1, 95}, {1883, -1, -1, 112}, {1884, -1, -1, 101},
+    {1885, -1, -1, 114}, {1886, -1, -1, 95}, {1887, -1, -1, 115}, {1888, -1, -1, 101},
+    {1889, -1, -1, 99}, {1890, -1, -1, 111}, {1891, -1, -1, 110}, {-1, -1, 645, 100},
+    {1893, 1881, -1, 160}, {1894, -1, -1, 112}, {1895, -1, -1, 101}, {1896, -1, -1, 114},
+    {1897, -1, -1, 160}, {1898, -1, -1, 115}, {1899, -1, -1, 101}, {1900, -1, -1, 99},
+    {1901, -1, -1, 111}, {1902, -1, -1, 110}, {-1, -1, 646, 100}, {1904, 1892, -1, 194},
+    {1905, -1, -1, 160}, {1906, -1, -1, 112}, {1907, -1, -1, 101}, {1908, -1, -1, 114},
+    {1909, -1, -1, 194}, {1910, -1, -1, 160}, {1911, -1, -1, 115}, {1912, -1, -1, 101},
+    {1913, -1, -1, 99}, {1914, -1, -1, 111}, {1915, -1, -1, 110}, {-1, -1, 647, 100},
+    {1917, -1, -1, 95}, {1918, -1, -1, 112}, {1919, -1, -1, 101}, {1920, -1, -1, 114},
+    {1921, -1, -1, 95}, {1922, -1, -1, 115}, {1923, -1, -1, 101}, {1924, -1, -1, 99},
+    {1925, -1, -1, 111}, {1926, -1, -1, 110}, {-1, -1, 648, 100}, {1928, 1916, -1, 160},
+    {1929, -1, -1, 112}, {1930, -1, -1, 101}, {1931, -1, -1, 114}, {1932, -1, -1, 160},
+    {1933, -1, -1, 115}, {1934, -1, -1, 101}, {1935, -1, -1, 99}, {1936, -1, -1, 111},
+    {1937, -1, -1, 110}, {-1, -1, 649, 100}, {1939, 1927, -1, 194}, {1940, -1, -1, 160},
+    {1941, -1, -1, 112}, {1942, -1, -1, 101}, {1943, -1, -1, 114}, {1944, -1, -1, 194},
+    {1945, -1, -1, 160}, {1946, -1, -1, 115}, {1947, -1, -1, 101}, {1948, -1, -1, 99},
+    {1949, -1, -1, 111}, {1950, -1, -1, 110}, {-1, -1, 650, 100}, {1955, 897, -1, 112},
+    {-1, -1, 651, 115}, {1954, 1596, -1, 112}, {-1, -1, 652, 115}, {-1, 1952, 653, 109},
+    {1957, 246, -1, 110}, {1958, -1, -1, 105}, {1959, -1, -1, 101}, {1960, -1, 654, 114},
+    {-1, -1, 655, 115}, {1962, 236, 656, 120}, {1963, -1, -1, 101}, {-1, -1, 657, 115},
+    {1975, 1035, -1, 109}, {1986, -1, -1, 95}, {1967, -1, -1, 48}, {-1, -1, 658, 99},
+    {1989, 1965, -1, 160}, {1970, -1, -1, 48}, {-1, -1, 659, 99}, {1972, 1968, -1, 194},
+    {1992, -1, -1, 160}, {1974, -1, -1, 48}, {-1, -1, 660, 99}, {1982, 1971, -1, 115},
+    {1995, -1, -1, 95}, {1978, -1, -1, 48}, {-1, -1, 661, 99}, {1998, 1976, -1, 160},
+    {1981, -1, -1, 48}, {-1, -1, 662, 99}, {1983, 1979, -1, 194}, {2001, -1, -1, 160},
+    {1985, -1, -1, 48}, {-1, -1, 663, 99}, {1987, 1966, -1, 50}, {1988, -1, -1, 51},
+    {-1, -1, 664, 99}, {1990, 1969, -1, 50}, {1991, -1, -1, 51}, {-1, -1, 665, 99},
+    {1993, 1973, -1, 50}, {1994, -1, -1, 51}, {-1, -1, 666, 99}, {1996, 1977, -1, 50},
+    {1997, -1, -1, 51}, {-1, -1, 667, 99}, {1999, 1980, -1, 50}, {2000, -1, -1, 51},
+    {-1, -1, 668, 99}, {2002, 1984, -1, 50}, {2003, -1, -1, 51}, {-1, -1, 669, 99},
+    {2005, 1056, -1, 117}, {2006, -1, -1, 108}, {2007, -1, -1, 97}, {2016, -1, -1, 114},
+    {2009, -1, -1, 95}, {2010, -1, -1, 109}, {2011, -1, -1, 105}, {2021, -1, 670, 108},
+    {2013, 2008, -1, 160}, {2014, -1, -1, 109}, {2015, -1, -1, 105}, {2022, -1, 671, 108},
+    {2017, 2012, -1, 194}, {2018, -1, -1, 160}, {2019, -1, -1, 109}, {2020, -1, -1, 105},
+    {2023, -1, 672, 108}, {-1, -1, 673, 115}, {-1, -1, 674, 115}, {-1, -1, 675, 115},
+    {2025, 352, -1, 114}, {2027, -1, -1, 99}, {-1, -1, 676, 121}, {2028, 2026, -1, 105},
+    {2029, -1, -1, 101}, {-1, -1, 677, 115}, {2031, 1412, -1, 99}, {2032, -1, -1, 114},
+    {2044, -1, 678, 101}, {-1, -1, 679, 115}, {2035, 2033, -1, 95}, {2050, -1, -1, 102},
+    {2037, -1, -1, 111}, {2038, -1, -1, 111}, {-1, -1, 680, 116}, {2040, 2034, -1, 160},
+    {2053, -1, -1, 102}, {2042, -1, -1, 111}, {2043, -1, -1, 111}, {-1, -1, 681, 116},
+    {2045, 2039, -1, 194}, {2046, -1, -1, 160}, {2056, -1, -1, 102}, {2048, -1, -1, 111},
+    {2049, -1, -1, 111}, {-1, -1, 682, 116}, {2051, 2036, -1, 101}, {2052, -1, -1, 101},
+    {-1, -1, 683, 116}, {2054, 2041, -1, 101}, {2055, -1, -1, 101}, {-1, -1, 684, 116},
+    {2057, 2047, -1, 101}, {2058, -1, -1, 101}, {-1, -1, 685, 116}, {4253, 1841, -1, 111},
+    {2061, -1, -1, 97}, {2062, -1, -1, 114}, {2073, -1, -1, 100}, {2064, -1, -1, 95},
+    {2079, -1, -1, 102}, {2066, -1, -1, 111}, {2067, -1, -1, 111}, {-1, -1, 686, 116},
+    {2069, 2063, -1, 160}, {2082, -1, -1, 102}, {2071, -1, -1, 111}, {2072, -1, -1, 111},
+    {-1, -1, 687, 116}, {2074, 2068, -1, 194}, {2075, -1, -1, 160}, {2085, -1, -1, 102},
+    {2077, -1, -1, 111}, {2078, -1, -1, 111}, {-1, -1, 688, 116}, {2080, 2065, -1, 101},
+    {2081, -1, -1, 101}, {-1, -1, 689, 116}, {2083, 2070, -1, 101}, {2084, -1, -1, 101},
+    {-1, -1, 690, 116}, {2086, 2076, -1, 101}, {2087, -1, -1, 101}, {-1, -1, 691, 116},
+    {2089, 2059, 694, 117}, {2090, -1, -1, 115}, {2091, -1, -1, 104}, {2092, -1, -1, 101},
+    {2093, -1, 692, 108}, {-1, -1, 693, 115}, {2095, 1323, -1, 99}, {2096, -1, 695, 107},
+    {-1, -1, 696, 115}, {-1, 1567, 697, 107}, {2099, 132, -1, 97}, {2100, -1, -1, 100},
+    {2101, -1, -1, 105}, {2102, -1, -1, 97}, {2131, -1, -1, 110}, {2104, -1, -1, 95},
+    {2105, -1, -1, 108}, {2106, -1, -1, 105}, {2107, -1, -1, 113}, {2108, -1, -1, 117},
+    {2109, -1, -1, 105}, {2110, -1, -1, 100}, {2111, -1, -1, 95}, {2112, -1, -1, 103},
+    {2113, -1, -1, 97}, {2114, -1, -1, 108}, {2115, -1, -1, 108}, {2116, -1, -1, 111},
+    {2147, -1, 698, 110}, {2118, 2103, -1, 160}, {2119, -1, -1, 108}, {2120, -1, -1, 105},
+    {2121, -1, -1, 113}, {2122, -1, -1, 117}, {2123, -1, -1, 105}, {2124, -1, -1, 100},
+    {2125, -1, -1, 160}, {2126, -1, -1, 103}, {2127, -1, -1, 97}, {2128, -1, -1, 108},
+    {2129, -1, -1, 108}, {2130, -1, -1, 111}, {2148, -1, 699, 110}, {2132, 2117, -1, 194},
+    {2133, -1, -1, 160}, {2134, -1, -1, 108}, {2135, -1, -1, 105}, {2136, -1, -1, 113},
+    {2137, -1, -1, 117}, {2138, -1, -1, 105}, {2139, -1, -1, 100}, {2140, -1, -1, 194},
+    {2141, -1, -1, 160}, {2142, -1, -1, 103}, {2143, -1, -1, 97}, {2144, -1, -1, 108},
+    {2145, -1, -1, 108}, {2146, -1, -1, 111}, {2149, -1, 700, 110}, {-1, -1, 701, 115},
+    {-1, -1, 702, 115}, {-1, -1, 703, 115}, {2151, 1622, -1, 100}, {2152, -1, -1, 114},
+    {2153, -1, -1, 121}, {2250, -1, -1, 95}, {2155, -1, -1, 103}, {2156, -1, -1, 97},
+    {2157, -1, -1, 108}, {2158, -1, -1, 108}, {2159, -1, -1, 111}, {2181, -1, 704, 110},
+    {2161, 1634, -1, 100}, {2162, -1, -1, 114}, {2163, -1, -1, 121}, {2254, -1, -1, 160},
+    {2165, -1, -1, 103}, {2166, -1, -1, 97}, {2167, -1, -1, 108}, {2168, -1, -1, 108},
+    {2169, -1, -1, 111}, {2182, -1, 705, 110}, {2171, 1647, -1, 100}, {2172, -1, -1, 114},
+    {2173, -1, -1, 121}, {2174, -1, -1, 194}, {2258, -1, -1, 160}, {2176, -1, -1, 103},
+    {2177, -1, -1, 97}, {2178, -1, -1, 108}, {2179, -1, -1, 108}, {2180, -1, -1, 111},
+    {2183, -1, 706, 110}, {-1, -1, 707, 115}, {-1, -1, 708, 115}, {-1, -1, 709, 115},
+    {-1, 1953, 710, 99}, {2186, 148, 711, 101}, {-1, -1, 712, 115}, {2188, 1068, -1, 103},
+    {2189, -1, -1, 105}, {2190, -1, -1, 115}, {2191, -1, -1, 116}, {2192, -1, -1, 101},
+    {2201, -1, -1, 114}, {2194, -1, -1, 95}, {2195, -1, -1, 116}, {2196, -1, -1, 111},
+    {2206, -1, 713, 110}, {2198, 2193, -1, 160}, {2199, -1, -1, 116}, {2200, -1, -1, 111},
+    {2207, -1, 714, 110}, {2202, 2197, -1, 194}, {2203, -1, -1, 160}, {2204, -1, -1, 116},
+    {2205, -1, -1, 111}, {2208, -1, 715, 110}, {-1, -1, 716, 115}, {-1, -1, 717, 115},
+    {-1, -1, 718, 115}, {2210, 2154, -1, 113}, {2211, -1, -1, 117}, {2212, -1, -1, 97},
+    {2213, -1, -1, 114}, {2224, -1, 719, 116}, {2215, 2164, -1, 113}, {2216, -1, -1, 117},
+    {2217, -1, -1, 97}, {2218, -1, -1, 114}, {2225, -1, 720, 116}, {2220, 2175, -1, 113},
+    {2221, -1, -1, 117}, {2222, -1, -1, 97}, {2223, -1, -1, 114}, {2226, -1, 721, 116},
+    {-1, -1, 722, 115}, {-1, -1, 723, 115}, {-1, -1, 724, 115}, {2240, 1492, -1, 121},
+    {2265, -1, -1, 95}, {2230, -1, -1, 113}, {2231, -1, -1, 117}, {2232, -1, -1, 97},
+    {2233, -1, -1, 114}, {2247, -1, 725, 116}, {2269, 2228, -1, 160}, {2236, -1, -1, 113},
+    {2237, -1, -1, 117}, {2238, -1, -1, 97}, {2239, -1, -1, 114}, {2248, -1, 726, 116},
+    {2241, 2234, -1, 194}, {2273, -1, -1, 160}, {2243, -1, -1, 113}, {2244, -1, -1, 117},
+    {2245, -1, -1, 97}, {2246, -1, -1, 114}, {2249, -1, 727, 116}, {-1, -1, 728, 115},
+    {-1, -1, 729, 115}, {-1, -1, 730, 115}, {2251, 2209, -1, 112}, {2252, -1, -1, 105},
+    {2253, -1, -1, 110}, {2262, -1, 731, 116}, {2255, 2214, -1, 112}, {2256, -1, -1, 105},
+    {2257, -1, -1, 110}, {2263, -1, 732, 116}, {2259, 2219, -1, 112}, {2260, -1, -1, 105},
+    {2261, -1, -1, 110}, {2264, -1, 733, 116}, {-1, -1, 734, 115}, {-1, -1, 735, 115},
+    {-1, -1, 736, 115}, {2266, 2229, -1, 112}, {2267, -1, -1, 105}, {2268, -1, -1, 110},
+    {2277, -1, 737, 116}, {2270, 2235, -1, 112}, {2271, -1, -1, 105}, {2272, -1, -1, 110},
+    {2278, -1, 738, 116}, {2274, 2242, -1, 112}, {2275, -1, -1, 105}, {2276, -1, -1, 110},
+    {2279, -1, 739, 116}, {-1, -1, 740, 115}, {-1, -1, 741, 115}, {-1, -1, 742, 115},
+    {2281, 2150, -1, 108}, {2282, -1, -1, 105}, {2283, -1, -1, 113}, {2284, -1, -1, 117},
+    {2285, -1, -1, 105}, {2286, -1, -1, 100}, {2534, -1, -1, 95}, {2470, -1, -1, 103},
+    {2289, -1, -1, 97}, {2290, -1, -1, 108}, {2291, -1, -1, 108}, {2292, -1, -1, 111},
+    {2320, -1, 743, 110}, {2294, 2160, -1, 108}, {2295, -1, -1, 105}, {2296, -1, -1, 113},
+    {2297, -1, -1, 117}, {2298, -1, -1, 105}, {2299, -1, -1, 100}, {2539, -1, -1, 160},
+    {2473, -1, -1, 103}, {2302, -1, -1, 97}, {2303, -1, -1, 108}, {2304, -1, -1, 108},
+    {2305, -1, -1, 111}, {2321, -1, 744, 110}, {2307, 2170, -1, 108}, {2308, -1, -1, 105},
+    {2309, -1, -1, 113}, {2310, -1, -1, 117}, {2311, -1, -1, 105}, {2312, -1, -1, 100},
+    {2313, -1, -1, 194}, {2544, -1, -1, 160}, {2476, -1, -1, 103}, {2316, -1, -1, 97},
+    {2317, -1, -1, 108}, {2318, -1, -1, 108}, {2319, -1, -1, 111}, {2322, -1, 745, 110},
+    {-1, -1, 746, 115}, {-1, -1, 747, 115}, {-1, -1, 748, 115}, {2324, 1537, -1, 113},
+    {2325, -1, -1, 117}, {2326, -1, -1, 105}, {2341, -1, -1, 100}, {2578, -1, -1, 95},
+    {2482, -1, -1, 103}, {2330, -1, -1, 97}, {2331, -1, -1, 108}, {2332, -1, -1, 108},
+    {2333, -1, -1, 111}, {2349, -1, 749, 110}, {2583, 2327, -1, 160}, {2485, -1, -1, 103},
+    {2337, -1, -1, 97}, {2338, -1, -1, 108}, {2339, -1, -1, 108}, {2340, -1, -1, 111},
+    {2350, -1, 750, 110}, {2342, 2334, -1, 194}, {2588, -1, -1, 160}, {2488, -1, -1, 103},
+    {2345, -1, -1, 97}, {2346, -1, -1, 108}, {2347, -1, -1, 108}, {2348, -1, -1, 111},
+    {2351, -1, 751, 110}, {-1, -1, 752, 115}, {-1, -1, 753, 115}, {-1, -1, 754, 115},
+    {2353, 881, -1, 108}, {2354, -1, -1, 111}, {2355, -1, 755, 110}, {-1, -1, 756, 115},
+    {2357, 1865, -1, 114}, {2358, -1, -1, 101}, {2359, -1, 757, 108}, {-1, -1, 758, 115},
+    {2361, 2088, -1, 98}, {-1, -1, 759, 108}, {2363, 1803, -1, 105}, {2364, -1, -1, 114},
+    {2365, -1, -1, 107}, {2366, -1, -1, 105}, {2367, -1, 760, 110}, {-1, -1, 761, 115},
+    {2369, 2287, -1, 113}, {2370, -1, -1, 117}, {2371, -1, -1, 97}, {2372, -1, -1, 114},
+    {2383, -1, 762, 116}, {2374, 2300, -1, 113}, {2375, -1, -1, 117}, {2376, -1, -1, 97},
+    {2377, -1, -1, 114}, {2384, -1, 763, 116}, {2379, 2314, -1, 113}, {2380, -1, -1, 117},
+    {2381, -1, -1, 97}, {2382, -1, -1, 114}, {2385, -1, 764, 116}, {-1, -1, 765, 115},
+    {-1, -1, 766, 115}, {-1, -1, 767, 115}, {2387, 2328, -1, 113}, {2388, -1, -1, 117},
+    {2389, -1, -1, 97}, {2390, -1, -1, 114}, {2401, -1, 768, 116}, {2392, 2335, -1, 113},
+    {2393, -1, -1, 117}, {2394, -1, -1, 97}, {2395, -1, -1, 114}, {2402, -1, 769, 116},
+    {2397, 2343, -1, 113}, {2398, -1, -1, 117}, {2399, -1, -1, 97}, {2400, -1, -1, 114},
+    {2403, -1, 770, 116}, {-1, -1, 771, 115}, {-1, -1, 772, 115}, {-1, -1, 773, 115},
+    {2405, -1, -1, 113}, {2406, -1, -1, 117}, {2407, -1, -1, 97}, {2408, -1, -1, 114},
+    {2409, -1, 774, 116}, {-1, -1, 775, 115}, {2411, 2368, -1, 112}, {2412, -1, -1, 105},
+    {2413, -1, -1, 110}, {2422, -1, 776, 116}, {2415, 2373, -1, 112}, {2416, -1, -1, 105},
+    {2417, -1, -1, 110}, {2423, -1, 777, 116}, {2419, 2378, -1, 112}, {2420, -1, -1, 105},
+    {2421, -1, -1, 110}, {2424, -1, 778, 116}, {-1, -1, 779, 115}, {-1, -1, 780, 115},
+    {-1, -1, 781, 115}, {2426, 2386, -1, 112}, {2427, -1, -1, 105}, {2428, -1, -1, 110},
+    {2437, -1, 782, 116}, {2430, 2391, -1, 112}, {2431, -1, -1, 105}, {2432, -1, -1, 110},
+    {2438, -1, 783, 116}, {2434, 2396, -1, 112}, {2435, -1, -1, 105}, {2436, -1, -1, 110},
+    {2439, -1, 784, 116}, {-1, -1, 785, 115}, {-1, -1, 786, 115}, {-1, -1, 787, 115},
+    {2441, 354, -1, 110}, {2442, -1, 788, 116}, {-1, -1, 789, 115}, {-1, 2097, 790, 116},
+    {2445, 2410, -1, 99}, {2446, -1, -1, 117}, {2453, -1, 791, 112}, {2448, 2414, -1, 99},
+    {2449, -1, -1, 117}, {2454, -1, 792, 112}, {2451, 2418, -1, 99}, {2452, -1, -1, 117},
+    {2455, -1, 793, 112}, {-1, -1, 794, 115}, {-1, -1, 795, 115}, {-1, -1, 796, 115},
+    {2457, 2425, -1, 99}, {2458, -1, -1, 117}, {2465, -1, 797, 112}, {2460, 2429, -1, 99},
+    {2461, -1, -1, 117}, {2466, -1, 798, 112}, {2463, 2433, -1, 99}, {2464, -1, -1, 117},
+    {2467, -1, 799, 112}, {-1, -1, 800, 115}, {-1, -1, 801, 115}, {-1, -1, 802, 115},
+    {2469, 883, 803, 112}, {-1, -1, 804, 115}, {2471, 2288, -1, 105}, {2472, -1, -1, 108},
+    {2479, -1, 805, 108}, {2474, 2301, -1, 105}, {2475, -1, -1, 108}, {2480, -1, 806, 108},
+    {2477, 2315, -1, 105}, {2478, -1, -1, 108}, {2481, -1, 807, 108}, {-1, -1, 808, 115},
+    {-1, -1, 809, 115}, {-1, -1, 810, 115}, {2483, 2329, -1, 105}, {2484, -1, -1, 108},
+    {2491, -1, 811, 108}, {2486, 2336, -1, 105}, {2487, -1, -1, 108}, {2492, -1, 812, 108},
+    {2489, 2344, -1, 105}, {2490, -1, -1, 108}, {2493, -1, 813, 108}, {-1, -1, 814, 115},
+    {-1, -1, 815, 115}, {-1, -1, 816, 115}, {4619, 29, -1, 108}, {2496, -1, 817, 108},
+    {-1, -1, 818, 115}, {2498, 2280, -1, 102}, {2499, -1, -1, 108}, {2500, -1, -1, 117},
+    {2501, -1, -1, 105}, {2502, -1, -1, 100}, {2503, -1, -1, 95}, {2504, -1, -1, 111},
+    {2505, -1, -1, 117}, {2506, -1, -1, 110}, {2507, -1, -1, 99}, {2531, -1, 819, 101},
+    {2509, 2293, -1, 102}, {2510, -1, -1, 108}, {2511, -1, -1, 117}, {2512, -1, -1, 105},
+    {2513, -1, -1, 100}, {2514, -1, -1, 160}, {2515, -1, -1, 111}, {2516, -1, -1, 117},
+    {2517, -1, -1, 110}, {2518, -1, -1, 99}, {2532, -1, 820, 101}, {2520, 2306, -1, 102},
+    {2521, -1, -1, 108}, {2522, -1, -1, 117}, {2523, -1, -1, 105}, {2524, -1, -1, 100},
+    {2525, -1, -1, 194}, {2526, -1, -1, 160}, {2527, -1, -1, 111}, {2528, -1, -1, 117},
+    {2529, -1, -1, 110}, {2530, -1, -1, 99}, {2533, -1, 821, 101}, {-1, -1, 822, 115},
+    {-1, -1, 823, 115}, {-1, -1, 824, 115}, {2535, 2444, -1, 111}, {2536, -1, -1, 117},
+    {2537, -1, -1, 110}, {2538, -1, -1, 99}, {2549, -1, 825, 101}, {2540, 2447, -1, 111},
+    {2541, -1, -1, 117}, {2542, -1, -1, 110}, {2543, -1, -1, 99}, {2550, -1, 826, 101},
+    {2545, 2450, -1, 111}, {2546, -1, -1, 117}, {2547, -1, -1, 110}, {2548, -1, -1, 99},
+    {2551, -1, 827, 101}, {-1, -1, 828, 115}, {-1, -1, 829, 115}, {-1, -1, 830, 115},
+    {2636, 2362, -1, 108}, {2554, -1, -1, 117}, {2555, -1, -1, 105}, {2568, -1, -1, 100},
+    {2621, -1, -1, 95}, {2558, -1, -1, 111}, {2559, -1, -1, 117}, {2560, -1, -1, 110},
+    {2561, -1, -1, 99}, {2575, -1, 831, 101}, {2625, 2556, -1, 160}, {2564, -1, -1, 111},
+    {2565, -1, -1, 117}, {2566, -1, -1, 110}, {2567, -1, -1, 99}, {2576, -1, 832, 101},
+    {2569, 2562, -1, 194}, {2629, -1, -1, 160}, {2571, -1, -1, 111}, {2572, -1, -1, 117},
+    {2573, -1, -1, 110}, {2574, -1, -1, 99}, {2577, -1, 833, 101}, {-1, -1, 834, 115},
+    {-1, -1, 835, 115}, {-1, -1, 836, 115}, {2579, 2456, -1, 111}, {2580, -1, -1, 117},
+    {2581, -1, -1, 110}, {2582, -1, -1, 99}, {2593, -1, 837, 101}, {2584, 2459, -1, 111},
+    {2585, -1, -1, 117}, {2586, -1, -1, 110}, {2587, -1, -1, 99}, {2594, -1, 838, 101},
+    {2589, 2462, -1, 111}, {2590, -1, -1, 117}, {2591, -1, -1, 110}, {2592, -1, -1, 99},
+    {2595, -1, 839, 101}, {-1, -1, 840, 115}, {-1, -1, 841, 115}, {-1, -1, 842, 115},
+    {3500, 214, 843, 122}, {2598, 2553, -1, 111}, {-1, -1, 844, 122}, {2600, 1387, -1, 97},
+    {2601, -1, -1, 98}, {2602, -1, -1, 108}, {2603, -1, -1, 101}, {2604, -1, -1, 115},
+    {2605, -1, -1, 112}, {2606, -1, -1, 111}, {2607, -1, -1, 111}, {2608, -1, 845, 110},
+    {-1, -1, 846, 115}, {2611, -1, -1, 98}, {2616, -1, 847, 108}, {2612, 2610, -1, 115},
+    {-1, -1, 848, 112}, {2618, 2599, -1, 98}, {2615, -1, -1, 115}, {-1, -1, 849, 112},
+    {2617, -1, -1, 115}, {-1, -1, 850, 112}, {2619, 2614, -1, 108}, {2620, -1, -1, 115},
+    {-1, -1, 851, 112}, {2622, 2557, -1, 100}, {2623, -1, -1, 114}, {2624, -1, -1, 97},
+    {2633, -1, 852, 109}, {2626, 2563, -1, 100}, {2627, -1, -1, 114}, {2628, -1, -1, 97},
+    {2634, -1, 853, 109}, {2630, 2570, -1, 100}, {2631, -1, -1, 114}, {2632, -1, -1, 97},
+    {2635, -1, 854, 109}, {-1, -1, 855, 115}, {-1, -1, 856, 115}, {-1, -1, 857, 115},
+    {2637, 2597, -1, 100}, {-1, -1, 858, 114}, {2639, 1961, -1, 97}, {2640, -1, -1, 115},
+    {2641, -1, -1, 112}, {2642, -1, -1, 111}, {2643, -1, -1, 111}, {2644, -1, 859, 110},
+    {-1, -1, 860, 115}, {2646, 2613, -1, 115}, {-1, -1, 861, 112}, {2676, 1620, -1, 107},
+    {4448, -1, -1, 95}, {2650, -1, -1, 108}, {2651, -1, -1, 105}, {2652, -1, -1, 113},
+    {2653, -1, -1, 117}, {2654, -1, -1, 105}, {2655, -1, -1, 100}, {2789, -1, -1, 95},
+    {2740, -1, -1, 103}, {2658, -1, -1, 97}, {2659, -1, -1, 108}, {2660, -1, -1, 108},
+    {2661, -1, -1, 111}, {2692, -1, 862, 110}, {4458, 2648, -1, 160}, {2664, -1, -1, 108},
+    {2665, -1, -1, 105}, {2666, -1, -1, 113}, {2667, -1, -1, 117}, {2668, -1, -1, 105},
+    {2669, -1, -1, 100}, {2794, -1, -1, 160}, {2743, -1, -1, 103}, {2672, -1, -1, 97},
+    {2673, -1, -1, 108}, {2674, -1, -1, 108}, {2675, -1, -1, 111}, {2693, -1, 863, 110},
+    {2677, 2662, -1, 194}, {4468, -1, -1, 160}, {2679, -1, -1, 108}, {2680, -1, -1, 105},
+    {2681, -1, -1, 113}, {2682, -1, -1, 117}, {2683, -1, -1, 105}, {2684, -1, -1, 100},
+    {2685, -1, -1, 194}, {2799, -1, -1, 160}, {2746, -1, -1, 103}, {2688, -1, -1, 97},
+    {2689, -1, -1, 108}, {2690, -1, -1, 108}, {2691, -1, -1, 111}, {2694, -1, 864, 110},
+    {-1, -1, 865, 115}, {-1, -1, 866, 115}, {-1, -1, 867, 115}, {2696, 2656, -1, 113},
+    {2697, -1, -1, 117}, {2698, -1, -1, 97}, {2699, -1, -1, 114}, {2710, -1, 868, 116},
+    {2701, 2670, -1, 113}, {2702, -1, -1, 117}, {2703, -1, -1, 97}, {2704, -1, -1, 114},
+    {2711, -1, 869, 116}, {2706, 2686, -1, 113}, {2707, -1, -1, 117}, {2708, -1, -1, 97},
+    {2709, -1, -1, 114}, {2712, -1, 870, 116}, {-1, -1, 871, 115}, {-1, -1, 872, 115},
+    {-1, -1, 873, 115}, {2714, 2695, -1, 112}, {2715, -1, -1, 105}, {2716, -1, -1, 110},
+    {2725, -1, 874, 116}, {2718, 2700, -1, 112}, {2719, -1, -1, 105}, {2720, -1, -1, 110},
+    {2726, -1, 875, 116}, {2722, 2705, -1, 112}, {2723, -1, -1, 105}, {2724, -1, -1, 110},
+    {2727, -1, 876, 116}, {-1, -1, 877, 115}, {-1, -1, 878, 115}, {-1, -1, 879, 115},
+    {2729, 2713, -1, 99}, {2730, -1, -1, 117}, {2737, -1, 880, 112}, {2732, 2717, -1, 99},
+    {2733, -1, -1, 117}, {2738, -1, 881, 112}, {2735, 2721, -1, 99}, {2736, -1, -1, 117},
+    {2739, -1, 882, 112}, {-1, -1, 883, 115}, {-1, -1, 884, 115}, {-1, -1, 885, 115},
+    {2741, 2657, -1, 105}, {2742, -1, -1, 108}, {2749, -1, 886, 108}, {2744, 2671, -1, 105},
+    {2745, -1, -1, 108}, {2750, -1, 887, 108}, {2747, 2687, -1, 105}, {2748, -1, -1, 108},
+    {2751, -1, 888, 108}, {-1, -1, 889, 115}, {-1, -1, 890, 115}, {-1, -1, 891, 115},
+    {2753, 2649, -1, 102}, {2754, -1, -1, 108}, {2755, -1, -1, 117}, {2756, -1, -1, 105},
+    {2757, -1, -1, 100}, {2758, -1, -1, 95}, {2759, -1, -1, 111}, {2760, -1, -1, 117},
+    {2761, -1, -1, 110}, {2762, -1, -1, 99}, {2786, -1, 892, 101}, {2764, 2663, -1, 102},
+    {2765, -1, -1, 108}, {2766, -1, -1, 117}, {2767, -1, -1, 105}, {2768, -1, -1, 100},
+    {2769, -1, -1, 160}, {2770, -1, -1, 111}, {2771, -1, -1, 117}, {2772, -1, -1, 110},
+    {2773, -1, -1, 99}, {2787, -1, 893, 101}, {2775, 2678, -1, 102}, {2776, -1, -1, 108},
+    {2777, -1, -1, 117}, {2778, -1, -1, 105}, {2779, -1, -1, 100}, {2780, -1, -1, 194},
+    {2781, -1, -1, 160}, {2782, -1, -1, 111}, {2783, -1, -1, 117}, {2784, -1, -1, 110},
+    {2785, -1, -1, 99}, {2788, -1, 894, 101}, {-1, -1, 895, 115}, {-1, -1, 896, 115},
+    {-1, -1, 897, 115}, {2790, 2728, -1, 111}, {2791, -1, -1, 117}, {2792, -1, -1, 110},
+    {2793, -1, -1, 99}, {2804, -1, 898, 101}, {2795, 2731, -1, 111}, {2796, -1, -1, 117},
+    {2797, -1, -1, 110}, {2798, -1, -1, 99}, {2805, -1, 899, 101}, {2800, 2734, -1, 111},
+    {2801, -1, -1, 117}, {2802, -1, -1, 110}, {2803, -1, -1, 99}, {2806, -1, 900, 101},
+    {-1, -1, 901, 115}, {-1, -1, 902, 115}, {-1, -1, 903, 115}, {-1, 973, 904, 90},
+    {4294, 1334, -1, 97}, {2810, -1, -1, 107}, {2811, -1, 905, 101}, {-1, -1, 906, 115},
+    {2813, 222, -1, 100}, {2814, -1, -1, 101}, {2815, -1, -1, 114}, {2816, -1, -1, 101},
+    {2817, -1, -1, 97}, {2826, -1, -1, 108}, {2891, -1, -1, 95}, {2820, -1, -1, 100},
+    {2821, -1, -1, 97}, {2831, -1, 907, 121}, {2895, 2818, -1, 160}, {2824, -1, -1, 100},
+    {2825, -1, -1, 97}, {2832, -1, 908, 121}, {2827, 2822, -1, 194}, {2899, -1, -1, 160},
+    {2829, -1, -1, 100}, {2830, -1, -1, 97}, {2833, -1, 909, 121}, {-1, -1, 910, 115},
+    {-1, -1, 911, 115}, {-1, -1, 912, 115}, {2835, 2819, -1, 104}, {2836, -1, -1, 111},
+    {2837, -1, -1, 117}, {2846, -1, 913, 114}, {2839, 2823, -1, 104}, {2840, -1, -1, 111},
+    {2841, -1, -1, 117}, {2847, -1, 914, 114}, {2843, 2828, -1, 104}, {2844, -1, -1, 111},
+    {2845, -1, -1, 117}, {2848, -1, 915, 114}, {-1, -1, 916, 115}, {-1, -1, 917, 115},
+    {-1, -1, 918, 115}, {3055, 2834, -1, 109}, {2851, -1, -1, 105}, {2852, -1, -1, 110},
+    {2853, -1, -1, 117}, {2854, -1, -1, 116}, {2867, -1, 919, 101}, {3059, 2838, -1, 109},
+    {2857, -1, -1, 105}, {2858, -1, -1, 110}, {2859, -1, -1, 117}, {2860, -1, -1, 116},
+    {2868, -1, 920, 101}, {3063, 2842, -1, 109}, {2863, -1, -1, 105}, {2864, -1, -1, 110},
+    {2865, -1, -1, 117}, {2866, -1, -1, 116}, {2869, -1, 921, 101}, {-1, -1, 922, 115},
+    {-1, -1, 923, 115}, {-1, -1, 924, 115}, {2871, 2849, -1, 115}, {2872, -1, -1, 101},
+    {2873, -1, -1, 99}, {2874, -1, -1, 111}, {2875, -1, -1, 110}, {2888, -1, 925, 100},
+    {2877, 2855, -1, 115}, {2878, -1, -1, 101}, {2879, -1, -1, 99}, {2880, -1, -1, 111},
+    {2881, -1, -1, 110}, {2889, -1, 926, 100}, {2883, 2861, -1, 115}, {2884, -1, -1, 101},
+    {2885, -1, -1, 99}, {2886, -1, -1, 111}, {2887, -1, -1, 110}, {2890, -1, 927, 100},
+    {-1, -1, 928, 115}, {-1, -1, 929, 115}, {-1, -1, 930, 115}, {2892, 2870, -1, 121},
+    {2893, -1, -1, 101}, {2894, -1, -1, 97}, {2903, -1, 931, 114}, {2896, 2876, -1, 121},
+    {2897, -1, -1, 101}, {2898, -1, -1, 97}, {2904, -1, 932, 114}, {2900, 2882, -1, 121},
+    {2901, -1, -1, 101}, {2902, -1, -1, 97}, {2905, -1, 933, 114}, {-1, -1, 934, 115},
+    {-1, -1, 935, 115}, {-1, -1, 936, 115}, {2907, 1389, -1, 112}, {2908, -1, -1, 105},
+    {2909, -1, -1, 99}, {2910, -1, -1, 97}, {2921, -1, -1, 108}, {3070, -1, -1, 95},
+    {2913, -1, -1, 121}, {2914, -1, -1, 101}, {2915, -1, -1, 97}, {2927, -1, 937, 114},
+    {3075, 2911, -1, 160}, {2918, -1, -1, 121}, {2919, -1, -1, 101}, {2920, -1, -1, 97},
+    {2928, -1, 938, 114}, {2922, 2916, -1, 194}, {3080, -1, -1, 160}, {2924, -1, -1, 121},
+    {2925, -1, -1, 101}, {2926, -1, -1, 97}, {2929, -1, 939, 114}, {-1, -1, 940, 115},
+    {-1, -1, 941, 115}, {-1, -1, 942, 115}, {2931, 1823, -1, 101}, {2932, -1, -1, 97},
+    {2933, -1, 943, 114}, {-1, -1, 944, 115}, {-1, 2930, 945, 114}, {2936, 312, -1, 110},
+    {2937, -1, -1, 97}, {2950, -1, -1, 114}, {2939, -1, -1, 95}, {2940, -1, -1, 109},
+    {2941, -1, -1, 111}, {2942, -1, -1, 110}, {2943, -1, -1, 116}, {2957, -1, 946, 104},
+    {2945, 2938, -1, 160}, {2946, -1, -1, 109}, {2947, -1, -1, 111}, {2948, -1, -1, 110},
+    {2949, -1, -1, 116}, {2958, -1, 947, 104}, {2951, 2944, -1, 194}, {2952, -1, -1, 160},
+    {2953, -1, -1, 109}, {2954, -1, -1, 111}, {2955, -1, -1, 110}, {2956, -1, -1, 116},
+    {2959, -1, 948, 104}, {-1, -1, 949, 115}, {-1, -1, 950, 115}, {-1, -1, 951, 115},
+    {2961, 194, -1, 109}, {2962, -1, -1, 109}, {2963, -1, -1, 111}, {2974, -1, -1, 110},
+    {2965, -1, -1, 95}, {2966, -1, -1, 121}, {2967, -1, -1, 101}, {2968, -1, -1, 97},
+    {2980, -1, 952, 114}, {2970, 2964, -1, 160}, {2971, -1, -1, 121}, {2972, -1, -1, 101},
+    {2973, -1, -1, 97}, {2981, -1, 953, 114}, {2975, 2969, -1, 194}, {2976, -1, -1, 160},
+    {2977, -1, -1, 121}, {2978, -1, -1, 101}, {2979, -1, -1, 97}, {2982, -1, 954, 114},
+    {-1, -1, 955, 115}, {-1, -1, 956, 115}, {-1, -1, 957, 115}, {2984, 1274, -1, 101},
+    {2985, -1, -1, 97}, {2996, -1, -1, 112}, {2987, -1, -1, 95}, {2988, -1, -1, 121},
+    {2989, -1, -1, 101}, {2990, -1, -1, 97}, {3002, -1, 958, 114}, {2992, 2986, -1, 160},
+    {2993, -1, -1, 121}, {2994, -1, -1, 101}, {2995, -1, -1, 97}, {3003, -1, 959, 114},
+    {2997, 2991, -1, 194}, {2998, -1, -1, 160}, {2999, -1, -1, 121}, {3000, -1, -1, 101},
+    {3001, -1, -1, 97}, {3004, -1, 960, 114}, {-1, -1, 961, 115}, {-1, -1, 962, 115},
+    {-1, -1, 963, 115}, {3006, 181, -1, 117}, {3007, -1, -1, 108}, {3008, -1, -1, 105},
+    {3009, -1, -1, 97}, {3020, -1, -1, 110}, {3011, -1, -1, 95}, {3012, -1, -1, 121},
+    {3013, -1, -1, 101}, {3014, -1, -1, 97}, {3026, -1, 964, 114}, {3016, 3010, -1, 160},
+    {3017, -1, -1, 121}, {3018, -1, -1, 101}, {3019, -1, -1, 97}, {3027, -1, 965, 114},
+    {3021, 3015, -1, 194}, {3022, -1, -1, 160}, {3023, -1, -1, 121}, {3024, -1, -1, 101},
+    {3025, -1, -1, 97}, {3028, -1, 966, 114}, {-1, -1, 967, 115}, {-1, -1, 968, 115},
+    {-1, -1, 969, 115}, {3030, 163, -1, 101}, {3031, -1, -1, 103}, {3032, -1, -1, 111},
+    {3033, -1, -1, 114}, {3034, -1, -1, 105}, {3035, -1, -1, 97}, {3046, -1, -1, 110},
+    {3037, -1, -1, 95}, {3038, -1, -1, 121}, {3039, -1, -1, 101}, {3040, -1, -1, 97},
+    {3052, -1, 970, 114}, {3042, 3036, -1, 160}, {3043, -1, -1, 121}, {3044, -1, -1, 101},
+    {3045, -1, -1, 97}, {3053, -1, 971, 114}, {3047, 3041, -1, 194}, {3048, -1, -1, 160},
+    {3049, -1, -1, 121}, {3050, -1, -1, 101}, {3051, -1, -1, 97}, {3054, -1, 972, 114},
+    {-1, -1, 973, 115}, {-1, -1, 974, 115}, {-1, -1, 975, 115}, {3056, 2850, -1, 111},
+    {3057, -1, -1, 110}, {3058, -1, -1, 116}, {3067, -1, 976, 104}, {3060, 2856, -1, 111},
+    {3061, -1, -1, 110}, {3062, -1, -1, 116}, {3068, -1, 977, 104}, {3064, 2862, -1, 111},
+    {3065, -1, -1, 110}, {3066, -1, -1, 116}, {3069, -1, 978, 104}, {-1, -1, 979, 115},
+    {-1, -1, 980, 115}, {-1, -1, 981, 115}, {3071, 2912, -1, 109}, {3072, -1, -1, 111},
+    {3073, -1, -1, 110}, {3074, -1, -1, 116}, {3085, -1, 982, 104}, {3076, 2917, -1, 109},
+    {3077, -1, -1, 111}, {3078, -1, -1, 110}, {3079, -1, -1, 116}, {3086, -1, 983, 104},
+    {3081, 2923, -1, 109}, {3082, -1, -1, 111}, {3083, -1, -1, 110}, {3084, -1, -1, 116},
+    {3087, -1, 984, 104}, {-1, -1, 985, 115}, {-1, -1, 986, 115}, {-1, -1, 987, 115},
+    {3359, 1799, -1, 114}, {3090, -1, -1, 116}, {3091, -1, -1, 110}, {3092, -1, -1, 105},
+    {3093, -1, -1, 103}, {3094, -1, -1, 104}, {3095, -1, 988, 116}, {-1, -1, 989, 115},
+    {3097, 231, -1, 101}, {3098, -1, 990, 107}, {-1, -1, 991, 115}, {3100, 3005, -1, 105},
+    {3101, -1, -1, 102}, {3103, -1, -1, 102}, {-1, -1, 992, 121}, {3104, 3102, -1, 105},
+    {3105, -1, -1, 101}, {-1, -1, 993, 115}, {3107, 962, -1, 111}, {3108, -1, 994, 110},
+    {-1, -1, 995, 115}, {3110, 127, -1, 110}, {3111, -1, -1, 116}, {3112, -1, 996, 104},
+    {-1, -1, 997, 115}, {3114, 1479, -1, 118}, {3115, -1, -1, 101}, {3116, -1, -1, 114},
+    {3117, -1, -1, 100}, {3118, -1, -1, 114}, {3119, -1, -1, 117}, {3120, -1, 998, 112},
+    {-1, -1, 999, 115}, {4624, 146, -1, 97}, {3123, -1, -1, 110}, {3124, -1, -1, 100},
+    {3125, -1, -1, 97}, {3126, -1, -1, 114}, {3147, -1, -1, 100}, {3667, -1, -1, 95},
+    {3129, -1, -1, 102}, {3130, -1, -1, 114}, {3131, -1, -1, 101}, {3132, -1, -1, 101},
+    {3133, -1, -1, 95}, {3134, -1, -1, 102}, {3135, -1, -1, 97}, {3136, -1, -1, 108},
+    {3159, -1, 1000, 108}, {3677, 3127, -1, 160}, {3139, -1, -1, 102}, {3140, -1, -1, 114},
+    {3141, -1, -1, 101}, {3142, -1, -1, 101}, {3143, -1, -1, 160}, {3144, -1, -1, 102},
+    {3145, -1, -1, 97}, {3146, -1, -1, 108}, {3160, -1, 1001, 108}, {3148, 3137, -1, 194},
+    {3687, -1, -1, 160}, {3150, -1, -1, 102}, {3151, -1, -1, 114}, {3152, -1, -1, 101},
+    {3153, -1, -1, 101}, {3154, -1, -1, 194}, {3155, -1, -1, 160}, {3156, -1, -1, 102},
+    {3157, -1, -1, 97}, {3158, -1, -1, 108}, {3161, -1, 1002, 108}, {-1, -1, 1003, 115},
+    {-1, -1, 1004, 115}, {-1, -1, 1005, 115}, {3163, 1271, -1, 118}, {3164, -1, -1, 105},
+    {3166, -1, -1, 116}, {-1, -1, 1006, 121}, {3167, 3165, -1, 105}, {3168, -1, -1, 101},
+    {-1, -1, 1007, 115}, {3170, 2960, -1, 110}, {3171, -1, -1, 118}, {3172, -1, -1, 101},
+    {3173, -1, -1, 110}, {3174, -1, -1, 116}, {3175, -1, -1, 105}, {3176, -1, -1, 111},
+    {3177, -1, -1, 110}, {3178, -1, -1, 97}, {3191, -1, -1, 108}, {3310, -1, -1, 95},
+    {3181, -1, -1, 119}, {3182, -1, -1, 97}, {3183, -1, -1, 116}, {3184, -1, -1, 101},
+    {3198, -1, 1008, 114}, {3317, 3179, -1, 160}, {3187, -1, -1, 119}, {3188, -1, -1, 97},
+    {3189, -1, -1, 116}, {3190, -1, -1, 101}, {3199, -1, 1009, 114}, {3192, 3185, -1, 194},
+    {3324, -1, -1, 160}, {3194, -1, -1, 119}, {3195, -1, -1, 97}, {3196, -1, -1, 116},
+    {3197, -1, -1, 101}, {3200, -1, 1010, 114}, {-1, -1, 1011, 115}, {-1, -1, 1012, 115},
+    {-1, -1, 1013, 115}, {3202, 190, -1, 101}, {3214, -1, 1014, 114}, {3224, -1, 1015, 115},
+    {3205, 161, -1, 50}, {-1, -1, 1016, 79}, {3207, 351, -1, 50}, {-1, -1, 1017, 111},
+    {4415, 3203, -1, 95}, {3210, -1, -1, 52}, {-1, -1, 1018, 99}, {4425, 3208, -1, 160},
+    {3213, -1, -1, 52}, {-1, -1, 1019, 99}, {3215, 3211, -1, 194}, {4435, -1, -1, 160},
+    {3217, -1, -1, 52}, {-1, -1, 1020, 99}, {3255, -1, -1, 95}, {3220, -1, -1, 52},
+    {-1, -1, 1021, 99}, {3258, 3218, -1, 160}, {3223, -1, -1, 52}, {-1, -1, 1022, 99},
+    {3225, 3221, -1, 194}, {3261, -1, -1, 160}, {3227, -1, -1, 52}, {-1, -1, 1023, 99},
+    {3229, 3209, -1, 51}, {3230, -1, -1, 57}, {-1, -1, 1024, 102}, {3232, 3212, -1, 51},
+    {3233, -1, -1, 57}, {-1, -1, 1025, 102}, {3235, 3216, -1, 51}, {3236, -1, -1, 57},
+    {-1, -1, 1026, 102}, {3238, 3219, -1, 51}, {3239, -1, -1, 57}, {-1, -1, 1027, 102},
+    {3241, 3222, -1, 51}, {3242, -1, -1, 57}, {-1, -1, 1028, 102}, {3244, 3226, -1, 51},
+    {3245, -1, -1, 57}, {-1, -1, 1029, 102}, {3247, 3228, -1, 54}, {3248, -1, -1, 48},
+    {-1, -1, 1030, 102}, {3250, 3231, -1, 54}, {3251, -1, -1, 48}, {-1, -1, 1031, 102},
+    {3253, 3234, -1, 54}, {3254, -1, -1, 48}, {-1, -1, 1032, 102}, {3256, 3237, -1, 54},
+    {3257, -1, -1, 48}, {-1, -1, 1033, 102}, {3259, 3240, -1, 54}, {3260, -1, -1, 48},
+    {-1, -1, 1034, 102}, {3262, 3243, -1, 54}, {3263, -1, -1, 48}, {-1, -1, 1035, 102},
+    {3265, 92, -1, 114}, {3266, -1, -1, 99}, {3267, -1, -1, 117}, {3279, -1, -1, 114},
+    {3275, -1, -1, 121}, {3341, -1, -1, 95}, {3271, -1, -1, 48}, {-1, -1, 1036, 99},
+    {3344, 3269, -1, 160}, {3274, -1, -1, 48}, {-1, -1, 1037, 99}, {3276, 3272, -1, 194},
+    {3347, -1, -1, 160}, {3278, -1, -1, 48}, {-1, -1, 1038, 99}, {3280, 3268, -1, 105},
+    {3281, -1, -1, 101}, {3288, -1, -1, 115}, {3350, -1, -1, 95}, {3284, -1, -1, 48},
+    {-1, -1, 1039, 99}, {3353, 3282, -1, 160}, {3287, -1, -1, 48}, {-1, -1, 1040, 99},
+    {3289, 3285, -1, 194}, {3356, -1, -1, 160}, {3291, -1, -1, 48}, {-1, -1, 1041, 99},
+    {3293, 3270, -1, 51}, {3294, -1, -1, 50}, {-1, -1, 1042, 102}, {3296, 3273, -1, 51},
+    {3297, -1, -1, 50}, {-1, -1, 1043, 102}, {3299, 3277, -1, 51}, {3300, -1, -1, 50},
+    {-1, -1, 1044, 102}, {3302, 3283, -1, 51}, {3303, -1, -1, 50}, {-1, -1, 1045, 102},
+    {3305, 3286, -1, 51}, {3306, -1, -1, 50}, {-1, -1, 1046, 102}, {3308, 3290, -1, 51},
+    {3309, -1, -1, 50}, {-1, -1, 1047, 102}, {3311, 3180, -1, 109}, {3312, -1, -1, 101},
+    {3313, -1, -1, 114}, {3314, -1, -1, 99}, {3315, -1, -1, 117}, {3331, -1, -1, 114},
+    {-1, -1, 1048, 121}, {3318, 3186, -1, 109}, {3319, -1, -1, 101}, {3320, -1, -1, 114},
+    {3321, -1, -1, 99}, {3322, -1, -1, 117}, {3334, -1, -1, 114}, {-1, -1, 1049, 121},
+    {3325, 3193, -1, 109}, {3326, -1, -1, 101}, {3327, -1, -1, 114}, {3328, -1, -1, 99},
+    {3329, -1, -1, 117}, {3337, -1, -1, 114}, {-1, -1, 1050, 121}, {3332, 3316, -1, 105},
+    {3333, -1, -1, 101}, {-1, -1, 1051, 115}, {3335, 3323, -1, 105}, {3336, -1, -1, 101},
+    {-1, -1, 1052, 115}, {3338, 3330, -1, 105}, {3339, -1, -1, 101}, {-1, -1, 1053, 115},
+    {-1, 3204, 1054, 103}, {3342, 3292, -1, 54}, {3343, -1, -1, 48}, {-1, -1, 1055, 102},
+    {3345, 3295, -1, 54}, {3346, -1, -1, 48}, {-1, -1, 1056, 102}, {3348, 3298, -1, 54},
+    {3349, -1, -1, 48}, {-1, -1, 1057, 102}, {3351, 3301, -1, 54}, {3352, -1, -1, 48},
+    {-1, -1, 1058, 102}, {3354, 3304, -1, 54}, {3355, -1, -1, 48}, {-1, -1, 1059, 102},
+    {3357, 3307, -1, 54}, {3358, -1, -1, 48}, {-1, -1, 1060, 102}, {3360, 3089, -1, 99},
+    {3387, -1, 1061, 101}, {-1, -1, 1062, 115}, {3363, 1491, -1, 121}, {5055, -1, -1, 110},
+    {3365, -1, 1063, 101}, {-1, -1, 1064, 115}, {3367, 1737, -1, 110}, {3368, -1, 1065, 100},
+    {-1, -1, 1066, 115}, {3615, 3361, -1, 95}, {3371, -1, -1, 107}, {3372, -1, -1, 105},
+    {3373, -1, -1, 108}, {3374, -1, -1, 111}, {3375, -1, -1, 103}, {3376, -1, -1, 114},
+    {3377, -1, -1, 97}, {3397, -1, 1067, 109}, {3618, 3369, -1, 160}, {3380, -1, -1, 107},
+    {3381, -1, -1, 105}, {3382, -1, -1, 108}, {3383, -1, -1, 111}, {3384, -1, -1, 103},
+    {3385, -1, -1, 114}, {3386, -1, -1, 97}, {3398, -1, 1068, 109}, {3388, 3378, -1, 194},
+    {3621, -1, -1, 160}, {3390, -1, -1, 107}, {3391, -1, -1, 105}, {3392, -1, -1, 108},
+    {3393, -1, -1, 111}, {3394, -1, -1, 103}, {3395, -1, -1, 114}, {3396, -1, -1, 97},
+    {3399, -1, 1069, 109}, {-1, -1, 1070, 115}, {-1, -1, 1071, 115}, {-1, -1, 1072, 115},
+    {3401, 103, -1, 95}, {3402, -1, -1, 102}, {3403, -1, -1, 111}, {3404, -1, -1, 114},
+    {3405, -1, -1, 99}, {-1, -1, 1073, 101}, {3407, 3400, -1, 160}, {3408, -1, -1, 102},
+    {3409, -1, -1, 111}, {3410, -1, -1, 114}, {3411, -1, -1, 99}, {-1, -1, 1074, 101},
+    {3413, 3406, -1, 194}, {3414, -1, -1, 160}, {3415, -1, -1, 102}, {3416, -1, -1, 111},
+    {3417, -1, -1, 114}, {3418, -1, -1, 99}, {-1, -1, 1075, 101}, {3420, -1, -1, 95},
+    {3421, -1, -1, 102}, {3422, -1, -1, 111}, {3423, -1, -1, 114}, {3424, -1, -1, 99},
+    {-1, -1, 1076, 101}, {3426, 3419, -1, 160}, {3427, -1, -1, 102}, {3428, -1, -1, 111},
+    {3429, -1, -1, 114}, {3430, -1, -1, 99}, {-1, -1, 1077, 101}, {3432, 3425, -1, 194},
+    {3433, -1, -1, 160}, {3434, -1, -1, 102}, {3435, -1, -1, 111}, {3436, -1, -1, 114},
+    {3437, -1, -1, 99}, {-1, -1, 1078, 101}, {-1, -1, 1079, 102}, {3440, 3370, -1, 111},
+    {3441, -1, -1, 117}, {3442, -1, -1, 110}, {3443, -1, -1, 99}, {3454, -1, 1080, 101},
+    {3445, 3379, -1, 111}, {3446, -1, -1, 117}, {3447, -1, -1, 110}, {3448, -1, -1, 99},
+    {3455, -1, 1081, 101}, {3450, 3389, -1, 111}, {3451, -1, -1, 117}, {3452, -1, -1, 110},
+    {3453, -1, -1, 99}, {3456, -1, 1082, 101}, {-1, -1, 1083, 115}, {-1, -1, 1084, 115},
+    {-1, -1, 1085, 115}, {3458, 2596, -1, 117}, {3459, -1, -1, 110}, {3460, -1, -1, 99},
+    {3480, -1, -1, 101}, {3462, -1, -1, 95}, {3463, -1, -1, 102}, {3464, -1, -1, 111},
+    {3465, -1, -1, 114}, {3466, -1, -1, 99}, {-1, -1, 1086, 101}, {3468, 3461, -1, 160},
+    {3469, -1, -1, 102}, {3470, -1, -1, 111}, {3471, -1, -1, 114}, {3472, -1, -1, 99},
+    {-1, -1, 1087, 101}, {3474, 3467, -1, 194}, {3475, -1, -1, 160}, {3476, -1, -1, 102},
+    {3477, -1, -1, 111}, {3478, -1, -1, 114}, {3479, -1, -1, 99}, {-1, -1, 1088, 101},
+    {3493, 3473, -1, 115}, {3482, -1, -1, 95}, {3483, -1, -1, 102}, {3484, -1, -1, 111},
+    {3485, -1, -1, 114}, {3486, -1, -1, 99}, {-1, -1, 1089, 101}, {3488, 3481, -1, 160},
+    {3489, -1, -1, 102}, {3490, -1, -1, 111}, {3491, -1, -1, 114}, {3492, -1, -1, 99},
+    {-1, -1, 1090, 101}, {3494, 3487, -1, 194}, {3495, -1, -1, 160}, {3496, -1, -1, 102},
+    {3497, -1, -1, 111}, {3498, -1, -1, 114}, {3499, -1, -1, 99}, {-1, -1, 1091, 101},
+    {-1, -1, 1092, 102}, {3502, 3439, -1, 112}, {3503, -1, -1, 111}, {3504, -1, -1, 117},
+    {3505, -1, -1, 110}, {3516, -1, 1093, 100}, {3507, 3444, -1, 112}, {3508, -1, -1, 111},
+    {3509, -1, -1, 117}, {3510, -1, -1, 110}, {3517, -1, 1094, 100}, {3512, 3449, -1, 112},
+    {3513, -1, -1, 111}, {3514, -1, -1, 117}, {3515, -1, -1, 110}, {3518, -1, 1095, 100},
+    {-1, -1, 1096, 115}, {-1, -1, 1097, 115}, {-1, -1, 1098, 115}, {3520, 1265, -1, 95},
+    {3521, -1, -1, 102}, {3522, -1, -1, 111}, {3523, -1, -1, 114}, {3524, -1, -1, 99},
+    {-1, -1, 1099, 101}, {3526, 3519, -1, 160}, {3527, -1, -1, 102}, {3528, -1, -1, 111},
+    {3529, -1, -1, 114}, {3530, -1, -1, 99}, {-1, -1, 1100, 101}, {3532, 3525, -1, 194},
+    {3533, -1, -1, 160}, {3534, -1, -1, 102}, {3535, -1, -1, 111}, {3536, -1, -1, 114},
+    {3537, -1, -1, 99}, {-1, -1, 1101, 101}, {3539, -1, -1, 95}, {3540, -1, -1, 102},
+    {3541, -1, -1, 111}, {3542, -1, -1, 114}, {3543, -1, -1, 99}, {-1, -1, 1102, 101},
+    {3545, 3538, -1, 160}, {3546, -1, -1, 102}, {3547, -1, -1, 111}, {3548, -1, -1, 114},
+    {3549, -1, -1, 99}, {-1, -1, 1103, 101}, {3551, 3544, -1, 194}, {3552, -1, -1, 160},
+    {3553, -1, -1, 102}, {3554, -1, -1, 111}, {3555, -1, -1, 114}, {3556, -1, -1, 99},
+    {-1, -1, 1104, 101}, {-1, -1, 1105, 102}, {3559, 3531, -1, 97}, {3560, -1, 1106, 108},
+    {-1, -1, 1107, 115}, {3562, 165, -1, 95}, {3563, -1, -1, 102}, {3564, -1, -1, 111},
+    {3565, -1, -1, 114}, {3566, -1, -1, 99}, {-1, -1, 1108, 101}, {3568, 3561, -1, 160},
+    {3569, -1, -1, 102}, {3570, -1, -1, 111}, {3571, -1, -1, 114}, {3572, -1, -1, 99},
+    {-1, -1, 1109, 101}, {3574, 3567, -1, 194}, {3575, -1, -1, 160}, {3576, -1, -1, 102},
+    {3577, -1, -1, 111}, {3578, -1, -1, 114}, {3579, -1, -1, 99}, {-1, -1, 1110, 101},
+    {3581, -1, -1, 95}, {3582, -1, -1, 102}, {3583, -1, -1, 111}, {3584, -1, -1, 114},
+    {3585, -1, -1, 99}, {-1, -1, 1111, 101}, {3587, 3580, -1, 160}, {3588, -1, -1, 102},
+    {3589, -1, -1, 111}, {3590, -1, -1, 114}, {3591, -1, -1, 99}, {-1, -1, 1112, 101},
+    {3593, 3586, -1, 194}, {3594, -1, -1, 160}, {3595, -1, -1, 102}, {3596, -1, -1, 111},
+    {3597, -1, -1, 114}, {3598, -1, -1, 99}, {-1, -1, 1113, 101}, {3600, 3501, -1, 103},
+    {3601, -1, -1, 114}, {3602, -1, -1, 97}, {3611, -1, 1114, 109}, {3604, 3506, -1, 103},
+    {3605, -1, -1, 114}, {3606, -1, -1, 97}, {3612, -1, 1115, 109}, {3608, 3511, -1, 103},
+    {3609, -1, -1, 114}, {3610, -1, -1, 97}, {3613, -1, 1116, 109}, {-1, -1, 1117, 115},
+    {-1, -1, 1118, 115}, {-1, -1, 1119, 115}, {-1, 879, 1120, 102}, {3616, 3599, -1, 116},
+    {3617, -1, -1, 111}, {3624, -1, 1121, 110}, {3619, 3603, -1, 116}, {3620, -1, -1, 111},
+    {3625, -1, 1122, 110}, {3622, 3607, -1, 116}, {3623, -1, -1, 111}, {3626, -1, 1123, 110},
+    {-1, -1, 1124, 115}, {-1, -1, 1125, 115}, {-1, -1, 1126, 115}, {4508, 1520, -1, 95},
+    {3629, -1, -1, 102}, {3630, -1, -1, 111}, {3631, -1, -1, 114}, {3632, -1, -1, 99},
+    {-1, -1, 1127, 101}, {4524, 3627, -1, 160}, {3635, -1, -1, 102}, {3636, -1, -1, 111},
+    {3637, -1, -1, 114}, {3638, -1, -1, 99}, {-1, -1, 1128, 101}, {3640, 3633, -1, 194},
+    {4540, -1, -1, 160}, {3642, -1, -1, 102}, {3643, -1, -1, 111}, {3644, -1, -1, 114},
+    {3645, -1, -1, 99}, {-1, -1, 1129, 101}, {4557, -1, -1, 95}, {3648, -1, -1, 102},
+    {3649, -1, -1, 111}, {3650, -1, -1, 114}, {3651, -1, -1, 99}, {-1, -1, 1130, 101},
+    {4573, 3646, -1, 160}, {3654, -1, -1, 102}, {3655, -1, -1, 111}, {3656, -1, -1, 114},
+    {3657, -1, -1, 99}, {-1, -1, 1131, 101}, {3659, 3652, -1, 194}, {4589, -1, -1, 160},
+    {3661, -1, -1, 102}, {3662, -1, -1, 111}, {3663, -1, -1, 114}, {3664, -1, -1, 99},
+    {-1, -1, 1132, 101}, {3666, 39, 1133, 112}, {-1, -1, 1134, 115}, {3668, 3128, -1, 97},
+    {3669, -1, -1, 116}, {3670, -1, -1, 109}, {3671, -1, -1, 111}, {3672, -1, -1, 115},
+    {3673, -1, -1, 112}, {3674, -1, -1, 104}, {3675, -1, -1, 101}, {3676, -1, -1, 114},
+    {3697, -1, 1135, 101}, {3678, 3138, -1, 97}, {3679, -1, -1, 116}, {3680, -1, -1, 109},
+    {3681, -1, -1, 111}, {3682, -1, -1, 115}, {3683, -1, -1, 112}, {3684, -1, -1, 104},
+    {3685, -1, -1, 101}, {3686, -1, -1, 114}, {3698, -1, 1136, 101}, {3688, 3149, -1, 97},
+    {3689, -1, -1, 116}, {3690, -1, -1, 109}, {3691, -1, -1, 111}, {3692, -1, -1, 115},
+    {3693, -1, -1, 112}, {3694, -1, -1, 104}, {3695, -1, -1, 101}, {3696, -1, -1, 114},
+    {3699, -1, 1137, 101}, {-1, -1, 1138, 115}, {-1, -1, 1139, 115}, {-1, -1, 1140, 115},
+    {3701, 651, 1143, 109}, {3702, -1, -1, 111}, {3703, -1, -1, 115}, {3704, -1, -1, 112},
+    {3705, -1, -1, 104}, {3706, -1, -1, 101}, {3707, -1, -1, 114}, {3708, -1, 1141, 101},
+    {-1, -1, 1142, 115}, {3710, 2638, -1, 99}, {3711, -1, -1, 104}, {3712, -1, -1, 110},
+    {3713, -1, -1, 105}, {3714, -1, -1, 99}, {3715, -1, -1, 97}, {3738, -1, -1, 108},
+    {3717, -1, -1, 95}, {3718, -1, -1, 97}, {3719, -1, -1, 116}, {3720, -1, -1, 109},
+    {3721, -1, -1, 111}, {3722, -1, -1, 115}, {3723, -1, -1, 112}, {3724, -1, -1, 104},
+    {3725, -1, -1, 101}, {3726, -1, -1, 114}, {3750, -1, 1144, 101}, {3728, 3716, -1, 160},
+    {3729, -1, -1, 97}, {3730, -1, -1, 116}, {3731, -1, -1, 109}, {3732, -1, -1, 111},
+    {3733, -1, -1, 115}, {3734, -1, -1, 112}, {3735, -1, -1, 104}, {3736, -1, -1, 101},
+    {3737, -1, -1, 114}, {3751, -1, 1145, 101}, {3739, 3727, -1, 194}, {3740, -1, -1, 160},
+    {3741, -1, -1, 97}, {3742, -1, -1, 116}, {3743, -1, -1, 109}, {3744, -1, -1, 111},
+    {3745, -1, -1, 115}, {3746, -1, -1, 112}, {3747, -1, -1, 104}, {3748, -1, -1, 101},
+    {3749, -1, -1, 114}, {3752, -1, 1146, 101}, {-1, -1, 1147, 115}, {-1, -1, 1148, 115},
+    {-1, -1, 1149, 115}, {3767, 2184, -1, 109}, {3755, -1, -1, 95}, {3908, -1, -1, 72},
+    {3757, -1, -1, 50}, {-1, -1, 1151, 79}, {3759, 3754, -1, 160}, {3909, -1, -1, 72},
+    {3761, -1, -1, 50}, {-1, -1, 1152, 79}, {3763, 3758, -1, 194}, {3764, -1, -1, 160},
+    {3910, -1, -1, 72}, {3766, -1, -1, 50}, {-1, -1, 1153, 79}, {3911, 3762, -1, 72},
+    {3769, -1, -1, 50}, {-1, -1, 1154, 79}, {3771, 1775, -1, 95}, {3958, -1, -1, 104},
+    {3773, -1, -1, 50}, {3774, -1, -1, 111}, {3822, -1, -1, 95}, {3776, -1, -1, 51},
+    {3777, -1, -1, 57}, {-1, -1, 1155, 102}, {3779, 3770, -1, 160}, {3963, -1, -1, 104},
+    {3781, -1, -1, 50}, {3782, -1, -1, 111}, {3825, -1, -1, 160}, {3784, -1, -1, 51},
+    {3785, -1, -1, 57}, {-1, -1, 1156, 102}, {3787, 3778, -1, 194}, {3788, -1, -1, 160},
+    {3968, -1, -1, 104}, {3790, -1, -1, 50}, {3791, -1, -1, 111}, {3792, -1, -1, 194},
+    {3828, -1, -1, 160}, {3794, -1, -1, 51}, {3795, -1, -1, 57}, {-1, -1, 1157, 102},
+    {3797, -1, -1, 95}, {3974, -1, -1, 104}, {3799, -1, -1, 50}, {3800, -1, -1, 111},
+    {3831, -1, -1, 95}, {3802, -1, -1, 51}, {3803, -1, -1, 57}, {-1, -1, 1158, 102},
+    {3805, 3796, -1, 160}, {3979, -1, -1, 104}, {3807, -1, -1, 50}, {3808, -1, -1, 111},
+    {3834, -1, -1, 160}, {3810, -1, -1, 51}, {3811, -1, -1, 57}, {-1, -1, 1159, 102},
+    {3813, 3804, -1, 194}, {3814, -1, -1, 160}, {3984, -1, -1, 104}, {3816, -1, -1, 50},
+    {3817, -1, -1, 111}, {3818, -1, -1, 194}, {3837, -1, -1, 160}, {3820, -1, -1, 51},
+    {3821, -1, -1, 57}, {-1, -1, 1160, 102}, {3823, 3775, -1, 54}, {3824, -1, -1, 48},
+    {-1, -1, 1161, 102}, {3826, 3783, -1, 54}, {3827, -1, -1, 48}, {-1, -1, 1162, 102},
+    {3829, 3793, -1, 54}, {3830, -1, -1, 48}, {-1, -1, 1163, 102}, {3832, 3801, -1, 54},
+    {3833, -1, -1, 48}, {-1, -1, 1164, 102}, {3835, 3809, -1, 54}, {3836, -1, -1, 48},
+    {-1, -1, 1165, 102}, {3838, 3819, -1, 54}, {3839, -1, -1, 48}, {-1, -1, 1166, 102},
+    {3878, -1, -1, 95}, {3842, -1, -1, 119}, {3843, -1, -1, 97}, {3844, -1, -1, 116},
+    {3845, -1, -1, 101}, {-1, -1, 1167, 114}, {3881, 3840, -1, 160}, {3848, -1, -1, 119},
+    {3849, -1, -1, 97}, {3850, -1, -1, 116}, {3851, -1, -1, 101}, {-1, -1, 1168, 114},
+    {3853, 3846, -1, 194}, {3884, -1, -1, 160}, {3855, -1, -1, 119}, {3856, -1, -1, 97},
+    {3857, -1, -1, 116}, {3858, -1, -1, 101}, {-1, -1, 1169, 114}, {3887, -1, -1, 95},
+    {3861, -1, -1, 119}, {3862, -1, -1, 97}, {3863, -1, -1, 116}, {3864, -1, -1, 101},
+    {-1, -1, 1170, 114}, {3890, 3859, -1, 160}, {3867, -1, -1, 119}, {3868, -1, -1, 97},
+    {3869, -1, -1, 116}, {3870, -1, -1, 101}, {-1, -1, 1171, 114}, {3872, 3865, -1, 194},
+    {3893, -1, -1, 160}, {3874, -1, -1, 119}, {3875, -1, -1, 97}, {3876, -1, -1, 116},
+    {3877, -1, -1, 101}, {-1, -1, 1172, 114}, {3879, 3841, -1, 104}, {3880, -1, -1, 50},
+    {-1, -1, 1173, 111}, {3882, 3847, -1, 104}, {3883, -1, -1, 50}, {-1, -1, 1174, 111},
+    {3885, 3854, -1, 104}, {3886, -1, -1, 50}, {-1, -1, 1175, 111}, {3888, 3860, -1, 104},
+    {3889, -1, -1, 50}, {-1, -1, 1176, 111}, {3891, 3866, -1, 104}, {3892, -1, -1, 50},
+    {-1, -1, 1177, 111}, {3894, 3873, -1, 104}, {3895, -1, -1, 50}, {-1, -1, 1178, 111},
+    {3897, 3852, -1, 104}, {3898, -1, -1, 50}, {-1, -1, 1179, 111}, {3900, 3871, -1, 104},
+    {3901, -1, -1, 50}, {-1, -1, 1180, 111}, {3903, -1, -1, 72}, {3904, -1, -1, 50},
+    {-1, -1, 1181, 79}, {3906, 3902, -1, 104}, {3907, -1, -1, 50}, {-1, -1, 1182, 111},
+    {-1, 3756, 1183, 103}, {-1, 3760, 1184, 103}, {-1, 3765, 1185, 103}, {-1, 3768, 1186, 103},
+    {3913, -1, -1, 109}, {3914, -1, -1, 101}, {3915, -1, -1, 116}, {3916, -1, -1, 101},
+    {3937, -1, -1, 114}, {3918, -1, -1, 95}, {3919, -1, -1, 104}, {3920, -1, 1205, 103},
+    {3921, -1, -1, 95}, {3922, -1, -1, 48}, {-1, -1, 1187, 99}, {3924, 3917, -1, 160},
+    {3925, -1, -1, 104}, {3926, -1, 1206, 103}, {3927, -1, -1, 160}, {3928, -1, -1, 48},
+    {-1, -1, 1188, 99}, {3930, 3923, -1, 194}, {3931, -1, -1, 160}, {3932, -1, -1, 104},
+    {3933, -1, 1207, 103}, {3934, -1, -1, 194}, {3935, -1, -1, 160}, {3936, -1, -1, 48},
+    {-1, -1, 1189, 99}, {3950, 3929, -1, 115}, {3939, -1, -1, 95}, {3940, -1, -1, 104},
+    {3941, -1, 1208, 103}, {3942, -1, -1, 95}, {3943, -1, -1, 48}, {-1, -1, 1190, 99},
+    {3945, 3938, -1, 160}, {3946, -1, -1, 104}, {3947, -1, 1209, 103}, {3948, -1, -1, 160},
+    {3949, -1, -1, 48}, {-1, -1, 1191, 99}, {3951, 3944, -1, 194}, {3952, -1, -1, 160},
+    {3953, -1, -1, 104}, {3954, -1, 1210, 103}, {3955, -1, -1, 194}, {3956, -1, -1, 160},
+    {3957, -1, -1, 48}, {-1, -1, 1192, 99}, {3959, 3772, 1221, 103}, {3990, -1, -1, 95},
+    {3961, -1, -1, 51}, {3962, -1, -1, 50}, {-1, -1, 1193, 102}, {3964, 3780, 1222, 103},
+    {3993, -1, -1, 160}, {3966, -1, -1, 51}, {3967, -1, -1, 50}, {-1, -1, 1194, 102},
+    {3969, 3789, 1223, 103}, {3970, -1, -1, 194}, {3996, -1, -1, 160}, {3972, -1, -1, 51},
+    {3973, -1, -1, 50}, {-1, -1, 1195, 102}, {3975, 3798, 1224, 103}, {3999, -1, -1, 95},
+    {3977, -1, -1, 51}, {3978, -1, -1, 50}, {-1, -1, 1196, 102}, {3980, 3806, 1225, 103},
+    {4002, -1, -1, 160}, {3982, -1, -1, 51}, {3983, -1, -1, 50}, {-1, -1, 1197, 102},
+    {3985, 3815, 1226, 103}, {3986, -1, -1, 194}, {4005, -1, -1, 160}, {3988, -1, -1, 51},
+    {3989, -1, -1, 50}, {-1, -1, 1198, 102}, {3991, 3960, -1, 54}, {3992, -1, -1, 48},
+    {-1, -1, 1199, 102}, {3994, 3965, -1, 54}, {3995, -1, -1, 48}, {-1, -1, 1200, 102},
+    {3997, 3971, -1, 54}, {3998, -1, -1, 48}, {-1, -1, 1201, 102}, {4000, 3976, -1, 54},
+    {4001, -1, -1, 48}, {-1, -1, 1202, 102}, {4003, 3981, -1, 54}, {4004, -1, -1, 48},
+    {-1, -1, 1203, 102}, {4006, 3987, -1, 54}, {4007, -1, -1, 48}, {-1, -1, 1204, 102},
+    {4009, 552, -1, 114}, {4010, -1, 1211, 114}, {-1, -1, 1212, 115}, {4030, 126, -1, 109},
+    {4022, -1, -1, 95}, {4014, -1, -1, 72}, {-1, -1, 1213, 103}, {4024, 4012, -1, 160},
+    {4017, -1, -1, 72}, {-1, -1, 1214, 103}, {4019, 4015, -1, 194}, {4026, -1, -1, 160},
+    {4021, -1, -1, 72}, {-1, -1, 1215, 103}, {4023, 4013, -1, 104}, {-1, -1, 1216, 103},
+    {4025, 4016, -1, 104}, {-1, -1, 1217, 103}, {4027, 4020, -1, 104}, {-1, -1, 1218, 103},
+    {4029, 4018, -1, 72}, {-1, -1, 1219, 103}, {4031, 4028, -1, 104}, {-1, -1, 1220, 103},
+    {4033, 1773, -1, 95}, {4034, -1, -1, 72}, {-1, -1, 1227, 103}, {4036, 4032, -1, 160},
+    {4037, -1, -1, 72}, {-1, -1, 1228, 103}, {4039, 4035, -1, 194}, {4040, -1, -1, 160},
+    {4041, -1, -1, 72}, {-1, -1, 1229, 103}, {4043, 4038, -1, 72}, {-1, -1, 1230, 103},
+    {4045, 2443, -1, 115}, {-1, -1, 1231, 105}, {4047, 994, -1, 115}, {-1, -1, 1232, 105},
+    {4049, 2356, -1, 105}, {4050, -1, 1233, 101}, {-1, -1, 1234, 115}, {4052, 4048, -1, 121},
+    {4053, -1, 1235, 101}, {-1, -1, 1236, 115}, {4055, 2807, -1, 95}, {4056, -1, -1, 83},
+    {4057, -1, -1, 80}, {-1, -1, 1237, 76}, {4059, 4054, -1, 160}, {4060, -1, -1, 83},
+    {4061, -1, -1, 80}, {-1, -1, 1238, 76}, {4848, 4058, -1, 194}, {4064, -1, -1, 160},
+    {4065, -1, -1, 83}, {4066, -1, -1, 80}, {-1, -1, 1239, 76}, {4068, 3366, -1, 105},
+    {4069, -1, -1, 115}, {4070, -1, 1240, 101}, {-1, -1, 1241, 115}, {4072, 3121, -1, 111},
+    {4073, -1, -1, 107}, {4074, -1, -1, 101}, {4075, -1, 1242, 115}, {4076, -1, -1, 101},
+    {-1, -1, 1243, 115}, {-1, 341, 1244, 116}, {4079, 1951, -1, 104}, {4080, -1, 1245, 101},
+    {-1, -1, 1246, 115}, {4082, 3106, -1, 114}, {4083, -1, 1247, 103}, {-1, -1, 1248, 115},
+    {4093, 758, -1, 116}, {4168, -1, -1, 95}, {4087, -1, -1, 98}, {4088, -1, -1, 116},
+    {4098, -1, 1249, 117}, {4175, 4085, -1, 160}, {4091, -1, -1, 98}, {4092, -1, -1, 116},
+    {4099, -1, 1250, 117}, {4094, 4089, -1, 194}, {4182, -1, -1, 160}, {4096, -1, -1, 98},
+    {4097, -1, -1, 116}, {4100, -1, 1251, 117}, {-1, -1, 1252, 115}, {-1, -1, 1253, 115},
+    {-1, -1, 1254, 115}, {4102, 2360, -1, 116}, {4103, -1, 1255, 117}, {-1, -1, 1256, 115},
+    {4117, 4081, -1, 99}, {4106, -1, -1, 95}, {4107, -1, -1, 116}, {4108, -1, -1, 104},
+    {4109, -1, -1, 101}, {4110, -1, -1, 114}, {4124, -1, 1257, 109}, {4112, 4105, -1, 160},
+    {4113, -1, -1, 116}, {4114, -1, -1, 104}, {4115, -1, -1, 101}, {4116, -1, -1, 114},
+    {4125, -1, 1258, 109}, {4118, 4111, -1, 194}, {4119, -1, -1, 160}, {4120, -1, -1, 116},
+    {4121, -1, -1, 104}, {4122, -1, -1, 101}, {4123, -1, -1, 114}, {4126, -1, 1259, 109},
+    {-1, -1, 1260, 115}, {-1, -1, 1261, 115}, {-1, -1, 1262, 115}, {4238, 2645, -1, 104},
+    {4129, -1, -1, 101}, {4130, -1, -1, 114}, {4237, -1, 1292, 109}, {4132, -1, -1, 111},
+    {4133, -1, -1, 99}, {4134, -1, -1, 104}, {4135, -1, -1, 101}, {4136, -1, -1, 109},
+    {4137, -1, -1, 105}, {4138, -1, -1, 99}, {4139, -1, -1, 97}, {4156, -1, -1, 108},
+    {4141, -1, -1, 95}, {4142, -1, -1, 99}, {4143, -1, -1, 97}, {4144, -1, -1, 108},
+    {4145, -1, -1, 111}, {4146, -1, -1, 114}, {4147, -1, -1, 105}, {4165, -1, 1263, 101},
+    {4149, 4140, -1, 160}, {4150, -1, -1, 99}, {4151, -1, -1, 97}, {4152, -1, -1, 108},
+    {4153, -1, -1, 111}, {4154, -1, -1, 114}, {4155, -1, -1, 105}, {4166, -1, 1264, 101},
+    {4157, 4148, -1, 194}, {4158, -1, -1, 160}, {4159, -1, -1, 99}, {4160, -1, -1, 97},
+    {4161, -1, -1, 108}, {4162, -1, -1, 111}, {4163, -1, -1, 114}, {4164, -1, -1, 105},
+    {4167, -1, 1265, 101}, {-1, -1, 1266, 115}, {-1, -1, 1267, 115}, {-1, -1, 1268, 115},
+    {4169, 4086, -1, 99}, {4170, -1, -1, 97}, {4171, -1, -1, 108}, {4172, -1, -1, 111},
+    {4173, -1, -1, 114}, {4174, -1, -1, 105}, {4189, -1, 1269, 101}, {4176, 4090, -1, 99},
+    {4177, -1, -1, 97}, {4178, -1, -1, 108}, {4179, -1, -1, 111}, {4180, -1, -1, 114},
+    {4181, -1, -1, 105}, {4190, -1, 1270, 101}, {4183, 4095, -1, 99}, {4184, -1, -1, 97},
+    {4185, -1, -1, 108}, {4186, -1, -1, 111}, {4187, -1, -1, 114}, {4188, -1, -1, 105},
+    {4191, -1, 1271, 101}, {-1, -1, 1272, 115}, {-1, -1, 1273, 115}, {-1, -1, 1274, 115},
+    {4193, 1267, 1277, 108}, {4194, -1, -1, 111}, {4195, -1, -1, 114}, {4196, -1, -1, 105},
+    {4197, -1, 1275, 101}, {-1, -1, 1276, 115}, {4199, 4127, -1, 110}, {4200, -1, 1278, 116},
+    {-1, -1, 1279, 115}, {4202, 3628, -1, 116}, {4203, -1, -1, 110}, {-1, -1, 1280, 116},
+    {4205, 3634, -1, 116}, {4206, -1, -1, 110}, {-1, -1, 1281, 116}, {4208, 3641, -1, 116},
+    {4209, -1, -1, 110}, {-1, -1, 1282, 116}, {4211, 3647, -1, 116}, {4212, -1, -1, 110},
+    {-1, -1, 1283, 116}, {4214, 3653, -1, 116}, {4215, -1, -1, 110}, {-1, -1, 1284, 116},
+    {4217, 3660, -1, 116}, {4218, -1, -1, 110}, {-1, -1, 1285, 116}, {4220, 2497, -1, 116},
+    {4221, -1, -1, 104}, {4222, -1, -1, 101}, {4223, -1, -1, 114}, {4234, -1, 1286, 109},
+    {4225, 2508, -1, 116}, {4226, -1, -1, 104}, {4227, -1, -1, 101}, {4228, -1, -1, 114},
+    {4235, -1, 1287, 109}, {4230, 2519, -1, 116}, {4231, -1, -1, 104}, {4232, -1, -1, 101},
+    {4233, -1, -1, 114}, {4236, -1, 1288, 109}, {-1, -1, 1289, 115}, {-1, -1, 1290, 115},
+    {-1, -1, 1291, 115}, {-1, 4131, 1293, 115}, {-1, 4128, 1294, 109}, {4240, 191, -1, 104},
+    {4241, -1, -1, 111}, {4242, -1, -1, 117}, {4243, -1, 1295, 114}, {-1, -1, 1296, 115},
+    {-1, 323, 1297, 118}, {4246, 205, -1, 97}, {4247, -1, -1, 109}, {4248, -1, -1, 112},
+    {4249, -1, -1, 101}, {4250, -1, -1, 114}, {4251, -1, 1298, 101}, {-1, -1, 1299, 115},
+    {-1, -1, 1300, 65}, {4254, 2060, -1, 105}, {4255, -1, -1, 108}, {4256, -1, -1, 101},
+    {4279, -1, -1, 114}, {4258, -1, -1, 95}, {4259, -1, -1, 104}, {4260, -1, -1, 111},
+    {4261, -1, -1, 114}, {4262, -1, -1, 115}, {4263, -1, -1, 101}, {4264, -1, -1, 112},
+    {4265, -1, -1, 111}, {4266, -1, -1, 119}, {4267, -1, -1, 101}, {4291, -1, 1301, 114},
+    {4269, 4257, -1, 160}, {4270, -1, -1, 104}, {4271, -1, -1, 111}, {4272, -1, -1, 114},
+    {4273, -1, -1, 115}, {4274, -1, -1, 101}, {4275, -1, -1, 112}, {4276, -1, -1, 111},
+    {4277, -1, -1, 119}, {4278, -1, -1, 101}, {4292, -1, 1302, 114}, {4280, 4268, -1, 194},
+    {4281, -1, -1, 160}, {4282, -1, -1, 104}, {4283, -1, -1, 111}, {4284, -1, -1, 114},
+    {4285, -1, -1, 115}, {4286, -1, -1, 101}, {4287, -1, -1, 112}, {4288, -1, -1, 111},
+    {4289, -1, -1, 119}, {4290, -1, -1, 101}, {4293, -1, 1303, 114}, {-1, -1, 1304, 115},
+    {-1, -1, 1305, 115}, {-1, -1, 1306, 115}, {4295, 2809, -1, 102}, {4318, -1, -1, 116},
+    {4297, -1, -1, 95}, {4298, -1, -1, 104}, {4299, -1, -1, 111}, {4300, -1, -1, 114},
+    {4301, -1, -1, 115}, {4302, -1, -1, 101}, {4303, -1, -1, 112}, {4304, -1, -1, 111},
+    {4305, -1, -1, 119}, {4306, -1, -1, 101}, {4330, -1, 1307, 114}, {4308, 4296, -1, 160},
+    {4309, -1, -1, 104}, {4310, -1, -1, 111}, {4311, -1, -1, 114}, {4312, -1, -1, 115},
+    {4313, -1, -1, 101}, {4314, -1, -1, 112}, {4315, -1, -1, 111}, {4316, -1, -1, 119},
+    {4317, -1, -1, 101}, {4331, -1, 1308, 114}, {4319, 4307, -1, 194}, {4320, -1, -1, 160},
+    {4321, -1, -1, 104}, {4322, -1, -1, 111}, {4323, -1, -1, 114}, {4324, -1, -1, 115},
+    {4325, -1, -1, 101}, {4326, -1, -1, 112}, {4327, -1, -1, 111}, {4328, -1, -1, 119},
+    {4329, -1, -1, 101}, {4332, -1, 1309, 114}, {-1, -1, 1310, 115}, {-1, -1, 1311, 115},
+    {-1, -1, 1312, 115}, {4334, 348, -1, 114}, {4335, -1, -1, 115}, {4336, -1, -1, 101},
+    {4337, -1, -1, 112}, {4338, -1, -1, 111}, {4339, -1, -1, 119}, {4340, -1, -1, 101},
+    {4341, -1, 1313, 114}, {-1, -1, 1314, 115}, {-1, 3206, 1315, 112}, {4344, 536, -1, 104},
+    {4345, -1, -1, 111}, {4346, -1, -1, 114}, {4347, -1, -1, 115}, {4348, -1, -1, 101},
+    {4349, -1, -1, 112}, {4350, -1, -1, 111}, {4351, -1, -1, 119}, {4352, -1, -1, 101},
+    {4373, -1, 1316, 114}, {4354, 540, -1, 104}, {4355, -1, -1, 111}, {4356, -1, -1, 114},
+    {4357, -1, -1, 115}, {4358, -1, -1, 101}, {4359, -1, -1, 112}, {4360, -1, -1, 111},
+    {4361, -1, -1, 119}, {4362, -1, -1, 101}, {4374, -1, 1317, 114}, {4364, 545, -1, 104},
+    {4365, -1, -1, 111}, {4366, -1, -1, 114}, {4367, -1, -1, 115}, {4368, -1, -1, 101},
+    {4369, -1, -1, 112}, {4370, -1, -1, 111}, {4371, -1, -1, 119}, {4372, -1, -1, 101},
+    {4375, -1, 1318, 114}, {-1, -1, 1319, 115}, {-1, -1, 1320, 115}, {-1, -1, 1321, 115},
+    {4377, 561, -1, 105}, {4400, -1, -1, 99}, {4379, -1, -1, 95}, {4380, -1, -1, 104},
+    {4381, -1, -1, 111}, {4382, -1, -1, 114}, {4383, -1, -1, 115}, {4384, -1, -1, 101},
+    {4385, -1, -1, 112}, {4386, -1, -1, 111}, {4387, -1, -1, 119}, {4388, -1, -1, 101},
+    {4412, -1, 1322, 114}, {4390, 4378, -1, 160}, {4391, -1, -1, 104}, {4392, -1, -1, 111},
+    {4393, -1, -1, 114}, {4394, -1, -1, 115}, {4395, -1, -1, 101}, {4396, -1, -1, 112},
+    {4397, -1, -1, 111}, {4398, -1, -1, 119}, {4399, -1, -1, 101}, {4413, -1, 1323, 114},
+    {4401, 4389, -1, 194}, {4402, -1, -1, 160}, {4403, -1, -1, 104}, {4404, -1, -1, 111},
+    {4405, -1, -1, 114}, {4406, -1, -1, 115}, {4407, -1, -1, 101}, {4408, -1, -1, 112},
+    {4409, -1, -1, 111}, {4410, -1, -1, 119}, {4411, -1, -1, 101}, {4414, -1, 1324, 114},
+    {-1, -1, 1325, 115}, {-1, -1, 1326, 115}, {-1, -1, 1327, 115}, {4416, 3246, -1, 104},
+    {4417, -1, -1, 111}, {4418, -1, -1, 114}, {4419, -1, -1, 115}, {4420, -1, -1, 101},
+    {4421, -1, -1, 112}, {4422, -1, -1, 111}, {4423, -1, -1, 119}, {4424, -1, -1, 101},
+    {4445, -1, 1328, 114}, {4426, 3249, -1, 104}, {4427, -1, -1, 111}, {4428, -1, -1, 114},
+    {4429, -1, -1, 115}, {4430, -1, -1, 101}, {4431, -1, -1, 112}, {4432, -1, -1, 111},
+    {4433, -1, -1, 119}, {4434, -1, -1, 101}, {4446, -1, 1329, 114}, {4436, 3252, -1, 104},
+    {4437, -1, -1, 111}, {4438, -1, -1, 114}, {4439, -1, -1, 115}, {4440, -1, -1, 101},
+    {4441, -1, -1, 112}, {4442, -1, -1, 111}, {4443, -1, -1, 119}, {4444, -1, -1, 101},
+    {4447, -1, 1330, 114}, {-1, -1, 1331, 115}, {-1, -1, 1332, 115}, {-1, -1, 1333, 115},
+    {4449, 2752, -1, 104}, {4450, -1, -1, 111}, {4451, -1, -1, 114}, {4452, -1, -1, 115},
+    {4453, -1, -1, 101}, {4454, -1, -1, 112}, {4455, -1, -1, 111}, {4456, -1, -1, 119},
+    {4457, -1, -1, 101}, {4478, -1, 1334, 114}, {4459, 2763, -1, 104}, {4460, -1, -1, 111},
+    {4461, -1, -1, 114}, {4462, -1, -1, 115}, {4463, -1, -1, 101}, {4464, -1, -1, 112},
+    {4465, -1, -1, 111}, {4466, -1, -1, 119}, {4467, -1, -1, 101}, {4479, -1, 1335, 114},
+    {4469, 2774, -1, 104}, {4470, -1, -1, 111}, {4471, -1, -1, 114}, {4472, -1, -1, 115},
+    {4473, -1, -1, 101}, {4474, -1, -1, 112}, {4475, -1, -1, 111}, {4476, -1, -1, 119},
+    {4477, -1, -1, 101}, {4480, -1, 1336, 114}, {-1, -1, 1337, 115}, {-1, -1, 1338, 115},
+    {-1, -1, 1339, 115}, {4482, 2187, -1, 102}, {4483, -1, -1, 114}, {4484, -1, -1, 105},
+    {4485, -1, -1, 103}, {4486, -1, -1, 101}, {4487, -1, -1, 114}, {4488, -1, -1, 97},
+    {4489, -1, -1, 116}, {4490, -1, -1, 105}, {4491, -1, -1, 111}, {4500, -1, -1, 110},
+    {4493, -1, -1, 95}, {4494, -1, -1, 116}, {4495, -1, -1, 111}, {4505, -1, 1340, 110},
+    {4497, 4492, -1, 160}, {4498, -1, -1, 116}, {4499, -1, -1, 111}, {4506, -1, 1341, 110},
+    {4501, 4496, -1, 194}, {4502, -1, -1, 160}, {4503, -1, -1, 116}, {4504, -1, -1, 111},
+    {4507, -1, 1342, 110}, {-1, -1, 1343, 115}, {-1, -1, 1344, 115}, {-1, -1, 1345, 115},
+    {4509, 4201, -1, 111}, {4510, -1, -1, 102}, {4511, -1, -1, 95}, {4512, -1, -1, 114},
+    {4513, -1, -1, 101}, {4514, -1, -1, 102}, {4515, -1, -1, 114}, {4516, -1, -1, 105},
+    {4517, -1, -1, 103}, {4518, -1, -1, 101}, {4519, -1, -1, 114}, {4520, -1, -1, 97},
+    {4521, -1, -1, 116}, {4522, -1, -1, 105}, {4523, -1, -1, 111}, {-1, -1, 1346, 110},
+    {4525, 4204, -1, 111}, {4526, -1, -1, 102}, {4527, -1, -1, 160}, {4528, -1, -1, 114},
+    {4529, -1, -1, 101}, {4530, -1, -1, 102}, {4531, -1, -1, 114}, {4532, -1, -1, 105},
+    {4533, -1, -1, 103}, {4534, -1, -1, 101}, {4535, -1, -1, 114}, {4536, -1, -1, 97},
+    {4537, -1, -1, 116}, {4538, -1, -1, 105}, {4539, -1, -1, 111}, {-1, -1, 1347, 110},
+    {4541, 4207, -1, 111}, {4542, -1, -1, 102}, {4543, -1, -1, 194}, {4544, -1, -1, 160},
+    {4545, -1, -1, 114}, {4546, -1, -1, 101}, {4547, -1, -1, 102}, {4548, -1, -1, 114},
+    {4549, -1, -1, 105}, {4550, -1, -1, 103}, {4551, -1, -1, 101}, {4552, -1, -1, 114},
+    {4553, -1, -1, 97}, {4554, -1, -1, 116}, {4555, -1, -1, 105}, {4556, -1, -1, 111},
+    {-1, -1, 1348, 110}, {4558, 4210, -1, 111}, {4559, -1, -1, 102}, {4560, -1, -1, 95},
+    {4561, -1, -1, 114}, {4562, -1, -1, 101}, {4563, -1, -1, 102}, {4564, -1, -1, 114},
+    {4565, -1, -1, 105}, {4566, -1, -1, 103}, {4567, -1, -1, 101}, {4568, -1, -1, 114},
+    {4569, -1, -1, 97}, {4570, -1, -1, 116}, {4571, -1, -1, 105}, {4572, -1, -1, 111},
+    {-1, -1, 1349, 110}, {4574, 4213, -1, 111}, {4575, -1, -1, 102}, {4576, -1, -1, 160},
+    {4577, -1, -1, 114}, {4578, -1, -1, 101}, {4579, -1, -1, 102}, {4580, -1, -1, 114},
+    {4581, -1, -1, 105}, {4582, -1, -1, 103}, {4583, -1, -1, 101}, {4584, -1, -1, 114},
+    {4585, -1, -1, 97}, {4586, -1, -1, 116}, {4587, -1, -1, 105}, {4588, -1, -1, 111},
+    {-1, -1, 1350, 110}, {4590, 4216, -1, 111}, {4591, -1, -1, 102}, {4592, -1, -1, 194},
+    {4593, -1, -1, 160}, {4594, -1, -1, 114}, {4595, -1, -1, 101}, {4596, -1, -1, 102},
+    {4597, -1, -1, 114}, {4598, -1, -1, 105}, {4599, -1, -1, 103}, {4600, -1, -1, 101},
+    {4601, -1, -1, 114}, {4602, -1, -1, 97}, {4603, -1, -1, 116}, {4604, -1, -1, 105},
+    {4605, -1, -1, 111}, {-1, -1, 1351, 110}, {-1, 4062, 1352, 87}, {-1, 4606, 1353, 109},
+    {4609, 3753, -1, 108}, {4610, -1, 1354, 111}, {-1, -1, 1355, 115}, {4657, 2030, -1, 98},
+    {4613, -1, -1, 97}, {4614, -1, -1, 109}, {4615, -1, -1, 112}, {4616, -1, -1, 101},
+    {4617, -1, -1, 114}, {4618, -1, 1356, 101}, {-1, -1, 1357, 115}, {4620, 2495, -1, 98},
+    {4621, -1, -1, 101}, {4622, -1, -1, 114}, {4623, -1, 1358, 116}, {-1, -1, 1359, 115},
+    {4819, 3122, -1, 116}, {4626, -1, -1, 97}, {4627, -1, -1, 109}, {4628, -1, -1, 112},
+    {4629, -1, -1, 101}, {4630, -1, -1, 114}, {4631, -1, 1360, 101}, {-1, -1, 1361, 115},
+    {4633, 1842, -1, 111}, {4634, -1, 1362, 116}, {-1, -1, 1363, 115}, {4636, 4612, -1, 102},
+    {4637, -1, -1, 97}, {4638, -1, -1, 114}, {4639, -1, -1, 97}, {4640, -1, 1364, 100},
+    {-1, -1, 1365, 115}, {4642, 4635, -1, 104}, {4643, -1, -1, 101}, {4644, -1, -1, 110},
+    {4646, -1, -1, 114}, {-1, -1, 1366, 121}, {4647, 4645, -1, 105}, {4648, -1, -1, 101},
+    {-1, -1, 1367, 115}, {4650, 4641, -1, 109}, {4651, -1, -1, 104}, {4652, -1, 1368, 111},
+    {-1, -1, 1369, 115}, {4654, 4649, -1, 111}, {4655, -1, -1, 104}, {4656, -1, 1370, 109},
+    {-1, -1, 1371, 115}, {4658, 4653, -1, 118}, {4659, -1, -1, 111}, {4660, -1, -1, 108},
+    {4661, -1, 1372, 116}, {-1, -1, 1373, 115}, {4663, 1597, -1, 101}, {4664, -1, -1, 109},
+    {4665, -1, -1, 105}, {4666, -1, -1, 99}, {4667, -1, -1, 97}, {4684, -1, -1, 108},
+    {4669, -1, -1, 95}, {4670, -1, -1, 102}, {4671, -1, -1, 97}, {4672, -1, -1, 114},
+    {4673, -1, -1, 97}, {4674, -1, -1, 100}, {4675, -1, -1, 97}, {4693, -1, 1375, 121},
+    {4677, 4668, -1, 160}, {4678, -1, -1, 102}, {4679, -1, -1, 97}, {4680, -1, -1, 114},
+    {4681, -1, -1, 97}, {4682, -1, -1, 100}, {4683, -1, -1, 97}, {4694, -1, 1376, 121},
+    {4685, 4676, -1, 194}, {4686, -1, -1, 160}, {4687, -1, -1, 102}, {4688, -1, -1, 97},
+    {4689, -1, -1, 114}, {4690, -1, -1, 97}, {4691, -1, -1, 100}, {4692, -1, -1, 97},
+    {4695, -1, 1377, 121}, {-1, -1, 1378, 115}, {-1, -1, 1379, 115}, {-1, -1, 1380, 115},
+    {5012, 4044, 1488, 104}, {4698, -1, -1, 121}, {4699, -1, -1, 115}, {4700, -1, -1, 105},
+    {4701, -1, -1, 99}, {4702, -1, -1, 97}, {4719, -1, -1, 108}, {4704, -1, -1, 95},
+    {4705, -1, -1, 102}, {4706, -1, -1, 97}, {4707, -1, -1, 114}, {4708, -1, -1, 97},
+    {4709, -1, -1, 100}, {4710, -1, -1, 97}, {4728, -1, 1381, 121}, {4712, 4703, -1, 160},
+    {4713, -1, -1, 102}, {4714, -1, -1, 97}, {4715, -1, -1, 114}, {4716, -1, -1, 97},
+    {4717, -1, -1, 100}, {4718, -1, -1, 97}, {4729, -1, 1382, 121}, {4720, 4711, -1, 194},
+    {4721, -1, -1, 160}, {4722, -1, -1, 102}, {4723, -1, -1, 97}, {4724, -1, -1, 114},
+    {4725, -1, -1, 97}, {4726, -1, -1, 100}, {4727, -1, -1, 97}, {4730, -1, 1383, 121},
+    {-1, -1, 1384, 115}, {-1, -1, 1385, 115}, {-1, -1, 1386, 115}, {4732, 4608, -1, 49},
+    {4749, -1, -1, 50}, {4734, -1, -1, 95}, {4735, -1, -1, 102}, {4736, -1, -1, 97},
+    {4737, -1, -1, 114}, {4738, -1, -1, 97}, {4739, -1, -1, 100}, {4740, -1, -1, 97},
+    {4758, -1, 1387, 121}, {4742, 4733, -1, 160}, {4743, -1, -1, 102}, {4744, -1, -1, 97},
+    {4745, -1, -1, 114}, {4746, -1, -1, 97}, {4747, -1, -1, 100}, {4748, -1, -1, 97},
+    {4759, -1, 1388, 121}, {4750, 4741, -1, 194}, {4751, -1, -1, 160}, {4752, -1, -1, 102},
+    {4753, -1, -1, 97}, {4754, -1, -1, 114}, {4755, -1, -1, 97}, {4756, -1, -1, 100},
+    {4757, -1, -1, 97}, {4760, -1, 1389, 121}, {-1, -1, 1390, 115}, {-1, -1, 1391, 115},
+    {-1, -1, 1392, 115}, {4762, 211, -1, 97}, {4763, -1, 1393, 121}, {-1, -1, 1394, 115},
+    {4765, 880, -1, 109}, {4766, -1, -1, 109}, {4767, -1, 1395, 97}, {-1, -1, 1396, 115},
+    {4769, 4764, -1, 117}, {4770, -1, -1, 115}, {4771, -1, 1397, 115}, {4772, -1, -1, 101},
+    {-1, -1, 1398, 115}, {4774, 4011, -1, 97}, {4775, -1, -1, 120}, {4776, -1, -1, 119},
+    {4777, -1, -1, 101}, {4778, -1, -1, 108}, {4779, -1, 1399, 108}, {-1, -1, 1400, 115},
+    {4781, 3457, -1, 101}, {4782, -1, -1, 114}, {4783, -1, -1, 115}, {4784, -1, -1, 116},
+    {4785, -1, -1, 101}, {4786, -1, 1401, 100}, {-1, -1, 1402, 115}, {4788, -1, -1, 79},
+    {-1, -1, 1403, 101}, {4790, 4625, -1, 99}, {4791, -1, -1, 111}, {4792, -1, -1, 117},
+    {4793, -1, -1, 108}, {4794, -1, -1, 111}, {4795, -1, -1, 109}, {4796, -1, 1404, 98},
+    {-1, -1, 1405, 115}, {4798, 4789, -1, 102}, {4799, -1, -1, 97}, {4800, -1, -1, 114},
+    {4801, -1, -1, 97}, {4802, -1, 1406, 100}, {-1, -1, 1407, 115}, {4804, 4797, -1, 104},
+    {4805, -1, -1, 101}, {4806, -1, -1, 110}, {4808, -1, -1, 114}, {-1, -1, 1408, 121},
+    {4809, 4807, -1, 105}, {4810, -1, -1, 101}, {-1, -1, 1409, 115}, {4812, 4803, -1, 109},
+    {4813, -1, -1, 104}, {4814, -1, 1410, 111}, {-1, -1, 1411, 115}, {4816, 4811, -1, 111},
+    {4817, -1, -1, 104}, {4818, -1, 1412, 109}, {-1, -1, 1413, 115}, {4820, 4815, -1, 118},
+    {4821, -1, -1, 111}, {4822, -1, -1, 108}, {4823, -1, 1414, 116}, {-1, -1, 1415, 115},
+    {4835, 590, -1, 116}, {4826, -1, -1, 95}, {4827, -1, -1, 112}, {4828, -1, -1, 111},
+    {4829, -1, -1, 108}, {4841, -1, 1416, 101}, {4831, 4825, -1, 160}, {4832, -1, -1, 112},
+    {4833, -1, -1, 111}, {4834, -1, -1, 108}, {4842, -1, 1417, 101}, {4836, 4830, -1, 194},
+    {4837, -1, -1, 160}, {4838, -1, -1, 112}, {4839, -1, -1, 111}, {4840, -1, -1, 108},
+    {4843, -1, 1418, 101}, {-1, -1, 1419, 115}, {-1, -1, 1420, 115}, {-1, -1, 1421, 115},
+    {-1, 4607, 1422, 86}, {-1, 4844, 1423, 118}, {4847, 4845, -1, 181}, {-1, -1, 1424, 86},
+    {4849, 4063, -1, 181}, {-1, -1, 1425, 86}, {-1, 902, 1426, 82}, {-1, 903, 1427, 82},
+    {4853, 1168, 1436, 114}, {4854, -1, -1, 97}, {4855, -1, -1, 110}, {4856, -1, -1, 107},
+    {4857, -1, -1, 105}, {4858, -1, -1, 110}, {-1, -1, 1428, 101}, {4860, 1172, 1437, 114},
+    {4861, -1, -1, 97}, {4862, -1, -1, 110}, {4863, -1, -1, 107}, {4864, -1, -1, 105},
+    {4865, -1, -1, 110}, {-1, -1, 1429, 101}, {4867, 1176, 1438, 114}, {4868, -1, -1, 97},
+    {4869, -1, -1, 110}, {4870, -1, -1, 107}, {4871, -1, -1, 105}, {4872, -1, -1, 110},
+    {-1, -1, 1430, 101}, {4874, 1180, 1439, 114}, {4875, -1, -1, 97}, {4876, -1, -1, 110},
+    {4877, -1, -1, 107}, {4878, -1, -1, 105}, {4879, -1, -1, 110}, {-1, -1, 1431, 101},
+    {4881, 1184, 1440, 114}, {4882, -1, -1, 97}, {4883, -1, -1, 110}, {4884, -1, -1, 107},
+    {4885, -1, -1, 105}, {4886, -1, -1, 110}, {-1, -1, 1432, 101}, {4888, 1188, 1441, 114},
+    {4889, -1, -1, 97}, {4890, -1, -1, 110}, {4891, -1, -1, 107}, {4892, -1, -1, 105},
+    {4893, -1, -1, 110}, {-1, -1, 1433, 101}, {-1, 1192, 1434, 114}, {-1, 1193, 1435, 114},
+    {-1, 993, 1443, 114}, {-1, 986, 1444, 114}, {-1, 987, 1445, 114}, {-1, 988, 1446, 114},
+    {-1, 989, 1447, 114}, {-1, 990, 1448, 114}, {-1, 991, 1449, 114}, {-1, 4850, 1450, 70},
+    {-1, 4851, 1451, 70}, {-1, 976, 1452, 137}, {4907, 1750, -1, 104}, {4908, -1, -1, 114},
+    {4909, -1, -1, 101}, {4910, -1, -1, 110}, {4911, -1, -1, 104}, {4912, -1, -1, 101},
+    {4913, -1, -1, 105}, {4914, -1, 1453, 116}, {-1, -1, 1454, 115}, {4916, 4852, 1463, 102},
+    {4917, -1, -1, 97}, {4918, -1, -1, 104}, {4919, -1, -1, 114}, {4920, -1, -1, 101},
+    {4921, -1, -1, 110}, {4922, -1, -1, 104}, {4923, -1, -1, 101}, {4924, -1, -1, 105},
+    {-1, -1, 1455, 116}, {4926, 4859, 1464, 102}, {4927, -1, -1, 97}, {4928, -1, -1, 104},
+    {4929, -1, -1, 114}, {4930, -1, -1, 101}, {4931, -1, -1, 110}, {4932, -1, -1, 104},
+    {4933, -1, -1, 101}, {4934, -1, -1, 105}, {-1, -1, 1456, 116}, {4936, 4866, 1465, 102},
+    {4937, -1, -1, 97}, {4938, -1, -1, 104}, {4939, -1, -1, 114}, {4940, -1, -1, 101},
+    {4941, -1, -1, 110}, {4942, -1, -1, 104}, {4943, -1, -1, 101}, {4944, -1, -1, 105},
+    {-1, -1, 1457, 116}, {4946, 4873, 1466, 102}, {4947, -1, -1, 97}, {4948, -1, -1, 104},
+    {4949, -1, -1, 114}, {4950, -1, -1, 101}, {4951, -1, -1, 110}, {4952, -1, -1, 104},
+    {4953, -1, -1, 101}, {4954, -1, -1, 105}, {-1, -1, 1458, 116}, {4956, 4880, 1467, 102},
+    {4957, -1, -1, 97}, {4958, -1, -1, 104}, {4959, -1, -1, 114}, {4960, -1, -1, 101},
+    {4961, -1, -1, 110}, {4962, -1, -1, 104}, {4963, -1, -1, 101}, {4964, -1, -1, 105},
+    {-1, -1, 1459, 116}, {4966, 4887, 1468, 102}, {4967, -1, -1, 97}, {4968, -1, -1, 104},
+    {4969, -1, -1, 114}, {4970, -1, -1, 101}, {4971, -1, -1, 110}, {4972, -1, -1, 104},
+    {4973, -1, -1, 101}, {4974, -1, -1, 105}, {-1, -1, 1460, 116}, {-1, 4894, 1461, 102},
+    {-1, 4895, 1462, 102}, {-1, 992, 1469, 102}, {-1, 4896, 1470, 102}, {-1, 4897, 1471, 102},
+    {-1, 4898, 1472, 102}, {-1, 4899, 1473, 102}, {-1, 4900, 1474, 102}, {-1, 4901, 1475, 102},
+    {-1, 4902, 1476, 102}, {4986, 3896, -1, 99}, {4987, -1, -1, 97}, {4988, -1, -1, 110},
+    {4989, -1, -1, 100}, {4990, -1, -1, 108}, {4991, -1, 1477, 101}, {-1, -1, 1478, 115},
+    {4993, 4985, -1, 108}, {4994, -1, -1, 97}, {4995, -1, -1, 109}, {4996, -1, -1, 98},
+    {4997, -1, -1, 101}, {4998, -1, -1, 114}, {4999, -1, 1479, 116}, {-1, -1, 1480, 115},
+    {5019, 2983, -1, 97}, {5002, -1, -1, 109}, {5003, -1, -1, 98}, {5004, -1, -1, 101},
+    {5005, -1, -1, 114}, {5006, -1, 1481, 116}, {-1, -1, 1482, 115}, {5008, 4071, -1, 105},
+    {5009, -1, -1, 108}, {5010, -1, 1483, 98}, {-1, -1, 1484, 115}, {-1, 3113, 1485, 98},
+    {5013, 4697, -1, 111}, {5014, -1, 1486, 116}, {-1, -1, 1487, 115}, {5016, 1615, -1, 105},
+    {5017, -1, 1489, 116}, {-1, -1, 1490, 115}, {-1, 5015, 1491, 116}, {5020, 5001, -1, 110},
+    {5021, -1, -1, 103}, {5022, -1, -1, 108}, {5023, -1, -1, 101}, {5024, -1, 1492, 121},
+    {-1, -1, 1493, 115}, {5026, 4101, -1, 108}, {5027, -1, -1, 111}, {5028, -1, -1, 110},
+    {5029, -1, -1, 100}, {5030, -1, -1, 101}, {5031, -1, 1494, 108}, {-1, -1, 1495, 115},
+    {5033, 1495, -1, 115}, {5034, -1, -1, 116}, {5035, -1, -1, 105}, {5036, -1, -1, 108},
+    {5037, -1, 1496, 98}, {-1, -1, 1497, 115}, {5039, 317, -1, 121}, {5040, -1, -1, 115},
+    {5041, -1, -1, 101}, {5042, -1, 1498, 114}, {-1, -1, 1499, 115}, {5044, 3614, -1, 101},
+    {5045, -1, -1, 111}, {5046, -1, -1, 112}, {5047, -1, -1, 111}, {5048, -1, -1, 116},
+    {5049, -1, -1, 101}, {5050, -1, -1, 110}, {5051, -1, -1, 116}, {5052, -1, -1, 105},
+    {5053, -1, -1, 97}, {5054, -1, 1500, 108}, {-1, -1, 1501, 115}, {5056, 3364, -1, 97},
+    {5057, -1, -1, 109}, {5058, -1, -1, 105}, {5059, -1, 1502, 99}, {-1, -1, 1503, 115},
+    {-1, 5043, 1504, 112}, {5062, 230, -1, 111}, {5063, -1, -1, 114}, {5074, -1, -1, 107},
+    {5083, -1, -1, 95}, {5066, -1, -1, 121}, {5067, -1, -1, 101}, {5068, -1, -1, 97},
+    {5080, -1, 1505, 114}, {5088, 5064, -1, 160}, {5071, -1, -1, 121}, {5072, -1, -1, 101},
+    {5073, -1, -1, 97}, {5081, -1, 1506, 114}, {5075, 5069, -1, 194}, {5093, -1, -1, 160},
+    {5077, -1, -1, 121}, {5078, -1, -1, 101}, {5079, -1, -1, 97}, {5082, -1, 1507, 114},
+    {-1, -1, 1508, 115}, {-1, -1, 1509, 115}, {-1, -1, 1510, 115}, {5084, 5065, -1, 109},
+    {5085, -1, -1, 111}, {5086, -1, -1, 110}, {5087, -1, -1, 116}, {5098, -1, 1511, 104},
+    {5089, 5070, -1, 109}, {5090, -1, -1, 111}, {5091, -1, -1, 110}, {5092, -1, -1, 116},
+    {5099, -1, 1512, 104}, {5094, 5076, -1, 109}, {5095, -1, -1, 111}, {5096, -1, -1, 110},
+    {5097, -1, -1, 116}, {5100, -1, 1513, 104}, {-1, -1, 1514, 115}, {-1, -1, 1515, 115},
+    {-1, -1, 1516, 115}, {5102, 4067, -1, 116}, {5103, -1, -1, 101}, {5104, -1, -1, 110},
+    {5105, -1, -1, 116}, {5106, -1, -1, 105}, {5107, -1, -1, 97}, {5138, -1, -1, 108},
+    {5109, -1, -1, 95}, {5110, -1, -1, 118}, {5111, -1, -1, 111}, {5112, -1, -1, 114},
+    {5113, -1, -1, 116}, {5114, -1, -1, 105}, {5115, -1, -1, 99}, {5116, -1, -1, 105},
+    {5117, -1, -1, 116}, {5118, -1, -1, 121}, {5119, -1, -1, 95}, {5120, -1, -1, 117},
+    {5121, -1, -1, 110}, {5122, -1, -1, 105}, {5155, -1, 1517, 116}, {5124, 5108, -1, 160},
+    {5125, -1, -1, 118}, {5126, -1, -1, 111}, {5127, -1, -1, 114}, {5128, -1, -1, 116},
+    {5129, -1, -1, 105}, {5130, -1, -1, 99}, {5131, -1, -1, 105}, {5132, -1, -1, 116},
+    {5133, -1, -1, 121}, {5134, -1, -1, 160}, {5135, -1, -1, 117}, {5136, -1, -1, 110},
+    {5137, -1, -1, 105}, {5156, -1, 1518, 116}, {5139, 5123, -1, 194}, {5140, -1, -1, 160},
+    {5141, -1, -1, 118}, {5142, -1, -1, 111}, {5143, -1, -1, 114}, {5144, -1, -1, 116},
+    {5145, -1, -1, 105}, {5146, -1, -1, 99}, {5147, -1, -1, 105}, {5148, -1, -1, 116},
+    {5149, -1, -1, 121}, {5150, -1, -1, 194}, {5151, -1, -1, 160}, {5152, -1, -1, 117},
+    {5153, -1, -1, 110}, {5154, -1, -1, 105}, {5157, -1, 1519, 116}, {-1, -1, 1520, 115},
+    {-1, -1, 1521, 115}, {-1, -1, 1522, 115}, {5159, 179, -1, 86}, {-1, -1, 1523, 85},
+    {5161, 195, -1, 110}, {5162, -1, 1524, 116}, {-1, -1, 1525, 115}, {5164, 4632, 1526, 116},
+    {-1, -1, 1527, 115}, {5166, 4780, -1, 99}, {5167, -1, -1, 116}, {5168, -1, -1, 101},
+    {5169, -1, 1528, 116}, {-1, -1, 1529, 115}, {5171, 5025, -1, 121}, {5172, -1, -1, 116},
+    {5173, -1, 1530, 101}, {-1, -1, 1531, 115}, {5175, 3362, -1, 111}, {5176, -1, -1, 98},
+    {5177, -1, -1, 115}, {5178, -1, -1, 111}, {5179, -1, 1532, 110}, {-1, -1, 1533, 115},
+    {5181, -1, -1, 68}, {-1, -1, 1534, 85}, {5187, 129, 1537, 99}, {5184, -1, -1, 117},
+    {5185, -1, -1, 108}, {5186, -1, 1535, 101}, {-1, -1, 1536, 115}, {-1, 5183, 1538, 115},
+    {5189, 5018, -1, 117}, {5195, -1, 1541, 99}, {5191, -1, -1, 108}, {5192, -1, -1, 101},
+    {5193, -1, -1, 111}, {5194, -1, 1539, 110}, {-1, -1, 1540, 115}, {-1, 5190, 1542, 115},
+};
+
+static const TrieEntry trieEntries[] = {
+    {-1, -1, 9.9999999999999998e+23, 0},
+    {-1, -1, 0, 9.9999999999999998e+23},
+    {-1, -1, 1e+21, 0},
+    {-1, -1, 0, 1e+21},
+    {-1, -1, 1e+18, 0},
+    {-1, -1, 0, 1e+18},
+    {-1, -1, 1000000000000000, 0},
+    {-1, -1, 0, 1000000000000000},
+    {-1, -1, 1000000000000, 0},
+    {-1, 68, 0, 1000000000000},
+    {-1, -1, 1000000000, 0},
+    {-1, -1, 0, 1000000000},
+    {-1, -1, 1000000, 0},
+    {-1, -1, 0, 1000000},
+    {-1, -1, 1000, 0},
+    {-1, -1, 0, 1000},
+    {-1, -1, 100, 0},
+    {-1, 103, 0, 100},
+    {-1, -1, 10, 0},
+    {-1, -1, 0, 10},
+    {-1, -1, 0.10000000000000001, 0},
+    {-1, 107, 0, 0.10000000000000001},
+    {-1, -1, 0.01, 0},
+    {-1, -1, 0, 0.01},
+    {-1, -1, 0.001, 0},
+    {-1, 2, 0, 0.001},
+    {-1, -1, 9.9999999999999995e-07, 0},
+    {-1, -1, 0, 9.9999999999999995e-07},
+    {-1, -1, 0, 9.9999999999999995e-07},
+    {-1, 195, 0, 9.9999999999999995e-07},
+    {-1, -1, 1.0000000000000001e-09, 0},
+    {-1, -1, 0, 1.0000000000000001e-09},
+    {-1, -1, 9.9999999999999998e-13, 0},
+    {-1, -1, 0, 9.9999999999999998e-13},
+    {-1, -1, 1.0000000000000001e-15, 0},
+    {-1, -1, 0, 1.0000000000000001e-15},
+    {-1, -1, 1.0000000000000001e-18, 0},
+    {-1, 244, 0, 1.0000000000000001e-18},
+    {-1, -1, 9.9999999999999991e-22, 0},
+    {-1, -1, 0, 9.9999999999999991e-22},
+    {-1, -1, 9.9999999999999992e-25, 0},
+    {-1, -1, 0, 9.9999999999999992e-25},
+    {0, -1, 0, 0},
+    {1, -1, 0, 0},
+    {3, -1, 0, 0},
+    {4, -1, 0, 0},
+    {5, -1, 0, 0},
+    {6, -1, 0, 0},
+    {-1, 7, 0, 0},
+    {8, -1, 0, 0},
+    {9, -1, 0, 0},
+    {-1, 10, 0, 0},
+    {11, -1, 0, 0},
+    {12, -1, 0, 0},
+    {-1, 13, 0, 0},
+    {14, -1, 0, 0},
+    {15, -1, 0, 0},
+    {-1, 16, 0, 0},
+    {17, -1, 0, 0},
+    {18, -1, 0, 0},
+    {-1, 19, 0, 0},
+    {20, -1, 0, 0},
+    {21, -1, 0, 0},
+    {-1, 22, 0, 0},
+    {23, -1, 0, 0},
+    {24, -1, 0, 0},
+    {-1, 25, 0, 0},
+    {26, -1, 0, 0},
+    {27, -1, 0, 0},
+    {-1, 28, 0, 0},
+    {29, -1, 0, 0},
+    {30, -1, 0, 0},
+    {-1, 31, 0, 0},
+    {32, -1, 0, 0},
+    {33, -1, 0, 0},
+    {-1, 34, 0, 0},
+    {35, -1, 0, 0},
+    {36, -1, 0, 0},
+    {-1, 37, 0, 0},
+    {38, -1, 0, 0},
+    {39, -1, 0, 0},
+    {-1, 40, 0, 0},
+    {41, -1, 0, 0},
+    {42, -1, 0, 0},
+    {-1, 43, 0, 0},
+    {44, -1, 0, 0},
+    {45, -1, 0, 0},
+    {-1, 46, 0, 0},
+    {47, -1, 0, 0},
+    {48, -1, 0, 0},
+    {-1, 49, 0, 0},
+    {50, -1, 0, 0},
+    {51, -1, 0, 0},
+    {-1, 52, 0, 0},
+    {53, -1, 0, 0},
+    {54, -1, 0, 0},
+    {-1, 55, 0, 0},
+    {56, -1, 0, 0},
+    {57, -1, 0, 0},
+    {-1, 58, 0, 0},
+    {-1, 59, 0, 0},
+    {60, -1, 0, 0},
+    {61, -1, 0, 0},
+    {-1, 62, 0, 0},
+    {63, -1, 0, 0},
+    {64, -1, 0, 0},
+    {-1, 65, 0, 0},
+    {66, -1, 0, 0},
+    {67, -1, 0, 0},
+    {69, -1, 0, 0},
+    {70, -1, 0, 0},
+    {-1, 71, 0, 0},
+    {72, -1, 0, 0},
+    {73, -1, 0, 0},
+    {74, -1, 0, 0},
+    {75, -1, 0, 0},
+    {76, -1, 0, 0},
+    {77, -1, 0, 0},
+    {-1, 78, 0, 0},
+    {-1, 79, 0, 0},
+    {80, -1, 0, 0},
+    {81, -1, 0, 0},
+    {-1, 82, 0, 0},
+    {83, -1, 0, 0},
+    {84, -1, 0, 0},
+    {-1, 85, 0, 0},
+    {86, -1, 0, 0},
+    {87, -1, 0, 0},
+    {-1, 88, 0, 0},
+    {89, -1, 0, 0},
+    {90, -1, 0, 0},
+    {-1, 91, 0, 0},
+    {92, -1, 0, 0},
+    {93, -1, 0, 0},
+    {-1, 94, 0, 0},
+    {95, -1, 0, 0},
+    {96, -1, 0, 0},
+    {-1, 97, 0, 0},
+    {98, -1, 0, 0},
+    {99, -1, 0, 0},
+    {-1, 100, 0, 0},
+    {101, -1, 0, 0},
+    {102, -1, 0, 0},
+    {-1, 104, 0, 0},
+    {105, -1, 0, 0},
+    {106, -1, 0, 0},
+    {108, -1, 0, 0},
+    {109, -1, 0, 0},
+    {-1, 110, 0, 0},
+    {111, -1, 0, 0},
+    {112, -1, 0, 0},
+    {113, -1, 0, 0},
+    {114, -1, 0, 0},
+    {115, -1, 0, 0},
+    {116, -1, 0, 0},
+    {-1, 117, 0, 0},
+    {-1, 118, 0, 0},
+    {119, -1, 0, 0},
+    {120, -1, 0, 0},
+    {121, -1, 0, 0},
+    {122, -1, 0, 0},
+    {123, -1, 0, 0},
+    {124, -1, 0, 0},
+    {125, -1, 0, 0},
+    {126, -1, 0, 0},
+    {127, -1, 0, 0},
+    {128, -1, 0, 0},
+    {129, -1, 0, 0},
+    {130, -1, 0, 0},
+    {131, -1, 0, 0},
+    {132, -1, 0, 0},
+    {133, -1, 0, 0},
+    {134, -1, 0, 0},
+    {-1, 135, 0, 0},
+    {-1, 136, 0, 0},
+    {137, -1, 0, 0},
+    {138, -1, 0, 0},
+    {139, -1, 0, 0},
+    {140, -1, 0, 0},
+    {141, -1, 0, 0},
+    {142, -1, 0, 0},
+    {143, -1, 0, 0},
+    {144, -1, 0, 0},
+    {145, -1, 0, 0},
+    {146, -1, 0, 0},
+    {147, -1, 0, 0},
+    {148, -1, 0, 0},
+    {149, -1, 0, 0},
+    {150, -1, 0, 0},
+    {151, -1, 0, 0},
+    {152, -1, 0, 0},
+    {-1, 153, 0, 0},
+    {-1, 154, 0, 0},
+    {155, -1, 0, 0},
+    {156, -1, 0, 0},
+    {157, -1, 0, 0},
+    {158, -1, 0, 0},
+    {159, -1, 0, 0},
+    {160, -1, 0, 0},
+    {161, -1, 0, 0},
+    {162, -1, 0, 0},
+    {163, -1, 0, 0},
+    {164, -1, 0, 0},
+    {165, -1, 0, 0},
+    {166, -1, 0, 0},
+    {-1, 167, 0, 0},
+    {168, -1, 0, 0},
+    {169, -1, 0, 0},
+    {-1, 170, 0, 0},
+    {171, -1, 0, 0},
+    {172, -1, 0, 0},
+    {173, -1, 0, 0},
+    {174, -1, 0, 0},
+    {175, -1, 0, 0},
+    {176, -1, 0, 0},
+    {-1, 177, 0, 0},
+    {178, -1, 0, 0},
+    {179, -1, 0, 0},
+    {180, -1, 0, 0},
+    {181, -1, 0, 0},
+    {-1, 182, 0, 0},
+    {183, -1, 0, 0},
+    {184, -1, 0, 0},
+    {185, -1, 0, 0},
+    {186, -1, 0, 0},
+    {187, -1, 0, 0},
+    {188, -1, 0, 0},
+    {189, -1, 0, 0},
+    {190, -1, 0, 0},
+    {191, -1, 0, 0},
+    {192, -1, 0, 0},
+    {193, -1, 0, 0},
+    {194, -1, 0, 0},
+    {196, -1, 0, 0},
+    {197, -1, 0, 0},
+    {198, -1, 0, 0},
+    {199, -1, 0, 0},
+    {200, -1, 0, 0},
+    {201, -1, 0, 0},
+    {202, -1, 0, 0},
+    {203, -1, 0, 0},
+    {204, -1, 0, 0},
+    {205, -1, 0, 0},
+    {206, -1, 0, 0},
+    {207, -1, 0, 0},
+    {208, -1, 0, 0},
+    {209, -1, 0, 0},
+    {210, -1, 0, 0},
+    {211, -1, 0, 0},
+    {-1, 212, 0, 0},
+    {213, -1, 0, 0},
+    {214, -1, 0, 0},
+    {215, -1, 0, 0},
+    {216, -1, 0, 0},
+    {217, -1, 0, 0},
+    {218, -1, 0, 0},
+    {219, -1, 0, 0},
+    {220, -1, 0, 0},
+    {221, -1, 0, 0},
+    {222, -1, 0, 0},
+    {223, -1, 0, 0},
+    {224, -1, 0, 0},
+    {225, -1, 0, 0},
+    {226, -1, 0, 0},
+    {227, -1, 0, 0},
+    {228, -1, 0, 0},
+    {229, -1, 0, 0},
+    {230, -1, 0, 0},
+    {231, -1, 0, 0},
+    {232, -1, 0, 0},
+    {233, -1, 0, 0},
+    {234, -1, 0, 0},
+    {235, -1, 0, 0},
+    {236, -1, 0, 0},
+    {237, -1, 0, 0},
+    {238, -1, 0, 0},
+    {-1, 239, 0, 0},
+    {-1, 240, 0, 0},
+    {-1, 241, 0, 0},
+    {242, -1, 0, 0},
+    {243, -1, 0, 0},
+    {245, -1, 0, 0},
+    {246, -1, 0, 0},
+    {247, -1, 0, 0},
+    {248, -1, 0, 0},
+    {-1, 249, 0, 0},
+    {250, -1, 0, 0},
+    {251, -1, 0, 0},
+    {252, -1, 0, 0},
+    {253, -1, 0, 0},
+    {254, -1, 0, 0},
+    {255, -1, 0, 0},
+    {-1, 256, 0, 0},
+    {257, -1, 0, 0},
+    {258, -1, 0, 0},
+    {-1, 259, 0, 0},
+    {260, -1, 0, 0},
+    {261, -1, 0, 0},
+    {262, -1, 0, 0},
+    {263, -1, 0, 0},
+    {264, -1, 0, 0},
+    {265, -1, 0, 0},
+    {-1, 266, 0, 0},
+    {-1, 267, 0, 0},
+    {268, -1, 0, 0},
+    {269, -1, 0, 0},
+    {270, -1, 0, 0},
+    {271, -1, 0, 0},
+    {272, -1, 0, 0},
+    {273, -1, 0, 0},
+    {274, -1, 0, 0},
+    {275, -1, 0, 0},
+    {276, -1, 0, 0},
+    {277, -1, 0, 0},
+    {278, -1, 0, 0},
+    {279, -1, 0, 0},
+    {280, -1, 0, 0},
+    {281, -1, 0, 0},
+    {282, -1, 0, 0},
+    {283, -1, 0, 0},
+    {284, -1, 0, 0},
+    {285, -1, 0, 0},
+    {286, -1, 0, 0},
+    {287, -1, 0, 0},
+    {288, -1, 0, 0},
+    {289, -1, 0, 0},
+    {290, -1, 0, 0},
+    {291, -1, 0, 0},
+    {292, -1, 0, 0},
+    {293, -1, 0, 0},
+    {294, -1, 0, 0},
+    {295, -1, 0, 0},
+    {-1, 296, 0, 0},
+    {-1, 297, 0, 0},
+    {-1, 298, 0, 0},
+    {299, -1, 0, 0},
+    {300, -1, 0, 0},
+    {301, -1, 0, 0},
+    {302, -1, 0, 0},
+    {303, -1, 0, 0},
+    {304, -1, 0, 0},
+    {305, -1, 0, 0},
+    {306, -1, 0, 0},
+    {307, -1, 0, 0},
+    {308, -1, 0, 0},
+    {309, -1, 0, 0},
+    {310, -1, 0, 0},
+    {311, -1, 0, 0},
+    {312, -1, 0, 0},
+    {313, -1, 0, 0},
+    {314, -1, 0, 0},
+    {315, -1, 0, 0},
+    {316, -1, 0, 0},
+    {-1, 317, 0, 0},
+    {-1, 318, 0, 0},
+    {319, -1, 0, 0},
+    {320, -1, 0, 0},
+    {321, -1, 0, 0},
+    {322, -1, 0, 0},
+    {323, -1, 0, 0},
+    {324, -1, 0, 0},
+    {325, -1, 0, 0},
+    {326, -1, 0, 0},
+    {-1, 327, 0, 0},
+    {-1, 328, 0, 0},
+    {-1, 329, 0, 0},
+    {-1, 330, 0, 0},
+    {-1, 331, 0, 0},
+    {-1, 332, 0, 0},
+    {-1, 333, 0, 0},
+    {-1, 334, 0, 0},
+    {-1, 335, 0, 0},
+    {336, -1, 0, 0},
+    {337, -1, 0, 0},
+    {338, -1, 0, 0},
+    {339, -1, 0, 0},
+    {340, -1, 0, 0},
+    {341, -1, 0, 0},
+    {342, -1, 0, 0},
+    {343, -1, 0, 0},
+    {344, -1, 0, 0},
+    {345, -1, 0, 0},
+    {346, -1, 0, 0},
+    {347, -1, 0, 0},
+    {348, -1, 0, 0},
+    {349, -1, 0, 0},
+    {350, -1, 0, 0},
+    {351, -1, 0, 0},
+    {352, -1, 0, 0},
+    {353, -1, 0, 0},
+    {354, -1, 0, 0},
+    {355, -1, 0, 0},
+    {356, -1, 0, 0},
+    {357, -1, 0, 0},
+    {358, -1, 0, 0},
+    {359, -1, 0, 0},
+    {360, -1, 0, 0},
+    {361, -1, 0, 0},
+    {362, -1, 0, 0},
+    {363, -1, 0, 0},
+    {364, -1, 0, 0},
+    {365, -1, 0, 0},
+    {366, -1, 0, 0},
+    {367, -1, 0, 0},
+    {368, -1, 0, 0},
+    {369, -1, 0, 0},
+    {370, -1, 0, 0},
+    {371, -1, 0, 0},
+    {372, -1, 0, 0},
+    {373, -1, 0, 0},
+    {374, -1, 0, 0},
+    {375, -1, 0, 0},
+    {376, -1, 0, 0},
+    {377, -1, 0, 0},
+    {378, -1, 0, 0},
+    {379, -1, 0, 0},
+    {380, -1, 0, 0},
+    {381, -1, 0, 0},
+    {382, -1, 0, 0},
+    {383, -1, 0, 0},
+    {384, -1, 0, 0},
+    {385, -1, 0, 0},
+    {386, -1, 0, 0},
+    {387, -1, 0, 0},
+    {388, -1, 0, 0},
+    {389, -1, 0, 0},
+    {390, -1, 0, 0},
+    {391, -1, 0, 0},
+    {392, -1, 0, 0},
+    {393, -1, 0, 0},
+    {394, -1, 0, 0},
+    {395, -1, 0, 0},
+    {396, -1, 0, 0},
+    {397, -1, 0, 0},
+    {398, -1, 0, 0},
+    {399, -1, 0, 0},
+    {400, -1, 0, 0},
+    {401, -1, 0, 0},
+    {402, -1, 0, 0},
+    {403, -1, 0, 0},
+    {404, -1, 0, 0},
+    {405, -1, 0, 0},
+    {406, -1, 0, 0},
+    {407, -1, 0, 0},
+    {408, -1, 0, 0},
+    {409, -1, 0, 0},
+    {410, -1, 0, 0},
+    {411, -1, 0, 0},
+    {412, -1, 0, 0},
+    {413, -1, 0, 0},
+    {414, -1, 0, 0},
+    {415, -1, 0, 0},
+    {416, -1, 0, 0},
+    {417, -1, 0, 0},
+    {418, -1, 0, 0},
+    {419, -1, 0, 0},
+    {420, -1, 0, 0},
+    {421, -1, 0, 0},
+    {422, -1, 0, 0},
+    {423, -1, 0, 0},
+    {-1, 424, 0, 0},
+    {425, -1, 0, 0},
+    {426, -1, 0, 0},
+    {427, -1, 0, 0},
+    {428, -1, 0, 0},
+    {-1, 429, 0, 0},
+    {430, -1, 0, 0},
+    {431, -1, 0, 0},
+    {432, -1, 0, 0},
+    {433, -1, 0, 0},
+    {434, -1, 0, 0},
+    {435, -1, 0, 0},
+    {436, -1, 0, 0},
+    {437, -1, 0, 0},
+    {438, -1, 0, 0},
+    {439, -1, 0, 0},
+    {440, -1, 0, 0},
+    {441, -1, 0, 0},
+    {442, -1, 0, 0},
+    {443, -1, 0, 0},
+    {444, -1, 0, 0},
+    {445, -1, 0, 0},
+    {446, -1, 0, 0},
+    {447, -1, 0, 0},
+    {448, -1, 0, 0},
+    {449, -1, 0, 0},
+    {450, -1, 0, 0},
+    {451, -1, 0, 0},
+    {452, -1, 0, 0},
+    {453, -1, 0, 0},
+    {454, -1, 0, 0},
+    {455, -1, 0, 0},
+    {456, -1, 0, 0},
+    {457, -1, 0, 0},
+    {458, -1, 0, 0},
+    {459, -1, 0, 0},
+    {460, -1, 0, 0},
+    {461, -1, 0, 0},
+    {462, -1, 0, 0},
+    {463, -1, 0, 0},
+    {464, -1, 0, 0},
+    {465, -1, 0, 0},
+    {466, -1, 0, 0},
+    {467, -1, 0, 0},
+    {468, -1, 0, 0},
+    {469, -1, 0, 0},
+    {470, -1, 0, 0},
+    {471, -1, 0, 0},
+    {472, -1, 0, 0},
+    {473, -1, 0, 0},
+    {474, -1, 0, 0},
+    {475, -1, 0, 0},
+    {-1, 476, 0, 0},
+    {477, -1, 0, 0},
+    {478, -1, 0, 0},
+    {479, -1, 0, 0},
+    {480, -1, 0, 0},
+    {481, -1, 0, 0},
+    {482, -1, 0, 0},
+    {483, -1, 0, 0},
+    {484, -1, 0, 0},
+    {485, -1, 0, 0},
+    {486, -1, 0, 0},
+    {487, -1, 0, 0},
+    {488, -1, 0, 0},
+    {489, -1, 0, 0},
+    {490, -1, 0, 0},
+    {491, -1, 0, 0},
+    {492, -1, 0, 0},
+    {493, -1, 0, 0},
+    {494, -1, 0, 0},
+    {495, -1, 0, 0},
+    {496, -1, 0, 0},
+    {497, -1, 0, 0},
+    {498, -1, 0, 0},
+    {499, -1, 0, 0},
+    {500, -1, 0, 0},
+    {501, -1, 0, 0},
+    {502, -1, 0, 0},
+    {503, -1, 0, 0},
+    {504, -1, 0, 0},
+    {505, -1, 0, 0},
+    {506, -1, 0, 0},
+    {507, -1, 0, 0},
+    {508, -1, 0, 0},
+    {509, -1, 0, 0},
+    {510, -1, 0, 0},
+    {511, -1, 0, 0},
+    {512, -1, 0, 0},
+    {513, -1, 0, 0},
+    {514, -1, 0, 0},
+    {515, -1, 0, 0},
+    {516, -1, 0, 0},
+    {517, -1, 0, 0},
+    {518, -1, 0, 0},
+    {519, -1, 0, 0},
+    {520, -1, 0, 0},
+    {521, -1, 0, 0},
+    {522, -1, 0, 0},
+    {523, -1, 0, 0},
+    {524, -1, 0, 0},
+    {525, -1, 0, 0},
+    {526, -1, 0, 0},
+    {527, -1, 0, 0},
+    {528, -1, 0, 0},
+    {529, -1, 0, 0},
+    {530, -1, 0, 0},
+    {531, -1, 0, 0},
+    {532, -1, 0, 0},
+    {533, -1, 0, 0},
+    {534, -1, 0, 0},
+    {535, -1, 0, 0},
+    {536, -1, 0, 0},
+    {537, -1, 0, 0},
+    {538, -1, 0, 0},
+    {539, -1, 0, 0},
+    {540, -1, 0, 0},
+    {541, -1, 0, 0},
+    {542, -1, 0, 0},
+    {543, -1, 0, 0},
+    {544, -1, 0, 0},
+    {545, -1, 0, 0},
+    {546, -1, 0, 0},
+    {547, -1, 0, 0},
+    {548, -1, 0, 0},
+    {549, -1, 0, 0},
+    {550, -1, 0, 0},
+    {551, -1, 0, 0},
+    {552, -1, 0, 0},
+    {553, -1, 0, 0},
+    {554, -1, 0, 0},
+    {555, -1, 0, 0},
+    {556, -1, 0, 0},
+    {557, -1, 0, 0},
+    {558, -1, 0, 0},
+    {559, -1, 0, 0},
+    {560, -1, 0, 0},
+    {561, -1, 0, 0},
+    {562, -1, 0, 0},
+    {563, -1, 0, 0},
+    {564, -1, 0, 0},
+    {565, -1, 0, 0},
+    {566, -1, 0, 0},
+    {567, -1, 0, 0},
+    {568, -1, 0, 0},
+    {569, -1, 0, 0},
+    {570, -1, 0, 0},
+    {-1, 571, 0, 0},
+    {572, -1, 0, 0},
+    {573, -1, 0, 0},
+    {574, -1, 0, 0},
+    {575, -1, 0, 0},
+    {576, -1, 0, 0},
+    {577, -1, 0, 0},
+    {578, -1, 0, 0},
+    {579, -1, 0, 0},
+    {-1, 580, 0, 0},
+    {581, -1, 0, 0},
+    {582, -1, 0, 0},
+    {583, -1, 0, 0},
+    {584, -1, 0, 0},
+    {585, -1, 0, 0},
+    {586, -1, 0, 0},
+    {587, -1, 0, 0},
+    {588, -1, 0, 0},
+    {-1, 589, 0, 0},
+    {590, -1, 0, 0},
+    {591, -1, 0, 0},
+    {592, -1, 0, 0},
+    {593, -1, 0, 0},
+    {594, -1, 0, 0},
+    {595, -1, 0, 0},
+    {596, -1, 0, 0},
+    {597, -1, 0, 0},
+    {-1, 598, 0, 0},
+    {599, -1, 0, 0},
+    {600, -1, 0, 0},
+    {601, -1, 0, 0},
+    {602, -1, 0, 0},
+    {603, -1, 0, 0},
+    {604, -1, 0, 0},
+    {605, -1, 0, 0},
+    {606, -1, 0, 0},
+    {607, -1, 0, 0},
+    {608, -1, 0, 0},
+    {609, -1, 0, 0},
+    {610, -1, 0, 0},
+    {611, -1, 0, 0},
+    {612, -1, 0, 0},
+    {613, -1, 0, 0},
+    {614, -1, 0, 0},
+    {-1, 615, 0, 0},
+    {-1, 616, 0, 0},
+    {-1, 617, 0, 0},
+    {618, -1, 0, 0},
+    {619, -1, 0, 0},
+    {620, -1, 0, 0},
+    {621, -1, 0, 0},
+    {622, -1, 0, 0},
+    {623, -1, 0, 0},
+    {624, -1, 0, 0},
+    {625, -1, 0, 0},
+    {626, -1, 0, 0},
+    {627, -1, 0, 0},
+    {628, -1, 0, 0},
+    {629, -1, 0, 0},
+    {630, -1, 0, 0},
+    {631, -1, 0, 0},
+    {632, -1, 0, 0},
+    {633, -1, 0, 0},
+    {634, -1, 0, 0},
+    {635, -1, 0, 0},
+    {636, -1, 0, 0},
+    {637, -1, 0, 0},
+    {638, -1, 0, 0},
+    {639, -1, 0, 0},
+    {640, -1, 0, 0},
+    {641, -1, 0, 0},
+    {642, -1, 0, 0},
+    {643, -1, 0, 0},
+    {644, -1, 0, 0},
+    {645, -1, 0, 0},
+    {646, -1, 0, 0},
+    {647, -1, 0, 0},
+    {648, -1, 0, 0},
+    {649, -1, 0, 0},
+    {650, -1, 0, 0},
+    {651, -1, 0, 0},
+    {652, -1, 0, 0},
+    {653, -1, 0, 0},
+    {654, -1, 0, 0},
+    {655, -1, 0, 0},
+    {656, -1, 0, 0},
+    {657, -1, 0, 0},
+    {-1, 658, 0, 0},
+    {659, -1, 0, 0},
+    {660, -1, 0, 0},
+    {-1, 661, 0, 0},
+    {662, -1, 0, 0},
+    {663, -1, 0, 0},
+    {664, -1, 0, 0},
+    {665, -1, 0, 0},
+    {666, -1, 0, 0},
+    {667, -1, 0, 0},
+    {668, -1, 0, 0},
+    {669, -1, 0, 0},
+    {670, -1, 0, 0},
+    {671, -1, 0, 0},
+    {672, -1, 0, 0},
+    {673, -1, 0, 0},
+    {-1, 674, 0, 0},
+    {675, -1, 0, 0},
+    {676, -1, 0, 0},
+    {677, -1, 0, 0},
+    {678, -1, 0, 0},
+    {679, -1, 0, 0},
+    {680, -1, 0, 0},
+    {681, -1, 0, 0},
+    {682, -1, 0, 0},
+    {683, -1, 0, 0},
+    {684, -1, 0, 0},
+    {685, -1, 0, 0},
+    {686, -1, 0, 0},
+    {687, -1, 0, 0},
+    {688, -1, 0, 0},
+    {689, -1, 0, 0},
+    {690, -1, 0, 0},
+    {691, -1, 0, 0},
+    {692, -1, 0, 0},
+    {693, -1, 0, 0},
+    {694, -1, 0, 0},
+    {695, -1, 0, 0},
+    {696, -1, 0, 0},
+    {697, -1, 0, 0},
+    {698, -1, 0, 0},
+    {699, -1, 0, 0},
+    {700, -1, 0, 0},
+    {701, -1, 0, 0},
+    {702, -1, 0, 0},
+    {703, -1, 0, 0},
+    {704, -1, 0, 0},
+    {705, -1, 0, 0},
+    {706, -1, 0, 0},
+    {707, -1, 0, 0},
+    {708, -1, 0, 0},
+    {709, -1, 0, 0},
+    {710, -1, 0, 0},
+    {711, -1, 0, 0},
+    {712, -1, 0, 0},
+    {713, -1, 0, 0},
+    {714, -1, 0, 0},
+    {715, -1, 0, 0},
+    {716, -1, 0, 0},
+    {717, -1, 0, 0},
+    {718, -1, 0, 0},
+    {719, -1, 0, 0},
+    {720, -1, 0, 0},
+    {721, -1, 0, 0},
+    {722, -1, 0, 0},
+    {-1, 723, 0, 0},
+    {724, -1, 0, 0},
+    {725, -1, 0, 0},
+    {726, -1, 0, 0},
+    {727, -1, 0, 0},
+    {728, -1, 0, 0},
+    {729, -1, 0, 0},
+    {730, -1, 0, 0},
+    {731, -1, 0, 0},
+    {732, -1, 0, 0},
+    {733, -1, 0, 0},
+    {734, -1, 0, 0},
+    {735, -1, 0, 0},
+    {736, -1, 0, 0},
+    {737, -1, 0, 0},
+    {738, -1, 0, 0},
+    {739, -1, 0, 0},
+    {740, -1, 0, 0},
+    {741, -1, 0, 0},
+    {742, -1, 0, 0},
+    {743, -1, 0, 0},
+    {744, -1, 0, 0},
+    {745, -1, 0, 0},
+    {746, -1, 0, 0},
+    {747, -1, 0, 0},
+    {748, -1, 0, 0},
+    {749, -1, 0, 0},
+    {750, -1, 0, 0},
+    {751, -1, 0, 0},
+    {752, -1, 0, 0},
+    {753, -1, 0, 0},
+    {-1, 754, 0, 0},
+    {755, -1, 0, 0},
+    {756, -1, 0, 0},
+    {757, -1, 0, 0},
+    {758, -1, 0, 0},
+    {759, -1, 0, 0},
+    {760, -1, 0, 0},
+    {761, -1, 0, 0},
+    {762, -1, 0, 0},
+    {763, -1, 0, 0},
+    {764, -1, 0, 0},
+    {765, -1, 0, 0},
+    {766, -1, 0, 0},
+    {767, -1, 0, 0},
+    {768, -1, 0, 0},
+    {769, -1, 0, 0},
+    {770, -1, 0, 0},
+    {771, -1, 0, 0},
+    {772, -1, 0, 0},
+    {773, -1, 0, 0},
+    {774, -1, 0, 0},
+    {775, -1, 0, 0},
+    {776, -1, 0, 0},
+    {777, -1, 0, 0},
+    {778, -1, 0, 0},
+    {779, -1, 0, 0},
+    {780, -1, 0, 0},
+    {781, -1, 0, 0},
+    {782, -1, 0, 0},
+    {783, -1, 0, 0},
+    {784, -1, 0, 0},
+    {785, -1, 0, 0},
+    {786, -1, 0, 0},
+    {787, -1, 0, 0},
+    {788, -1, 0, 0},
+    {789, -1, 0, 0},
+    {790, -1, 0, 0},
+    {791, -1, 0, 0},
+    {792, -1, 0, 0},
+    {793, -1, 0, 0},
+    {794, -1, 0, 0},
+    {795, -1, 0, 0},
+    {796, -1, 0, 0},
+    {797, -1, 0, 0},
+    {798, -1, 0, 0},
+    {799, -1, 0, 0},
+    {800, -1, 0, 0},
+    {801, -1, 0, 0},
+    {802, -1, 0, 0},
+    {803, -1, 0, 0},
+    {804, -1, 0, 0},
+    {805, -1, 0, 0},
+    {806, -1, 0, 0},
+    {-1, 807, 0, 0},
+    {-1, 808, 0, 0},
+    {809, -1, 0, 0},
+    {810, -1, 0, 0},
+    {-1, 811, 0, 0},
+    {-1, 812, 0, 0},
+    {-1, 813, 0, 0},
+    {-1, 814, 0, 0},
+    {-1, 815, 0, 0},
+    {816, -1, 0, 0},
+    {817, -1, 0, 0},
+    {818, -1, 0, 0},
+    {819, -1, 0, 0},
+    {820, -1, 0, 0},
+    {821, -1, 0, 0},
+    {-1, 822, 0, 0},
+    {823, -1, 0, 0},
+    {824, -1, 0, 0},
+    {-1, 825, 0, 0},
+    {826, -1, 0, 0},
+    {827, -1, 0, 0},
+    {828, -1, 0, 0},
+    {829, -1, 0, 0},
+    {830, -1, 0, 0},
+    {831, -1, 0, 0},
+    {832, -1, 0, 0},
+    {833, -1, 0, 0},
+    {834, -1, 0, 0},
+    {835, -1, 0, 0},
+    {836, -1, 0, 0},
+    {837, -1, 0, 0},
+    {838, -1, 0, 0},
+    {839, -1, 0, 0},
+    {840, -1, 0, 0},
+    {841, -1, 0, 0},
+    {842, -1, 0, 0},
+    {843, -1, 0, 0},
+    {844, -1, 0, 0},
+    {845, -1, 0, 0},
+    {846, -1, 0, 0},
+    {847, -1, 0, 0},
+    {848, -1, 0, 0},
+    {849, -1, 0, 0},
+    {850, -1, 0, 0},
+    {851, -1, 0, 0},
+    {852, -1, 0, 0},
+    {853, -1, 0, 0},
+    {854, -1, 0, 0},
+    {855, -1, 0, 0},
+    {856, -1, 0, 0},
+    {857, -1, 0, 0},
+    {858, -1, 0, 0},
+    {859, -1, 0, 0},
+    {860, -1, 0, 0},
+    {861, -1, 0, 0},
+    {862, -1, 0, 0},
+    {863, -1, 0, 0},
+    {864, -1, 0, 0},
+    {865, -1, 0, 0},
+    {866, -1, 0, 0},
+    {867, -1, 0, 0},
+    {-1, 868, 0, 0},
+    {869, -1, 0, 0},
+    {870, -1, 0, 0},
+    {871, -1, 0, 0},
+    {872, -1, 0, 0},
+    {873, -1, 0, 0},
+    {874, -1, 0, 0},
+    {875, -1, 0, 0},
+    {876, -1, 0, 0},
+    {877, -1, 0, 0},
+    {878, -1, 0, 0},
+    {879, -1, 0, 0},
+    {880, -1, 0, 0},
+    {881, -1, 0, 0},
+    {882, -1, 0, 0},
+    {883, -1, 0, 0},
+    {884, -1, 0, 0},
+    {885, -1, 0, 0},
+    {886, -1, 0, 0},
+    {887, -1, 0, 0},
+    {888, -1, 0, 0},
+    {889, -1, 0, 0},
+    {890, -1, 0, 0},
+    {891, -1, 0, 0},
+    {892, -1, 0, 0},
+    {893, -1, 0, 0},
+    {894, -1, 0, 0},
+    {895, -1, 0, 0},
+    {896, -1, 0, 0},
+    {897, -1, 0, 0},
+    {898, -1, 0, 0},
+    {899, -1, 0, 0},
+    {900, -1, 0, 0},
+    {901, -1, 0, 0},
+    {902, -1, 0, 0},
+    {903, -1, 0, 0},
+    {904, -1, 0, 0},
+    {905, -1, 0, 0},
+    {906, -1, 0, 0},
+    {907, -1, 0, 0},
+    {908, -1, 0, 0},
+    {-1, 909, 0, 0},
+    {910, -1, 0, 0},
+    {911, -1, 0, 0},
+    {912, -1, 0, 0},
+    {913, -1, 0, 0},
+    {914, -1, 0, 0},
+    {915, -1, 0, 0},
+    {916, -1, 0, 0},
+    {917, -1, 0, 0},
+    {918, -1, 0, 0},
+    {919, -1, 0, 0},
+    {920, -1, 0, 0},
+    {921, -1, 0, 0},
+    {922, -1, 0, 0},
+    {923, -1, 0, 0},
+    {924, -1, 0, 0},
+    {925, -1, 0, 0},
+    {926, -1, 0, 0},
+    {927, -1, 0, 0},
+    {928, -1, 0, 0},
+    {929, -1, 0, 0},
+    {930, -1, 0, 0},
+    {931, -1, 0, 0},
+    {932, -1, 0, 0},
+    {933, -1, 0, 0},
+    {934, -1, 0, 0},
+    {935, -1, 0, 0},
+    {936, -1, 0, 0},
+    {937, -1, 0, 0},
+    {938, -1, 0, 0},
+    {939, -1, 0, 0},
+    {940, -1, 0, 0},
+    {941, -1, 0, 0},
+    {942, -1, 0, 0},
+    {943, -1, 0, 0},
+    {944, -1, 0, 0},
+    {945, -1, 0, 0},
+    {946, -1, 0, 0},
+    {947, -1, 0, 0},
+    {948, -1, 0, 0},
+    {949, -1, 0, 0},
+    {950, -1, 0, 0},
+    {951, -1, 0, 0},
+    {952, -1, 0, 0},
+    {953, -1, 0, 0},
+    {954, -1, 0, 0},
+    {955, -1, 0, 0},
+    {956, -1, 0, 0},
+    {957, -1, 0, 0},
+    {958, -1, 0, 0},
+    {959, -1, 0, 0},
+    {960, -1, 0, 0},
+    {961, -1, 0, 0},
+    {962, -1, 0, 0},
+    {963, -1, 0, 0},
+    {964, -1, 0, 0},
+    {965, -1, 0, 0},
+    {966, -1, 0, 0},
+    {967, -1, 0, 0},
+    {968, -1, 0, 0},
+    {969, -1, 0, 0},
+    {970, -1, 0, 0},
+    {971, -1, 0, 0},
+    {972, -1, 0, 0},
+    {973, -1, 0, 0},
+    {974, -1, 0, 0},
+    {975, -1, 0, 0},
+    {976, -1, 0, 0},
+    {977, -1, 0, 0},
+    {978, -1, 0, 0},
+    {979, -1, 0, 0},
+    {-1, 980, 0, 0},
+    {-1, 981, 0, 0},
+    {982, -1, 0, 0},
+    {983, -1, 0, 0},
+    {984, -1, 0, 0},
+    {985, -1, 0, 0},
+    {986, -1, 0, 0},
+    {987, -1, 0, 0},
+    {988, -1, 0, 0},
+    {989, -1, 0, 0},
+    {990, -1, 0, 0},
+    {991, -1, 0, 0},
+    {992, -1, 0, 0},
+    {993, -1, 0, 0},
+    {994, -1, 0, 0},
+    {995, -1, 0, 0},
+    {996, -1, 0, 0},
+    {997, -1, 0, 0},
+    {998, -1, 0, 0},
+    {999, -1, 0, 0},
+    {1000, -1, 0, 0},
+    {1001, -1, 0, 0},
+    {1002, -1, 0, 0},
+    {1003, -1, 0, 0},
+    {1004, -1, 0, 0},
+    {1005, -1, 0, 0},
+    {1006, -1, 0, 0},
+    {1007, -1, 0, 0},
+    {1008, -1, 0, 0},
+    {1009, -1, 0, 0},
+    {1010, -1, 0, 0},
+    {1011, -1, 0, 0},
+    {1012, -1, 0, 0},
+    {1013, -1, 0, 0},
+    {1014, -1, 0, 0},
+    {1015, -1, 0, 0},
+    {1016, -1, 0, 0},
+    {1017, -1, 0, 0},
+    {-1, 1018, 0, 0},
+    {1019, -1, 0, 0},
+    {1020, -1, 0, 0},
+    {1021, -1, 0, 0},
+    {1022, -1, 0, 0},
+    {1023, -1, 0, 0},
+    {1024, -1, 0, 0},
+    {1025, -1, 0, 0},
+    {1026, -1, 0, 0},
+    {1027, -1, 0, 0},
+    {1028, -1, 0, 0},
+    {1029, -1, 0, 0},
+    {1030, -1, 0, 0},
+    {1031, -1, 0, 0},
+    {1032, -1, 0, 0},
+    {1033, -1, 0, 0},
+    {1034, -1, 0, 0},
+    {1035, -1, 0, 0},
+    {1036, -1, 0, 0},
+    {1037, -1, 0, 0},
+    {1038, -1, 0, 0},
+    {1039, -1, 0, 0},
+    {1040, -1, 0, 0},
+    {1041, -1, 0, 0},
+    {1042, -1, 0, 0},
+    {-1, 1043, 0, 0},
+    {1044, -1, 0, 0},
+    {1045, -1, 0, 0},
+    {1046, -1, 0, 0},
+    {1047, -1, 0, 0},
+    {1048, -1, 0, 0},
+    {1049, -1, 0, 0},
+    {1050, -1, 0, 0},
+    {1051, -1, 0, 0},
+    {1052, -1, 0, 0},
+    {1053, -1, 0, 0},
+    {1054, -1, 0, 0},
+    {1055, -1, 0, 0},
+    {-1, 1056, 0, 0},
+    {1057, -1, 0, 0},
+    {1058, -1, 0, 0},
+    {1059, -1, 0, 0},
+    {1060, -1, 0, 0},
+    {1061, -1, 0, 0},
+    {1062, -1, 0, 0},
+    {1063, -1, 0, 0},
+    {1064, -1, 0, 0},
+    {1065, -1, 0, 0},
+    {1066, -1, 0, 0},
+    {1067, -1, 0, 0},
+    {1068, -1, 0, 0},
+    {-1, 1069, 0, 0},
+    {1070, -1, 0, 0},
+    {1071, -1, 0, 0},
+    {1072, -1, 0, 0},
+    {1073, -1, 0, 0},
+    {1074, -1, 0, 0},
+    {1075, -1, 0, 0},
+    {1076, -1, 0, 0},
+    {1077, -1, 0, 0},
+    {1078, -1, 0, 0},
+    {1079, -1, 0, 0},
+    {1080, -1, 0, 0},
+    {1081, -1, 0, 0},
+    {1082, -1, 0, 0},
+    {1083, -1, 0, 0},
+    {-1, 1084, 0, 0},
+    {1085, -1, 0, 0},
+    {1086, -1, 0, 0},
+    {1087, -1, 0, 0},
+    {1088, -1, 0, 0},
+    {1089, -1, 0, 0},
+    {1090, -1, 0, 0},
+    {1091, -1, 0, 0},
+    {1092, -1, 0, 0},
+    {1093, -1, 0, 0},
+    {1094, -1, 0, 0},
+    {1095, -1, 0, 0},
+    {1096, -1, 0, 0},
+    {1097, -1, 0, 0},
+    {1098, -1, 0, 0},
+    {1099, -1, 0, 0},
+    {1100, -1, 0, 0},
+    {1101, -1, 0, 0},
+    {1102, -1, 0, 0},
+    {1103, -1, 0, 0},
+    {1104, -1, 0, 0},
+    {1105, -1, 0, 0},
+    {1106, -1, 0, 0},
+    {-1, 1107, 0, 0},
+    {1108, -1, 0, 0},
+    {1109, -1, 0, 0},
+    {1110, -1, 0, 0},
+    {1111, -1, 0, 0},
+    {1112, -1, 0, 0},
+    {1113, -1, 0, 0},
+    {-1, 1114, 0, 0},
+    {-1, 1115, 0, 0},
+    {-1, 1116, 0, 0},
+    {-1, 1117, 0, 0},
+    {-1, 1118, 0, 0},
+    {1119, -1, 0, 0},
+    {1120, -1, 0, 0},
+    {1121, -1, 0, 0},
+    {1122, -1, 0, 0},
+    {1123, -1, 0, 0},
+    {1124, -1, 0, 0},
+    {1125, -1, 0, 0},
+    {1126, -1, 0, 0},
+    {1127, -1, 0, 0},
+    {1128, -1, 0, 0},
+    {1129, -1, 0, 0},
+    {1130, -1, 0, 0},
+    {1131, -1, 0, 0},
+    {1132, -1, 0, 0},
+    {1133, -1, 0, 0},
+    {1134, -1, 0, 0},
+    {1135, -1, 0, 0},
+    {1136, -1, 0, 0},
+    {1137, -1, 0, 0},
+    {1138, -1, 0, 0},
+    {1139, -1, 0, 0},
+    {1140, -1, 0, 0},
+    {1141, -1, 0, 0},
+    {1142, -1, 0, 0},
+    {1143, -1, 0, 0},
+    {1144, -1, 0, 0},
+    {-1, 1145, 0, 0},
+    {-1, 1146, 0, 0},
+    {-1, 1147, 0, 0},
+    {-1, 1148, 0, 0},
+    {-1, 1149, 0, 0},
+    {-1, 1150, 0, 0},
+    {1151, -1, 0, 0},
+    {1152, -1, 0, 0},
+    {1153, -1, 0, 0},
+    {1154, -1, 0, 0},
+    {1155, -1, 0, 0},
+    {1156, -1, 0, 0},
+    {1157, -1, 0, 0},
+    {1158, -1, 0, 0},
+    {1159, -1, 0, 0},
+    {1160, -1, 0, 0},
+    {1161, -1, 0, 0},
+    {1162, -1, 0, 0},
+    {1163, -1, 0, 0},
+    {1164, -1, 0, 0},
+    {1165, -1, 0, 0},
+    {1166, -1, 0, 0},
+    {1167, -1, 0, 0},
+    {1168, -1, 0, 0},
+    {1169, -1, 0, 0},
+    {1170, -1, 0, 0},
+    {1171, -1, 0, 0},
+    {1172, -1, 0, 0},
+    {1173, -1, 0, 0},
+    {1174, -1, 0, 0},
+    {1175, -1, 0, 0},
+    {1176, -1, 0, 0},
+    {-1, 1177, 0, 0},
+    {-1, 1178, 0, 0},
+    {-1, 1179, 0, 0},
+    {-1, 1180, 0, 0},
+    {-1, 1181, 0, 0},
+    {-1, 1182, 0, 0},
+    {-1, 1183, 0, 0},
+    {-1, 1184, 0, 0},
+    {1185, -1, 0, 0},
+    {1186, -1, 0, 0},
+    {1187, -1, 0, 0},
+    {1188, -1, 0, 0},
+    {1189, -1, 0, 0},
+    {1190, -1, 0, 0},
+    {-1, 1191, 0, 0},
+    {-1, 1192, 0, 0},
+    {-1, 1193, 0, 0},
+    {-1, 1194, 0, 0},
+    {-1, 1195, 0, 0},
+    {-1, 1196, 0, 0},
+    {1197, -1, 0, 0},
+    {1198, -1, 0, 0},
+    {1199, -1, 0, 0},
+    {1200, -1, 0, 0},
+    {-1, 1201, 0, 0},
+    {-1, 1202, 0, 0},
+    {-1, 1203, 0, 0},
+    {1204, -1, 0, 0},
+    {1205, -1, 0, 0},
+    {1206, -1, 0, 0},
+    {1207, -1, 0, 0},
+    {-1, 1208, 0, 0},
+    {1209, -1, 0, 0},
+    {1210, -1, 0, 0},
+    {1211, -1, 0, 0},
+    {1212, -1, 0, 0},
+    {1213, -1, 0, 0},
+    {1214, -1, 0, 0},
+    {1215, -1, 0, 0},
+    {1216, -1, 0, 0},
+    {1217, -1, 0, 0},
+    {1218, -1, 0, 0},
+    {1219, -1, 0, 0},
+    {1220, -1, 0, 0},
+    {1221, -1, 0, 0},
+    {1222, -1, 0, 0},
+    {1223, -1, 0, 0},
+    {1224, -1, 0, 0},
+    {1225, -1, 0, 0},
+    {1226, -1, 0, 0},
+    {1227, -1, 0, 0},
+    {1228, -1, 0, 0},
+    {1229, -1, 0, 0},
+    {1230, -1, 0, 0},
+    {1231, -1, 0, 0},
+    {1232, -1, 0, 0},
+    {1233, -1, 0, 0},
+    {1234, -1, 0, 0},
+    {1235, -1, 0, 0},
+    {1236, -1, 0, 0},
+    {1237, -1, 0, 0},
+    {1238, -1, 0, 0},
+    {1239, -1, 0, 0},
+    {1240, -1, 0, 0},
+    {-1, 1241, 0, 0},
+    {1242, -1, 0, 0},
+    {1243, -1, 0, 0},
+    {1244, -1, 0, 0},
+    {1245, -1, 0, 0},
+    {1246, -1, 0, 0},
+    {1247, -1, 0, 0},
+    {1248, -1, 0, 0},
+    {1249, -1, 0, 0},
+    {1250, -1, 0, 0},
+    {1251, -1, 0, 0},
+    {1252, -1, 0, 0},
+    {1253, -1, 0, 0},
+    {1254, -1, 0, 0},
+    {1255, -1, 0, 0},
+    {1256, -1, 0, 0},
+    {1257, -1, 0, 0},
+    {-1, 1258, 0, 0},
+    {1259, -1, 0, 0},
+    {1260, -1, 0, 0},
+    {-1, 1261, 0, 0},
+    {1262, -1, 0, 0},
+    {1263, -1, 0, 0},
+    {-1, 1264, 0, 0},
+    {1265, -1, 0, 0},
+    {1266, -1, 0, 0},
+    {1267, -1, 0, 0},
+    {1268, -1, 0, 0},
+    {1269, -1, 0, 0},
+    {1270, -1, 0, 0},
+    {1271, -1, 0, 0},
+    {1272, -1, 0, 0},
+    {1273, -1, 0, 0},
+    {1274, -1, 0, 0},
+    {1275, -1, 0, 0},
+    {1276, -1, 0, 0},
+    {1277, -1, 0, 0},
+    {1278, -1, 0, 0},
+    {-1, 1279, 0, 0},
+    {1280, -1, 0, 0},
+    {1281, -1, 0, 0},
+    {1282, -1, 0, 0},
+    {1283, -1, 0, 0},
+    {1284, -1, 0, 0},
+    {1285, -1, 0, 0},
+    {1286, -1, 0, 0},
+    {1287, -1, 0, 0},
+    {1288, -1, 0, 0},
+    {1289, -1, 0, 0},
+    {1290, -1, 0, 0},
+    {1291, -1, 0, 0},
+    {1292, -1, 0, 0},
+    {1293, -1, 0, 0},
+    {1294, -1, 0, 0},
+    {1295, -1, 0, 0},
+    {1296, -1, 0, 0},
+    {1297, -1, 0, 0},
+    {1298, -1, 0, 0},
+    {1299, -1, 0, 0},
+    {1300, -1, 0, 0},
+    {1301, -1, 0, 0},
+    {1302, -1, 0, 0},
+    {1303, -1, 0, 0},
+    {1304, -1, 0, 0},
+    {1305, -1, 0, 0},
+    {1306, -1, 0, 0},
+    {1307, -1, 0, 0},
+    {1308, -1, 0, 0},
+    {1309, -1, 0, 0},
+    {1310, -1, 0, 0},
+    {1311, -1, 0, 0},
+    {1312, -1, 0, 0},
+    {1313, -1, 0, 0},
+    {1314, -1, 0, 0},
+    {1315, -1, 0, 0},
+    {-1, 1316, 0, 0},
+    {-1, 1317, 0, 0},
+    {1318, -1, 0, 0},
+    {1319, -1, 0, 0},
+    {1320, -1, 0, 0},
+    {1321, -1, 0, 0},
+    {1322, -1, 0, 0},
+    {1323, -1, 0, 0},
+    {1324, -1, 0, 0},
+    {1325, -1, 0, 0},
+    {1326, -1, 0, 0},
+    {1327, -1, 0, 0},
+    {1328, -1, 0, 0},
+    {1329, -1, 0, 0},
+    {1330, -1, 0, 0},
+    {1331, -1, 0, 0},
+    {1332, -1, 0, 0},
+    {1333, -1, 0, 0},
+    {1334, -1, 0, 0},
+    {1335, -1, 0, 0},
+    {1336, -1, 0, 0},
+    {1337, -1, 0, 0},
+    {-1, 1338, 0, 0},
+    {1339, -1, 0, 0},
+    {1340, -1, 0, 0},
+    {1341, -1, 0, 0},
+    {1342, -1, 0, 0},
+    {1343, -1, 0, 0},
+    {1344, -1, 0, 0},
+    {1345, -1, 0, 0},
+    {1346, -1, 0, 0},
+    {1347, -1, 0, 0},
+    {1348, -1, 0, 0},
+    {1349, -1, 0, 0},
+    {1350, -1, 0, 0},
+    {1351, -1, 0, 0},
+    {1352, -1, 0, 0},
+    {1353, -1, 0, 0},
+    {1354, -1, 0, 0},
+    {1355, -1, 0, 0},
+    {1356, -1, 0, 0},
+    {1357, -1, 0, 0},
+    {1358, -1, 0, 0},
+    {1359, -1, 0, 0},
+    {1360, -1, 0, 0},
+    {1361, -1, 0, 0},
+    {1362, -1, 0, 0},
+    {1363, -1, 0, 0},
+    {1364, -1, 0, 0},
+    {1365, -1, 0, 0},
+    {1366, -1, 0, 0},
+    {-1, 1367, 0, 0},
+    {1368, -1, 0, 0},
+    {1369, -1, 0, 0},
+    {1370, -1, 0, 0},
+    {1371, -1, 0, 0},
+    {1372, -1, 0, 0},
+    {1373, -1, 0, 0},
+    {1374, -1, 0, 0},
+    {1375, -1, 0, 0},
+    {1376, -1, 0, 0},
+    {1377, -1, 0, 0},
+    {1378, -1, 0, 0},
+    {1379, -1, 0, 0},
+    {1380, -1, 0, 0},
+    {1381, -1, 0, 0},
+    {1382, -1, 0, 0},
+    {1383, -1, 0, 0},
+    {1384, -1, 0, 0},
+    {1385, -1, 0, 0},
+    {-1, 1386, 0, 0},
+    {-1, 1387, 0, 0},
+    {-1, 1388, 0, 0},
+    {-1, 1389, 0, 0},
+    {-1, 1390, 0, 0},
+    {-1, 1391, 0, 0},
+    {1392, -1, 0, 0},
+    {1393, -1, 0, 0},
+    {1394, -1, 0, 0},
+    {1395, -1, 0, 0},
+    {1396, -1, 0, 0},
+    {1397, -1, 0, 0},
+    {1398, -1, 0, 0},
+    {1399, -1, 0, 0},
+    {1400, -1, 0, 0},
+    {1401, -1, 0, 0},
+    {1402, -1, 0, 0},
+    {1403, -1, 0, 0},
+    {1404, -1, 0, 0},
+    {1405, -1, 0, 0},
+    {1406, -1, 0, 0},
+    {1407, -1, 0, 0},
+    {1408, -1, 0, 0},
+    {1409, -1, 0, 0},
+    {1410, -1, 0, 0},
+    {1411, -1, 0, 0},
+    {1412, -1, 0, 0},
+    {1413, -1, 0, 0},
+    {-1, 1414, 0, 0},
+    {-1, 1415, 0, 0},
+    {-1, 1416, 0, 0},
+    {1417, -1, 0, 0},
+    {1418, -1, 0, 0},
+    {1419, -1, 0, 0},
+    {1420, -1, 0, 0},
+    {1421, -1, 0, 0},
+    {1422, -1, 0, 0},
+    {1423, -1, 0, 0},
+    {1424, -1, 0, 0},
+    {1425, -1, 0, 0},
+    {1426, -1, 0, 0},
+    {1427, -1, 0, 0},
+    {1428, -1, 0, 0},
+    {1429, -1, 0, 0},
+    {1430, -1, 0, 0},
+    {1431, -1, 0, 0},
+    {1432, -1, 0, 0},
+    {1433, -1, 0, 0},
+    {1434, -1, 0, 0},
+    {1435, -1, 0, 0},
+    {1436, -1, 0, 0},
+    {1437, -1, 0, 0},
+    {1438, -1, 0, 0},
+    {1439, -1, 0, 0},
+    {1440, -1, 0, 0},
+    {1441, -1, 0, 0},
+    {1442, -1, 0, 0},
+    {1443, -1, 0, 0},
+    {1444, -1, 0, 0},
+    {1445, -1, 0, 0},
+    {1446, -1, 0, 0},
+    {1447, -1, 0, 0},
+    {1448, -1, 0, 0},
+    {-1, 1449, 0, 0},
+    {1450, -1, 0, 0},
+    {1451, -1, 0, 0},
+    {-1, 1452, 0, 0},
+    {1453, -1, 0, 0},
+    {1454, -1, 0, 0},
+    {-1, 1455, 0, 0},
+    {1456, -1, 0, 0},
+    {1457, -1, 0, 0},
+    {1458, -1, 0, 0},
+    {1459, -1, 0, 0},
+    {1460, -1, 0, 0},
+    {1461, -1, 0, 0},
+    {1462, -1, 0, 0},
+    {1463, -1, 0, 0},
+    {1464, -1, 0, 0},
+    {1465, -1, 0, 0},
+    {1466, -1, 0, 0},
+    {1467, -1, 0, 0},
+    {-1, 1468, 0, 0},
+    {1469, -1, 0, 0},
+    {1470, -1, 0, 0},
+    {1471, -1, 0, 0},
+    {1472, -1, 0, 0},
+    {1473, -1, 0, 0},
+    {1474, -1, 0, 0},
+    {1475, -1, 0, 0},
+    {1476, -1, 0, 0},
+    {1477, -1, 0, 0},
+    {1478, -1, 0, 0},
+    {1479, -1, 0, 0},
+    {1480, -1, 0, 0},
+    {1481, -1, 0, 0},
+    {1482, -1, 0, 0},
+    {1483, -1, 0, 0},
+    {1484, -1, 0, 0},
+    {1485, -1, 0, 0},
+    {1486, -1, 0, 0},
+    {-1, 1487, 0, 0},
+    {1488, -1, 0, 0},
+    {1489, -1, 0, 0},
+    {1490, -1, 0, 0},
+    {1491, -1, 0, 0},
+    {1492, -1, 0, 0},
+    {1493, -1, 0, 0},
+    {1494, -1, 0, 0},
+    {1495, -1, 0, 0},
+    {1496, -1, 0, 0},
+    {1497, -1, 0, 0},
+    {-1, 1498, 0, 0},
+    {1499, -1, 0, 0},
+    {1500, -1, 0, 0},
+    {1501, -1, 0, 0},
+    {1502, -1, 0, 0},
+    {1503, -1, 0, 0},
+    {1504, -1, 0, 0},
+    {1505, -1, 0, 0},
+    {1506, -1, 0, 0},
+    {-1, -1, 0, 0}
+};
+
+static const int trieRootChild[] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 493, -1, -1, 1040, -1, 440,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 118, 331, 200, 5180, 16,
+    212, 31, 160, -1, 186, 125, 529, 36, 172, 4787,
+    21, -1, 896, 229, 26, -1, 206, 192, -1, 6,
+    12, -1, -1, -1, -1, -1, -1, 82, 321, 53,
+    46, 13, 77, 27, 41, 757, 180, 37, 305, 32,
+    70, 213, 17, 2404, 138, 105, 22, 69, 201, 187,
+    -1, 1, 7, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 301, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 65, 853, -1, 865, -1, -1,
+    -1, -1, -1, -1, -1, -1, 67, 355, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 218, -1, -1, 845,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1,
+};
+
+static const int trieSlots[] = {
+    0, 0, 0, 0, 0, 1, 1, 1, 2, 2,
+    2, 3, 3, 3, 4, 4, 4, 5, 5, 5,
+    6, 6, 6, 7, 7, 7, 8, 8, 8, 9,
+    9, 9, 10, 10, 10, 11, 11, 11, 12, 12,
+    12, 13, 13, 13, 14, 14, 14, 15, 15, 15,
+    16, 16, 16, 17, 17, 17, 18, 18, 18, 18,
+    19, 19, 19, 20, 20, 20, 21, 21, 21, 22,
+    22, 22, 23, 23, 23, 23, 23, 23, 23, 23,
+    24, 24, 24, 25, 25, 25, 26, 26, 26, 9,
+    9, 9, 27, 27, 27, 27, 27, 27, 28, 28,
+    28, 29, 29, 29, 29, 30, 30, 30, 32, 32,
+    32, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 37, 37, 37, 37, 37,
+    37, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 41, 41, 41, 41,
+    41, 41, 41, 42, 42, 42, 42, 42, 42, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 47, 47, 47, 48, 48, 49, 49, 49,
+    50, 50, 52, 52, 53, 53, 53, 55, 55, 55,
+    56, 56, 2, 2, 3, 3, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    6, 6, 5, 5, 9, 9, 9, 9, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 44, 44, 58,
+    58, 58, 58, 58, 58, 59, 59, 59, 60, 60,
+    61, 61, 62, 62, 63, 63, 64, 64, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 67, 67, 67, 67, 67, 67,
+    68, 68, 68, 68, 68, 68, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 70, 70, 71, 71, 71,
+    72, 72, 72, 72, 72, 72, 73, 73, 74, 74,
+    74, 74, 74, 74, 75, 75, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    78, 78, 79, 79, 80, 80, 80, 81, 81, 82,
+    82, 83, 83, 84, 84, 84, 84, 84, 84, 84,
+    84, 85, 85, 85, 85, 85, 85, 86, 86, 87,
+    87, 87, 87, 87, 87, 88, 88, 89, 89, 90,
+    90, 91, 91, 91, 91, 91, 91, 92, 92, 93,
+    93, 93, 93, 93, 93, 93, 93, 42, 42, 94,
+    94, 94, 94, 94, 94, 95, 95, 95, 95, 95,
+    95, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 97, 97, 97, 97, 97, 97, 98,
+    98, 99, 99, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 104,
+    104, 104, 104, 104, 104, 105, 105, 106, 106, 108,
+    108, 108, 108, 108, 108, 108, 108, 109, 111, 111,
+    112, 112, 114, 114, 114, 114, 114, 114, 115, 115,
+    115, 115, 115, 115, 116, 116, 116, 116, 116, 116,
+    117, 117, 118, 118, 119, 119, 119, 119, 119, 119,
+    120, 120, 120, 120, 120, 120, 121, 121, 121, 122,
+    122, 122, 123, 123, 123, 123, 123, 123, 124, 124,
+    124, 124, 124, 124, 125, 36, 36, 126, 126, 126,
+    126, 126, 126, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 129, 129, 129,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 130, 130, 130, 131, 131, 132, 132, 132, 132,
+    132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+    133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+    133, 133, 133, 133, 133, 134, 134, 134, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 135,
+    135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+    135, 135, 135, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 136, 136, 136, 136, 136, 136, 136, 137,
+    137, 137, 137, 137, 137, 137, 138, 138, 138, 138,
+    138, 138, 138, 139, 139, 139, 123, 123, 123, 123,
+    123, 123, 140, 140, 140, 140, 140, 140, 141, 141,
+    141, 141, 141, 141, 142, 142, 142, 142, 142, 142,
+    143, 143, 143, 143, 143, 143, 144, 144, 144, 144,
+    144, 144, 144, 144, 144, 144, 144, 144, 146, 147,
+    147, 148, 148, 148, 148, 148, 148, 149, 149, 149,
+    149, 149, 149, 150, 150, 150, 150, 150, 150, 151,
+    151, 151, 151, 151, 151, 152, 152, 152, 152, 152,
+    152, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+    154, 154, 154, 154, 154, 154, 155, 155, 155, 155,
+    155, 155, 156, 156, 156, 156, 156, 156, 157, 157,
+    157, 157, 157, 157, 158, 158, 158, 158, 158, 158,
+    159, 159, 159, 159, 159, 159, 160, 160, 160, 160,
+    160, 160, 161, 161, 162, 162, 163, 163, 164, 164,
+    165, 165, 167, 167, 168, 168, 168, 168, 168, 168,
+    168, 168, 170, 170, 170, 170, 170, 170, 170, 170,
+    170, 170, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 172, 172, 172, 172, 172, 172,
+    173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+    173, 173, 173, 173, 173, 173, 173, 173, 173, 174,
+    174, 174, 174, 174, 174, 168, 168, 175, 175, 176,
+    176, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 178, 178, 178, 178, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 179, 179, 179,
+    179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+    180, 180, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176, 176, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 182, 182, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 184, 184,
+    184, 184, 184, 184, 184, 185, 185, 185, 185, 186,
+    186, 186, 186, 186, 186, 187, 187, 187, 187, 187,
+    187, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+    188, 188, 188, 188, 188, 188, 188, 189, 189, 189,
+    189, 190, 190, 190, 190, 190, 190, 191, 191, 191,
+    191, 191, 191, 192, 192, 192, 192, 192, 192, 190,
+    190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+    190, 190, 190, 190, 190, 191, 191, 191, 191, 191,
+    191, 191, 191, 191, 191, 193, 194, 195, 195, 195,
+    195, 197, 197, 197, 199, 199, 201, 201, 201, 203,
+    203, 204, 204, 205, 205, 205, 205, 205, 205, 205,
+    205, 206, 206, 206, 206, 206, 206, 207, 207, 207,
+    207, 207, 207, 208, 208, 208, 208, 208, 208, 208,
+    208, 208, 209, 209, 210, 210, 210, 210, 210, 210,
+    211, 211, 211, 211, 211, 211, 211, 211, 211, 212,
+    212, 213, 14, 14, 14, 214, 214, 214, 214, 214,
+    214, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    216, 216, 216, 216, 216, 216, 217, 217, 217, 217,
+    217, 217, 218, 218, 218, 218, 218, 218, 219, 219,
+    219, 219, 219, 219, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 220, 220, 221, 223, 225, 225,
+    226, 226, 227, 227, 228, 228, 226, 226, 229, 229,
+    230, 230, 231, 231, 232, 232, 233, 233, 234, 235,
+    235, 235, 235, 235, 235, 236, 236, 236, 236, 236,
+    236, 237, 237, 237, 237, 237, 237, 237, 237, 238,
+    238, 239, 239, 240, 240, 242, 242, 242, 243, 243,
+    244, 244, 245, 245, 246, 246, 247, 247, 248, 248,
+    249, 249, 249, 249, 249, 249, 250, 252, 254, 254,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 257, 257, 259, 259, 260, 260, 261, 261, 261,
+    262, 262, 262, 258, 258, 258, 264, 264, 265, 265,
+    265, 265, 267, 267, 168, 168, 168, 168, 168, 268,
+    268, 268, 268, 268, 268, 269, 269, 269, 269, 269,
+    269, 271, 271, 271, 271, 271, 271, 271, 31, 31,
+    31, 31, 272, 272, 272, 272, 274, 274, 274, 275,
+    275, 275, 275, 275, 275, 275, 275,
+    -1
+};
+
+static const BundledDb bundledDb = {
+    units,
+    factors,
+    unitNames,
+    unitSymbols,
+    {names, namesDisplacements, 1348, 338},
+    {symbols, symbolsDisplacements, 159, 40},
+    {trieNodes, trieEntries, trieRootChild, trieSlots, 5196, 1543, 1507},
+    276,
+    51,
+    42,
+    2
+};
+
+
+/*
+ * Returns the unit-system of the unit database that was bundled with the
+ * package.  See "udunits2.h".
+ */
+ut_system*
+ut_read_bundled(void)
+{
+    return bdbLoad(&bundledDb);
+}
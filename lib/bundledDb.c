@@ -0,0 +1,495 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Loading of, and lookups in, the bundled unit database.
+ *
+ * The units of the database are created from a static program of unit
+ * operations, so the XML files aren't read and the unit definitions aren't
+ * parsed.  The unit-names and unit-symbols of the database are looked-up in
+ * static, minimal perfect hash-tables and the identifier-trie of the
+ * unit-system shares a static image (see "idtSetImage()"), so neither is
+ * built when the database is loaded.  Identifiers that the client maps
+ * afterwards are kept in the usual tables (see "idToUnitMap.c").
+ *
+ * Lookups don't modify the unit-system.  Removal of a mapping must be
+ * externally synchronized.
+ */
+
+/*LINTLIBRARY*/
+
+#ifndef	_XOPEN_SOURCE
+#   define _XOPEN_SOURCE 500
+#endif
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <string.h>
+
+#include "bundledDb.h"			/* this module's API */
+#include "idTrie.h"
+#include "systemTable.h"
+#include "udunits2.h"
+
+/*
+ * The state of a unit-system that was loaded from a bundled database.
+ */
+typedef struct {
+    const BundledDb*	db;
+    ut_unit**		units;		/* units of the database */
+    int			unitCount;	/* number of units created */
+    unsigned char*	isRemoved;	/* NULL or flag of each name, symbol */
+} BundledSystem;
+
+#define HASH_INIT	2166136261UL
+#define HASH_MASK	0xFFFFFFFFUL
+
+/*
+ * Returns the character of a key.
+ *
+ * Arguments:
+ *	c	A character of an identifier.
+ *	isName	Whether the identifier is a name.
+ * Returns:
+ *	The character of the key: "c" in lowercase if "isName" is true;
+ *	otherwise, "c".
+ */
+#define KEY_CHAR(c, isName) \
+    ((isName) ? tolower((unsigned char)(c)) : (unsigned char)(c))
+
+
+/*
+ * Returns the bundled-database state of a unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ * Returns:
+ *	NULL	"system" wasn't loaded from a bundled database.
+ *	else	Pointer to the state.
+ */
+static BundledSystem*
+getState(
+    const ut_system* const	system)
+{
+    return *(BundledSystem**)coreGetTable(system, ST_BUNDLED_DB);
+}
+
+
+/*
+ * Returns the slot of an identifier in a minimal perfect hash-table.
+ *
+ * Arguments:
+ *	table	Pointer to the hash-table.
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	-1	"table" doesn't contain "id".
+ *	else	Index of the slot of "id".
+ */
+static int
+bdbLookup(
+    const BundledHash* const	table,
+    const char*			id,
+    const int			isName)
+{
+    int		index = -1;
+
+    if (table->idCount > 0) {
+	const unsigned long	hash = bdbHash(id, isName);
+	const int		slot = bdbSlot(hash,
+	    table->displacements[hash % (unsigned long)table->bucketCount],
+	    table->idCount);
+	const char*		key = table->ids[slot].key;
+
+	while (*id != 0 && KEY_CHAR(*id, isName) == (unsigned char)*key) {
+	    id++;
+	    key++;
+	}
+
+	if (*id == 0 && *key == 0)
+	    index = slot;
+    }
+
+    return index;
+}
+
+
+/*
+ * Creates the units of a bundled database in a unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	state	Pointer to the bundled-database state of "system".
+ * Returns:
+ *	UT_SUCCESS	Success.
+ *	else		The status of the failed unit operation.
+ */
+static ut_status
+bdbCreateUnits(
+    ut_system* const		system,
+    BundledSystem* const	state)
+{
+    const BundledDb* const	db = state->db;
+    ut_status			status = UT_SUCCESS;
+
+    while (status == UT_SUCCESS && state->unitCount < db->unitCount) {
+	const BundledUnit* const	bu = db->units + state->unitCount;
+	ut_unit*			unit = NULL;
+
+	switch (bu->op) {
+	case BU_BASE:
+	    unit = ut_new_base_unit(system);
+	    break;
+	case BU_DIMENSIONLESS:
+	    unit = ut_new_dimensionless_unit(system);
+	    break;
+	case BU_PRODUCT: {
+	    ut_product_builder	builder;
+	    int			i;
+
+	    (void)ut_init_product(&builder, system);
+
+	    for (i = bu->unit; i < bu->unit + bu->count; i++)
+		(void)ut_multiply_product(&builder,
+		    state->units[db->factors[i].unit], db->factors[i].power);
+
+	    unit = ut_finish_product(&builder);
+	    break;
+	}
+	case BU_GALILEAN: {
+	    ut_unit* const	scaled =
+		ut_scale(bu->scale, state->units[bu->unit]);
+
+	    if (scaled != NULL) {
+		unit = ut_offset(scaled, bu->offset);
+		ut_free(scaled);
+	    }
+	    break;
+	}
+	case BU_TIMESTAMP:
+	    unit = ut_offset_by_time(state->units[bu->unit], bu->offset);
+	    break;
+	case BU_LOG:
+	    unit = ut_log(bu->scale, state->units[bu->unit]);
+	    break;
+	}
+
+	if (unit == NULL) {
+	    status = ut_get_status();
+	    ut_handle_error_message(
+		"bdbCreateUnits(): Couldn't create unit %d of bundled database",
+		state->unitCount);
+	}
+	else {
+	    state->units[state->unitCount++] = unit;
+
+	    if (state->unitCount - 1 == db->second)
+		status = ut_set_second(unit);
+	}
+    }
+
+    return status;
+}
+
+
+/*
+ * Maps units of a bundled database to their identifiers.
+ *
+ * Arguments:
+ *	state	Pointer to the bundled-database state of the unit-system.
+ *	ids	Pointer to the unit-identifiers.
+ *	count	The number of unit-identifiers.
+ *	map	Function that maps a unit to an identifier.
+ * Returns:
+ *	UT_SUCCESS	Success.
+ *	else		Failure.  See "ut_map_unit_to_name()".
+ */
+static ut_status
+bdbMapUnits(
+    const BundledSystem* const	state,
+    const BundledUnitId*	ids,
+    const int			count,
+    ut_status			(*map)(const ut_unit*, const char*,
+				    ut_encoding))
+{
+    ut_status	status = UT_SUCCESS;
+    int		i;
+
+    for (i = 0; status == UT_SUCCESS && i < count; i++)
+	status = map(state->units[ids[i].unit], ids[i].id, ids[i].encoding);
+
+    return status;
+}
+
+
+/******************************************************************************
+ * Internal API:
+ ******************************************************************************/
+
+
+/*
+ * Returns the hash-code of the key of an identifier.
+ *
+ * Arguments:
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name (and its key is in lowercase).
+ * Returns:
+ *	The hash-code of the key of "id".
+ */
+unsigned long
+bdbHash(
+    const char*	id,
+    const int	isName)
+{
+    unsigned long	hash = HASH_INIT;
+
+    for (; *id != 0; id++) {
+	hash ^= (unsigned long)KEY_CHAR(*id, isName);
+	hash = (hash * 16777619UL) & HASH_MASK;
+    }
+
+    return hash;
+}
+
+
+/*
+ * Returns the slot of a key in a minimal perfect hash-table.
+ *
+ * Arguments:
+ *	hash		The hash-code of the key.
+ *	displacement	The displacement of the key's bucket: a negative value
+ *			is the complement of the slot; otherwise, the slot is
+ *			hashed from "hash" and "displacement".
+ *	idCount		The number of slots of the table.
+ * Returns:
+ *	The index of the slot.
+ */
+int
+bdbSlot(
+    const unsigned long	hash,
+    const int		displacement,
+    const int		idCount)
+{
+    int		slot;
+
+    if (displacement < 0) {
+	slot = ~displacement;
+    }
+    else {
+	/*
+	 * Mix the bits of the hash-code and displacement so that each
+	 * displacement maps the keys of a bucket to unrelated slots.
+	 */
+	unsigned long	h =
+	    (hash ^ ((unsigned long)displacement * 0x9E3779B9UL)) & HASH_MASK;
+
+	h ^= h >> 16;
+	h = (h * 0x85EBCA6BUL) & HASH_MASK;
+	h ^= h >> 13;
+	h = (h * 0xC2B2AE35UL) & HASH_MASK;
+	h ^= h >> 16;
+	slot = (int)(h % (unsigned long)idCount);
+    }
+
+    return slot;
+}
+
+
+/*
+ * Returns a new unit-system that contains the units and identifiers of a
+ * bundled database.
+ *
+ * Arguments:
+ *	db	Pointer to the bundled database.  Must remain valid until the
+ *		unit-system is freed.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	Pointer to the new unit-system.
+ */
+ut_system*
+bdbLoad(
+    const BundledDb* const	db)
+{
+    ut_system*	system = ut_new_system();
+
+    if (system == NULL) {
+	ut_handle_error_message("bdbLoad(): Couldn't create new unit-system");
+    }
+    else {
+	ut_status	status = UT_OS;
+	BundledSystem*	state = malloc(sizeof(BundledSystem));
+
+	if (state != NULL) {
+	    state->units = malloc(db->unitCount*sizeof(ut_unit*));
+
+	    if (state->units == NULL) {
+		free(state);
+		state = NULL;
+	    }
+	}
+
+	if (state == NULL) {
+	    ut_set_status(status);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"bdbLoad(): Couldn't allocate bundled-database state");
+	}
+	else {
+	    state->db = db;
+	    state->unitCount = 0;
+	    state->isRemoved = NULL;
+	    *(BundledSystem**)coreGetTable(system, ST_BUNDLED_DB) = state;
+
+	    /*
+	     * The units of the database are allocated contiguously.
+	     */
+	    (void)ut_set_arena(system, 1);
+	    status = bdbCreateUnits(system, state);
+	    (void)ut_set_arena(system, 0);
+
+	    if (status == UT_SUCCESS)
+		status = idtSetImage(system, &db->trie, state->units);
+
+	    if (status == UT_SUCCESS)
+		status = bdbMapUnits(state, db->unitNames, db->unitNameCount,
+		    ut_map_unit_to_name);
+
+	    if (status == UT_SUCCESS)
+		status = bdbMapUnits(state, db->unitSymbols,
+		    db->unitSymbolCount, ut_map_unit_to_symbol);
+	}
+
+	if (status != UT_SUCCESS) {
+	    ut_free_system(system);
+	    system = NULL;
+	}
+
+	ut_set_status(status);
+    }
+
+    return system;
+}
+
+
+/*
+ * Returns the unit to which an identifier of the bundled database of a
+ * unit-system maps.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	NULL	"system" wasn't loaded from a bundled database or "id" isn't
+ *		mapped by it.
+ *	else	Pointer to the unit.  The client must not free it.
+ */
+const ut_unit*
+bdbFind(
+    const ut_system* const	system,
+    const char* const		id,
+    const int			isName)
+{
+    const ut_unit*		unit = NULL;
+    const BundledSystem* const	state = getState(system);
+
+    if (state != NULL) {
+	const BundledHash* const	table =
+	    isName ? &state->db->names : &state->db->symbols;
+	const int			slot = bdbLookup(table, id, isName);
+
+	if (slot >= 0 && (state->isRemoved == NULL ||
+		!state->isRemoved[isName ? slot : state->db->names.idCount +
+		    slot]))
+	    unit = state->units[table->ids[slot].unit];
+    }
+
+    return unit;
+}
+
+
+/*
+ * Removes the mapping from an identifier of the bundled database of a
+ * unit-system.  Does nothing if the unit-system wasn't loaded from a bundled
+ * database or the identifier isn't in it.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+bdbRemove(
+    const ut_system* const	system,
+    const char* const		id,
+    const int			isName)
+{
+    ut_status			status = UT_SUCCESS;
+    BundledSystem* const	state = getState(system);
+
+    if (state != NULL) {
+	const BundledDb* const	db = state->db;
+	const int		slot =
+	    bdbLookup(isName ? &db->names : &db->symbols, id, isName);
+
+	if (slot >= 0) {
+	    if (state->isRemoved == NULL) {
+		state->isRemoved =
+		    calloc(db->names.idCount + db->symbols.idCount, 1);
+
+		if (state->isRemoved == NULL) {
+		    status = UT_OS;
+		    ut_set_status(status);
+		    ut_handle_error_message(strerror(errno));
+		    ut_handle_error_message(
+			"bdbRemove(): Couldn't allocate removal flags");
+		}
+	    }
+
+	    if (state->isRemoved != NULL)
+		state->isRemoved[isName ? slot : db->names.idCount + slot] = 1;
+	}
+    }
+
+    return status;
+}
+
+
+/*
+ * Frees the resources of a unit-system that were allocated by "bdbLoad()".
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system to have its associated
+ *			resources freed.
+ */
+void
+bdbFreeSystem(
+    ut_system*	system)
+{
+    if (system != NULL) {
+	BundledSystem** const	state =
+	    (BundledSystem**)coreGetTable(system, ST_BUNDLED_DB);
+
+	if (*state != NULL) {
+	    int	i;
+
+	    for (i = 0; i < (*state)->unitCount; i++)
+		ut_free((*state)->units[i]);
+
+	    free((*state)->units);
+	    free((*state)->isRemoved);
+	    free(*state);
+	    *state = NULL;
+	}
+    }
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * The bundled unit database: the units and identifiers of the default XML
+ * database as generated by "makeBundledData" into "bundledData.c", which is
+ * distributed with the package.
+ */
+#ifndef UT_BUNDLED_DB_H_INCLUDED
+#define UT_BUNDLED_DB_H_INCLUDED
+
+#include "idTrie.h"
+#include "udunits2.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * The operation that creates a unit of the database from units that precede
+ * it.
+ */
+typedef enum {
+    BU_BASE,			/* ut_new_base_unit() */
+    BU_DIMENSIONLESS,		/* ut_new_dimensionless_unit() */
+    BU_PRODUCT,			/* product of basic-units */
+    BU_GALILEAN,		/* ut_offset(ut_scale()) */
+    BU_TIMESTAMP,		/* ut_offset_by_time() */
+    BU_LOG			/* ut_log() */
+} BundledOp;
+
+typedef struct {
+    BundledOp	op;
+    int		unit;		/* underlying unit or first factor */
+    int		count;		/* number of factors of a product */
+    double	scale;		/* scale-factor or logarithmic base */
+    double	offset;		/* offset or time-origin */
+} BundledUnit;
+
+typedef struct {
+    int		unit;		/* basic-unit */
+    int		power;
+} BundledFactor;
+
+/*
+ * A unit-name or unit-symbol.  The key of a name is the name in lowercase.
+ */
+typedef struct {
+    const char*	key;
+    int		unit;
+} BundledId;
+
+/*
+ * A minimal perfect hash-table of identifiers: the hash-code of a key selects
+ * a bucket and the displacement of the bucket selects the key's slot (see
+ * "bdbSlot()").  The table has exactly one slot per identifier.
+ */
+typedef struct {
+    const BundledId*	ids;		/* in slot order */
+    const int*		displacements;	/* of each bucket */
+    int			idCount;
+    int			bucketCount;
+} BundledHash;
+
+/*
+ * The identifier to which a unit maps in a given encoding.
+ */
+typedef struct {
+    int		unit;
+    ut_encoding	encoding;
+    const char*	id;
+} BundledUnitId;
+
+typedef struct {
+    const BundledUnit*		units;		/* in order of creation */
+    const BundledFactor*	factors;	/* of the products */
+    const BundledUnitId*	unitNames;
+    const BundledUnitId*	unitSymbols;
+    BundledHash			names;
+    BundledHash			symbols;
+    TrieImage			trie;		/* units are "units" */
+    int				unitCount;
+    int				unitNameCount;
+    int				unitSymbolCount;
+    int				second;		/* the "second" unit or -1 */
+} BundledDb;
+
+
+/*
+ * Returns the hash-code of the key of an identifier.
+ *
+ * Arguments:
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name (and its key is in lowercase).
+ * Returns:
+ *	The hash-code of the key of "id".
+ */
+unsigned long
+bdbHash(
+    const char*	id,
+    const int	isName);
+
+
+/*
+ * Returns the slot of a key in a minimal perfect hash-table.
+ *
+ * Arguments:
+ *	hash		The hash-code of the key.
+ *	displacement	The displacement of the key's bucket: a negative value
+ *			is the complement of the slot; otherwise, the slot is
+ *			hashed from "hash" and "displacement".
+ *	idCount		The number of slots of the table.
+ * Returns:
+ *	The index of the slot.
+ */
+int
+bdbSlot(
+    const unsigned long	hash,
+    const int		displacement,
+    const int		idCount);
+
+
+/*
+ * Returns a new unit-system that contains the units and identifiers of a
+ * bundled database.
+ *
+ * Arguments:
+ *	db	Pointer to the bundled database.  Must remain valid until the
+ *		unit-system is freed.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	Pointer to the new unit-system.
+ */
+ut_system*
+bdbLoad(
+    const BundledDb* const	db);
+
+
+/*
+ * Returns the unit to which an identifier of the bundled database of a
+ * unit-system maps.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	NULL	"system" wasn't loaded from a bundled database or "id" isn't
+ *		mapped by it.
+ *	else	Pointer to the unit.  The client must not free it.
+ */
+const ut_unit*
+bdbFind(
+    const ut_system* const	system,
+    const char* const		id,
+    const int			isName);
+
+
+/*
+ * Removes the mapping from an identifier of the bundled database of a
+ * unit-system.  Does nothing if the unit-system wasn't loaded from a bundled
+ * database or the identifier isn't in it.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+bdbRemove(
+    const ut_system* const	system,
+    const char* const		id,
+    const int			isName);
+
+
+/*
+ * Frees the resources of a unit-system that were allocated by "bdbLoad()".
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system to have its associated
+ *			resources freed.
+ */
+void
+bdbFreeSystem(
+    ut_system*	system);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Error-handling contexts of the UDUNITS2(3) library.
+ *
+ * Each thread has its own context, so the status and error-message handler of
+ * one thread aren't affected by another.  A client may also create contexts
+ * and install one in whichever thread is executing a task (e.g., in a thread
+ * pool), so that the task's status follows the task rather than the thread.
+ *
+ * This module is thread-safe.
+ */
+
+/*LINTLIBRARY*/
+
+#ifndef	_XOPEN_SOURCE
+#   define _XOPEN_SOURCE 500
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "atomics.h"
+#include "context.h"
+#include "udunits2.h"
+
+static UT_THREAD_LOCAL ut_context	threadContext = {UT_SUCCESS, NULL};
+static UT_THREAD_LOCAL ut_context*	currentContext = NULL;
+
+
+ut_context*
+ctxGet(void)
+{
+    return currentContext != NULL ? currentContext : &threadContext;
+}
+
+
+/*
+ * Returns a new context.  Its status is "UT_SUCCESS" and its error-message
+ * handler is the handler of the calling thread's current context.
+ *
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be:
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	Pointer to the new context.  The client should pass it to
+ *		"ut_free_context()" when it's no longer needed.
+ */
+ut_context*
+ut_new_context(void)
+{
+    ut_context*	context = malloc(sizeof(ut_context));
+
+    if (context == NULL) {
+	ut_set_status(UT_OS);
+	ut_handle_error_message(strerror(errno));
+	ut_handle_error_message(
+	    "ut_new_context(): Couldn't allocate %lu-byte context",
+	    sizeof(ut_context));
+    }
+    else {
+	context->status = UT_SUCCESS;
+	context->handler = ctxGet()->handler;
+    }
+
+    return context;
+}
+
+
+/*
+ * Frees a context.  The context mustn't be installed in any thread.
+ *
+ * Arguments:
+ *	context	Pointer to the context to be freed or NULL.
+ */
+void
+ut_free_context(
+    ut_context* const	context)
+{
+    free(context);
+}
+
+
+/*
+ * Installs a context in the calling thread.  Until another context is
+ * installed, the status and error-message handler of the thread are those of
+ * the context.
+ *
+ * Arguments:
+ *	context	Pointer to the context to be installed or NULL.  If NULL, then
+ *		the thread's own context is installed.
+ * Returns:
+ *	Pointer to the previously-installed context or NULL if it was the
+ *	thread's own.
+ */
+ut_context*
+ut_set_context(
+    ut_context* const	context)
+{
+    ut_context*	prev = currentContext;
+
+    currentContext = context;
+
+    return prev;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+#ifndef UT_CONTEXT_H_INCLUDED
+#define UT_CONTEXT_H_INCLUDED
+
+#include "udunits2.h"
+
+/*
+ * The state of the error-handling of the library.
+ */
+struct ut_context {
+    ut_status			status;		/* status of last operation */
+    ut_error_message_handler	handler;	/* NULL => ut_write_to_stderr() */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Returns the current context of the calling thread: the context installed
+ * by "ut_set_context()" or, if none is, the thread's own context.
+ *
+ * Returns:
+ *	Pointer to the current context.  Never NULL.
+ */
+ut_context*
+ctxGet(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,8 +20,12 @@
 #include "udunits2.h" /* For the MSVC-specific defines. */
 #endif
 
+#include <assert.h>
+#include <float.h>
+#include <limits.h>
 #include <math.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 // Add a declaration to suppress a compiler warning when
 // compiling on Mountain Lion because the declaration is
@@ -31,7 +35,9 @@ int snprintf(char * __restrict, size_t, const char * __restrict, ...) __printfli
 #endif /* __DARWIN_C_LEVEL < 200112L */
 #include <stdlib.h>
 #include <string.h>
+#include "atomics.h"
 #include "converter.h"		/* this module's API */
+#include "converterKernels.h"
 
 typedef struct {
     cv_converter*	(*clone)(cv_converter*);
@@ -46,60 +52,226 @@ typedef struct {
     void		(*free)(cv_converter*);
 } ConverterOps;
 
+/*
+ * Every converter starts with the members of this structure.  A converter
+ * that's allocated by this module is reference-counted: cloning it increments
+ * "refCount" and freeing it decrements "refCount" and frees the converter when
+ * no references remain.  A converter whose "refCount" is zero (e.g., one in
+ * storage provided by the client) isn't counted: it's copied when it's cloned
+ * and freeing it does nothing.
+ */
+typedef struct {
+    ConverterOps*	ops;
+    long		refCount;
+} CommonConverter;
+
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
 } ReciprocalConverter;
 
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
     double		value;
 } ScaleConverter;
 
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
     double		value;
 } OffsetConverter;
 
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
     double		slope;
     double		intercept;
 } GalileanConverter;
 
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
     double		logE;
 } LogConverter;
 
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
     double		base;
 } ExpConverter;
 
 typedef struct {
     ConverterOps*	ops;
+    long		refCount;
     cv_converter*	first;
     cv_converter*	second;
 } CompositeConverter;
 
+/*
+ * The operations of a compiled converter (see cv_compile()).
+ */
+typedef enum {
+    OP_RECIPROCAL,	/* y = 1/x */
+    OP_SCALE,		/* y = a*x */
+    OP_OFFSET,		/* y = x + a */
+    OP_GALILEAN,	/* y = a*x + b */
+    OP_LOG,		/* y = a*ln(x) */
+    OP_POW		/* y = pow(a, x) */
+} OpCode;
+
+typedef struct {
+    OpCode		code;
+    double		a;
+    double		b;
+} Instruction;
+
+typedef struct {
+    ConverterOps*	ops;
+    long		refCount;
+    Instruction*	code;
+    size_t		count;
+} ProgramConverter;
+
 union cv_converter {
     ConverterOps*	ops;
+    CommonConverter	common;
     ScaleConverter	scale;
     OffsetConverter	offset;
     GalileanConverter	galilean;
     LogConverter	log;
     ExpConverter	exp;
     CompositeConverter	composite;
+    ProgramConverter	program;
 };
 
+/*
+ * Compile-time check that caller-provided storage can hold any converter that
+ * can be initialized in it.
+ */
+typedef char	cvStorageIsLargeEnough[
+    sizeof(GalileanConverter) <= sizeof(cv_storage) ? 1 : -1];
+
 #define CV_CLONE(conv)		((conv)->ops->clone(conv))
 
+#define IS_COUNTED(conv)	(UT_LOAD_LONG((conv)->common.refCount) != 0)
+
 #define IS_TRIVIAL(conv)	((conv)->ops == &trivialOps)
 #define IS_RECIPROCAL(conv)	((conv)->ops == &reciprocalOps)
 #define IS_SCALE(conv)		((conv)->ops == &scaleOps)
 #define IS_OFFSET(conv)		((conv)->ops == &offsetOps)
 #define IS_GALILEAN(conv)	((conv)->ops == &galileanOps)
 #define IS_LOG(conv)		((conv)->ops == &logOps)
+#define IS_POW(conv)		((conv)->ops == &expOps)
+#define IS_COMPOSITE(conv)	((conv)->ops == &compositeOps)
+#define IS_PROGRAM(conv)	((conv)->ops == &programOps)
+
+/*
+ * The number of values that a compiled converter processes at a time.  A block
+ * of this many doubles should comfortably fit in the L1 cache.
+ */
+#define PROGRAM_BLOCK_SIZE	512
+
+/*
+ * The number of non-contiguous values that are gathered into a contiguous
+ * block for conversion.
+ */
+#define STRIDE_BLOCK_SIZE	512
+
+/*
+ * The number of values in each task of a parallel conversion.  A chunk of
+ * this many doubles should fit in a core's L2 cache.
+ */
+#define PARALLEL_CHUNK_SIZE	32768
+
+/*
+ * The serialized form of a converter (see cv_serialize()) is the bytes 'c' and
+ * 'v', a version byte, and the encoding of the converter.  A converter is
+ * encoded as a tag byte followed by its parameters, which are IEEE 754 doubles
+ * in little-endian byte order.  A composite converter is followed by its two
+ * converters; a compiled converter, by its number of operations as a
+ * little-endian 32-bit integer and by the operations as converters.  The
+ * converters of a composite converter are one level deeper than it; a
+ * converter deeper than SERIAL_MAX_DEPTH (see isSerialDepth()) is neither
+ * serialized nor deserialized.
+ */
+#define SERIAL_VERSION		1
+#define SERIAL_MAX_DEPTH	256
+
+typedef enum {
+    TAG_TRIVIAL,
+    TAG_RECIPROCAL,
+    TAG_SCALE,		/* slope */
+    TAG_OFFSET,		/* offset */
+    TAG_GALILEAN,	/* slope, intercept */
+    TAG_LOG,		/* factor of the natural logarithm */
+    TAG_POW,		/* base */
+    TAG_COMPOSITE,	/* first converter, second converter */
+    TAG_PROGRAM		/* number of operations, operations */
+} SerialTag;
+
+/*
+ * A parallel conversion (see cv_convert_doubles_parallel()).
+ */
+typedef struct {
+    const cv_converter*	converter;
+    const void*		in;
+    void*		out;
+    size_t		count;
+    int			isDouble;
+} ParallelJob;
+
+/*
+ * A hyperslab of values to be converted (see cv_convert_doubles_nd()).  The
+ * outermost "rank" dimensions are iterated over; each element of them is a
+ * run of "count" values that are "inStride" and "outStride" bytes apart.
+ */
+typedef struct {
+    const cv_converter*	converter;
+    const size_t*	shape;
+    const ptrdiff_t*	inStrides;
+    const ptrdiff_t*	outStrides;
+    int			rank;
+    size_t		count;
+    ptrdiff_t		inStride;
+    ptrdiff_t		outStride;
+    int			isDouble;
+} Hyperslab;
+
+
+/*
+ * Returns a new reference to a reference-counted converter.
+ *
+ * Arguments:
+ *	conv	The converter.  Must be reference-counted.
+ * Returns:
+ *	The converter.
+ */
+static cv_converter*
+cvRetain(
+    cv_converter* const	conv)
+{
+    (void)UT_INCREMENT(conv->common.refCount);
+
+    return conv;
+}
+
+
+/*
+ * Releases a reference to a converter.
+ *
+ * Arguments:
+ *	conv	The converter.
+ * Returns:
+ *	0	The converter is still referenced or isn't reference-counted.
+ *	1	That was the last reference: the converter should be freed.
+ */
+static int
+cvRelease(
+    cv_converter* const	conv)
+{
+    return IS_COUNTED(conv) && UT_DECREMENT(conv->common.refCount) == 0;
+}
 
 
 static void
@@ -113,7 +285,8 @@ static void
 cvSimpleFree(
     cv_converter* const conv)
 {
-    free(conv);
+    if (cvRelease(conv))
+	free(conv);
 }
 
 
@@ -236,16 +409,7 @@ reciprocalConvertFloats(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = (float)(1.0f / in[i]);
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = (float)(1.0f / in[i]);
-	}
+	ckReciprocalFloats(in, count, out);
     }
 
     return out;
@@ -263,16 +427,7 @@ reciprocalConvertDoubles(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = 1.0 / in[i];
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = 1.0 / in[i];
-	}
+	ckReciprocalDoubles(in, count, out);
     }
 
     return out;
@@ -312,7 +467,10 @@ static cv_converter*
 scaleClone(
     cv_converter* const	conv)
 {
-    return cv_get_scale(conv->scale.value);
+    return
+	IS_COUNTED(conv)
+	    ? cvRetain(conv)
+	    : cv_get_scale(conv->scale.value);
 }
 
 
@@ -336,16 +494,7 @@ scaleConvertFloats(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = (float)(conv->scale.value * in[i]);
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = (float)(conv->scale.value * in[i]);
-	}
+	ckScaleFloats(conv->scale.value, in, count, out);
     }
 
     return out;
@@ -363,16 +512,7 @@ scaleConvertDoubles(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = conv->scale.value * in[i];
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = conv->scale.value * in[i];
-	}
+	ckScaleDoubles(conv->scale.value, in, count, out);
     }
 
     return out;
@@ -410,7 +550,10 @@ static cv_converter*
 offsetClone(
     cv_converter* const	conv)
 {
-    return cv_get_offset(conv->offset.value);
+    return
+	IS_COUNTED(conv)
+	    ? cvRetain(conv)
+	    : cv_get_offset(conv->offset.value);
 }
 
 
@@ -434,16 +577,7 @@ offsetConvertFloats(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = (float)(conv->offset.value + in[i]);
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = (float)(conv->offset.value + in[i]);
-	}
+	ckOffsetFloats(conv->offset.value, in, count, out);
     }
 
     return out;
@@ -461,16 +595,7 @@ offsetConvertDoubles(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = conv->offset.value + in[i];
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = conv->offset.value + in[i];
-	}
+	ckOffsetDoubles(conv->offset.value, in, count, out);
     }
 
     return out;
@@ -512,7 +637,10 @@ static cv_converter*
 cvGalileanClone(
     cv_converter* const	conv)
 {
-    return cv_get_galilean(conv->galilean.slope, conv->galilean.intercept);
+    return
+	IS_COUNTED(conv)
+	    ? cvRetain(conv)
+	    : cv_get_galilean(conv->galilean.slope, conv->galilean.intercept);
 }
 
 
@@ -536,18 +664,8 @@ galileanConvertFloats(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = (float)(conv->galilean.slope * in[i] +
-		    conv->galilean.intercept);
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = (float)(conv->galilean.slope * in[i] +
-		    conv->galilean.intercept);
-	}
+	ckGalileanFloats(conv->galilean.slope,
+	    conv->galilean.intercept, in, count, out);
     }
 
     return out;
@@ -565,18 +683,8 @@ galileanConvertDoubles(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = conv->galilean.slope * in[i] + 
-		    conv->galilean.intercept;
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = conv->galilean.slope * in[i] + 
-		    conv->galilean.intercept;
-	}
+	ckGalileanDoubles(conv->galilean.slope,
+	    conv->galilean.intercept, in, count, out);
     }
 
     return out;
@@ -614,19 +722,66 @@ static ConverterOps	galileanOps = {
  * Logarithmic Converter:
  ******************************************************************************/
 
+static ConverterOps	logOps;
+
+
+/*
+ * Returns the factor by which to multiply the natural logarithm to obtain the
+ * logarithm in a given base.
+ *
+ * Arguments:
+ *	base	The base.  Must be greater than one.
+ * Returns:
+ *	1/ln(base)
+ */
+static double
+cvGetLogE(
+    const double	base)
+{
+    return
+	base == 2
+	    ? M_LOG2E
+	    : base == M_E
+		? 1
+		: base == 10
+		    ? M_LOG10E
+		    : 1/log(base);
+}
+
+
+/*
+ * Returns a new logarithmic converter.
+ *
+ * Arguments:
+ *	logE	The factor by which to multiply the natural logarithm.
+ * Returns:
+ *	NULL	Necessary memory couldn't be allocated.
+ *	else	The logarithmic converter.
+ */
+static cv_converter*
+logNew(
+    const double	logE)
+{
+    cv_converter*	conv = malloc(sizeof(LogConverter));
+
+    if (conv != NULL) {
+	conv->ops = &logOps;
+	conv->log.refCount = 1;
+	conv->log.logE = logE;
+    }
+
+    return conv;
+}
+
+
 static cv_converter*
 cvLogClone(
     cv_converter* const	conv)
 {
     return
-        cv_get_log(
-            conv->log.logE == M_LOG2E
-                ? 2
-                : conv->log.logE == 1
-                    ? M_E
-                    : conv->log.logE == M_LOG10E
-                        ? 10
-                        : exp(conv->log.logE));
+	IS_COUNTED(conv)
+	    ? cvRetain(conv)
+	    : logNew(conv->log.logE);
 }
 
 
@@ -650,16 +805,7 @@ logConvertFloats(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = (float)(log(in[i]) * conv->log.logE);
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = (float)(log(in[i]) * conv->log.logE);
-	}
+	ckLogFloats(conv->log.logE, in, count, out);
     }
 
     return out;
@@ -677,16 +823,7 @@ logConvertDoubles(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = log(in[i]) * conv->log.logE;
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = log(in[i]) * conv->log.logE;
-	}
+	ckLogDoubles(conv->log.logE, in, count, out);
     }
 
     return out;
@@ -728,7 +865,10 @@ static cv_converter*
 expClone(
     cv_converter* const	conv)
 {
-    return cv_get_pow(conv->exp.base);
+    return
+	IS_COUNTED(conv)
+	    ? cvRetain(conv)
+	    : cv_get_pow(conv->exp.base);
 }
 
 
@@ -751,16 +891,7 @@ expConvertFloats(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = (float)(pow(conv->exp.base, in[i]));
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = (float)(pow(conv->exp.base, in[i]));
-	}
+	ckExpFloats(conv->exp.base, in, count, out);
     }
 
     return out;
@@ -778,16 +909,7 @@ expConvertDoubles(
 	out = NULL;
     }
     else {
-	size_t	i;
-
-	if (in < out) {
-	    for (i = count; i-- > 0;)
-		out[i] = pow(conv->exp.base, in[i]);
-	}
-	else {
-	    for (i = 0; i < count; i++)
-		out[i] = pow(conv->exp.base, in[i]);
-	}
+	ckExpDoubles(conv->exp.base, in, count, out);
     }
 
     return out;
@@ -825,7 +947,7 @@ static cv_converter*
 compositeClone(
     cv_converter* const	conv)
 {
-    return cv_combine(conv->composite.first, conv->composite.second);
+    return cvRetain(conv);
 }
 
 
@@ -890,9 +1012,11 @@ static void
 compositeFree(
     cv_converter* const	conv)
 {
-    cv_free(conv->composite.first);
-    cv_free(conv->composite.second);
-    free(conv);
+    if (cvRelease(conv)) {
+	cv_free(conv->composite.first);
+	cv_free(conv->composite.second);
+	free(conv);
+    }
 }
 
 
@@ -935,66 +1059,80 @@ static ConverterOps	compositeOps = {
     compositeFree};
 
 
-/*******************************************************************************
- * Public API:
- ******************************************************************************/
-
 /*
- * Returns the trivial converter (i.e., y = x).
- * When finished with the converter, the client should pass the converter to
- * cv_free().
+ * Returns a new composite converter.
  *
+ * Arguments:
+ *	first	The converter to be applied first.  Is owned by the returned
+ *		converter.
+ *	second	The converter to be applied second.  Is owned by the returned
+ *		converter.
  * Returns:
- *	The trivial converter.
+ *	NULL	Necessary memory couldn't be allocated.  The converters are
+ *		still owned by the caller.
+ *	else	The composite converter.
  */
-cv_converter*
-cv_get_trivial()
+static cv_converter*
+compositeNew(
+    cv_converter* const	first,
+    cv_converter* const	second)
 {
-    return &trivialConverter;
+    cv_converter*	conv = malloc(sizeof(CompositeConverter));
+
+    if (conv != NULL) {
+	conv->composite.ops = &compositeOps;
+	conv->composite.refCount = 1;
+	conv->composite.first = first;
+	conv->composite.second = second;
+    }
+
+    return conv;
 }
 
 
-/*
- * Returns the reciprocal converter (i.e., y = 1/x).
- * When finished with the converter, the client should pass the converter to
- * cv_free().
+/*******************************************************************************
+ * Program Converter:
  *
- * Returns:
- *	The reciprocal converter.
- */
-cv_converter*
-cv_get_inverse()
-{
-    return &reciprocalConverter;
-}
+ * A compiled converter is a flat sequence of elementary operations rather than
+ * a tree of converters.  Its array methods copy a block of values into a local
+ * buffer, apply every operation to the block, and then write the block out;
+ * consequently, each value crosses memory once regardless of the number of
+ * operations.  Intermediate values are kept in double precision.
+ ******************************************************************************/
+
+static ConverterOps	programOps;
 
 
 /*
- * Returns a converter that multiplies values by a number (i.e., y = ax).
- * When finished with the converter, the client should pass the converter to
- * cv_free().
+ * Returns a new compiled converter.
  *
  * Arguments:
- *	slope	The number by which to multiply values.
+ *	code	The instructions of the program.  May be freed upon return.
+ *	count	The number of instructions.  Must be positive.
  * Returns:
  *	NULL	Necessary memory couldn't be allocated.
- *	else	A converter that will multiply values by the given number.
+ *	else	The compiled converter.
  */
-cv_converter*
-cv_get_scale(
-    const double	slope)
+static cv_converter*
+programNew(
+    const Instruction* const	code,
+    const size_t		count)
 {
-    cv_converter*	conv;
+    cv_converter*	conv = malloc(sizeof(ProgramConverter));
 
-    if (slope == 1) {
-	conv = &trivialConverter;
-    }
-    else {
-	conv = malloc(sizeof(ScaleConverter));
+    if (conv != NULL) {
+	Instruction*	newCode = malloc(count*sizeof(Instruction));
 
-	if (conv != NULL) {
-	    conv->ops = &scaleOps;
-	    conv->scale.value = slope;
+	if (newCode == NULL) {
+	    free(conv);
+	    conv = NULL;
+	}
+	else {
+	    conv->program.ops = &programOps;
+	    conv->program.refCount = 1;
+	    conv->program.code =
+		memcpy(newCode, code, count*sizeof(Instruction));
+	    conv->program.count = count;
 	}
     }
 
@@ -1003,411 +1141,3170 @@ cv_get_scale(
 
 
 /*
- * Returns a converter that adds a number to values (i.e., y = x + b).
- * When finished with the converter, the client should pass the converter to
- * cv_free().
+ * Initializes a converter that's equivalent to a single instruction.  The
+ * converter doesn't own any memory and must not be passed to cv_free().
  *
  * Arguments:
- *	offset	The number to be added.
- * Returns:
- *	NULL	Necessary memory couldn't be allocated.
- *	else	A converter that adds the given number to values.
+ *	inst	The instruction.
+ *	step	The converter to be initialized.
  */
-cv_converter*
-cv_get_offset(
-    const double	offset)
+static void
+programGetStep(
+    const Instruction* const	inst,
+    cv_converter* const		step)
 {
-    cv_converter*	conv;
-
-    if (offset == 0) {
-	conv = &trivialConverter;
+    step->common.refCount = 0;
+
+    switch (inst->code) {
+    case OP_RECIPROCAL:
+	step->ops = &reciprocalOps;
+	break;
+    case OP_SCALE:
+	step->scale.ops = &scaleOps;
+	step->scale.value = inst->a;
+	break;
+    case OP_OFFSET:
+	step->offset.ops = &offsetOps;
+	step->offset.value = inst->a;
+	break;
+    case OP_GALILEAN:
+	step->galilean.ops = &galileanOps;
+	step->galilean.slope = inst->a;
+	step->galilean.intercept = inst->b;
+	break;
+    case OP_LOG:
+	step->log.ops = &logOps;
+	step->log.logE = inst->a;
+	break;
+    case OP_POW:
+	step->exp.ops = &expOps;
+	step->exp.base = inst->a;
+	break;
     }
-    else {
-	conv = malloc(sizeof(OffsetConverter));
+}
 
-	if (conv != NULL) {
-	    conv->ops = &offsetOps;
-	    conv->offset.value = offset;
-	}
-    }
 
-    return conv;
+/*
+ * Returns the Galilean coefficients of an instruction.
+ *
+ * Arguments:
+ *	inst		The instruction.  Must be a scale, offset, or Galilean
+ *			instruction.
+ *	slope		The slope of the instruction.
+ *	intercept	The intercept of the instruction.
+ */
+static void
+programGetGalilean(
+    const Instruction* const	inst,
+    double* const		slope,
+    double* const		intercept)
+{
+    *slope = inst->code == OP_OFFSET ? 1 : inst->a;
+    *intercept =
+	inst->code == OP_OFFSET
+	    ? inst->a
+	    : inst->code == OP_GALILEAN
+		? inst->b
+		: 0;
 }
 
 
+#define IS_GALILEAN_OP(code) \
+    ((code) == OP_SCALE || (code) == OP_OFFSET || (code) == OP_GALILEAN)
+
 /*
- * Returns a Galilean converter (i.e., y = ax + b).
- * When finished with the converter, the client should pass the converter to
- * cv_free().
+ * Appends an instruction to a program.  An instruction that's Galilean is
+ * folded into a preceding Galilean instruction and a reciprocal instruction
+ * cancels a preceding one.
  *
  * Arguments:
- *	slope	The number by which to multiply values.
- *	offset	The number to be added.
+ *	code	The program.  Must have room for one more instruction.
+ *	count	The number of instructions in the program.
+ *	inst	The instruction to be appended.
  * Returns:
- *	NULL	Necessary memory couldn't be allocated.
- *	else	A Galilean converter corresponding to the inputs.
+ *	The number of instructions in the program.
  */
-cv_converter*
-cv_get_galilean(
-    const double	slope,
-    const double	intercept)
+static size_t
+programEmit(
+    Instruction* const		code,
+    size_t			count,
+    const Instruction* const	inst)
 {
-    cv_converter*	conv;
+    Instruction* const	prev = count > 0 ? code + count - 1 : NULL;
 
-    if (slope == 1) {
-	conv = cv_get_offset(intercept);
+    if (prev != NULL && IS_GALILEAN_OP(prev->code) &&
+	    IS_GALILEAN_OP(inst->code)) {
+	double	slope1, intercept1, slope2, intercept2, slope, intercept;
+
+	programGetGalilean(prev, &slope1, &intercept1);
+	programGetGalilean(inst, &slope2, &intercept2);
+
+	slope = slope2 * slope1;
+	intercept = slope2 * intercept1 + intercept2;
+
+	if (slope == 1 && intercept == 0) {
+	    count--;
+	}
+	else if (intercept == 0) {
+	    prev->code = OP_SCALE;
+	    prev->a = slope;
+	}
+	else if (slope == 1) {
+	    prev->code = OP_OFFSET;
+	    prev->a = intercept;
+	}
+	else {
+	    prev->code = OP_GALILEAN;
+	    prev->a = slope;
+	    prev->b = intercept;
+	}
     }
-    else if (intercept == 0) {
-	conv = cv_get_scale(slope);
+    else if (prev != NULL && prev->code == OP_RECIPROCAL &&
+	    inst->code == OP_RECIPROCAL) {
+	count--;
     }
     else {
-	conv = malloc(sizeof(GalileanConverter));
+	code[count++] = *inst;
+    }
 
-	if (conv != NULL) {
-	    conv->ops = &galileanOps;
-	    conv->galilean.slope = slope;
-	    conv->galilean.intercept = intercept;
+    return count;
+}
+
+
+/*
+ * Returns the maximum number of instructions needed to evaluate a converter.
+ *
+ * Arguments:
+ *	conv	The converter.
+ * Returns:
+ *	The maximum number of instructions needed to evaluate "conv".
+ */
+static size_t
+programLength(
+    const cv_converter* const	conv)
+{
+    return
+	IS_TRIVIAL(conv)
+	    ? 0
+	    : IS_COMPOSITE(conv)
+		? programLength(conv->composite.first) +
+		    programLength(conv->composite.second)
+		: IS_PROGRAM(conv)
+		    ? conv->program.count
+		    : 1;
+}
+
+
+/*
+ * Appends the instructions that evaluate a converter to a program.
+ *
+ * Arguments:
+ *	conv	The converter.
+ *	code	The program.  Must have room for "programLength(conv)" more
+ *		instructions.
+ *	count	The number of instructions in the program.
+ * Returns:
+ *	The number of instructions in the program.
+ */
+static size_t
+programAppend(
+    const cv_converter* const	conv,
+    Instruction* const		code,
+    size_t			count)
+{
+    if (IS_COMPOSITE(conv)) {
+	count = programAppend(conv->composite.first, code, count);
+	count = programAppend(conv->composite.second, code, count);
+    }
+    else if (IS_PROGRAM(conv)) {
+	size_t	i;
+
+	for (i = 0; i < conv->program.count; i++)
+	    count = programEmit(code, count, conv->program.code + i);
+    }
+    else if (!IS_TRIVIAL(conv)) {
+	Instruction	inst;
+
+	inst.a = 0;
+	inst.b = 0;
+
+	if (IS_RECIPROCAL(conv)) {
+	    inst.code = OP_RECIPROCAL;
+	}
+	else if (IS_SCALE(conv)) {
+	    inst.code = OP_SCALE;
+	    inst.a = conv->scale.value;
+	}
+	else if (IS_OFFSET(conv)) {
+	    inst.code = OP_OFFSET;
+	    inst.a = conv->offset.value;
+	}
+	else if (IS_GALILEAN(conv)) {
+	    inst.code = OP_GALILEAN;
+	    inst.a = conv->galilean.slope;
+	    inst.b = conv->galilean.intercept;
+	}
+	else if (IS_LOG(conv)) {
+	    inst.code = OP_LOG;
+	    inst.a = conv->log.logE;
+	}
+	else {
+	    assert(IS_POW(conv));
+	    inst.code = OP_POW;
+	    inst.a = conv->exp.base;
 	}
+
+	count = programEmit(code, count, &inst);
     }
 
-    return conv;
+    return count;
 }
 
 
 /*
- * Returns a logarithmic converter (i.e., y = log(x/x0) in some base).
- * When finished with the converter, the client should pass the converter to
- * cv_free().
+ * The tolerance within which a factor that results from a logarithm and an
+ * exponential of the same base (e.g., M_LOG10E*ln(10)) is taken to be 1.
+ */
+#define UNITY_TOLERANCE		(8*DBL_EPSILON)
+
+#define IS_NEARLY_ONE(x)	(fabs((x) - 1) <= UNITY_TOLERANCE)
+
+/*
+ * Returns an instruction.
  *
  * Arguments:
- *	base		The logarithmic base (e.g., 2, M_E, 10).  Must be
- *                      greater than one.
+ *	code	The operation.
+ *	a	The first parameter.
+ *	b	The second parameter.
  * Returns:
- *	NULL		"base" is invalid or necessary memory couldn't be
- *			allocated.
- *	else		A logarithmic converter corresponding to the inputs.
+ *	The instruction.
  */
-cv_converter*
-cv_get_log(
-    const double	base)
+static Instruction
+programInstruction(
+    const OpCode	code,
+    const double	a,
+    const double	b)
 {
-    cv_converter*	conv;
+    Instruction	inst;
 
-    if (base <= 1) {
-	conv = NULL;
+    inst.code = code;
+    inst.a = a;
+    inst.b = b;
+
+    return inst;
+}
+
+
+/*
+ * Rewrites the instructions at the start of a sequence if they match an
+ * algebraic identity that reduces the number of reciprocal, logarithmic, and
+ * exponential operations.
+ *
+ * Arguments:
+ *	code	The instructions.
+ *	count	The number of instructions.
+ *	repl	The replacement instructions.  Must have room for three.
+ *	nrepl	The number of replacement instructions.  Never more than the
+ *		number of instructions replaced.
+ * Returns:
+ *	0	The sequence doesn't start with a rewritable pattern.
+ *	else	The number of instructions replaced by "repl".
+ */
+static size_t
+programRewrite(
+    const Instruction* const	code,
+    const size_t		count,
+    Instruction* const		repl,
+    size_t* const		nrepl)
+{
+    size_t	matched = 0;
+    size_t	n = 0;
+
+    if (count >= 2 && code[0].code == OP_POW && code[1].code == OP_LOG) {
+	/* a*ln(B^x) = a*ln(B)*x */
+	const double	slope = code[1].a * log(code[0].a);
+
+	if (!IS_NEARLY_ONE(slope))
+	    repl[n++] = programInstruction(OP_SCALE, slope, 0);
+	matched = 2;
     }
-    else {
-	conv = malloc(sizeof(LogConverter));
+    else if (count >= 2 && code[0].code == OP_LOG && code[1].code == OP_POW) {
+	/* B^(a*ln(x)) = x^(a*ln(B)) */
+	const double	p = code[0].a * log(code[1].a);
 
-	if (conv != NULL) {
-	    conv->ops = &logOps;
-	    conv->log.logE = 
-                base == 2
-                    ? M_LOG2E
-                    : base == M_E
-                        ? 1
-                        : base == 10
-                            ? M_LOG10E
-                            : 1/log(base);
+	if (IS_NEARLY_ONE(p)) {
+	    matched = 2;
+	}
+	else if (IS_NEARLY_ONE(-p)) {
+	    repl[n++] = programInstruction(OP_RECIPROCAL, 0, 0);
+	    matched = 2;
+	}
+    }
+    else if (count >= 2 && code[0].code == OP_RECIPROCAL &&
+	    code[1].code == OP_LOG) {
+	/* a*ln(1/x) = -a*ln(x) */
+	repl[n++] = programInstruction(OP_LOG, -code[1].a, 0);
+	matched = 2;
+    }
+    else if (count >= 2 && code[0].code == OP_POW &&
+	    code[1].code == OP_RECIPROCAL) {
+	/* 1/B^x = B^-x */
+	repl[n++] = programInstruction(OP_SCALE, -1, 0);
+	repl[n++] = code[0];
+	matched = 2;
+    }
+    else if (count >= 3 && IS_GALILEAN_OP(code[1].code)) {
+	double	slope;
+	double	intercept;
+
+	programGetGalilean(code + 1, &slope, &intercept);
+
+	if (code[0].code == OP_POW && code[2].code == OP_LOG &&
+		intercept == 0 && slope > 0) {
+	    /* a*ln(s*B^x) = a*ln(B)*x + a*ln(s) */
+	    repl[n++] = programInstruction(OP_GALILEAN,
+		code[2].a * log(code[0].a), code[2].a * log(slope));
+	    matched = 3;
+	}
+	else if (code[0].code == OP_LOG && code[2].code == OP_POW) {
+	    /* B^(s*a*ln(x) + i) = B^i * x^(s*a*ln(B)) */
+	    const double	p = slope * code[0].a * log(code[2].a);
+
+	    if (IS_NEARLY_ONE(p) || IS_NEARLY_ONE(-p)) {
+		if (p < 0)
+		    repl[n++] = programInstruction(OP_RECIPROCAL, 0, 0);
+
+		repl[n++] = programInstruction(OP_SCALE,
+		    pow(code[2].a, intercept), 0);
+		matched = 3;
+	    }
+	}
+	else if (code[0].code == OP_RECIPROCAL &&
+		code[2].code == OP_RECIPROCAL && slope != 0) {
+	    if (intercept == 0) {
+		/* 1/(s/x) = x/s */
+		repl[n++] = programInstruction(OP_SCALE, 1 / slope, 0);
+	    }
+	    else {
+		/* 1/(s/x + i) = 1/i - (s/i)/(i*x + s) */
+		repl[n++] = programInstruction(OP_GALILEAN, intercept, slope);
+		repl[n++] = programInstruction(OP_RECIPROCAL, 0, 0);
+		repl[n++] = programInstruction(OP_GALILEAN, -slope / intercept,
+		    1 / intercept);
+	    }
+	    matched = 3;
 	}
     }
 
+    *nrepl = n;
+
+    return matched;
+}
+
+
+/*
+ * Returns the algebraic simplification of the composition of two converters
+ * if it has a canonical form: the identity, a single operation, or a single
+ * reciprocal, logarithm, or exponential between Galilean operations (e.g.,
+ * (a*x + b)/(c*x + d) or c*ln(a*x + b) + d).  The latter are returned as
+ * compiled converters so that they're evaluated in a single pass.
+ *
+ * Arguments:
+ *	first	The converter to be applied first.
+ *	second	The converter to be applied second.
+ * Returns:
+ *	NULL	The composition has no canonical form or necessary memory
+ *		couldn't be allocated.
+ *	else	The simplified converter.
+ */
+static cv_converter*
+cvSimplify(
+    const cv_converter* const	first,
+    const cv_converter* const	second)
+{
+    const size_t	max = programLength(first) + programLength(second);
+    Instruction*	code = malloc(2*max*sizeof(Instruction));
+    cv_converter*	conv = NULL;
+
+    if (code != NULL) {
+	Instruction* const	next = code + max;
+	size_t			count = programAppend(second, code,
+				    programAppend(first, code, 0));
+	size_t			nonGalilean = 0;
+	size_t			i = 0;
+
+	/*
+	 * Rewrite the program until no identity applies.  Each rewrite
+	 * removes a non-Galilean operation or a reciprocal, so this ends.
+	 */
+	while (i < count) {
+	    Instruction		repl[3];
+	    size_t		nrepl;
+	    const size_t	matched =
+				    programRewrite(code + i, count - i, repl,
+					&nrepl);
+
+	    if (matched == 0) {
+		i++;
+	    }
+	    else {
+		size_t	n = 0;
+		size_t	j;
+
+		for (j = 0; j < i; j++)
+		    n = programEmit(next, n, code + j);
+		for (j = 0; j < nrepl; j++)
+		    n = programEmit(next, n, repl + j);
+		for (j = i + matched; j < count; j++)
+		    n = programEmit(next, n, code + j);
+
+		(void)memcpy(code, next, n*sizeof(Instruction));
+		count = n;
+		i = 0;
+	    }
+	}
+
+	for (i = 0; i < count; i++) {
+	    if (!IS_GALILEAN_OP(code[i].code))
+		nonGalilean++;
+	}
+
+	if (count == 0) {
+	    conv = cv_get_trivial();
+	}
+	else if (count == 1 && (code->code != OP_LOG || code->a > 0)) {
+	    cv_converter	step;
+
+	    programGetStep(code, &step);
+	    conv = CV_CLONE(&step);
+	}
+	else if (nonGalilean <= 1) {
+	    conv = programNew(code, count);
+	}
+
+	free(code);
+    }
+
     return conv;
 }
 
 
+static cv_converter*
+programClone(
+    cv_converter* const	conv)
+{
+    return cvRetain(conv);
+}
+
+
+static double
+programConvertDouble(
+    const cv_converter* const	conv,
+    double			value)
+{
+    const Instruction*		inst = conv->program.code;
+    const Instruction* const	end = inst + conv->program.count;
+
+    for (; inst < end; inst++) {
+	switch (inst->code) {
+	case OP_RECIPROCAL:
+	    value = 1.0 / value;
+	    break;
+	case OP_SCALE:
+	    value = inst->a * value;
+	    break;
+	case OP_OFFSET:
+	    value = inst->a + value;
+	    break;
+	case OP_GALILEAN:
+	    value = inst->a * value + inst->b;
+	    break;
+	case OP_LOG:
+	    value = log(value) * inst->a;
+	    break;
+	case OP_POW:
+	    value = pow(inst->a, value);
+	    break;
+	}
+    }
+
+    return value;
+}
+
+
 /*
- * Returns an exponential converter (i.e., y = pow(b, x) in some base "b").
+ * Applies, in order, every instruction of a compiled converter to a block of
+ * values.
+ *
+ * Arguments:
+ *	conv	The compiled converter.
+ *	values	The values to be converted in place.
+ *	count	The number of values.
+ */
+static void
+programRun(
+    const cv_converter* const	conv,
+    double* const		values,
+    const size_t		count)
+{
+    const Instruction*		inst = conv->program.code;
+    const Instruction* const	end = inst + conv->program.count;
+
+    for (; inst < end; inst++) {
+	const double	a = inst->a;
+	const double	b = inst->b;
+
+	switch (inst->code) {
+	case OP_RECIPROCAL:
+	    ckReciprocalDoubles(values, count, values);
+	    break;
+	case OP_SCALE:
+	    ckScaleDoubles(a, values, count, values);
+	    break;
+	case OP_OFFSET:
+	    ckOffsetDoubles(a, values, count, values);
+	    break;
+	case OP_GALILEAN:
+	    ckGalileanDoubles(a, b, values, count, values);
+	    break;
+	case OP_LOG:
+	    ckLogDoubles(a, values, count, values);
+	    break;
+	case OP_POW:
+	    ckExpDoubles(a, values, count, values);
+	    break;
+	}
+    }
+}
+
+
+static float*
+programConvertFloats(
+    const cv_converter* const	conv,
+    const float* const		in,
+    const size_t		count,
+    float* 			out)
+{
+    if (conv == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+	double	block[PROGRAM_BLOCK_SIZE];
+	size_t	start = in < out ? count : 0;
+	size_t	remaining = count;
+
+	/*
+	 * If the output array follows the input array, then the blocks are
+	 * processed from last to first so that unconverted input values
+	 * aren't overwritten.
+	 */
+	while (remaining > 0) {
+	    const size_t	n = remaining < PROGRAM_BLOCK_SIZE
+		? remaining
+		: PROGRAM_BLOCK_SIZE;
+	    size_t		i;
+
+	    if (in < out)
+		start -= n;
+
+	    for (i = 0; i < n; i++)
+		block[i] = in[start+i];
+
+	    programRun(conv, block, n);
+
+	    for (i = 0; i < n; i++)
+		out[start+i] = (float)block[i];
+
+	    if (!(in < out))
+		start += n;
+
+	    remaining -= n;
+	}
+    }
+
+    return out;
+}
+
+
+static double*
+programConvertDoubles(
+    const cv_converter* const	conv,
+    const double* const		in,
+    const size_t		count,
+    double* 			out)
+{
+    if (conv == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+	double	block[PROGRAM_BLOCK_SIZE];
+	size_t	start = in < out ? count : 0;
+	size_t	remaining = count;
+
+	/*
+	 * If the output array follows the input array, then the blocks are
+	 * processed from last to first so that unconverted input values
+	 * aren't overwritten.
+	 */
+	while (remaining > 0) {
+	    const size_t	n = remaining < PROGRAM_BLOCK_SIZE
+		? remaining
+		: PROGRAM_BLOCK_SIZE;
+
+	    if (in < out)
+		start -= n;
+
+	    (void)memcpy(block, in + start, n*sizeof(double));
+	    programRun(conv, block, n);
+	    (void)memcpy(out + start, block, n*sizeof(double));
+
+	    if (!(in < out))
+		start += n;
+
+	    remaining -= n;
+	}
+    }
+
+    return out;
+}
+
+
+static void
+programFree(
+    cv_converter* const	conv)
+{
+    if (cvRelease(conv)) {
+	free(conv->program.code);
+	free(conv);
+    }
+}
+
+
+static int
+programGetExpression(
+    const cv_converter* const	conv,
+    char* const			buf,
+    const size_t		max,
+    const char* const		variable)
+{
+    char	tmpBuf[132];
+    int		nchar = snprintf(buf, max, "%s", variable);
+    size_t	i;
+
+    for (i = 0; nchar >= 0 && i < conv->program.count; i++) {
+	cv_converter	step;
+
+	buf[max-1] = 0;
+
+	if (cvNeedsParentheses(buf)) {
+	    (void)snprintf(tmpBuf, sizeof(tmpBuf), "(%s)", buf);
+	}
+	else {
+	    (void)strncpy(tmpBuf, buf, sizeof(tmpBuf));
+
+	    tmpBuf[sizeof(tmpBuf)-1] = 0;
+	}
+
+	programGetStep(conv->program.code + i, &step);
+	nchar = cv_get_expression(&step, buf, max, tmpBuf);
+    }
+
+    return nchar;
+}
+
+
+static ConverterOps	programOps = {
+    programClone,
+    programConvertDouble,
+    programConvertFloats,
+    programConvertDoubles,
+    programGetExpression,
+    programFree};
+
+
+/*******************************************************************************
+ * Public API:
+ ******************************************************************************/
+
+/*
+ * Returns the trivial converter (i.e., y = x).
  * When finished with the converter, the client should pass the converter to
  * cv_free().
  *
- * Arguments:
- *	base		The desired base.  Must be positive.
  * Returns:
- *	NULL		"base" is invalid or necessary memory couldn't be
- *			allocated.
- *	else		An exponential converter corresponding to the inputs.
+ *	The trivial converter.
  */
 cv_converter*
-cv_get_pow(
-    const double	base)
+cv_get_trivial()
+{
+    return &trivialConverter;
+}
+
+
+/*
+ * Returns the reciprocal converter (i.e., y = 1/x).
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ *
+ * Returns:
+ *	The reciprocal converter.
+ */
+cv_converter*
+cv_get_inverse()
+{
+    return &reciprocalConverter;
+}
+
+
+/*
+ * Returns a converter that multiplies values by a number (i.e., y = ax).
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ *
+ * Arguments:
+ *	slope	The number by which to multiply values.
+ * Returns:
+ *	NULL	Necessary memory couldn't be allocated.
+ *	else	A converter that will multiply values by the given number.
+ */
+cv_converter*
+cv_get_scale(
+    const double	slope)
+{
+    cv_converter*	conv;
+
+    if (slope == 1) {
+	conv = &trivialConverter;
+    }
+    else {
+	conv = malloc(sizeof(ScaleConverter));
+
+	if (conv != NULL) {
+	    conv->ops = &scaleOps;
+	    conv->scale.refCount = 1;
+	    conv->scale.value = slope;
+	}
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a converter that adds a number to values (i.e., y = x + b).
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ *
+ * Arguments:
+ *	offset	The number to be added.
+ * Returns:
+ *	NULL	Necessary memory couldn't be allocated.
+ *	else	A converter that adds the given number to values.
+ */
+cv_converter*
+cv_get_offset(
+    const double	offset)
+{
+    cv_converter*	conv;
+
+    if (offset == 0) {
+	conv = &trivialConverter;
+    }
+    else {
+	conv = malloc(sizeof(OffsetConverter));
+
+	if (conv != NULL) {
+	    conv->ops = &offsetOps;
+	    conv->offset.refCount = 1;
+	    conv->offset.value = offset;
+	}
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a Galilean converter (i.e., y = ax + b).
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ *
+ * Arguments:
+ *	slope	The number by which to multiply values.
+ *	offset	The number to be added.
+ * Returns:
+ *	NULL	Necessary memory couldn't be allocated.
+ *	else	A Galilean converter corresponding to the inputs.
+ */
+cv_converter*
+cv_get_galilean(
+    const double	slope,
+    const double	intercept)
+{
+    cv_converter*	conv;
+
+    if (slope == 1) {
+	conv = cv_get_offset(intercept);
+    }
+    else if (intercept == 0) {
+	conv = cv_get_scale(slope);
+    }
+    else {
+	conv = malloc(sizeof(GalileanConverter));
+
+	if (conv != NULL) {
+	    conv->ops = &galileanOps;
+	    conv->galilean.refCount = 1;
+	    conv->galilean.slope = slope;
+	    conv->galilean.intercept = intercept;
+	}
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a logarithmic converter (i.e., y = log(x/x0) in some base).
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ *
+ * Arguments:
+ *	base		The logarithmic base (e.g., 2, M_E, 10).  Must be
+ *                      greater than one.
+ * Returns:
+ *	NULL		"base" is invalid or necessary memory couldn't be
+ *			allocated.
+ *	else		A logarithmic converter corresponding to the inputs.
+ */
+cv_converter*
+cv_get_log(
+    const double	base)
+{
+    cv_converter*	conv;
+
+    if (base <= 1) {
+	conv = NULL;
+    }
+    else {
+	conv = logNew(cvGetLogE(base));
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns an exponential converter (i.e., y = pow(b, x) in some base "b").
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ *
+ * Arguments:
+ *	base		The desired base.  Must be positive.
+ * Returns:
+ *	NULL		"base" is invalid or necessary memory couldn't be
+ *			allocated.
+ *	else		An exponential converter corresponding to the inputs.
+ */
+cv_converter*
+cv_get_pow(
+    const double	base)
+{
+    cv_converter*	conv;
+
+    if (base <= 0) {
+	conv = NULL;
+    }
+    else {
+	conv = malloc(sizeof(ExpConverter));
+
+	if (conv != NULL) {
+	    conv->ops = &expOps;
+	    conv->exp.refCount = 1;
+	    conv->exp.base = base;
+	}
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a scale converter (i.e., y = slope*x) in storage provided by the
+ * client, so that no memory is allocated.  The converter is valid for the
+ * lifetime of the storage.  Passing it to cv_free() does nothing.
+ *
+ * Arguments:
+ *	storage	Pointer to the storage for the converter.
+ *	slope	The slope of the converter.
+ * Returns:
+ *	NULL	"storage" is NULL.
+ *	else	The scale converter.  Is the trivial converter if "slope" is 1.
+ */
+cv_converter*
+cv_init_scale(
+    cv_storage* const	storage,
+    const double	slope)
+{
+    cv_converter*	conv;
+
+    if (storage == NULL) {
+	conv = NULL;
+    }
+    else if (slope == 1) {
+	conv = &trivialConverter;
+    }
+    else {
+	conv = (cv_converter*)storage;
+	conv->ops = &scaleOps;
+	conv->scale.refCount = 0;
+	conv->scale.value = slope;
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns an offset converter (i.e., y = x + offset) in storage provided by
+ * the client, so that no memory is allocated.  The converter is valid for the
+ * lifetime of the storage.  Passing it to cv_free() does nothing.
+ *
+ * Arguments:
+ *	storage	Pointer to the storage for the converter.
+ *	offset	The offset of the converter.
+ * Returns:
+ *	NULL	"storage" is NULL.
+ *	else	The offset converter.  Is the trivial converter if "offset"
+ *		is 0.
+ */
+cv_converter*
+cv_init_offset(
+    cv_storage* const	storage,
+    const double	offset)
+{
+    cv_converter*	conv;
+
+    if (storage == NULL) {
+	conv = NULL;
+    }
+    else if (offset == 0) {
+	conv = &trivialConverter;
+    }
+    else {
+	conv = (cv_converter*)storage;
+	conv->ops = &offsetOps;
+	conv->offset.refCount = 0;
+	conv->offset.value = offset;
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a Galilean converter (i.e., y = slope*x + intercept) in storage
+ * provided by the client, so that no memory is allocated.  The converter is
+ * valid for the lifetime of the storage.  Passing it to cv_free() does nothing.
+ *
+ * Arguments:
+ *	storage		Pointer to the storage for the converter.
+ *	slope		The slope of the converter.
+ *	intercept	The intercept of the converter.
+ * Returns:
+ *	NULL		"storage" is NULL.
+ *	else		The Galilean converter.
+ */
+cv_converter*
+cv_init_galilean(
+    cv_storage* const	storage,
+    const double	slope,
+    const double	intercept)
+{
+    cv_converter*	conv;
+
+    if (storage == NULL || slope == 1) {
+	conv = cv_init_offset(storage, intercept);
+    }
+    else if (intercept == 0) {
+	conv = cv_init_scale(storage, slope);
+    }
+    else {
+	conv = (cv_converter*)storage;
+	conv->ops = &galileanOps;
+	conv->galilean.refCount = 0;
+	conv->galilean.slope = slope;
+	conv->galilean.intercept = intercept;
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a logarithmic converter (i.e., y = log(x) in some base) in storage
+ * provided by the client, so that no memory is allocated.  The converter is
+ * valid for the lifetime of the storage.  Passing it to cv_free() does nothing.
+ *
+ * Arguments:
+ *	storage	Pointer to the storage for the converter.
+ *	base	The logarithmic base.  Must be greater than one.
+ * Returns:
+ *	NULL	"storage" is NULL or "base" is invalid.
+ *	else	The logarithmic converter.
+ */
+cv_converter*
+cv_init_log(
+    cv_storage* const	storage,
+    const double	base)
+{
+    cv_converter*	conv;
+
+    if (storage == NULL || !(base > 1)) {
+	conv = NULL;
+    }
+    else {
+	conv = (cv_converter*)storage;
+	conv->ops = &logOps;
+	conv->log.refCount = 0;
+	conv->log.logE = cvGetLogE(base);
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns an exponential converter (i.e., y = pow(base, x)) in storage
+ * provided by the client, so that no memory is allocated.  The converter is
+ * valid for the lifetime of the storage.  Passing it to cv_free() does nothing.
+ *
+ * Arguments:
+ *	storage	Pointer to the storage for the converter.
+ *	base	The base.  Must be positive.
+ * Returns:
+ *	NULL	"storage" is NULL or "base" is invalid.
+ *	else	The exponential converter.
+ */
+cv_converter*
+cv_init_pow(
+    cv_storage* const	storage,
+    const double	base)
+{
+    cv_converter*	conv;
+
+    if (storage == NULL || !(base > 0)) {
+	conv = NULL;
+    }
+    else {
+	conv = (cv_converter*)storage;
+	conv->ops = &expOps;
+	conv->exp.refCount = 0;
+	conv->exp.base = base;
+    }
+
+    return conv;
+}
+
+
+/*
+ * Returns a converter corresponding to the sequential application of two
+ * other converters.  The composition is simplified algebraically where
+ * possible (e.g., lg(1000*pow(10, x)) becomes x + 3) and, if the result has at
+ * most one reciprocal, logarithm, or exponential, it's a single converter.
+ * The returned converter should be passed to cv_free() when it is no longer
+ * needed.
+ *
+ * Arguments:
+ *	first	The converter to be applied first.  May be passed to cv_free()
+ *		upon return.
+ *	second	The converter to be applied second.  May be passed to cv_free()
+ *		upon return.
+ * Returns:
+ *	NULL	Either "first" or "second" is NULL or necessary memory couldn't
+ *		be allocated.
+ *      else    A converter corresponding to the sequential application of the
+ *              given converters.  If one of the input converters is the trivial
+ *              converter, then the returned converter will be the other input
+ *              converter.
+ */
+cv_converter*
+cv_combine(
+    cv_converter* const	first,
+    cv_converter* const	second)
+{
+    cv_converter*	conv;
+
+    if (first == NULL || second == NULL) {
+	conv = NULL;
+    }
+    else if (IS_TRIVIAL(first)) {
+	conv = CV_CLONE(second);
+    }
+    else if (IS_TRIVIAL(second)) {
+	conv = CV_CLONE(first);
+    }
+    else {
+	conv = NULL;
+
+	if (IS_RECIPROCAL(first)) {
+	    if (IS_RECIPROCAL(second)) {
+		conv = cv_get_trivial();
+	    }
+	}
+	else if (IS_SCALE(first)) {
+	    if (IS_SCALE(second)) {
+		conv = cv_get_scale(first->scale.value * second->scale.value);
+	    }
+	    else if (IS_OFFSET(second)) {
+		conv = cv_get_galilean(first->scale.value, second->offset.value);
+	    }
+	    else if (IS_GALILEAN(second)) {
+		conv = cv_get_galilean(
+		    first->scale.value * second->galilean.slope, 
+		    second->galilean.intercept);
+	    }
+	}
+	else if (IS_OFFSET(first)) {
+	    if (IS_SCALE(second)) {
+		conv = cv_get_galilean(second->scale.value, 
+		    first->offset.value * second->scale.value);
+	    }
+	    else if (IS_OFFSET(second)) {
+		conv = cv_get_offset(first->offset.value + second->offset.value);
+	    }
+	    else if (IS_GALILEAN(second)) {
+		conv = cv_get_galilean(second->galilean.slope, 
+		    first->offset.value * second->galilean.slope +
+			second->galilean.intercept);
+	    }
+	}
+	else if (IS_GALILEAN(first)) {
+	    if (IS_SCALE(second)) {
+		conv = cv_get_galilean(
+		    second->scale.value * first->galilean.slope,
+		    second->scale.value * first->galilean.intercept);
+	    }
+	    else if (IS_OFFSET(second)) {
+		conv = cv_get_galilean(first->galilean.slope,
+		    first->galilean.intercept + second->offset.value);
+	    }
+	    else if (IS_GALILEAN(second)) {
+		conv = cv_get_galilean(
+		    second->galilean.slope * first->galilean.slope,
+		    second->galilean.slope * first->galilean.intercept +
+			second->galilean.intercept);
+	    }
+	}
+
+	if (conv == NULL)
+	    conv = cvSimplify(first, second);
+
+	if (conv == NULL) {
+	    /*
+	     * General case: create a composite converter.
+	     */
+	    cv_converter*	c1 = CV_CLONE(first);
+            int                 error = 1;
+
+            if (c1 != NULL) {
+                cv_converter*	c2 = CV_CLONE(second);
+
+                if (c2 != NULL) {
+                    conv = compositeNew(c1, c2);
+
+                    if (conv != NULL)
+                        error = 0;
+
+                    if (error)
+                        cv_free(c2);
+                }                       /* "c2" allocated */
+
+                if (error)
+                    cv_free(c1);
+            }                           /* "c1" allocated */
+	}                               /* "conv != NULL" */
+    }                                   /* "first" & "second" not trivial */
+
+    return conv;
+}
+
+
+/*
+ * Returns a compiled converter that's equivalent to another converter.  A
+ * compiled converter evaluates a chain of converters (e.g., one returned by
+ * cv_combine()) as a flat sequence of operations: arrays are converted in a
+ * single pass rather than one pass per constituent converter.  Intermediate
+ * values are kept in double precision.  The returned converter should be passed
+ * to cv_free() when it is no longer needed.
+ *
+ * Arguments:
+ *	conv	The converter to be compiled.  May be passed to cv_free() upon
+ *		return.
+ * Returns:
+ *	NULL	"conv" is NULL or necessary memory couldn't be allocated.
+ *	else	A compiled converter equivalent to "conv".  If "conv" already
+ *		converts arrays in a single pass, then the returned converter
+ *		will be a clone of "conv".
+ */
+cv_converter*
+cv_compile(
+    cv_converter* const	conv)
+{
+    cv_converter*	compiled;
+
+    if (conv == NULL) {
+	compiled = NULL;
+    }
+    else if (!IS_COMPOSITE(conv)) {
+	compiled = CV_CLONE(conv);
+    }
+    else {
+	Instruction*	code = malloc(programLength(conv)*sizeof(Instruction));
+
+	if (code == NULL) {
+	    compiled = NULL;
+	}
+	else {
+	    size_t	count = programAppend(conv, code, 0);
+
+	    compiled =
+		count == 0
+		    ? cv_get_trivial()
+		    : programNew(code, count);
+
+	    free(code);
+	}
+    }
+
+    return compiled;
+}
+
+
+/*
+ * Returns a copy of a converter.  A reference-counted converter is shared
+ * rather than copied.
+ *
+ * Arguments:
+ *	conv	The converter to be copied or NULL.
+ * Returns:
+ *	NULL	"conv" is NULL or necessary memory couldn't be allocated.
+ *	else	A converter equivalent to "conv".
+ */
+cv_converter*
+cv_clone(
+    cv_converter* const	conv)
+{
+    return conv == NULL ? NULL : CV_CLONE(conv);
+}
+
+
+/*
+ * Frees resources associated with a converter.  Use of the converter argument
+ * subsequent to this function may result in undefined behavior.
+ *
+ * Arguments:
+ *	conv	The converter to have its resources freed or NULL.  The
+ *		converter must have been returned by this module.
+ */
+void
+cv_free(
+    cv_converter* const	conv)
+{
+    if (conv != NULL) {
+	conv->ops->free((cv_converter*)conv);
+    }
+}
+
+
+/*
+ * Converts a float.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	value		The value to be converted.
+ * Returns:
+ *	The converted value.
+ */
+float
+cv_convert_float(
+    const cv_converter*	converter,
+    const float		value)
+{
+    return (float)converter->ops->convertDouble(converter, value);
+}
+
+
+/*
+ * Converts a double.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	value		The value to be converted.
+ * Returns:
+ *	The converted value.
+ */
+double
+cv_convert_double(
+    const cv_converter*	converter,
+    const double	value)
+{
+    return converter->ops->convertDouble(converter, value);
+}
+
+
+/*
+ * Converts an array of floats.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.  The array may
+ *			overlap "out".
+ *	count		The number of values to be converted.
+ *	out		Pointer to the output array for the converted values.
+ *			The array may overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the output array, "out".
+ */
+float*
+cv_convert_floats(
+    const cv_converter*	converter,
+    const float* const	in,
+    const size_t	count,
+    float*		out)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+        out = converter->ops->convertFloats(converter, in, count, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts an array of doubles.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.  The array may
+ *			overlap "out".
+ *	count		The number of values to be converted.
+ *	out		Pointer to the output array for the converted values.
+ *			The array may overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the output array, "out".
+ */
+double*
+cv_convert_doubles(
+    const cv_converter*	converter,
+    const double* const	in,
+    const size_t	count,
+    double*		out)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+    	out = converter->ops->convertDoubles(converter, in, count, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts a strided run of floats.  Values that aren't contiguous are
+ * gathered into a block, converted, and scattered.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the first value to be converted.
+ *	inStride	The number of bytes between input values.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the first output value.
+ *	outStride	The number of bytes between output values.
+ */
+static void
+convertFloatsStrided(
+    const cv_converter* const	converter,
+    const char*			in,
+    const ptrdiff_t		inStride,
+    size_t			count,
+    char*			out,
+    const ptrdiff_t		outStride)
+{
+    if (inStride == sizeof(float) && outStride == sizeof(float)) {
+	(void)converter->ops->convertFloats(converter, (const float*)in, count,
+	    (float*)out);
+    }
+    else {
+	float	block[STRIDE_BLOCK_SIZE];
+
+	while (count > 0) {
+	    const size_t	n = count < STRIDE_BLOCK_SIZE
+				    ? count
+				    : STRIDE_BLOCK_SIZE;
+	    size_t		i;
+
+	    for (i = 0; i < n; i++, in += inStride)
+		(void)memcpy(block + i, in, sizeof(float));
+
+	    (void)converter->ops->convertFloats(converter, block, n, block);
+
+	    for (i = 0; i < n; i++, out += outStride)
+		(void)memcpy(out, block + i, sizeof(float));
+
+	    count -= n;
+	}
+    }
+}
+
+
+/*
+ * Converts a strided run of doubles.  Values that aren't contiguous are
+ * gathered into a block, converted, and scattered.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the first value to be converted.
+ *	inStride	The number of bytes between input values.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the first output value.
+ *	outStride	The number of bytes between output values.
+ */
+static void
+convertDoublesStrided(
+    const cv_converter* const	converter,
+    const char*			in,
+    const ptrdiff_t		inStride,
+    size_t			count,
+    char*			out,
+    const ptrdiff_t		outStride)
+{
+    if (inStride == sizeof(double) && outStride == sizeof(double)) {
+	(void)converter->ops->convertDoubles(converter, (const double*)in,
+	    count, (double*)out);
+    }
+    else {
+	double	block[STRIDE_BLOCK_SIZE];
+
+	while (count > 0) {
+	    const size_t	n = count < STRIDE_BLOCK_SIZE
+				    ? count
+				    : STRIDE_BLOCK_SIZE;
+	    size_t		i;
+
+	    for (i = 0; i < n; i++, in += inStride)
+		(void)memcpy(block + i, in, sizeof(double));
+
+	    (void)converter->ops->convertDoubles(converter, block, n, block);
+
+	    for (i = 0; i < n; i++, out += outStride)
+		(void)memcpy(out, block + i, sizeof(double));
+
+	    count -= n;
+	}
+    }
+}
+
+
+/*
+ * Converts the part of a hyperslab that starts at a given dimension.
+ *
+ * Arguments:
+ *	slab		Pointer to the hyperslab.
+ *	dim		The outermost dimension to iterate over.
+ *	in		Pointer to the first input value of the part.
+ *	out		Pointer to the first output value of the part.
+ */
+static void
+convertHyperslab(
+    const Hyperslab* const	slab,
+    const int			dim,
+    const char* const		in,
+    char* const			out)
+{
+    if (dim == slab->rank) {
+	if (slab->isDouble) {
+	    convertDoublesStrided(slab->converter, in, slab->inStride,
+		slab->count, out, slab->outStride);
+	}
+	else {
+	    convertFloatsStrided(slab->converter, in, slab->inStride,
+		slab->count, out, slab->outStride);
+	}
+    }
+    else {
+	size_t	i;
+
+	for (i = 0; i < slab->shape[dim]; i++)
+	    convertHyperslab(slab, dim+1,
+		in + (ptrdiff_t)i*slab->inStrides[dim],
+		out + (ptrdiff_t)i*slab->outStrides[dim]);
+    }
+}
+
+
+/*
+ * Converts an N-dimensional hyperslab.  Trailing dimensions that are laid out
+ * contiguously with respect to each other in both the input and the output
+ * are merged into a single run.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	rank		The number of dimensions.
+ *	shape		The number of values along each dimension.
+ *	in		Pointer to the first value to be converted.
+ *	inStrides	The number of bytes between successive input values
+ *			along each dimension.
+ *	out		Pointer to the first output value.
+ *	outStrides	The number of bytes between successive output values
+ *			along each dimension.
+ *	isDouble	Whether the values are doubles or floats.
+ */
+static void
+convertNd(
+    const cv_converter* const	converter,
+    const int			rank,
+    const size_t* const		shape,
+    const void* const		in,
+    const ptrdiff_t* const	inStrides,
+    void* const			out,
+    const ptrdiff_t* const	outStrides,
+    const int			isDouble)
+{
+    Hyperslab	slab;
+
+    slab.converter = converter;
+    slab.shape = shape;
+    slab.inStrides = inStrides;
+    slab.outStrides = outStrides;
+    slab.isDouble = isDouble;
+
+    if (rank == 0) {
+	slab.rank = 0;
+	slab.count = 1;
+	slab.inStride = slab.outStride = 0;
+    }
+    else {
+	slab.rank = rank - 1;
+	slab.count = shape[slab.rank];
+	slab.inStride = inStrides[slab.rank];
+	slab.outStride = outStrides[slab.rank];
+
+	while (slab.rank > 0 &&
+		inStrides[slab.rank-1] ==
+		    (ptrdiff_t)slab.count * slab.inStride &&
+		outStrides[slab.rank-1] ==
+		    (ptrdiff_t)slab.count * slab.outStride) {
+	    slab.count *= shape[--slab.rank];
+	}
+    }
+
+    convertHyperslab(&slab, 0, in, out);
+}
+
+
+/*
+ * Converts strided floats.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the first value to be converted.
+ *	inStride	The number of bytes between successive input values
+ *			(e.g., the size of a structure of which the values
+ *			are members).  May be negative.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the first output value.  May be "in".
+ *	outStride	The number of bytes between successive output values.
+ *			May be negative.
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the first output value, "out".
+ */
+float*
+cv_convert_floats_strided(
+    const cv_converter*	converter,
+    const float* const	in,
+    const ptrdiff_t	inStride,
+    const size_t	count,
+    float*		out,
+    const ptrdiff_t	outStride)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+	convertFloatsStrided(converter, (const char*)in, inStride, count,
+	    (char*)out, outStride);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts strided doubles.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the first value to be converted.
+ *	inStride	The number of bytes between successive input values
+ *			(e.g., the size of a structure of which the values
+ *			are members).  May be negative.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the first output value.  May be "in".
+ *	outStride	The number of bytes between successive output values.
+ *			May be negative.
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the first output value, "out".
+ */
+double*
+cv_convert_doubles_strided(
+    const cv_converter*	converter,
+    const double* const	in,
+    const ptrdiff_t	inStride,
+    const size_t	count,
+    double*		out,
+    const ptrdiff_t	outStride)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+	convertDoublesStrided(converter, (const char*)in, inStride, count,
+	    (char*)out, outStride);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts an N-dimensional hyperslab of floats.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	rank		The number of dimensions.  If zero, then a single value
+ *			is converted.
+ *	shape		The number of values along each dimension, outermost
+ *			first.
+ *	in		Pointer to the first value to be converted.
+ *	inStrides	The number of bytes between successive input values
+ *			along each dimension.  May be negative.
+ *	out		Pointer to the first output value.  May be "in".
+ *	outStrides	The number of bytes between successive output values
+ *			along each dimension.  May be negative.
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL; "rank" is
+ *			negative; or "rank" is positive and "shape",
+ *			"inStrides", or "outStrides" is NULL.
+ *	else		Pointer to the first output value, "out".
+ */
+float*
+cv_convert_floats_nd(
+    const cv_converter*		converter,
+    const int			rank,
+    const size_t* const		shape,
+    const float* const		in,
+    const ptrdiff_t* const	inStrides,
+    float*			out,
+    const ptrdiff_t* const	outStrides)
+{
+    if (converter == NULL || in == NULL || out == NULL || rank < 0 ||
+	    (rank > 0 &&
+	     (shape == NULL || inStrides == NULL || outStrides == NULL))) {
+	out = NULL;
+    }
+    else {
+	convertNd(converter, rank, shape, in, inStrides, out, outStrides, 0);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts an N-dimensional hyperslab of doubles.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	rank		The number of dimensions.  If zero, then a single value
+ *			is converted.
+ *	shape		The number of values along each dimension, outermost
+ *			first.
+ *	in		Pointer to the first value to be converted.
+ *	inStrides	The number of bytes between successive input values
+ *			along each dimension.  May be negative.
+ *	out		Pointer to the first output value.  May be "in".
+ *	outStrides	The number of bytes between successive output values
+ *			along each dimension.  May be negative.
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL; "rank" is
+ *			negative; or "rank" is positive and "shape",
+ *			"inStrides", or "outStrides" is NULL.
+ *	else		Pointer to the first output value, "out".
+ */
+double*
+cv_convert_doubles_nd(
+    const cv_converter*		converter,
+    const int			rank,
+    const size_t* const		shape,
+    const double* const		in,
+    const ptrdiff_t* const	inStrides,
+    double*			out,
+    const ptrdiff_t* const	outStrides)
+{
+    if (converter == NULL || in == NULL || out == NULL || rank < 0 ||
+	    (rank > 0 &&
+	     (shape == NULL || inStrides == NULL || outStrides == NULL))) {
+	out = NULL;
+    }
+    else {
+	convertNd(converter, rank, shape, in, inStrides, out, outStrides, 1);
+    }
+
+    return out;
+}
+
+
+/*
+ * Returns the coefficients of a converter that's Galilean (i.e., y = ax + b).
+ * For use by the unit module too.
+ *
+ * Arguments:
+ *	conv		Pointer to the converter.
+ *	slope		Pointer to the slope.  Set if the converter is
+ *			Galilean.
+ *	intercept	Pointer to the intercept.  Set if the converter is
+ *			Galilean.
+ * Returns:
+ *	0		The converter isn't Galilean.
+ *	1		The converter is Galilean.
+ */
+int
+cvGetGalilean(
+    const cv_converter* const	conv,
+    double* const		slope,
+    double* const		intercept)
+{
+    int	isGalilean = 1;
+
+    if (IS_TRIVIAL(conv)) {
+	*slope = 1;
+	*intercept = 0;
+    }
+    else if (IS_SCALE(conv)) {
+	*slope = conv->scale.value;
+	*intercept = 0;
+    }
+    else if (IS_OFFSET(conv)) {
+	*slope = 1;
+	*intercept = conv->offset.value;
+    }
+    else if (IS_GALILEAN(conv)) {
+	*slope = conv->galilean.slope;
+	*intercept = conv->galilean.intercept;
+    }
+    else if (IS_PROGRAM(conv) && conv->program.count == 0) {
+	*slope = 1;
+	*intercept = 0;
+    }
+    else if (IS_PROGRAM(conv) && conv->program.count == 1 &&
+	    IS_GALILEAN_OP(conv->program.code[0].code)) {
+	programGetGalilean(conv->program.code, slope, intercept);
+    }
+    else {
+	isGalilean = 0;
+    }
+
+    return isGalilean;
+}
+
+
+/*
+ * Returns the size of a packed integer type.
+ *
+ * Arguments:
+ *	type	The type.
+ * Returns:
+ *	0	"type" is unknown.
+ *	else	The size of "type" in bytes.
+ */
+static size_t
+packedSize(
+    const cv_packed_type	type)
+{
+    return
+	type == CV_SCHAR
+	    ? sizeof(signed char)
+	    : type == CV_SHORT
+		? sizeof(short)
+		: type == CV_INT
+		    ? sizeof(int)
+		    : 0;
+}
+
+
+/*
+ * Widens packed integers to doubles.
+ *
+ * Arguments:
+ *	type	The type of the packed integers.
+ *	in	Pointer to the first packed integer.
+ *	count	The number of packed integers.
+ *	out	Pointer to the output doubles.
+ */
+static void
+widenPacked(
+    const cv_packed_type	type,
+    const void* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    size_t	i;
+
+    if (type == CV_SCHAR) {
+	for (i = 0; i < count; i++)
+	    out[i] = ((const signed char*)in)[i];
+    }
+    else if (type == CV_SHORT) {
+	for (i = 0; i < count; i++)
+	    out[i] = ((const short*)in)[i];
+    }
+    else {
+	for (i = 0; i < count; i++)
+	    out[i] = ((const int*)in)[i];
+    }
+}
+
+
+/*
+ * Returns a value rounded to the nearest integer (halfway cases away from
+ * zero) and limited to a range.
+ *
+ * Arguments:
+ *	value	The value.
+ *	min	The smallest allowed integer.
+ *	max	The largest allowed integer.
+ * Returns:
+ *	0	"value" is NaN.
+ *	else	The rounded and limited value.
+ */
+static double
+saturate(
+    const double	value,
+    const double	min,
+    const double	max)
+{
+    return
+	value != value
+	    ? 0
+	    : value <= min
+		? min
+		: value >= max
+		    ? max
+		    : round(value);
+}
+
+
+/*
+ * Narrows doubles to packed integers with rounding and saturation.
+ *
+ * Arguments:
+ *	in	Pointer to the doubles.
+ *	count	The number of doubles.
+ *	type	The type of the packed integers.
+ *	out	Pointer to the first output packed integer.
+ */
+static void
+narrowPacked(
+    const double* const		in,
+    const size_t		count,
+    const cv_packed_type	type,
+    void* const			out)
+{
+    size_t	i;
+
+    if (type == CV_SCHAR) {
+	for (i = 0; i < count; i++)
+	    ((signed char*)out)[i] =
+		(signed char)saturate(in[i], SCHAR_MIN, SCHAR_MAX);
+    }
+    else if (type == CV_SHORT) {
+	for (i = 0; i < count; i++)
+	    ((short*)out)[i] = (short)saturate(in[i], SHRT_MIN, SHRT_MAX);
+    }
+    else {
+	for (i = 0; i < count; i++)
+	    ((int*)out)[i] = (int)saturate(in[i], INT_MIN, INT_MAX);
+    }
+}
+
+
+/*
+ * Unpacks and converts packed integers.  If the converter is Galilean, then
+ * the unpacking is folded into it so that each value is computed by a single
+ * multiplication and addition.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	type		The type of the packed integers.
+ *	in		Pointer to the packed integers.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.
+ *	addOffset	The packing offset.
+ *	doubles		Pointer to the output doubles or NULL.
+ *	floats		Pointer to the output floats if "doubles" is NULL.
+ */
+static void
+unpack(
+    const cv_converter* const	converter,
+    const cv_packed_type	type,
+    const char*			in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    double* const		doubles,
+    float* const		floats)
+{
+    const size_t	size = packedSize(type);
+    double		slope;
+    double		intercept;
+    const int		isGalilean =
+			    cvGetGalilean(converter, &slope, &intercept);
+    double		block[STRIDE_BLOCK_SIZE];
+    size_t		start;
+
+    if (isGalilean) {
+	intercept = slope * addOffset + intercept;
+	slope = slope * scaleFactor;
+    }
+
+    for (start = 0; start < count; start += STRIDE_BLOCK_SIZE) {
+	const size_t	n = count - start < STRIDE_BLOCK_SIZE
+			    ? count - start
+			    : STRIDE_BLOCK_SIZE;
+	double* const	values = doubles == NULL ? block : doubles + start;
+
+	widenPacked(type, in + start*size, n, values);
+
+	if (isGalilean) {
+	    ckGalileanDoubles(slope, intercept, values, n, values);
+	}
+	else {
+	    ckGalileanDoubles(scaleFactor, addOffset, values, n, values);
+	    (void)converter->ops->convertDoubles(converter, values, n, values);
+	}
+
+	if (doubles == NULL) {
+	    size_t	i;
+
+	    for (i = 0; i < n; i++)
+		floats[start+i] = (float)values[i];
+	}
+    }
+}
+
+
+/*
+ * Converts and packs values into integers.  If the converter is Galilean,
+ * then the packing is folded into it so that each value is computed by a
+ * single multiplication and addition.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	doubles		Pointer to the values to be converted or NULL.
+ *	floats		Pointer to the values to be converted if "doubles" is
+ *			NULL.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.  Must not be zero.
+ *	addOffset	The packing offset.
+ *	type		The type of the packed integers.
+ *	out		Pointer to the output packed integers.
+ */
+static void
+pack(
+    const cv_converter* const	converter,
+    const double* const		doubles,
+    const float* const		floats,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    const cv_packed_type	type,
+    char* const			out)
+{
+    const size_t	size = packedSize(type);
+    double		slope;
+    double		intercept;
+    const int		isGalilean =
+			    cvGetGalilean(converter, &slope, &intercept);
+    double		block[STRIDE_BLOCK_SIZE];
+    size_t		start;
+
+    if (isGalilean) {
+	slope = slope / scaleFactor;
+	intercept = (intercept - addOffset) / scaleFactor;
+    }
+
+    for (start = 0; start < count; start += STRIDE_BLOCK_SIZE) {
+	const size_t	n = count - start < STRIDE_BLOCK_SIZE
+			    ? count - start
+			    : STRIDE_BLOCK_SIZE;
+	const double*	values;
+
+	if (doubles != NULL) {
+	    values = doubles + start;
+	}
+	else {
+	    size_t	i;
+
+	    for (i = 0; i < n; i++)
+		block[i] = floats[start+i];
+
+	    values = block;
+	}
+
+	if (isGalilean) {
+	    ckGalileanDoubles(slope, intercept, values, n, block);
+	}
+	else {
+	    (void)converter->ops->convertDoubles(converter, values, n, block);
+	    ckGalileanDoubles(1 / scaleFactor, -addOffset / scaleFactor, block,
+		n, block);
+	}
+
+	narrowPacked(block, n, type, out + start*size);
+    }
+}
+
+
+/*
+ * Unpacks integers (e.g., those of a netCDF variable with "scale_factor" and
+ * "add_offset" attributes) and converts them to floats in a single pass.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	type		The type of the packed integers.
+ *	in		Pointer to the packed integers.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.
+ *	addOffset	The packing offset.  The unpacked value of packed
+ *			integer "i" is "i*scaleFactor + addOffset".
+ *	out		Pointer to the output array.  Must not overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL or "type" is
+ *			unknown.
+ *	else		Pointer to the output array, "out".
+ */
+float*
+cv_unpack_floats(
+    const cv_converter*		converter,
+    const cv_packed_type	type,
+    const void* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    float*			out)
+{
+    if (converter == NULL || in == NULL || out == NULL ||
+	    packedSize(type) == 0) {
+	out = NULL;
+    }
+    else {
+	unpack(converter, type, in, count, scaleFactor, addOffset, NULL, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Unpacks integers (e.g., those of a netCDF variable with "scale_factor" and
+ * "add_offset" attributes) and converts them to doubles in a single pass.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	type		The type of the packed integers.
+ *	in		Pointer to the packed integers.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.
+ *	addOffset	The packing offset.  The unpacked value of packed
+ *			integer "i" is "i*scaleFactor + addOffset".
+ *	out		Pointer to the output array.  Must not overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL or "type" is
+ *			unknown.
+ *	else		Pointer to the output array, "out".
+ */
+double*
+cv_unpack_doubles(
+    const cv_converter*		converter,
+    const cv_packed_type	type,
+    const void* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    double*			out)
+{
+    if (converter == NULL || in == NULL || out == NULL ||
+	    packedSize(type) == 0) {
+	out = NULL;
+    }
+    else {
+	unpack(converter, type, in, count, scaleFactor, addOffset, out, NULL);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts floats and packs them into integers in a single pass.  Values are
+ * rounded to the nearest integer (halfway cases away from zero) and limited to
+ * the range of the type.  NaN values are packed as zero.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.  Must not be zero.
+ *	addOffset	The packing offset.  A value "v" is packed as
+ *			"(v - addOffset)/scaleFactor".
+ *	type		The type of the packed integers.
+ *	out		Pointer to the output packed integers.  Must not
+ *			overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL; "scaleFactor" is
+ *			zero; or "type" is unknown.
+ *	else		Pointer to the output array, "out".
+ */
+void*
+cv_pack_floats(
+    const cv_converter*		converter,
+    const float* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    const cv_packed_type	type,
+    void*			out)
+{
+    if (converter == NULL || in == NULL || out == NULL || scaleFactor == 0 ||
+	    packedSize(type) == 0) {
+	out = NULL;
+    }
+    else {
+	pack(converter, NULL, in, count, scaleFactor, addOffset, type, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts doubles and packs them into integers in a single pass.  Values are
+ * rounded to the nearest integer (halfway cases away from zero) and limited to
+ * the range of the type.  NaN values are packed as zero.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.  Must not be zero.
+ *	addOffset	The packing offset.  A value "v" is packed as
+ *			"(v - addOffset)/scaleFactor".
+ *	type		The type of the packed integers.
+ *	out		Pointer to the output packed integers.  Must not
+ *			overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL; "scaleFactor" is
+ *			zero; or "type" is unknown.
+ *	else		Pointer to the output array, "out".
+ */
+void*
+cv_pack_doubles(
+    const cv_converter*		converter,
+    const double* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    const cv_packed_type	type,
+    void*			out)
+{
+    if (converter == NULL || in == NULL || out == NULL || scaleFactor == 0 ||
+	    packedSize(type) == 0) {
+	out = NULL;
+    }
+    else {
+	pack(converter, in, NULL, count, scaleFactor, addOffset, type, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts one chunk of a parallel conversion.  This is the task that's given
+ * to the executor.
+ *
+ * Arguments:
+ *	arg	Pointer to the parallel conversion.
+ *	index	The index of the chunk.
+ */
+static void
+convertChunk(
+    void* const		arg,
+    const size_t	index)
+{
+    const ParallelJob* const	job = (const ParallelJob*)arg;
+    const size_t		start = index * PARALLEL_CHUNK_SIZE;
+    const size_t		n = job->count - start < PARALLEL_CHUNK_SIZE
+				    ? job->count - start
+				    : PARALLEL_CHUNK_SIZE;
+
+    if (job->isDouble) {
+	(void)job->converter->ops->convertDoubles(job->converter,
+	    (const double*)job->in + start, n, (double*)job->out + start);
+    }
+    else {
+	(void)job->converter->ops->convertFloats(job->converter,
+	    (const float*)job->in + start, n, (float*)job->out + start);
+    }
+}
+
+
+/*
+ * Converts an array in chunks that are executed by an executor.
+ *
+ * Arguments:
+ *	job		Pointer to the conversion.
+ *	executor	The executor or NULL to execute the chunks serially.
+ *	context		The executor's context.
+ */
+static void
+convertParallel(
+    ParallelJob* const	job,
+    const cv_executor	executor,
+    void* const		context)
+{
+    const size_t	nchunks =
+			    (job->count + PARALLEL_CHUNK_SIZE - 1) /
+			    PARALLEL_CHUNK_SIZE;
+
+    if (executor == NULL || nchunks <= 1) {
+	size_t	i;
+
+	for (i = 0; i < nchunks; i++)
+	    convertChunk(job, i);
+    }
+    else {
+	executor(convertChunk, job, nchunks, context);
+    }
+}
+
+
+/*
+ * Converts an array of floats in parallel.  The array is divided into chunks,
+ * each of which is converted by a task that's given to an executor.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the output array for the converted values.
+ *			May be "in".  If it otherwise overlaps "in", then the
+ *			conversion is serial.
+ *	executor	The executor of the tasks or NULL to convert the
+ *			chunks serially in the calling thread.
+ *	context		The context argument for the executor.
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the output array, "out".
+ */
+float*
+cv_convert_floats_parallel(
+    const cv_converter*	converter,
+    const float* const	in,
+    const size_t	count,
+    float*		out,
+    const cv_executor	executor,
+    void* const		context)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else if (in != out && in < out + count && out < in + count) {
+	out = converter->ops->convertFloats(converter, in, count, out);
+    }
+    else {
+	ParallelJob	job;
+
+	job.converter = converter;
+	job.in = in;
+	job.out = out;
+	job.count = count;
+	job.isDouble = 0;
+
+	convertParallel(&job, executor, context);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts an array of doubles in parallel.  The array is divided into
+ * chunks, each of which is converted by a task that's given to an executor.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the output array for the converted values.
+ *			May be "in".  If it otherwise overlaps "in", then the
+ *			conversion is serial.
+ *	executor	The executor of the tasks or NULL to convert the
+ *			chunks serially in the calling thread.
+ *	context		The context argument for the executor.
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the output array, "out".
+ */
+double*
+cv_convert_doubles_parallel(
+    const cv_converter*	converter,
+    const double* const	in,
+    const size_t	count,
+    double*		out,
+    const cv_executor	executor,
+    void* const		context)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else if (in != out && in < out + count && out < in + count) {
+	out = converter->ops->convertDoubles(converter, in, count, out);
+    }
+    else {
+	ParallelJob	job;
+
+	job.converter = converter;
+	job.in = in;
+	job.out = out;
+	job.count = count;
+	job.isDouble = 1;
+
+	convertParallel(&job, executor, context);
+    }
+
+    return out;
+}
+
+
+/*
+ * Returns a string expression representation of a converter.
+ *
+ * Arguments:
+ *	conv		The converter.
+ *	buf		The buffer into which to write the expression.
+ *	max		The size of the buffer.
+ *	variable	The string to be used as the input value for the
+ *			converter.
+ * RETURNS
+ *	<0	An error was encountered.
+ *	else	The number of bytes formatted excluding the terminating null.
+ */
+int
+cv_get_expression(
+    const cv_converter* const	conv,
+    char* const			buf,
+    size_t			max,
+    const char* const		variable)
+{
+    return conv->ops->getExpression(conv, buf, max, variable);
+}
+
+
+/*
+ * Indicates if a value is missing.
+ *
+ * Arguments:
+ *	value	The value.
+ *	fill	The fill value.  If NaN, then NaN values are missing.
+ * Returns:
+ *	0	The value isn't missing.
+ *	1	The value is missing.
+ */
+static int
+cvIsMissing(
+    const double	value,
+    const double	fill)
+{
+    return fill == fill
+	? value == fill
+	: value != value;
+}
+
+
+/*
+ * Converts an array of floats, passing missing values through unchanged.  A
+ * converter with a single operation uses the masked kernel of the operation.
+ * Any other converter converts a block at a time, after which the missing
+ * values of the block are restored.
+ *
+ * Arguments:
+ *	conv	Pointer to the converter.
+ *	in	Pointer to the values to be converted.
+ *	count	The number of values to be converted.
+ *	fill	The fill value.  If NaN, then NaN values are missing.
+ *	out	Pointer to the output array for the converted values.
+ */
+static void
+convertFloatsMasked(
+    const cv_converter* const	conv,
+    const float* const		in,
+    const size_t		count,
+    const float			fill,
+    float* const		out)
+{
+    if (IS_TRIVIAL(conv)) {
+	(void)memmove(out, in, count*sizeof(float));
+    }
+    else if (IS_RECIPROCAL(conv)) {
+	ckReciprocalFloatsMasked(fill, in, count, out);
+    }
+    else if (IS_SCALE(conv)) {
+	ckScaleFloatsMasked(conv->scale.value, fill, in, count, out);
+    }
+    else if (IS_OFFSET(conv)) {
+	ckOffsetFloatsMasked(conv->offset.value, fill, in, count, out);
+    }
+    else if (IS_GALILEAN(conv)) {
+	ckGalileanFloatsMasked(conv->galilean.slope, conv->galilean.intercept,
+	    fill, in, count, out);
+    }
+    else if (IS_LOG(conv)) {
+	ckLogFloatsMasked(conv->log.logE, fill, in, count, out);
+    }
+    else if (IS_POW(conv)) {
+	ckExpFloatsMasked(conv->exp.base, fill, in, count, out);
+    }
+    else if (IS_PROGRAM(conv) && conv->program.count == 1) {
+	cv_converter	step;
+
+	programGetStep(conv->program.code, &step);
+	convertFloatsMasked(&step, in, count, fill, out);
+    }
+    else {
+	float	block[STRIDE_BLOCK_SIZE];
+	size_t	start = in < out ? count : 0;
+	size_t	remaining = count;
+
+	/*
+	 * If the output array follows the input array, then the blocks and
+	 * their values are processed from last to first so that unconverted
+	 * input values aren't overwritten.
+	 */
+	while (remaining > 0) {
+	    const size_t	n = remaining < STRIDE_BLOCK_SIZE
+		? remaining
+		: STRIDE_BLOCK_SIZE;
+	    size_t		i;
+
+	    if (in < out)
+		start -= n;
+
+	    (void)conv->ops->convertFloats(conv, in + start, n, block);
+
+	    if (in < out) {
+		for (i = n; i-- > 0;)
+		    out[start+i] = cvIsMissing(in[start+i], fill)
+			? in[start+i]
+			: block[i];
+	    }
+	    else {
+		for (i = 0; i < n; i++)
+		    out[start+i] = cvIsMissing(in[start+i], fill)
+			? in[start+i]
+			: block[i];
+
+		start += n;
+	    }
+
+	    remaining -= n;
+	}
+    }
+}
+
+
+/*
+ * Converts an array of doubles, passing missing values through unchanged.  A
+ * converter with a single operation uses the masked kernel of the operation.
+ * Any other converter converts a block at a time, after which the missing
+ * values of the block are restored.
+ *
+ * Arguments:
+ *	conv	Pointer to the converter.
+ *	in	Pointer to the values to be converted.
+ *	count	The number of values to be converted.
+ *	fill	The fill value.  If NaN, then NaN values are missing.
+ *	out	Pointer to the output array for the converted values.
+ */
+static void
+convertDoublesMasked(
+    const cv_converter* const	conv,
+    const double* const		in,
+    const size_t		count,
+    const double		fill,
+    double* const		out)
+{
+    if (IS_TRIVIAL(conv)) {
+	(void)memmove(out, in, count*sizeof(double));
+    }
+    else if (IS_RECIPROCAL(conv)) {
+	ckReciprocalDoublesMasked(fill, in, count, out);
+    }
+    else if (IS_SCALE(conv)) {
+	ckScaleDoublesMasked(conv->scale.value, fill, in, count, out);
+    }
+    else if (IS_OFFSET(conv)) {
+	ckOffsetDoublesMasked(conv->offset.value, fill, in, count, out);
+    }
+    else if (IS_GALILEAN(conv)) {
+	ckGalileanDoublesMasked(conv->galilean.slope, conv->galilean.intercept,
+	    fill, in, count, out);
+    }
+    else if (IS_LOG(conv)) {
+	ckLogDoublesMasked(conv->log.logE, fill, in, count, out);
+    }
+    else if (IS_POW(conv)) {
+	ckExpDoublesMasked(conv->exp.base, fill, in, count, out);
+    }
+    else if (IS_PROGRAM(conv) && conv->program.count == 1) {
+	cv_converter	step;
+
+	programGetStep(conv->program.code, &step);
+	convertDoublesMasked(&step, in, count, fill, out);
+    }
+    else {
+	double	block[STRIDE_BLOCK_SIZE];
+	size_t	start = in < out ? count : 0;
+	size_t	remaining = count;
+
+	/*
+	 * If the output array follows the input array, then the blocks and
+	 * their values are processed from last to first so that unconverted
+	 * input values aren't overwritten.
+	 */
+	while (remaining > 0) {
+	    const size_t	n = remaining < STRIDE_BLOCK_SIZE
+		? remaining
+		: STRIDE_BLOCK_SIZE;
+	    size_t		i;
+
+	    if (in < out)
+		start -= n;
+
+	    (void)conv->ops->convertDoubles(conv, in + start, n, block);
+
+	    if (in < out) {
+		for (i = n; i-- > 0;)
+		    out[start+i] = cvIsMissing(in[start+i], fill)
+			? in[start+i]
+			: block[i];
+	    }
+	    else {
+		for (i = 0; i < n; i++)
+		    out[start+i] = cvIsMissing(in[start+i], fill)
+			? in[start+i]
+			: block[i];
+
+		start += n;
+	    }
+
+	    remaining -= n;
+	}
+    }
+}
+
+
+/*
+ * Converts an array of floats, passing missing values through unchanged.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values to be converted.
+ *	fillValue	The value that marks missing values, which are copied
+ *			to the output array unchanged.  If NaN, then NaN values
+ *			are missing.
+ *	out		Pointer to the output array for the converted values.
+ *			The array may overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the output array, "out".
+ */
+float*
+cv_convert_floats_masked(
+    const cv_converter*	converter,
+    const float* const	in,
+    const size_t	count,
+    const float		fillValue,
+    float*		out)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+	convertFloatsMasked(converter, in, count, fillValue, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Converts an array of doubles, passing missing values through unchanged.
+ *
+ * Arguments:
+ *	converter	Pointer to the converter.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values to be converted.
+ *	fillValue	The value that marks missing values, which are copied
+ *			to the output array unchanged.  If NaN, then NaN values
+ *			are missing.
+ *	out		Pointer to the output array for the converted values.
+ *			The array may overlap "in".
+ * Returns:
+ *	NULL		"converter", "in", or "out" is NULL.
+ *	else		Pointer to the output array, "out".
+ */
+double*
+cv_convert_doubles_masked(
+    const cv_converter*	converter,
+    const double* const	in,
+    const size_t	count,
+    const double	fillValue,
+    double*		out)
+{
+    if (converter == NULL || in == NULL || out == NULL) {
+	out = NULL;
+    }
+    else {
+	convertDoublesMasked(converter, in, count, fillValue, out);
+    }
+
+    return out;
+}
+
+
+/*
+ * Appends bytes to a serialization buffer.  Nothing is written past the end of
+ * the buffer, but the position is always advanced.
+ *
+ * Arguments:
+ *	buf	The buffer.
+ *	size	The size of the buffer in bytes.
+ *	pos	The position at which to write.
+ *	bytes	The bytes to be written.
+ *	n	The number of bytes.
+ * Returns:
+ *	The position after the bytes.
+ */
+static size_t
+serialPut(
+    unsigned char* const	buf,
+    const size_t		size,
+    const size_t		pos,
+    const unsigned char* const	bytes,
+    const size_t		n)
+{
+    if (pos <= size && n <= size - pos)
+	(void)memcpy(buf + pos, bytes, n);
+
+    return pos + n;
+}
+
+
+/*
+ * Appends a little-endian integer to a serialization buffer.
+ *
+ * Arguments:
+ *	buf	The buffer.
+ *	size	The size of the buffer in bytes.
+ *	pos	The position at which to write.
+ *	value	The value to be written.
+ *	n	The number of bytes of the integer.  Must be at most 8.
+ * Returns:
+ *	The position after the integer.
+ */
+static size_t
+serialPutInt(
+    unsigned char* const	buf,
+    const size_t		size,
+    const size_t		pos,
+    uint64_t			value,
+    const size_t		n)
+{
+    unsigned char	bytes[8];
+    size_t		i;
+
+    for (i = 0; i < n; i++) {
+	bytes[i] = (unsigned char)(value & 0xff);
+	value >>= 8;
+    }
+
+    return serialPut(buf, size, pos, bytes, n);
+}
+
+
+/*
+ * Appends a double to a serialization buffer.
+ *
+ * Arguments:
+ *	buf	The buffer.
+ *	size	The size of the buffer in bytes.
+ *	pos	The position at which to write.
+ *	value	The value to be written.
+ * Returns:
+ *	The position after the value.
+ */
+static size_t
+serialPutDouble(
+    unsigned char* const	buf,
+    const size_t		size,
+    const size_t		pos,
+    const double		value)
+{
+    uint64_t	bits;
+
+    (void)memcpy(&bits, &value, sizeof(bits));
+
+    return serialPutInt(buf, size, pos, bits, 8);
+}
+
+
+/*
+ * Indicates if a converter at a given nesting depth may be serialized and
+ * deserialized.  Both directions use this function so that every serialized
+ * converter can be deserialized.
+ *
+ * Arguments:
+ *	depth	The nesting depth of the converter.  The depth of the outermost
+ *		converter is zero.
+ * Returns:
+ *	0	The converter is too deeply nested.
+ *	1	The converter may be serialized and deserialized.
+ */
+static int
+isSerialDepth(
+    const int	depth)
+{
+    return depth <= SERIAL_MAX_DEPTH;
+}
+
+
+/*
+ * Appends the encoding of a converter to a serialization buffer.
+ *
+ * Arguments:
+ *	conv	The converter.
+ *	buf	The buffer.
+ *	size	The size of the buffer in bytes.
+ *	pos	The position at which to write.
+ *	depth	The nesting depth of the converter.
+ * Returns:
+ *	0	The converter is too deeply nested (see isSerialDepth()).
+ *	else	The position after the encoding.
+ */
+static size_t
+serializeConverter(
+    const cv_converter* const	conv,
+    unsigned char* const	buf,
+    const size_t		size,
+    size_t			pos,
+    const int			depth)
 {
-    cv_converter*	conv;
-
-    if (base <= 0) {
-	conv = NULL;
+    if (!isSerialDepth(depth)) {
+	pos = 0;
+    }
+    else if (IS_TRIVIAL(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_TRIVIAL, 1);
+    }
+    else if (IS_RECIPROCAL(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_RECIPROCAL, 1);
+    }
+    else if (IS_SCALE(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_SCALE, 1);
+	pos = serialPutDouble(buf, size, pos, conv->scale.value);
+    }
+    else if (IS_OFFSET(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_OFFSET, 1);
+	pos = serialPutDouble(buf, size, pos, conv->offset.value);
+    }
+    else if (IS_GALILEAN(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_GALILEAN, 1);
+	pos = serialPutDouble(buf, size, pos, conv->galilean.slope);
+	pos = serialPutDouble(buf, size, pos, conv->galilean.intercept);
+    }
+    else if (IS_LOG(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_LOG, 1);
+	pos = serialPutDouble(buf, size, pos, conv->log.logE);
+    }
+    else if (IS_POW(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_POW, 1);
+	pos = serialPutDouble(buf, size, pos, conv->exp.base);
+    }
+    else if (IS_COMPOSITE(conv)) {
+	pos = serialPutInt(buf, size, pos, TAG_COMPOSITE, 1);
+	pos = serializeConverter(conv->composite.first, buf, size, pos,
+	    depth + 1);
+
+	if (pos != 0)
+	    pos = serializeConverter(conv->composite.second, buf, size, pos,
+		depth + 1);
     }
     else {
-	conv = malloc(sizeof(ExpConverter));
+	size_t	i;
 
-	if (conv != NULL) {
-	    conv->ops = &expOps;
-	    conv->exp.base = base;
+	assert(IS_PROGRAM(conv));
+
+	pos = serialPutInt(buf, size, pos, TAG_PROGRAM, 1);
+	pos = serialPutInt(buf, size, pos, conv->program.count, 4);
+
+	for (i = 0; i < conv->program.count; i++) {
+	    cv_converter	step;
+
+	    /* An operation is encoded at the depth of its program */
+	    programGetStep(conv->program.code + i, &step);
+	    pos = serializeConverter(&step, buf, size, pos, depth);
 	}
     }
 
-    return conv;
+    return pos;
 }
 
 
 /*
- * Returns a converter corresponding to the sequential application of two
- * other converters.  The returned converter should be passed to cv_free() when
- * it is no longer needed.
+ * Reads a little-endian integer from a serialized converter.
  *
  * Arguments:
- *	first	The converter to be applied first.  May be passed to cv_free()
- *		upon return.
- *	second	The converter to be applied second.  May be passed to cv_free()
- *		upon return.
+ *	buf	The serialized converter.
+ *	size	The size of the serialized converter in bytes.
+ *	pos	Pointer to the position at which to read.  Advanced past the
+ *		integer on success.
+ *	n	The number of bytes of the integer.  Must be at most 8.
+ *	value	Pointer to the integer.  Set on success.
  * Returns:
- *	NULL	Either "first" or "second" is NULL or necessary memory couldn't
- *		be allocated.
- *      else    A converter corresponding to the sequential application of the
- *              given converters.  If one of the input converters is the trivial
- *              converter, then the returned converter will be the other input
- *              converter.
+ *	0	Success.
+ *	-1	The serialized converter is too short.
  */
-cv_converter*
-cv_combine(
-    cv_converter* const	first,
-    cv_converter* const	second)
+static int
+serialGetInt(
+    const unsigned char* const	buf,
+    const size_t		size,
+    size_t* const		pos,
+    const size_t		n,
+    uint64_t* const		value)
 {
-    cv_converter*	conv;
+    int	status;
 
-    if (first == NULL || second == NULL) {
-	conv = NULL;
-    }
-    else if (IS_TRIVIAL(first)) {
-	conv = CV_CLONE(second);
-    }
-    else if (IS_TRIVIAL(second)) {
-	conv = CV_CLONE(first);
+    if (*pos > size || n > size - *pos) {
+	status = -1;
     }
     else {
-	conv = NULL;
-
-	if (IS_RECIPROCAL(first)) {
-	    if (IS_RECIPROCAL(second)) {
-		conv = cv_get_trivial();
-	    }
-	}
-	else if (IS_SCALE(first)) {
-	    if (IS_SCALE(second)) {
-		conv = cv_get_scale(first->scale.value * second->scale.value);
-	    }
-	    else if (IS_OFFSET(second)) {
-		conv = cv_get_galilean(first->scale.value, second->offset.value);
-	    }
-	    else if (IS_GALILEAN(second)) {
-		conv = cv_get_galilean(
-		    first->scale.value * second->galilean.slope, 
-		    second->galilean.intercept);
-	    }
-	}
-	else if (IS_OFFSET(first)) {
-	    if (IS_SCALE(second)) {
-		conv = cv_get_galilean(second->scale.value, 
-		    first->offset.value * second->scale.value);
-	    }
-	    else if (IS_OFFSET(second)) {
-		conv = cv_get_offset(first->offset.value + second->offset.value);
-	    }
-	    else if (IS_GALILEAN(second)) {
-		conv = cv_get_galilean(second->galilean.slope, 
-		    first->offset.value * second->galilean.slope +
-			second->galilean.intercept);
-	    }
-	}
-	else if (IS_GALILEAN(first)) {
-	    if (IS_SCALE(second)) {
-		conv = cv_get_galilean(
-		    second->scale.value * first->galilean.slope,
-		    second->scale.value * first->galilean.intercept);
-	    }
-	    else if (IS_OFFSET(second)) {
-		conv = cv_get_galilean(first->galilean.slope,
-		    first->galilean.intercept + second->offset.value);
-	    }
-	    else if (IS_GALILEAN(second)) {
-		conv = cv_get_galilean(
-		    second->galilean.slope * first->galilean.slope,
-		    second->galilean.slope * first->galilean.intercept +
-			second->galilean.intercept);
-	    }
-	}
-
-	if (conv == NULL) {
-	    /*
-	     * General case: create a composite converter.
-	     */
-	    cv_converter*	c1 = CV_CLONE(first);
-            int                 error = 1;
-
-            if (c1 != NULL) {
-                cv_converter*	c2 = CV_CLONE(second);
-
-                if (c2 != NULL) {
-                    conv = malloc(sizeof(CompositeConverter));
+	size_t	i;
 
-                    if (conv != NULL) {
-                        conv->composite.ops = &compositeOps;
-                        conv->composite.first = c1;
-                        conv->composite.second = c2;
-                        error = 0;
-                    }                   /* "conv" allocated */
+	*value = 0;
 
-                    if (error)
-                        cv_free(c2);
-                }                       /* "c2" allocated */
+	for (i = n; i-- > 0;)
+	    *value = (*value << 8) | buf[*pos + i];
 
-                if (error)
-                    cv_free(c1);
-            }                           /* "c1" allocated */
-	}                               /* "conv != NULL" */
-    }                                   /* "first" & "second" not trivial */
+	*pos += n;
+	status = 0;
+    }
 
-    return conv;
+    return status;
 }
 
 
 /*
- * Frees resources associated with a converter.  Use of the converter argument
- * subsequent to this function may result in undefined behavior.
- *
- * Arguments:
- *	conv	The converter to have its resources freed or NULL.  The
- *		converter must have been returned by this module.
+ * Reads a double from a serialized converter.  The arguments and return value
+ * are those of serialGetInt().
  */
-void
-cv_free(
-    cv_converter* const	conv)
+static int
+serialGetDouble(
+    const unsigned char* const	buf,
+    const size_t		size,
+    size_t* const		pos,
+    double* const		value)
 {
-    if (conv != NULL) {
-	conv->ops->free((cv_converter*)conv);
-    }
+    uint64_t	bits;
+    int		status = serialGetInt(buf, size, pos, 8, &bits);
+
+    if (status == 0)
+	(void)memcpy(value, &bits, sizeof(bits));
+
+    return status;
 }
 
 
 /*
- * Converts a float.
+ * Reads the encoding of a single operation from a serialized converter.
  *
  * Arguments:
- *	converter	Pointer to the converter.
- *	value		The value to be converted.
+ *	buf	The serialized converter.
+ *	size	The size of the serialized converter in bytes.
+ *	pos	Pointer to the position at which to read.  Advanced past the
+ *		operation on success.
+ *	tag	The tag of the operation, which has been read.
+ *	inst	Pointer to the operation.  Set on success.
  * Returns:
- *	The converted value.
+ *	0	Success.
+ *	-1	The encoding is invalid.
  */
-float
-cv_convert_float(
-    const cv_converter*	converter,
-    const float		value)
+static int
+deserializeInstruction(
+    const unsigned char* const	buf,
+    const size_t		size,
+    size_t* const		pos,
+    const uint64_t		tag,
+    Instruction* const		inst)
 {
-    return (float)converter->ops->convertDouble(converter, value);
+    int	status = 0;
+
+    inst->a = 0;
+    inst->b = 0;
+
+    switch (tag) {
+    case TAG_RECIPROCAL:
+	inst->code = OP_RECIPROCAL;
+	break;
+    case TAG_SCALE:
+	inst->code = OP_SCALE;
+	status = serialGetDouble(buf, size, pos, &inst->a);
+	break;
+    case TAG_OFFSET:
+	inst->code = OP_OFFSET;
+	status = serialGetDouble(buf, size, pos, &inst->a);
+	break;
+    case TAG_GALILEAN:
+	inst->code = OP_GALILEAN;
+	status = serialGetDouble(buf, size, pos, &inst->a);
+	if (status == 0)
+	    status = serialGetDouble(buf, size, pos, &inst->b);
+	break;
+    case TAG_LOG:
+	inst->code = OP_LOG;
+	status = serialGetDouble(buf, size, pos, &inst->a);
+	break;
+    case TAG_POW:
+	inst->code = OP_POW;
+	status = serialGetDouble(buf, size, pos, &inst->a);
+	if (status == 0 && !(inst->a > 0))
+	    status = -1;
+	break;
+    default:
+	status = -1;
+    }
+
+    return status;
 }
 
 
 /*
- * Converts a double.
+ * Returns a new converter for a single operation.  Unlike the public
+ * constructors, the parameters of the operation are used as is.
  *
  * Arguments:
- *	converter	Pointer to the converter.
- *	value		The value to be converted.
+ *	inst	The operation.
  * Returns:
- *	The converted value.
+ *	NULL	Necessary memory couldn't be allocated.
+ *	else	The converter.
  */
-double
-cv_convert_double(
-    const cv_converter*	converter,
-    const double	value)
+static cv_converter*
+cvNewStep(
+    const Instruction* const	inst)
 {
-    return converter->ops->convertDouble(converter, value);
+    cv_converter*	conv;
+
+    if (inst->code == OP_LOG) {
+	conv = logNew(inst->a);
+    }
+    else {
+	cv_converter	step;
+
+	programGetStep(inst, &step);
+	conv = CV_CLONE(&step);
+    }
+
+    return conv;
 }
 
 
 /*
- * Converts an array of floats.
+ * Returns the converter encoded in a serialized converter.
  *
  * Arguments:
- *	converter	Pointer to the converter.
- *	in		Pointer to the values to be converted.  The array may
- *			overlap "out".
- *	count		The number of values to be converted.
- *	out		Pointer to the output array for the converted values.
- *			The array may overlap "in".
+ *	buf	The serialized converter.
+ *	size	The size of the serialized converter in bytes.
+ *	pos	Pointer to the position at which to read.  Advanced past the
+ *		converter on success.
+ *	depth	The nesting depth of the converter.
  * Returns:
- *	NULL		"converter", "in", or "out" is NULL.
- *	else		Pointer to the output array, "out".
+ *	NULL	The encoding is invalid or necessary memory couldn't be
+ *		allocated.
+ *	else	The converter.
  */
-float*
-cv_convert_floats(
-    const cv_converter*	converter,
-    const float* const	in,
-    const size_t	count,
-    float*		out)
+static cv_converter*
+deserializeConverter(
+    const unsigned char* const	buf,
+    const size_t		size,
+    size_t* const		pos,
+    const int			depth)
 {
-    if (converter == NULL || in == NULL || out == NULL) {
-	out = NULL;
-    }
-    else {
-        out = converter->ops->convertFloats(converter, in, count, out);
+    cv_converter*	conv = NULL;
+    uint64_t		tag;
+
+    if (isSerialDepth(depth) && serialGetInt(buf, size, pos, 1, &tag) == 0) {
+	if (tag == TAG_TRIVIAL) {
+	    conv = cv_get_trivial();
+	}
+	else if (tag == TAG_COMPOSITE) {
+	    cv_converter*	first = deserializeConverter(buf, size, pos,
+				    depth + 1);
+
+	    if (first != NULL) {
+		cv_converter*	second = deserializeConverter(buf, size, pos,
+				    depth + 1);
+
+		if (second != NULL)
+		    conv = compositeNew(first, second);
+
+		if (conv == NULL) {
+		    cv_free(second);
+		    cv_free(first);
+		}
+	    }
+	}
+	else if (tag == TAG_PROGRAM) {
+	    uint64_t	count;
+
+	    /* Each operation takes at least one byte */
+	    if (serialGetInt(buf, size, pos, 4, &count) == 0 && count > 0 &&
+		    count <= size - *pos) {
+		Instruction*	code = malloc(count*sizeof(Instruction));
+
+		if (code != NULL) {
+		    size_t	i;
+
+		    for (i = 0; i < count; i++) {
+			if (serialGetInt(buf, size, pos, 1, &tag) != 0 ||
+				deserializeInstruction(buf, size, pos, tag,
+				    code + i) != 0)
+			    break;
+		    }
+
+		    if (i == count)
+			conv = programNew(code, count);
+
+		    free(code);
+		}
+	    }
+	}
+	else {
+	    Instruction	inst;
+
+	    if (deserializeInstruction(buf, size, pos, tag, &inst) == 0)
+		conv = cvNewStep(&inst);
+	}
     }
 
-    return out;
+    return conv;
 }
 
 
 /*
- * Converts an array of doubles.
+ * Serializes a converter into a compact, versioned, platform-independent
+ * sequence of bytes from which cv_deserialize() can recreate the converter
+ * (e.g., in another process).
  *
  * Arguments:
  *	converter	Pointer to the converter.
- *	in		Pointer to the values to be converted.  The array may
- *			overlap "out".
- *	count		The number of values to be converted.
- *	out		Pointer to the output array for the converted values.
- *			The array may overlap "in".
+ *	buf		Pointer to the buffer for the serialized converter or
+ *			NULL.
+ *	size		The size of the buffer in bytes.
  * Returns:
- *	NULL		"converter", "in", or "out" is NULL.
- *	else		Pointer to the output array, "out".
+ *	0		"converter" is NULL or is nested more than
+ *			SERIAL_MAX_DEPTH levels deep.
+ *	else		The number of bytes of the serialized converter.  If
+ *			greater than "size", then nothing was written.
  */
-double*
-cv_convert_doubles(
-    const cv_converter*	converter,
-    const double* const	in,
-    const size_t	count,
-    double*		out)
+size_t
+cv_serialize(
+    const cv_converter* const	converter,
+    void* const			buf,
+    const size_t		size)
 {
-    if (converter == NULL || in == NULL || out == NULL) {
-	out = NULL;
+    size_t	nbytes;
+
+    if (converter == NULL) {
+	nbytes = 0;
     }
     else {
-    	out = converter->ops->convertDoubles(converter, in, count, out);
+	static const unsigned char	header[] = {'c', 'v', SERIAL_VERSION};
+
+	nbytes = serializeConverter(converter, NULL, 0, sizeof(header), 0);
+
+	if (buf != NULL && nbytes != 0 && nbytes <= size) {
+	    (void)serialPut(buf, size, 0, header, sizeof(header));
+	    (void)serializeConverter(converter, buf, size, sizeof(header), 0);
+	}
     }
 
-    return out;
+    return nbytes;
 }
 
 
 /*
- * Returns a string expression representation of a converter.
+ * Returns the converter of a serialized converter (see cv_serialize()).  No
+ * unit-system is needed.  The returned converter should be passed to cv_free()
+ * when it is no longer needed.
  *
  * Arguments:
- *	conv		The converter.
- *	buf		The buffer into which to write the expression.
- *	max		The size of the buffer.
- *	variable	The string to be used as the input value for the
- *			converter.
- * RETURNS
- *	<0	An error was encountered.
- *	else	The number of bytes formatted excluding the terminating null.
+ *	buf		Pointer to the serialized converter.
+ *	size		The number of bytes of the serialized converter.
+ * Returns:
+ *	NULL		"buf" is NULL, the bytes aren't a serialized converter
+ *			of a supported version, or necessary memory couldn't
+ *			be allocated.
+ *	else		The converter.
  */
-int
-cv_get_expression(
-    const cv_converter* const	conv,
-    char* const			buf,
-    size_t			max,
-    const char* const		variable)
+cv_converter*
+cv_deserialize(
+    const void* const	buf,
+    const size_t	size)
 {
-    return conv->ops->getExpression(conv, buf, max, variable);
+    const unsigned char* const	bytes = buf;
+    cv_converter*		conv = NULL;
+
+    if (bytes != NULL && size >= 3 && bytes[0] == 'c' && bytes[1] == 'v' &&
+	    bytes[2] == SERIAL_VERSION) {
+	size_t	pos = 3;
+
+	conv = deserializeConverter(bytes, size, &pos, 0);
+
+	if (conv != NULL && pos != size) {
+	    cv_free(conv);			/* trailing bytes */
+	    conv = NULL;
+	}
+    }
+
+    return conv;
 }
@@ -24,6 +24,42 @@ extern "C" {
 
 typedef union cv_converter	cv_converter;
 
+/*
+ * Storage for a converter that's provided by the client (e.g., on the stack)
+ * so that the converter can be obtained without allocating memory (see
+ * cv_init_galilean()).
+ */
+typedef union {
+    double	alignDouble;
+    void*	alignPointer;
+    char	bytes[4*sizeof(double)];
+} cv_storage;
+
+/*
+ * Types of packed integers (e.g., netCDF variables with "scale_factor" and
+ * "add_offset" attributes).
+ */
+typedef enum {
+    CV_SCHAR,		/* signed char */
+    CV_SHORT,		/* short */
+    CV_INT		/* int */
+} cv_packed_type;
+
+/*
+ * A task of a parallel conversion: converts chunk "index" of the job "arg".
+ */
+typedef void (*cv_task)(void* arg, size_t index);
+
+/*
+ * An executor of the tasks of a parallel conversion (e.g., one that hands them
+ * to an existing thread pool).  It must call "task(arg, i)" exactly once for
+ * each "i" in [0, count) -- in any order and on any threads -- and return
+ * only after all the calls have returned.  "context" is the argument given
+ * to the parallel conversion function.
+ */
+typedef void (*cv_executor)(cv_task task, void* arg, size_t count,
+    void* context);
+
 /*
  * Returns the trivial converter (i.e., y = x).
  * When finished with the converter, the client should pass the converter to
@@ -117,9 +153,97 @@ EXTERNL cv_converter*
 cv_get_pow(
     const double	base);
 
+/*
+ * Returns a scaling converter (i.e., y = ax) in storage provided by the
+ * client, so that no memory is allocated.  The converter is valid for the
+ * lifetime of the storage and is copied if it's combined with another
+ * converter.  Passing it to cv_free() does nothing.
+ * ARGUMENTS:
+ *	storage		The storage for the converter.
+ *	slope		The number by which to multiply values.
+ * RETURNS:
+ *	NULL	"storage" is NULL.
+ *	else	The converter, which might be the trivial converter.
+ */
+EXTERNL cv_converter*
+cv_init_scale(
+    cv_storage* const	storage,
+    const double	slope);
+
+/*
+ * Returns a converter that adds a number to values (i.e., y = x + b) in
+ * storage provided by the client, so that no memory is allocated.  The
+ * converter is valid for the lifetime of the storage and is copied if it's
+ * combined with another converter.  Passing it to cv_free() does nothing.
+ * ARGUMENTS:
+ *	storage		The storage for the converter.
+ *	intercept	The number to be added.
+ * RETURNS:
+ *	NULL	"storage" is NULL.
+ *	else	The converter, which might be the trivial converter.
+ */
+EXTERNL cv_converter*
+cv_init_offset(
+    cv_storage* const	storage,
+    const double	intercept);
+
+/*
+ * Returns a Galilean converter (i.e., y = ax + b) in storage provided by the
+ * client, so that no memory is allocated.  The converter is valid for the
+ * lifetime of the storage and is copied if it's combined with another
+ * converter.  Passing it to cv_free() does nothing.
+ * ARGUMENTS:
+ *	storage		The storage for the converter.
+ *	slope		The number by which to multiply values.
+ *	intercept	The number to be added.
+ * RETURNS:
+ *	NULL	"storage" is NULL.
+ *	else	The converter, which might be the trivial converter.
+ */
+EXTERNL cv_converter*
+cv_init_galilean(
+    cv_storage* const	storage,
+    const double	slope,
+    const double	intercept);
+
+/*
+ * Returns a logarithmic converter (i.e., y = log(x) in some base) in storage
+ * provided by the client, so that no memory is allocated.  The converter is
+ * valid for the lifetime of the storage and is copied if it's combined with
+ * another converter.  Passing it to cv_free() does nothing.
+ * ARGUMENTS:
+ *	storage		The storage for the converter.
+ *	base		The logarithmic base.  Must be greater than one.
+ * RETURNS:
+ *	NULL	"storage" is NULL or "base" is invalid.
+ *	else	The logarithmic converter in "storage".
+ */
+EXTERNL cv_converter*
+cv_init_log(
+    cv_storage* const	storage,
+    const double	base);
+
+/*
+ * Returns an exponential converter (i.e., y = pow(b, x)) in storage provided
+ * by the client, so that no memory is allocated.  The converter is valid for
+ * the lifetime of the storage and is copied if it's combined with another
+ * converter.  Passing it to cv_free() does nothing.
+ * ARGUMENTS:
+ *	storage		The storage for the converter.
+ *	base		The base.  Must be positive.
+ * RETURNS:
+ *	NULL	"storage" is NULL or "base" is invalid.
+ *	else	The exponential converter in "storage".
+ */
+EXTERNL cv_converter*
+cv_init_pow(
+    cv_storage* const	storage,
+    const double	base);
+
 /*
  * Returns a converter corresponding to the sequential application of two
- * other converters.
+ * other converters.  The composition is simplified algebraically where
+ * possible (e.g., a logarithm of an exponential of the same base cancels).
  * ARGUMENTS:
  *	first	The converter to be applied first.
  *	second	The converter to be applied second.
@@ -136,6 +260,37 @@ cv_combine(
     cv_converter* const	first,
     cv_converter* const	second);
 
+/*
+ * Returns a compiled converter that's equivalent to another converter.  The
+ * compiled converter evaluates a chain of converters as a flat sequence of
+ * operations so that arrays are converted in a single pass.  Intermediate
+ * values are kept in double precision.
+ * When finished with the converter, the client should pass the converter to
+ * cv_free().
+ * ARGUMENTS:
+ *	conv	The converter to be compiled.
+ * RETURNS:
+ *	NULL	"conv" is NULL or necessary memory couldn't be allocated.
+ *	else	A compiled converter equivalent to "conv".
+ */
+EXTERNL cv_converter*
+cv_compile(
+    cv_converter* const	conv);
+
+/*
+ * Returns a copy of a converter.  A converter that was allocated by this
+ * module is shared rather than copied, so no memory is allocated.
+ * When finished with the copy, the client should pass it to cv_free().
+ * ARGUMENTS:
+ *	conv	The converter to be copied.
+ * RETURNS:
+ *	NULL	"conv" is NULL or necessary memory couldn't be allocated.
+ *	else	A converter equivalent to "conv".
+ */
+EXTERNL cv_converter*
+cv_clone(
+    cv_converter* const	conv);
+
 /*
  * Frees resources associated with a converter.
  * ARGUMENTS:
@@ -172,7 +327,8 @@ cv_convert_double(
     const double	value);
 
 /*
- * Converts an array of floats.
+ * Converts an array of floats.  See cv_convert_doubles() for the accuracy of
+ * logarithmic and exponential conversions.
  * ARGUMENTS:
  *	converter	The converter.
  *	in		The values to be converted.
@@ -191,7 +347,12 @@ cv_convert_floats(
     float*		out);
 
 /*
- * Converts an array of doubles.
+ * Converts an array of doubles.  The values of a logarithmic or exponential
+ * converter are computed by the library's own vectorized logarithm and
+ * exponential.  They can differ from those of cv_convert_double() by up to 2
+ * units in the last place for a logarithm and 1 for an exponential; float
+ * values can, rarely, differ from those of cv_convert_float() by 1.  This is
+ * also true of the other array-conversion functions.
  * ARGUMENTS:
  *	converter	The converter.
  *	in		The values to be converted.
@@ -209,6 +370,373 @@ cv_convert_doubles(
     const size_t	count,
     double*		out);
 
+/*
+ * Converts strided floats (e.g., a member of an array of structures).  The
+ * output values may be the input values (i.e., "out" equal to "in" and
+ * "outStride" equal to "inStride") but must not otherwise overlap them.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The first value to be converted.
+ *	inStride	The number of bytes between successive input values.
+ *			May be negative.
+ *	count		The number of values to be converted.
+ *	out		The first output value.
+ *	outStride	The number of bytes between successive output values.
+ *			May be negative.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL.
+ *	else	"out".
+ */
+EXTERNL float*
+cv_convert_floats_strided(
+    const cv_converter*	converter,
+    const float* const	in,
+    const ptrdiff_t	inStride,
+    const size_t	count,
+    float*		out,
+    const ptrdiff_t	outStride);
+
+/*
+ * Converts strided doubles (e.g., a member of an array of structures).  The
+ * output values may be the input values (i.e., "out" equal to "in" and
+ * "outStride" equal to "inStride") but must not otherwise overlap them.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The first value to be converted.
+ *	inStride	The number of bytes between successive input values.
+ *			May be negative.
+ *	count		The number of values to be converted.
+ *	out		The first output value.
+ *	outStride	The number of bytes between successive output values.
+ *			May be negative.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL.
+ *	else	"out".
+ */
+EXTERNL double*
+cv_convert_doubles_strided(
+    const cv_converter*	converter,
+    const double* const	in,
+    const ptrdiff_t	inStride,
+    const size_t	count,
+    double*		out,
+    const ptrdiff_t	outStride);
+
+/*
+ * Converts an N-dimensional hyperslab of floats (e.g., a non-contiguous
+ * subset of a netCDF variable).  The output values may be the input values
+ * (i.e., "out" equal to "in" and "outStrides" equal to "inStrides") but must
+ * not otherwise overlap them.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	rank		The number of dimensions.  If zero, then a single value
+ *			is converted.
+ *	shape		The number of values along each dimension, outermost
+ *			first.
+ *	in		The first value to be converted.
+ *	inStrides	The number of bytes between successive input values
+ *			along each dimension.  May be negative.
+ *	out		The first output value.
+ *	outStrides	The number of bytes between successive output values
+ *			along each dimension.  May be negative.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL; "rank" is negative; or
+ *		"rank" is positive and "shape", "inStrides", or "outStrides"
+ *		is NULL.
+ *	else	"out".
+ */
+EXTERNL float*
+cv_convert_floats_nd(
+    const cv_converter*		converter,
+    const int			rank,
+    const size_t* const		shape,
+    const float* const		in,
+    const ptrdiff_t* const	inStrides,
+    float*			out,
+    const ptrdiff_t* const	outStrides);
+
+/*
+ * Converts an N-dimensional hyperslab of doubles (e.g., a non-contiguous
+ * subset of a netCDF variable).  The output values may be the input values
+ * (i.e., "out" equal to "in" and "outStrides" equal to "inStrides") but must
+ * not otherwise overlap them.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	rank		The number of dimensions.  If zero, then a single value
+ *			is converted.
+ *	shape		The number of values along each dimension, outermost
+ *			first.
+ *	in		The first value to be converted.
+ *	inStrides	The number of bytes between successive input values
+ *			along each dimension.  May be negative.
+ *	out		The first output value.
+ *	outStrides	The number of bytes between successive output values
+ *			along each dimension.  May be negative.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL; "rank" is negative; or
+ *		"rank" is positive and "shape", "inStrides", or "outStrides"
+ *		is NULL.
+ *	else	"out".
+ */
+EXTERNL double*
+cv_convert_doubles_nd(
+    const cv_converter*		converter,
+    const int			rank,
+    const size_t* const		shape,
+    const double* const		in,
+    const ptrdiff_t* const	inStrides,
+    double*			out,
+    const ptrdiff_t* const	outStrides);
+
+/*
+ * Unpacks integers (e.g., those of a netCDF variable with "scale_factor" and
+ * "add_offset" attributes) and converts them to floats in a single pass.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	type		The type of the packed integers.
+ *	in		The packed integers.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.
+ *	addOffset	The packing offset.  The unpacked value of packed
+ *			integer "i" is "i*scaleFactor + addOffset".
+ *	out		The output array.  Must not overlap "in".
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL or "type" is unknown.
+ *	else	A pointer to the output array.
+ */
+EXTERNL float*
+cv_unpack_floats(
+    const cv_converter*		converter,
+    const cv_packed_type	type,
+    const void* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    float*			out);
+
+/*
+ * Unpacks integers (e.g., those of a netCDF variable with "scale_factor" and
+ * "add_offset" attributes) and converts them to doubles in a single pass.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	type		The type of the packed integers.
+ *	in		The packed integers.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.
+ *	addOffset	The packing offset.  The unpacked value of packed
+ *			integer "i" is "i*scaleFactor + addOffset".
+ *	out		The output array.  Must not overlap "in".
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL or "type" is unknown.
+ *	else	A pointer to the output array.
+ */
+EXTERNL double*
+cv_unpack_doubles(
+    const cv_converter*		converter,
+    const cv_packed_type	type,
+    const void* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    double*			out);
+
+/*
+ * Converts floats and packs them into integers in a single pass.  Values are
+ * rounded to the nearest integer (halfway cases away from zero) and limited to
+ * the range of the type.  NaN values are packed as zero.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The values to be converted.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.  Must not be zero.
+ *	addOffset	The packing offset.  A value "v" is packed as
+ *			"(v - addOffset)/scaleFactor".
+ *	type		The type of the packed integers.
+ *	out		The output packed integers.  Must not overlap "in".
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL; "scaleFactor" is zero;
+ *		or "type" is unknown.
+ *	else	A pointer to the output array.
+ */
+EXTERNL void*
+cv_pack_floats(
+    const cv_converter*		converter,
+    const float* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    const cv_packed_type	type,
+    void*			out);
+
+/*
+ * Converts doubles and packs them into integers in a single pass.  Values are
+ * rounded to the nearest integer (halfway cases away from zero) and limited to
+ * the range of the type.  NaN values are packed as zero.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The values to be converted.
+ *	count		The number of values.
+ *	scaleFactor	The packing scale factor.  Must not be zero.
+ *	addOffset	The packing offset.  A value "v" is packed as
+ *			"(v - addOffset)/scaleFactor".
+ *	type		The type of the packed integers.
+ *	out		The output packed integers.  Must not overlap "in".
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL; "scaleFactor" is zero;
+ *		or "type" is unknown.
+ *	else	A pointer to the output array.
+ */
+EXTERNL void*
+cv_pack_doubles(
+    const cv_converter*		converter,
+    const double* const		in,
+    const size_t		count,
+    const double		scaleFactor,
+    const double		addOffset,
+    const cv_packed_type	type,
+    void*			out);
+
+/*
+ * Converts an array of floats in parallel.  The array is divided into
+ * cache-sized chunks, each of which is converted by a task that's given to an
+ * executor.  The library doesn't create any threads itself.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The values to be converted.
+ *	count		The number of values to be converted.
+ *	out		The output array for the converted values.  May be the
+ *			same array as "in".  If it otherwise overlaps "in",
+ *			then the conversion is serial.
+ *	executor	The executor of the tasks or NULL to convert the
+ *			chunks serially in the calling thread.
+ *	context		The context argument for the executor.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL.
+ *	else	A pointer to the output array.
+ */
+EXTERNL float*
+cv_convert_floats_parallel(
+    const cv_converter*	converter,
+    const float* const	in,
+    const size_t	count,
+    float*		out,
+    const cv_executor	executor,
+    void* const		context);
+
+/*
+ * Converts an array of doubles in parallel.  The array is divided into
+ * cache-sized chunks, each of which is converted by a task that's given to an
+ * executor.  The library doesn't create any threads itself.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The values to be converted.
+ *	count		The number of values to be converted.
+ *	out		The output array for the converted values.  May be the
+ *			same array as "in".  If it otherwise overlaps "in",
+ *			then the conversion is serial.
+ *	executor	The executor of the tasks or NULL to convert the
+ *			chunks serially in the calling thread.
+ *	context		The context argument for the executor.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL.
+ *	else	A pointer to the output array.
+ */
+EXTERNL double*
+cv_convert_doubles_parallel(
+    const cv_converter*	converter,
+    const double* const	in,
+    const size_t	count,
+    double*		out,
+    const cv_executor	executor,
+    void* const		context);
+
+/*
+ * Converts an array of floats, passing missing values through unchanged.  The
+ * test for missing values is part of the conversion loop, so no mask array or
+ * extra pass is needed.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The values to be converted.
+ *	count		The number of values to be converted.
+ *	fillValue	The value that marks missing values (e.g., a netCDF
+ *			"_FillValue"), which are copied to the output array
+ *			unchanged.  If NaN, then NaN values are missing.
+ *	out		The output array for the converted values.  May be the
+ *			same array as "in" or overlap it.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL.
+ *	else	A pointer to the output array.
+ */
+EXTERNL float*
+cv_convert_floats_masked(
+    const cv_converter*	converter,
+    const float* const	in,
+    const size_t	count,
+    const float		fillValue,
+    float*		out);
+
+/*
+ * Converts an array of doubles, passing missing values through unchanged.  The
+ * test for missing values is part of the conversion loop, so no mask array or
+ * extra pass is needed.
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	in		The values to be converted.
+ *	count		The number of values to be converted.
+ *	fillValue	The value that marks missing values (e.g., a netCDF
+ *			"_FillValue"), which are copied to the output array
+ *			unchanged.  If NaN, then NaN values are missing.
+ *	out		The output array for the converted values.  May be the
+ *			same array as "in" or overlap it.
+ * RETURNS:
+ *	NULL	"converter", "in", or "out" is NULL.
+ *	else	A pointer to the output array.
+ */
+EXTERNL double*
+cv_convert_doubles_masked(
+    const cv_converter*	converter,
+    const double* const	in,
+    const size_t	count,
+    const double	fillValue,
+    double*		out);
+
+/*
+ * Serializes a converter into a compact, versioned sequence of bytes that's
+ * independent of the platform, so that the converter can be recreated by
+ * cv_deserialize() in another process (e.g., one without a unit-system).
+ * ARGUMENTS:
+ *	converter	The converter.
+ *	buf		The buffer for the serialized converter or NULL.
+ *	size		The size of the buffer in bytes.
+ * RETURNS:
+ *	0	"converter" is NULL or is a composite converter that's nested
+ *		more than 256 levels deep.
+ *	else	The number of bytes of the serialized converter.  If greater
+ *		than "size", then nothing was written.
+ */
+EXTERNL size_t
+cv_serialize(
+    const cv_converter* const	converter,
+    void* const			buf,
+    const size_t		size);
+
+/*
+ * Returns the converter of a serialized converter (see cv_serialize()).  When
+ * finished with the converter, the client should pass the converter to
+ * cv_free().
+ * ARGUMENTS:
+ *	buf	The serialized converter.
+ *	size	The number of bytes of the serialized converter.
+ * RETURNS:
+ *	NULL	"buf" is NULL, the bytes aren't a serialized converter of a
+ *		supported version, or necessary memory couldn't be allocated.
+ *	else	The converter.
+ */
+EXTERNL cv_converter*
+cv_deserialize(
+    const void* const	buf,
+    const size_t	size);
+
 /*
  * Returns a string representation of a converter.
  * ARGUMENTS:
@@ -228,6 +756,23 @@ cv_get_expression(
     size_t			max,
     const char* const		variable);
 
+/*
+ * Returns the coefficients of a converter that's Galilean (i.e., y = ax + b).
+ * For use within the library only (e.g., by the unit module).
+ * ARGUMENTS:
+ *	conv		The converter.
+ *	slope		The slope.  Set if the converter is Galilean.
+ *	intercept	The intercept.  Set if the converter is Galilean.
+ * RETURNS:
+ *	0	The converter isn't Galilean.
+ *	1	The converter is Galilean.
+ */
+int
+cvGetGalilean(
+    const cv_converter* const	conv,
+    double* const		slope,
+    double* const		intercept);
+
 #ifdef __cplusplus
 }
 #endif
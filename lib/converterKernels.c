@@ -0,0 +1,1800 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ *
+ * The logarithm and exponential are derived from fdlibm's e_log.c and e_exp.c,
+ * which carry the following notice:
+ *
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+ * Array-conversion kernels for the converter module.
+ *
+ * On x86-64 with a GNU-compatible compiler, SSE2, AVX2, and AVX-512F versions
+ * of each kernel are compiled and the best one for the host CPU is selected at
+ * runtime.  Everywhere else, scalar loops are used.
+ *
+ * Every kernel must produce exactly the result of the scalar loop.  Therefore:
+ *
+ *     - Multiplication and addition are never fused (i.e., no FMA).  The
+ *       AVX-512F kernels use the explicit-rounding intrinsics because GCC
+ *       will otherwise contract them into FMA instructions;
+ *
+ *     - Reciprocals use true division rather than an approximation;
+ *
+ *     - Float values are widened to double, converted, and narrowed -- except
+ *       for the reciprocal, which is a float division as in the scalar code.
+ *
+ * The logarithm and exponential are the library's own (adapted from fdlibm's
+ * e_log.c and e_exp.c) so that they can be vectorized.  They use only
+ * operations that every kernel has, in the same order, so they too give
+ * identical results whichever kernel is used.  They can, however, differ from
+ * the C library's log() and pow() (see "converterKernels.h").
+ */
+
+/*LINTLIBRARY*/
+
+#ifndef	_XOPEN_SOURCE
+#   define _XOPEN_SOURCE 500
+#endif
+
+#ifdef _MSC_VER
+#define _USE_MATH_DEFINES
+#endif
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "atomics.h"
+#include "converterKernels.h"	/* this module's API */
+
+#if defined(__x86_64__) && (defined(__clang__) || \
+	(defined(__GNUC__) && (__GNUC__ > 4 || \
+	    (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#   define CK_X86_64	1
+#   include <immintrin.h>
+#   define CK_TARGET(isa)	__attribute__((target(isa)))
+#endif
+
+typedef enum {
+    CK_SCALE,
+    CK_OFFSET,
+    CK_GALILEAN,
+    CK_RECIPROCAL,
+    CK_LOG,		/* log(x) * a */
+    CK_EXP		/* exp(x * (a + b)) with "a" having 26 significant bits */
+} Operation;
+
+/*
+ * Which input values are missing and copied to the output unchanged.
+ */
+typedef enum {
+    CK_UNMASKED,	/* none */
+    CK_FILL,		/* those equal to the fill value */
+    CK_NAN		/* NaN values */
+} Mask;
+
+typedef struct {
+    void	(*convertDoubles)(Operation, double, double, Mask, double,
+		    const double*, size_t, double*);
+    void	(*convertFloats)(Operation, double, double, Mask, double,
+		    const float*, size_t, float*);
+} Kernels;
+
+
+/*******************************************************************************
+ * Logarithm and Exponential:
+ ******************************************************************************/
+
+#define LN2_HI		6.93147180369123816490e-01	/* 32 significant bits */
+#define LN2_LO		1.90821492927058770002e-10
+#define INV_LN2		1.44269504088896338700e+00
+
+/* ln(b) - (double)ln(b) for common bases */
+#define LN2_TAIL	2.3190468138462996e-17
+#define LN10_TAIL	(-2.1707562233822494e-16)
+#define LNE_TAIL	(-5.318237706605891e-17)
+
+/* Coefficients of the logarithm's polynomial */
+#define LG1		6.666666666666735130e-01
+#define LG2		3.999999999940941908e-01
+#define LG3		2.857142874366239149e-01
+#define LG4		2.222219843214978396e-01
+#define LG5		1.818357216161805012e-01
+#define LG6		1.531383769920937332e-01
+#define LG7		1.479819860511658591e-01
+
+/* Coefficients of the exponential's polynomial */
+#define P1		1.66666666666666019037e-01
+#define P2		(-2.77777777770155933842e-03)
+#define P3		6.61375632143793436117e-05
+#define P4		(-1.65339022054652515390e-06)
+#define P5		4.13813679705723846039e-08
+
+/*
+ * Adding ROUNDER to a number of magnitude less than 2^51 rounds it to an
+ * integer, which is then the difference between the bits of the sum and those
+ * of ROUNDER.
+ */
+#define ROUNDER		0x1.8p52
+
+#define SMALLEST_NORMAL	0x1p-1022
+#define SUBNORMAL_SCALE	0x1p54
+/* Moves the logarithm's reduced argument into [sqrt(2)/2, sqrt(2)) */
+#define LOG_SHIFT	UINT64_C(0x00095f6200000000)
+#define LOG_BASE	UINT64_C(0x3fe6a09e00000000)
+#define MANTISSA_MASK	UINT64_C(0x000fffffffffffff)
+#define EXPONENT_BIAS	UINT64_C(0x4330000000000000)	/* bits of 2^52 */
+#define HIGH_26_MASK	UINT64_C(0xfffffffff8000000)
+#define QUIET_NAN	UINT64_C(0x7ff8000000000000)
+
+/* Bounds of the exponential's argument */
+#define EXP_CLAMP	800.0
+#define EXP_OVERFLOW	710.0
+#define EXP_UNDERFLOW	(-746.0)
+
+
+static double
+asDouble(
+    const uint64_t	bits)
+{
+    double	value;
+
+    (void)memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+
+static uint64_t
+asBits(
+    const double	value)
+{
+    uint64_t	bits;
+
+    (void)memcpy(&bits, &value, sizeof(bits));
+
+    return bits;
+}
+
+
+/*
+ * Returns the parameters of the CK_EXP operation for a given base: "a" is
+ * ln(base) to 26 significant bits, so that its product with the high half of
+ * an argument is exact, and "b" is the rest of ln(base) to more than double
+ * precision.
+ *
+ * Arguments:
+ *	base	The base.  Must be positive.
+ *	a	Pointer to the high part of ln(base).
+ *	b	Pointer to the low part of ln(base).
+ */
+static void
+getExpParameters(
+    const double	base,
+    double* const	a,
+    double* const	b)
+{
+    const long double	lnb = logl(base);
+    const double	ln = log(base);
+    const double	tail =
+	base == 10
+	    ? LN10_TAIL
+	    : base == 2
+		? LN2_TAIL
+		: base == M_E
+		    ? LNE_TAIL
+		    : (double)(lnb - ln);
+
+    *a = asDouble(asBits(ln) & HIGH_26_MASK);
+    *b = (ln - *a) + tail;
+}
+
+
+/*
+ * Returns the natural logarithm of a value.  The argument is reduced to
+ * 2^k * (1 + f) with 1 + f in [sqrt(2)/2, sqrt(2)) and log(1 + f) is
+ * approximated by a polynomial in s = f / (2 + f).  See "converterKernels.h"
+ * for the accuracy.
+ */
+static double
+scalarLog(
+    const double	x)
+{
+    const int		tiny = x < SMALLEST_NORMAL;
+    const double	xn = tiny ? x * SUBNORMAL_SCALE : x;
+    const uint64_t	u = asBits(xn) + LOG_SHIFT;
+    const double	k = (asDouble((u >> 52) | EXPONENT_BIAS) -
+			    (0x1p52 + 1023.0)) + (tiny ? -54.0 : 0.0);
+    const double	f = asDouble((u & MANTISSA_MASK) + LOG_BASE) - 1.0;
+    const double	hfsq = 0.5 * f * f;
+    const double	s = f / (2.0 + f);
+    const double	z = s * s;
+    const double	w = z * z;
+    const double	r = z * (LG1 + w * (LG3 + w * (LG5 + w * LG7))) +
+			    w * (LG2 + w * (LG4 + w * LG6));
+    double		y = k * LN2_HI - ((hfsq - (s * (hfsq + r) +
+			    k * LN2_LO)) - f);
+
+    if (!(x < HUGE_VAL))
+	y = x;				/* +Inf or NaN */
+    if (x == 0)
+	y = -HUGE_VAL;
+    if (x < 0)
+	y = asDouble(QUIET_NAN);
+
+    return y;
+}
+
+
+/*
+ * Returns exp(x * (a + b)).  The product is reduced to k*ln(2) + r with |r|
+ * <= ln(2)/2, where r is computed from the exact product of the high halves of
+ * x and "a", and exp(r) is approximated by a rational function.  See
+ * "converterKernels.h" for the accuracy.
+ */
+static double
+scalarExp(
+    const double	a,
+    const double	b,
+    const double	x)
+{
+    const double	y = x * (a + b);
+    const double	yc = y < -EXP_CLAMP
+			    ? -EXP_CLAMP
+			    : y > EXP_CLAMP ? EXP_CLAMP : y;
+    const double	t = yc * INV_LN2 + ROUNDER;
+    const double	kd = t - ROUNDER;
+    const double	xh = asDouble(asBits(x) & HIGH_26_MASK);
+    const double	xl = x - xh;
+    const double	hi = xh * a - kd * LN2_HI;
+    const double	nlo = kd * LN2_LO - (xl * a + x * b);
+    const double	r = hi - nlo;
+    const double	rr = r * r;
+    const double	c = r - rr * (P1 + rr * (P2 + rr * (P3 + rr * (P4 +
+			    rr * P5))));
+    const double	p = 1.0 - ((nlo - (r * c) / (2.0 - c)) - hi);
+    /* 2^k is applied as 2^k1 * 2^k2 so that both factors are normal */
+    const uint64_t	ki = asBits(t) - asBits(ROUNDER);
+    const uint64_t	h = (ki + 2048) >> 1;	/* k1 + 1024 */
+    double		z = p * asDouble((h - 1) << 52) *
+			    asDouble((ki - h + 2047) << 52);
+
+    if (y > EXP_OVERFLOW)
+	z = HUGE_VAL;
+    if (y < EXP_UNDERFLOW)
+	z = 0.0;
+
+    return z;
+}
+
+
+
+/*******************************************************************************
+ * Scalar Kernels:
+ ******************************************************************************/
+
+static double
+scalarApply(
+    const Operation	op,
+    const double	a,
+    const double	b,
+    const double	x)
+{
+    switch (op) {
+    case CK_SCALE:
+	return a * x;
+    case CK_OFFSET:
+	return a + x;
+    case CK_GALILEAN:
+	return a * x + b;
+    case CK_LOG:
+	return scalarLog(x) * a;
+    case CK_EXP:
+	return scalarExp(a, b, x);
+    default:
+	return 1.0 / x;
+    }
+}
+
+
+/*
+ * Indicates if an input value is missing.
+ */
+static int
+isMissing(
+    const Mask		mask,
+    const double	fill,
+    const double	x)
+{
+    return mask == CK_FILL
+	? x == fill
+	: mask == CK_NAN && x != x;
+}
+
+
+static float
+scalarApplyFloat(
+    const Operation	op,
+    const double	a,
+    const double	b,
+    const float		x)
+{
+    return op == CK_RECIPROCAL
+	? 1.0f / x
+	: (float)scalarApply(op, a, b, x);
+}
+
+
+static void
+scalarConvertDoubles(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    size_t	i;
+
+    if (in < out) {
+	for (i = count; i-- > 0;)
+	    out[i] = isMissing(mask, fill, in[i])
+		? in[i]
+		: scalarApply(op, a, b, in[i]);
+    }
+    else {
+	for (i = 0; i < count; i++)
+	    out[i] = isMissing(mask, fill, in[i])
+		? in[i]
+		: scalarApply(op, a, b, in[i]);
+    }
+}
+
+
+static void
+scalarConvertFloats(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    size_t	i;
+
+    if (in < out) {
+	for (i = count; i-- > 0;)
+	    out[i] = isMissing(mask, fill, in[i])
+		? in[i]
+		: scalarApplyFloat(op, a, b, in[i]);
+    }
+    else {
+	for (i = 0; i < count; i++)
+	    out[i] = isMissing(mask, fill, in[i])
+		? in[i]
+		: scalarApplyFloat(op, a, b, in[i]);
+    }
+}
+
+
+#ifdef CK_X86_64
+
+/*
+ * In the vector kernels below, each chunk of values is loaded before it is
+ * stored.  If the output array follows the input array, then the chunks are
+ * processed from last to first so that unconverted input values aren't
+ * overwritten; otherwise, they're processed from first to last.  Any leftover
+ * values are handled by the scalar kernel, which follows the same rule.
+ */
+
+/*******************************************************************************
+ * SSE2 Kernels:
+ ******************************************************************************/
+
+/*
+ * Returns, for each element, "b" where "mask" is set and "a" elsewhere.
+ */
+static __m128d
+sse2Select(
+    const __m128d	mask,
+    const __m128d	a,
+    const __m128d	b)
+{
+    return _mm_or_pd(_mm_and_pd(mask, b), _mm_andnot_pd(mask, a));
+}
+
+
+/*
+ * Vector version of scalarLog().
+ */
+static __m128d
+sse2Log(
+    const __m128d	x)
+{
+    const __m128d	tiny = _mm_cmplt_pd(x, _mm_set1_pd(SMALLEST_NORMAL));
+    const __m128d	xn = sse2Select(tiny, x,
+			    _mm_mul_pd(x, _mm_set1_pd(SUBNORMAL_SCALE)));
+    const __m128i	u = _mm_add_epi64(_mm_castpd_si128(xn),
+			    _mm_set1_epi64x(LOG_SHIFT));
+    const __m128d	k = _mm_add_pd(_mm_sub_pd(
+			    _mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(u, 52),
+				_mm_set1_epi64x(EXPONENT_BIAS))),
+			    _mm_set1_pd(0x1p52 + 1023.0)),
+			    _mm_and_pd(tiny, _mm_set1_pd(-54.0)));
+    const __m128d	f = _mm_sub_pd(_mm_castsi128_pd(_mm_add_epi64(
+			    _mm_and_si128(u, _mm_set1_epi64x(MANTISSA_MASK)),
+			    _mm_set1_epi64x(LOG_BASE))), _mm_set1_pd(1.0));
+    const __m128d	hfsq = _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(0.5), f), f);
+    const __m128d	s = _mm_div_pd(f, _mm_add_pd(_mm_set1_pd(2.0), f));
+    const __m128d	z = _mm_mul_pd(s, s);
+    const __m128d	w = _mm_mul_pd(z, z);
+    __m128d		r1 = _mm_add_pd(_mm_set1_pd(LG5),
+			    _mm_mul_pd(w, _mm_set1_pd(LG7)));
+    __m128d		r2 = _mm_add_pd(_mm_set1_pd(LG4),
+			    _mm_mul_pd(w, _mm_set1_pd(LG6)));
+    __m128d		y;
+
+    r1 = _mm_add_pd(_mm_set1_pd(LG3), _mm_mul_pd(w, r1));
+    r1 = _mm_mul_pd(z, _mm_add_pd(_mm_set1_pd(LG1), _mm_mul_pd(w, r1)));
+    r2 = _mm_mul_pd(w, _mm_add_pd(_mm_set1_pd(LG2), _mm_mul_pd(w, r2)));
+    r1 = _mm_add_pd(r1, r2);
+    y = _mm_sub_pd(_mm_mul_pd(k, _mm_set1_pd(LN2_HI)),
+	_mm_sub_pd(_mm_sub_pd(hfsq,
+	    _mm_add_pd(_mm_mul_pd(s, _mm_add_pd(hfsq, r1)),
+		_mm_mul_pd(k, _mm_set1_pd(LN2_LO)))), f));
+
+    y = sse2Select(_mm_cmpnlt_pd(x, _mm_set1_pd(HUGE_VAL)), y, x);
+    y = sse2Select(_mm_cmpeq_pd(x, _mm_setzero_pd()), y,
+	_mm_set1_pd(-HUGE_VAL));
+    y = sse2Select(_mm_cmplt_pd(x, _mm_setzero_pd()), y,
+	_mm_castsi128_pd(_mm_set1_epi64x(QUIET_NAN)));
+
+    return y;
+}
+
+
+/*
+ * Vector version of scalarExp().
+ */
+static __m128d
+sse2Exp(
+    const __m128d	a,
+    const __m128d	b,
+    const __m128d	x)
+{
+    const __m128d	y = _mm_mul_pd(x, _mm_add_pd(a, b));
+    const __m128d	yc = _mm_min_pd(_mm_set1_pd(EXP_CLAMP),
+			    _mm_max_pd(_mm_set1_pd(-EXP_CLAMP), y));
+    const __m128d	t = _mm_add_pd(_mm_mul_pd(yc, _mm_set1_pd(INV_LN2)),
+			    _mm_set1_pd(ROUNDER));
+    const __m128d	kd = _mm_sub_pd(t, _mm_set1_pd(ROUNDER));
+    const __m128d	xh = _mm_and_pd(x,
+			    _mm_castsi128_pd(_mm_set1_epi64x(HIGH_26_MASK)));
+    const __m128d	xl = _mm_sub_pd(x, xh);
+    const __m128d	hi = _mm_sub_pd(_mm_mul_pd(xh, a),
+			    _mm_mul_pd(kd, _mm_set1_pd(LN2_HI)));
+    const __m128d	nlo = _mm_sub_pd(_mm_mul_pd(kd, _mm_set1_pd(LN2_LO)),
+			    _mm_add_pd(_mm_mul_pd(xl, a), _mm_mul_pd(x, b)));
+    const __m128d	r = _mm_sub_pd(hi, nlo);
+    const __m128d	rr = _mm_mul_pd(r, r);
+    const __m128i	ki = _mm_sub_epi64(_mm_castpd_si128(t),
+			    _mm_castpd_si128(_mm_set1_pd(ROUNDER)));
+    const __m128i	h = _mm_srli_epi64(_mm_add_epi64(ki,
+			    _mm_set1_epi64x(2048)), 1);
+    __m128d		c = _mm_add_pd(_mm_set1_pd(P4),
+			    _mm_mul_pd(rr, _mm_set1_pd(P5)));
+    __m128d		z;
+
+    c = _mm_add_pd(_mm_set1_pd(P3), _mm_mul_pd(rr, c));
+    c = _mm_add_pd(_mm_set1_pd(P2), _mm_mul_pd(rr, c));
+    c = _mm_sub_pd(r, _mm_mul_pd(rr,
+	_mm_add_pd(_mm_set1_pd(P1), _mm_mul_pd(rr, c))));
+    z = _mm_sub_pd(_mm_set1_pd(1.0), _mm_sub_pd(_mm_sub_pd(nlo,
+	_mm_div_pd(_mm_mul_pd(r, c), _mm_sub_pd(_mm_set1_pd(2.0), c))), hi));
+    z = _mm_mul_pd(_mm_mul_pd(z, _mm_castsi128_pd(_mm_slli_epi64(
+	_mm_sub_epi64(h, _mm_set1_epi64x(1)), 52))),
+	_mm_castsi128_pd(_mm_slli_epi64(_mm_add_epi64(_mm_sub_epi64(ki, h),
+	    _mm_set1_epi64x(2047)), 52)));
+
+    z = sse2Select(_mm_cmpgt_pd(y, _mm_set1_pd(EXP_OVERFLOW)), z,
+	_mm_set1_pd(HUGE_VAL));
+    z = sse2Select(_mm_cmplt_pd(y, _mm_set1_pd(EXP_UNDERFLOW)), z,
+	_mm_setzero_pd());
+
+    return z;
+}
+
+
+static __m128d
+sse2Apply(
+    const Operation	op,
+    const __m128d	a,
+    const __m128d	b,
+    const __m128d	x)
+{
+    switch (op) {
+    case CK_SCALE:
+	return _mm_mul_pd(a, x);
+    case CK_OFFSET:
+	return _mm_add_pd(a, x);
+    case CK_GALILEAN:
+	return _mm_add_pd(_mm_mul_pd(a, x), b);
+    case CK_LOG:
+	return _mm_mul_pd(sse2Log(x), a);
+    case CK_EXP:
+	return sse2Exp(a, b, x);
+    default:
+	return _mm_div_pd(_mm_set1_pd(1.0), x);
+    }
+}
+
+
+static __m128
+sse2ApplyFloats(
+    const Operation	op,
+    const __m128d	a,
+    const __m128d	b,
+    const __m128	x)
+{
+    __m128	y;
+
+    if (op == CK_RECIPROCAL) {
+	y = _mm_div_ps(_mm_set1_ps(1.0f), x);
+    }
+    else {
+	const __m128	lo = _mm_cvtpd_ps(sse2Apply(op, a, b, _mm_cvtps_pd(x)));
+	const __m128	hi = _mm_cvtpd_ps(sse2Apply(op, a, b,
+	    _mm_cvtps_pd(_mm_movehl_ps(x, x))));
+
+	y = _mm_movelh_ps(lo, hi);
+    }
+
+    return y;
+}
+
+
+/*
+ * Returns the conversion of "x" with missing values passed through.
+ */
+static __m128d
+sse2ApplyMasked(
+    const Operation	op,
+    const __m128d	a,
+    const __m128d	b,
+    const Mask		mask,
+    const __m128d	fill,
+    const __m128d	x)
+{
+    const __m128d	y = sse2Apply(op, a, b, x);
+
+    return mask == CK_UNMASKED
+	? y
+	: sse2Select(mask == CK_FILL
+	    ? _mm_cmpeq_pd(x, fill)
+	    : _mm_cmpunord_pd(x, x), y, x);
+}
+
+
+static __m128
+sse2ApplyFloatsMasked(
+    const Operation	op,
+    const __m128d	a,
+    const __m128d	b,
+    const Mask		mask,
+    const __m128	fill,
+    const __m128	x)
+{
+    __m128	y = sse2ApplyFloats(op, a, b, x);
+
+    if (mask != CK_UNMASKED) {
+	const __m128	missing = mask == CK_FILL
+	    ? _mm_cmpeq_ps(x, fill)
+	    : _mm_cmpunord_ps(x, x);
+
+	y = _mm_or_ps(_mm_and_ps(missing, x), _mm_andnot_ps(missing, y));
+    }
+
+    return y;
+}
+
+
+static void
+sse2ConvertDoubles(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    const __m128d	va = _mm_set1_pd(a);
+    const __m128d	vb = _mm_set1_pd(b);
+    const __m128d	vfill = _mm_set1_pd(fill);
+    size_t		i;
+
+    if (in < out) {
+	for (i = count; i >= 2;) {
+	    i -= 2;
+	    _mm_storeu_pd(out + i, sse2ApplyMasked(op, va, vb, mask, vfill,
+		_mm_loadu_pd(in + i)));
+	}
+	scalarConvertDoubles(op, a, b, mask, fill, in, i, out);
+    }
+    else {
+	for (i = 0; count - i >= 2; i += 2)
+	    _mm_storeu_pd(out + i, sse2ApplyMasked(op, va, vb, mask, vfill,
+		_mm_loadu_pd(in + i)));
+	scalarConvertDoubles(op, a, b, mask, fill, in + i, count - i, out + i);
+    }
+}
+
+
+static void
+sse2ConvertFloats(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    const __m128d	va = _mm_set1_pd(a);
+    const __m128d	vb = _mm_set1_pd(b);
+    const __m128	vfill = _mm_set1_ps((float)fill);
+    size_t		i;
+
+    if (in < out) {
+	for (i = count; i >= 4;) {
+	    i -= 4;
+	    _mm_storeu_ps(out + i,
+		sse2ApplyFloatsMasked(op, va, vb, mask, vfill,
+		    _mm_loadu_ps(in + i)));
+	}
+	scalarConvertFloats(op, a, b, mask, fill, in, i, out);
+    }
+    else {
+	for (i = 0; count - i >= 4; i += 4)
+	    _mm_storeu_ps(out + i,
+		sse2ApplyFloatsMasked(op, va, vb, mask, vfill,
+		    _mm_loadu_ps(in + i)));
+	scalarConvertFloats(op, a, b, mask, fill, in + i, count - i, out + i);
+    }
+}
+
+
+/*******************************************************************************
+ * AVX2 Kernels:
+ ******************************************************************************/
+
+/*
+ * Returns, for each element, "b" where "mask" is set and "a" elsewhere.
+ */
+CK_TARGET("avx2") static __m256d
+avx2Select(
+    const __m256d	mask,
+    const __m256d	a,
+    const __m256d	b)
+{
+    return _mm256_blendv_pd(a, b, mask);
+}
+
+
+/*
+ * Vector version of scalarLog().
+ */
+CK_TARGET("avx2") static __m256d
+avx2Log(
+    const __m256d	x)
+{
+    const __m256d	tiny = _mm256_cmp_pd(x,
+			    _mm256_set1_pd(SMALLEST_NORMAL), _CMP_LT_OQ);
+    const __m256d	xn = avx2Select(tiny, x,
+			    _mm256_mul_pd(x, _mm256_set1_pd(SUBNORMAL_SCALE)));
+    const __m256i	u = _mm256_add_epi64(_mm256_castpd_si256(xn),
+			    _mm256_set1_epi64x(LOG_SHIFT));
+    const __m256d	k = _mm256_add_pd(_mm256_sub_pd(
+			    _mm256_castsi256_pd(_mm256_or_si256(
+				_mm256_srli_epi64(u, 52),
+				_mm256_set1_epi64x(EXPONENT_BIAS))),
+			    _mm256_set1_pd(0x1p52 + 1023.0)),
+			    _mm256_and_pd(tiny, _mm256_set1_pd(-54.0)));
+    const __m256d	f = _mm256_sub_pd(_mm256_castsi256_pd(
+			    _mm256_add_epi64(_mm256_and_si256(u,
+				    _mm256_set1_epi64x(MANTISSA_MASK)),
+				_mm256_set1_epi64x(LOG_BASE))),
+			    _mm256_set1_pd(1.0));
+    const __m256d	hfsq = _mm256_mul_pd(
+			    _mm256_mul_pd(_mm256_set1_pd(0.5), f), f);
+    const __m256d	s = _mm256_div_pd(f,
+			    _mm256_add_pd(_mm256_set1_pd(2.0), f));
+    const __m256d	z = _mm256_mul_pd(s, s);
+    const __m256d	w = _mm256_mul_pd(z, z);
+    __m256d		r1 = _mm256_add_pd(_mm256_set1_pd(LG5),
+			    _mm256_mul_pd(w, _mm256_set1_pd(LG7)));
+    __m256d		r2 = _mm256_add_pd(_mm256_set1_pd(LG4),
+			    _mm256_mul_pd(w, _mm256_set1_pd(LG6)));
+    __m256d		y;
+
+    r1 = _mm256_add_pd(_mm256_set1_pd(LG3), _mm256_mul_pd(w, r1));
+    r1 = _mm256_mul_pd(z,
+	_mm256_add_pd(_mm256_set1_pd(LG1), _mm256_mul_pd(w, r1)));
+    r2 = _mm256_mul_pd(w,
+	_mm256_add_pd(_mm256_set1_pd(LG2), _mm256_mul_pd(w, r2)));
+    r1 = _mm256_add_pd(r1, r2);
+    y = _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(LN2_HI)),
+	_mm256_sub_pd(_mm256_sub_pd(hfsq,
+	    _mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(hfsq, r1)),
+		_mm256_mul_pd(k, _mm256_set1_pd(LN2_LO)))), f));
+
+    y = avx2Select(_mm256_cmp_pd(x, _mm256_set1_pd(HUGE_VAL), _CMP_NLT_UQ),
+	y, x);
+    y = avx2Select(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ), y,
+	_mm256_set1_pd(-HUGE_VAL));
+    y = avx2Select(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ), y,
+	_mm256_castsi256_pd(_mm256_set1_epi64x(QUIET_NAN)));
+
+    return y;
+}
+
+
+/*
+ * Vector version of scalarExp().
+ */
+CK_TARGET("avx2") static __m256d
+avx2Exp(
+    const __m256d	a,
+    const __m256d	b,
+    const __m256d	x)
+{
+    const __m256d	y = _mm256_mul_pd(x, _mm256_add_pd(a, b));
+    const __m256d	yc = _mm256_min_pd(_mm256_set1_pd(EXP_CLAMP),
+			    _mm256_max_pd(_mm256_set1_pd(-EXP_CLAMP), y));
+    const __m256d	t = _mm256_add_pd(
+			    _mm256_mul_pd(yc, _mm256_set1_pd(INV_LN2)),
+			    _mm256_set1_pd(ROUNDER));
+    const __m256d	kd = _mm256_sub_pd(t, _mm256_set1_pd(ROUNDER));
+    const __m256d	xh = _mm256_and_pd(x, _mm256_castsi256_pd(
+			    _mm256_set1_epi64x(HIGH_26_MASK)));
+    const __m256d	xl = _mm256_sub_pd(x, xh);
+    const __m256d	hi = _mm256_sub_pd(_mm256_mul_pd(xh, a),
+			    _mm256_mul_pd(kd, _mm256_set1_pd(LN2_HI)));
+    const __m256d	nlo = _mm256_sub_pd(
+			    _mm256_mul_pd(kd, _mm256_set1_pd(LN2_LO)),
+			    _mm256_add_pd(_mm256_mul_pd(xl, a),
+				_mm256_mul_pd(x, b)));
+    const __m256d	r = _mm256_sub_pd(hi, nlo);
+    const __m256d	rr = _mm256_mul_pd(r, r);
+    const __m256i	ki = _mm256_sub_epi64(_mm256_castpd_si256(t),
+			    _mm256_castpd_si256(_mm256_set1_pd(ROUNDER)));
+    const __m256i	h = _mm256_srli_epi64(_mm256_add_epi64(ki,
+			    _mm256_set1_epi64x(2048)), 1);
+    __m256d		c = _mm256_add_pd(_mm256_set1_pd(P4),
+			    _mm256_mul_pd(rr, _mm256_set1_pd(P5)));
+    __m256d		z;
+
+    c = _mm256_add_pd(_mm256_set1_pd(P3), _mm256_mul_pd(rr, c));
+    c = _mm256_add_pd(_mm256_set1_pd(P2), _mm256_mul_pd(rr, c));
+    c = _mm256_sub_pd(r, _mm256_mul_pd(rr,
+	_mm256_add_pd(_mm256_set1_pd(P1), _mm256_mul_pd(rr, c))));
+    z = _mm256_sub_pd(_mm256_set1_pd(1.0),
+	_mm256_sub_pd(_mm256_sub_pd(nlo, _mm256_div_pd(_mm256_mul_pd(r, c),
+	    _mm256_sub_pd(_mm256_set1_pd(2.0), c))), hi));
+    z = _mm256_mul_pd(_mm256_mul_pd(z,
+	_mm256_castsi256_pd(_mm256_slli_epi64(
+	    _mm256_sub_epi64(h, _mm256_set1_epi64x(1)), 52))),
+	_mm256_castsi256_pd(_mm256_slli_epi64(
+	    _mm256_add_epi64(_mm256_sub_epi64(ki, h),
+		_mm256_set1_epi64x(2047)), 52)));
+
+    z = avx2Select(
+	_mm256_cmp_pd(y, _mm256_set1_pd(EXP_OVERFLOW), _CMP_GT_OQ), z,
+	_mm256_set1_pd(HUGE_VAL));
+    z = avx2Select(
+	_mm256_cmp_pd(y, _mm256_set1_pd(EXP_UNDERFLOW), _CMP_LT_OQ), z,
+	_mm256_setzero_pd());
+
+    return z;
+}
+
+
+CK_TARGET("avx2") static __m256d
+avx2Apply(
+    const Operation	op,
+    const __m256d	a,
+    const __m256d	b,
+    const __m256d	x)
+{
+    switch (op) {
+    case CK_SCALE:
+	return _mm256_mul_pd(a, x);
+    case CK_OFFSET:
+	return _mm256_add_pd(a, x);
+    case CK_GALILEAN:
+	return _mm256_add_pd(_mm256_mul_pd(a, x), b);
+    case CK_LOG:
+	return _mm256_mul_pd(avx2Log(x), a);
+    case CK_EXP:
+	return avx2Exp(a, b, x);
+    default:
+	return _mm256_div_pd(_mm256_set1_pd(1.0), x);
+    }
+}
+
+
+CK_TARGET("avx2") static __m256
+avx2ApplyFloats(
+    const Operation	op,
+    const __m256d	a,
+    const __m256d	b,
+    const __m256	x)
+{
+    __m256	y;
+
+    if (op == CK_RECIPROCAL) {
+	y = _mm256_div_ps(_mm256_set1_ps(1.0f), x);
+    }
+    else {
+	const __m128	lo = _mm256_cvtpd_ps(avx2Apply(op, a, b,
+	    _mm256_cvtps_pd(_mm256_castps256_ps128(x))));
+	const __m128	hi = _mm256_cvtpd_ps(avx2Apply(op, a, b,
+	    _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1))));
+
+	y = _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+
+    return y;
+}
+
+
+/*
+ * Returns the conversion of "x" with missing values passed through.
+ */
+CK_TARGET("avx2") static __m256d
+avx2ApplyMasked(
+    const Operation	op,
+    const __m256d	a,
+    const __m256d	b,
+    const Mask		mask,
+    const __m256d	fill,
+    const __m256d	x)
+{
+    const __m256d	y = avx2Apply(op, a, b, x);
+
+    return mask == CK_UNMASKED
+	? y
+	: avx2Select(mask == CK_FILL
+	    ? _mm256_cmp_pd(x, fill, _CMP_EQ_OQ)
+	    : _mm256_cmp_pd(x, x, _CMP_UNORD_Q), y, x);
+}
+
+
+CK_TARGET("avx2") static __m256
+avx2ApplyFloatsMasked(
+    const Operation	op,
+    const __m256d	a,
+    const __m256d	b,
+    const Mask		mask,
+    const __m256	fill,
+    const __m256	x)
+{
+    const __m256	y = avx2ApplyFloats(op, a, b, x);
+
+    return mask == CK_UNMASKED
+	? y
+	: _mm256_blendv_ps(y, x, mask == CK_FILL
+	    ? _mm256_cmp_ps(x, fill, _CMP_EQ_OQ)
+	    : _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+}
+
+
+CK_TARGET("avx2") static void
+avx2ConvertDoubles(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    const __m256d	va = _mm256_set1_pd(a);
+    const __m256d	vb = _mm256_set1_pd(b);
+    const __m256d	vfill = _mm256_set1_pd(fill);
+    size_t		i;
+
+    if (in < out) {
+	for (i = count; i >= 4;) {
+	    i -= 4;
+	    _mm256_storeu_pd(out + i,
+		avx2ApplyMasked(op, va, vb, mask, vfill,
+		    _mm256_loadu_pd(in + i)));
+	}
+	scalarConvertDoubles(op, a, b, mask, fill, in, i, out);
+    }
+    else {
+	for (i = 0; count - i >= 4; i += 4)
+	    _mm256_storeu_pd(out + i,
+		avx2ApplyMasked(op, va, vb, mask, vfill,
+		    _mm256_loadu_pd(in + i)));
+	scalarConvertDoubles(op, a, b, mask, fill, in + i, count - i, out + i);
+    }
+}
+
+
+CK_TARGET("avx2") static void
+avx2ConvertFloats(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    const __m256d	va = _mm256_set1_pd(a);
+    const __m256d	vb = _mm256_set1_pd(b);
+    const __m256	vfill = _mm256_set1_ps((float)fill);
+    size_t		i;
+
+    if (in < out) {
+	for (i = count; i >= 8;) {
+	    i -= 8;
+	    _mm256_storeu_ps(out + i,
+		avx2ApplyFloatsMasked(op, va, vb, mask, vfill,
+		    _mm256_loadu_ps(in + i)));
+	}
+	scalarConvertFloats(op, a, b, mask, fill, in, i, out);
+    }
+    else {
+	for (i = 0; count - i >= 8; i += 8)
+	    _mm256_storeu_ps(out + i,
+		avx2ApplyFloatsMasked(op, va, vb, mask, vfill,
+		    _mm256_loadu_ps(in + i)));
+	scalarConvertFloats(op, a, b, mask, fill, in + i, count - i, out + i);
+    }
+}
+
+
+/*******************************************************************************
+ * AVX-512F Kernels:
+ *
+ * Leftover values are converted by a single masked operation rather than by
+ * the scalar kernel, which the compiler could otherwise inline and contract.
+ ******************************************************************************/
+
+#define CK_ROUND	_MM_FROUND_CUR_DIRECTION
+
+/*
+ * Vector version of scalarLog().
+ */
+CK_TARGET("avx512f") static __m512d
+avx512Log(
+    const __m512d	x)
+{
+    const __mmask8	tiny = _mm512_cmp_pd_mask(x,
+			    _mm512_set1_pd(SMALLEST_NORMAL), _CMP_LT_OQ);
+    const __m512d	xn = _mm512_mask_blend_pd(tiny, x, _mm512_mul_round_pd(x,
+			    _mm512_set1_pd(SUBNORMAL_SCALE), CK_ROUND));
+    const __m512i	u = _mm512_add_epi64(_mm512_castpd_si512(xn),
+			    _mm512_set1_epi64(LOG_SHIFT));
+    const __m512d	k = _mm512_add_round_pd(_mm512_sub_round_pd(
+			    _mm512_castsi512_pd(_mm512_or_epi64(
+				_mm512_srli_epi64(u, 52),
+				_mm512_set1_epi64(EXPONENT_BIAS))),
+			    _mm512_set1_pd(0x1p52 + 1023.0), CK_ROUND),
+			    _mm512_maskz_mov_pd(tiny, _mm512_set1_pd(-54.0)),
+			    CK_ROUND);
+    const __m512d	f = _mm512_sub_round_pd(_mm512_castsi512_pd(
+			    _mm512_add_epi64(_mm512_and_epi64(u,
+				    _mm512_set1_epi64(MANTISSA_MASK)),
+				_mm512_set1_epi64(LOG_BASE))),
+			    _mm512_set1_pd(1.0), CK_ROUND);
+    const __m512d	hfsq = _mm512_mul_round_pd(_mm512_mul_round_pd(
+			    _mm512_set1_pd(0.5), f, CK_ROUND), f, CK_ROUND);
+    const __m512d	s = _mm512_div_round_pd(f, _mm512_add_round_pd(
+			    _mm512_set1_pd(2.0), f, CK_ROUND), CK_ROUND);
+    const __m512d	z = _mm512_mul_round_pd(s, s, CK_ROUND);
+    const __m512d	w = _mm512_mul_round_pd(z, z, CK_ROUND);
+    __m512d		r1 = _mm512_add_round_pd(_mm512_set1_pd(LG5),
+			    _mm512_mul_round_pd(w, _mm512_set1_pd(LG7),
+				CK_ROUND), CK_ROUND);
+    __m512d		r2 = _mm512_add_round_pd(_mm512_set1_pd(LG4),
+			    _mm512_mul_round_pd(w, _mm512_set1_pd(LG6),
+				CK_ROUND), CK_ROUND);
+    __m512d		y;
+
+    r1 = _mm512_add_round_pd(_mm512_set1_pd(LG3),
+	_mm512_mul_round_pd(w, r1, CK_ROUND), CK_ROUND);
+    r1 = _mm512_mul_round_pd(z, _mm512_add_round_pd(_mm512_set1_pd(LG1),
+	_mm512_mul_round_pd(w, r1, CK_ROUND), CK_ROUND), CK_ROUND);
+    r2 = _mm512_mul_round_pd(w, _mm512_add_round_pd(_mm512_set1_pd(LG2),
+	_mm512_mul_round_pd(w, r2, CK_ROUND), CK_ROUND), CK_ROUND);
+    r1 = _mm512_add_round_pd(r1, r2, CK_ROUND);
+    y = _mm512_sub_round_pd(
+	_mm512_mul_round_pd(k, _mm512_set1_pd(LN2_HI), CK_ROUND),
+	_mm512_sub_round_pd(_mm512_sub_round_pd(hfsq, _mm512_add_round_pd(
+		_mm512_mul_round_pd(s, _mm512_add_round_pd(hfsq, r1, CK_ROUND),
+		    CK_ROUND),
+		_mm512_mul_round_pd(k, _mm512_set1_pd(LN2_LO), CK_ROUND),
+		CK_ROUND), CK_ROUND),
+	    f, CK_ROUND),
+	CK_ROUND);
+
+    y = _mm512_mask_blend_pd(
+	_mm512_cmp_pd_mask(x, _mm512_set1_pd(HUGE_VAL), _CMP_NLT_UQ), y, x);
+    y = _mm512_mask_blend_pd(
+	_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OQ), y,
+	_mm512_set1_pd(-HUGE_VAL));
+    y = _mm512_mask_blend_pd(
+	_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_LT_OQ), y,
+	_mm512_castsi512_pd(_mm512_set1_epi64(QUIET_NAN)));
+
+    return y;
+}
+
+
+/*
+ * Vector version of scalarExp().
+ */
+CK_TARGET("avx512f") static __m512d
+avx512Exp(
+    const __m512d	a,
+    const __m512d	b,
+    const __m512d	x)
+{
+    const __m512d	y = _mm512_mul_round_pd(x,
+			    _mm512_add_round_pd(a, b, CK_ROUND), CK_ROUND);
+    const __m512d	yc = _mm512_min_pd(_mm512_set1_pd(EXP_CLAMP),
+			    _mm512_max_pd(_mm512_set1_pd(-EXP_CLAMP), y));
+    const __m512d	t = _mm512_add_round_pd(_mm512_mul_round_pd(yc,
+			    _mm512_set1_pd(INV_LN2), CK_ROUND),
+			    _mm512_set1_pd(ROUNDER), CK_ROUND);
+    const __m512d	kd = _mm512_sub_round_pd(t, _mm512_set1_pd(ROUNDER),
+			    CK_ROUND);
+    const __m512d	xh = _mm512_castsi512_pd(_mm512_and_epi64(
+			    _mm512_castpd_si512(x),
+			    _mm512_set1_epi64(HIGH_26_MASK)));
+    const __m512d	xl = _mm512_sub_round_pd(x, xh, CK_ROUND);
+    const __m512d	hi = _mm512_sub_round_pd(
+			    _mm512_mul_round_pd(xh, a, CK_ROUND),
+			    _mm512_mul_round_pd(kd, _mm512_set1_pd(LN2_HI),
+				CK_ROUND), CK_ROUND);
+    const __m512d	nlo = _mm512_sub_round_pd(
+			    _mm512_mul_round_pd(kd, _mm512_set1_pd(LN2_LO),
+				CK_ROUND),
+			    _mm512_add_round_pd(
+				_mm512_mul_round_pd(xl, a, CK_ROUND),
+				_mm512_mul_round_pd(x, b, CK_ROUND), CK_ROUND),
+			    CK_ROUND);
+    const __m512d	r = _mm512_sub_round_pd(hi, nlo, CK_ROUND);
+    const __m512d	rr = _mm512_mul_round_pd(r, r, CK_ROUND);
+    const __m512i	ki = _mm512_sub_epi64(_mm512_castpd_si512(t),
+			    _mm512_castpd_si512(_mm512_set1_pd(ROUNDER)));
+    const __m512i	h = _mm512_srli_epi64(_mm512_add_epi64(ki,
+			    _mm512_set1_epi64(2048)), 1);
+    __m512d		c = _mm512_add_round_pd(_mm512_set1_pd(P4),
+			    _mm512_mul_round_pd(rr, _mm512_set1_pd(P5),
+				CK_ROUND), CK_ROUND);
+    __m512d		z;
+
+    c = _mm512_add_round_pd(_mm512_set1_pd(P3),
+	_mm512_mul_round_pd(rr, c, CK_ROUND), CK_ROUND);
+    c = _mm512_add_round_pd(_mm512_set1_pd(P2),
+	_mm512_mul_round_pd(rr, c, CK_ROUND), CK_ROUND);
+    c = _mm512_sub_round_pd(r, _mm512_mul_round_pd(rr,
+	_mm512_add_round_pd(_mm512_set1_pd(P1),
+	    _mm512_mul_round_pd(rr, c, CK_ROUND), CK_ROUND), CK_ROUND),
+	CK_ROUND);
+    z = _mm512_sub_round_pd(_mm512_set1_pd(1.0), _mm512_sub_round_pd(
+	_mm512_sub_round_pd(nlo, _mm512_div_round_pd(
+		_mm512_mul_round_pd(r, c, CK_ROUND),
+		_mm512_sub_round_pd(_mm512_set1_pd(2.0), c, CK_ROUND),
+		CK_ROUND),
+	    CK_ROUND),
+	hi, CK_ROUND), CK_ROUND);
+    z = _mm512_mul_round_pd(_mm512_mul_round_pd(z,
+	    _mm512_castsi512_pd(_mm512_slli_epi64(
+		_mm512_sub_epi64(h, _mm512_set1_epi64(1)), 52)),
+	    CK_ROUND),
+	_mm512_castsi512_pd(_mm512_slli_epi64(
+	    _mm512_add_epi64(_mm512_sub_epi64(ki, h),
+		_mm512_set1_epi64(2047)), 52)),
+	CK_ROUND);
+
+    z = _mm512_mask_blend_pd(
+	_mm512_cmp_pd_mask(y, _mm512_set1_pd(EXP_OVERFLOW), _CMP_GT_OQ), z,
+	_mm512_set1_pd(HUGE_VAL));
+    z = _mm512_mask_blend_pd(
+	_mm512_cmp_pd_mask(y, _mm512_set1_pd(EXP_UNDERFLOW), _CMP_LT_OQ), z,
+	_mm512_setzero_pd());
+
+    return z;
+}
+
+
+CK_TARGET("avx512f") static __m512d
+avx512Apply(
+    const Operation	op,
+    const __m512d	a,
+    const __m512d	b,
+    const __m512d	x)
+{
+    switch (op) {
+    case CK_SCALE:
+	return _mm512_mul_round_pd(a, x, CK_ROUND);
+    case CK_OFFSET:
+	return _mm512_add_round_pd(a, x, CK_ROUND);
+    case CK_GALILEAN:
+	return _mm512_add_round_pd(_mm512_mul_round_pd(a, x, CK_ROUND), b,
+	    CK_ROUND);
+    case CK_LOG:
+	return _mm512_mul_round_pd(avx512Log(x), a, CK_ROUND);
+    case CK_EXP:
+	return avx512Exp(a, b, x);
+    default:
+	return _mm512_div_round_pd(_mm512_set1_pd(1.0), x, CK_ROUND);
+    }
+}
+
+
+CK_TARGET("avx512f") static __m512
+avx512ApplyFloats(
+    const Operation	op,
+    const __m512d	a,
+    const __m512d	b,
+    const __m512	x)
+{
+    __m512	y;
+
+    if (op == CK_RECIPROCAL) {
+	y = _mm512_div_round_ps(_mm512_set1_ps(1.0f), x, CK_ROUND);
+    }
+    else {
+	const __m256	lo = _mm512_cvtpd_ps(avx512Apply(op, a, b,
+	    _mm512_cvtps_pd(_mm512_castps512_ps256(x))));
+	const __m256	hi = _mm512_cvtpd_ps(avx512Apply(op, a, b,
+	    _mm512_cvtps_pd(_mm256_castpd_ps(
+		_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)))));
+
+	y = _mm512_castpd_ps(_mm512_insertf64x4(
+	    _mm512_castpd256_pd512(_mm256_castps_pd(lo)),
+	    _mm256_castps_pd(hi), 1));
+    }
+
+    return y;
+}
+
+
+/*
+ * Returns the conversion of "x" with missing values passed through.
+ */
+CK_TARGET("avx512f") static __m512d
+avx512ApplyMasked(
+    const Operation	op,
+    const __m512d	a,
+    const __m512d	b,
+    const Mask		mask,
+    const __m512d	fill,
+    const __m512d	x)
+{
+    const __m512d	y = avx512Apply(op, a, b, x);
+
+    return mask == CK_UNMASKED
+	? y
+	: _mm512_mask_blend_pd(mask == CK_FILL
+	    ? _mm512_cmp_pd_mask(x, fill, _CMP_EQ_OQ)
+	    : _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q), y, x);
+}
+
+
+CK_TARGET("avx512f") static __m512
+avx512ApplyFloatsMasked(
+    const Operation	op,
+    const __m512d	a,
+    const __m512d	b,
+    const Mask		mask,
+    const __m512	fill,
+    const __m512	x)
+{
+    const __m512	y = avx512ApplyFloats(op, a, b, x);
+
+    return mask == CK_UNMASKED
+	? y
+	: _mm512_mask_blend_ps(mask == CK_FILL
+	    ? _mm512_cmp_ps_mask(x, fill, _CMP_EQ_OQ)
+	    : _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), y, x);
+}
+
+
+CK_TARGET("avx512f") static void
+avx512ConvertDoubles(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    const __m512d	va = _mm512_set1_pd(a);
+    const __m512d	vb = _mm512_set1_pd(b);
+    const __m512d	vfill = _mm512_set1_pd(fill);
+    size_t		i;
+    size_t		n;
+
+    if (in < out) {
+	for (i = count; i >= 8;) {
+	    i -= 8;
+	    _mm512_storeu_pd(out + i,
+		avx512ApplyMasked(op, va, vb, mask, vfill,
+		    _mm512_loadu_pd(in + i)));
+	}
+	n = i;
+	i = 0;
+    }
+    else {
+	for (i = 0; count - i >= 8; i += 8)
+	    _mm512_storeu_pd(out + i,
+		avx512ApplyMasked(op, va, vb, mask, vfill,
+		    _mm512_loadu_pd(in + i)));
+	n = count - i;
+    }
+
+    if (n > 0) {
+	const __mmask8	tail = (__mmask8)((1u << n) - 1);
+
+	_mm512_mask_storeu_pd(out + i, tail,
+	    avx512ApplyMasked(op, va, vb, mask, vfill,
+		_mm512_maskz_loadu_pd(tail, in + i)));
+    }
+}
+
+
+CK_TARGET("avx512f") static void
+avx512ConvertFloats(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const Mask			mask,
+    const double		fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    const __m512d	va = _mm512_set1_pd(a);
+    const __m512d	vb = _mm512_set1_pd(b);
+    const __m512	vfill = _mm512_set1_ps((float)fill);
+    size_t		i;
+    size_t		n;
+
+    if (in < out) {
+	for (i = count; i >= 16;) {
+	    i -= 16;
+	    _mm512_storeu_ps(out + i,
+		avx512ApplyFloatsMasked(op, va, vb, mask, vfill,
+		    _mm512_loadu_ps(in + i)));
+	}
+	n = i;
+	i = 0;
+    }
+    else {
+	for (i = 0; count - i >= 16; i += 16)
+	    _mm512_storeu_ps(out + i,
+		avx512ApplyFloatsMasked(op, va, vb, mask, vfill,
+		    _mm512_loadu_ps(in + i)));
+	n = count - i;
+    }
+
+    if (n > 0) {
+	const __mmask16	tail = (__mmask16)((1u << n) - 1);
+
+	_mm512_mask_storeu_ps(out + i, tail,
+	    avx512ApplyFloatsMasked(op, va, vb, mask, vfill,
+		_mm512_maskz_loadu_ps(tail, in + i)));
+    }
+}
+
+
+static const Kernels	sse2Kernels = {sse2ConvertDoubles, sse2ConvertFloats};
+static const Kernels	avx2Kernels = {avx2ConvertDoubles, avx2ConvertFloats};
+static const Kernels	avx512Kernels =
+    {avx512ConvertDoubles, avx512ConvertFloats};
+
+#else
+
+static const Kernels	scalarKernels =
+    {scalarConvertDoubles, scalarConvertFloats};
+
+#endif
+
+
+/*******************************************************************************
+ * Dispatch:
+ ******************************************************************************/
+
+/*
+ * Returns the kernels for the host CPU.  The selection is made once.  Racing
+ * threads will make the same selection, so the selection is merely published
+ * atomically rather than under a lock.
+ *
+ * Returns:
+ *	Pointer to the kernels to use.
+ */
+static const Kernels*
+getKernels(void)
+{
+    static const Kernels*	kernels = NULL;
+    const Kernels*		selected = UT_LOAD_POINTER(kernels);
+
+    if (selected == NULL) {
+#ifdef CK_X86_64
+	__builtin_cpu_init();
+
+	selected = __builtin_cpu_supports("avx512f")
+	    ? &avx512Kernels
+	    : __builtin_cpu_supports("avx2")
+		? &avx2Kernels
+		: &sse2Kernels;
+#else
+	selected = &scalarKernels;
+#endif
+
+	UT_STORE_POINTER(kernels, selected);
+    }
+
+    return selected;
+}
+
+
+/*
+ * Converts an array of doubles using the kernel for the host CPU.
+ *
+ * Arguments:
+ *	op	The operation.
+ *	a	The first parameter of the operation.
+ *	b	The second parameter of the operation.
+ *	fill	Pointer to the fill value or NULL if no values are missing.
+ *		If the fill value is NaN, then NaN values are missing.
+ *	in	Pointer to the values to be converted.
+ *	count	The number of values to be converted.
+ *	out	Pointer to the output array for the converted values.
+ */
+static void
+convertDoubles(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const double* const		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    if (fill == NULL) {
+	getKernels()->convertDoubles(op, a, b, CK_UNMASKED, 0.0, in, count,
+	    out);
+    }
+    else {
+	getKernels()->convertDoubles(op, a, b,
+	    *fill == *fill ? CK_FILL : CK_NAN, *fill, in, count, out);
+    }
+}
+
+
+/*
+ * Converts an array of floats using the kernel for the host CPU.  The
+ * arguments are those of convertDoubles().
+ */
+static void
+convertFloats(
+    const Operation		op,
+    const double		a,
+    const double		b,
+    const float* const		fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    if (fill == NULL) {
+	getKernels()->convertFloats(op, a, b, CK_UNMASKED, 0.0, in, count,
+	    out);
+    }
+    else {
+	getKernels()->convertFloats(op, a, b,
+	    *fill == *fill ? CK_FILL : CK_NAN, *fill, in, count, out);
+    }
+}
+
+
+void
+ckScaleDoubles(
+    const double		slope,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_SCALE, slope, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckScaleDoublesMasked(
+    const double		slope,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_SCALE, slope, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckScaleFloats(
+    const double		slope,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_SCALE, slope, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckScaleFloatsMasked(
+    const double		slope,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_SCALE, slope, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckOffsetDoubles(
+    const double		offset,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_OFFSET, offset, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckOffsetDoublesMasked(
+    const double		offset,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_OFFSET, offset, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckOffsetFloats(
+    const double		offset,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_OFFSET, offset, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckOffsetFloatsMasked(
+    const double		offset,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_OFFSET, offset, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckGalileanDoubles(
+    const double		slope,
+    const double		intercept,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_GALILEAN, slope, intercept, NULL, in, count, out);
+}
+
+
+void
+ckGalileanDoublesMasked(
+    const double		slope,
+    const double		intercept,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_GALILEAN, slope, intercept, &fill, in, count, out);
+}
+
+
+void
+ckGalileanFloats(
+    const double		slope,
+    const double		intercept,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_GALILEAN, slope, intercept, NULL, in, count, out);
+}
+
+
+void
+ckGalileanFloatsMasked(
+    const double		slope,
+    const double		intercept,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_GALILEAN, slope, intercept, &fill, in, count, out);
+}
+
+
+void
+ckReciprocalDoubles(
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_RECIPROCAL, 0.0, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckReciprocalDoublesMasked(
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_RECIPROCAL, 0.0, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckReciprocalFloats(
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_RECIPROCAL, 0.0, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckReciprocalFloatsMasked(
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_RECIPROCAL, 0.0, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckLogDoubles(
+    const double		factor,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_LOG, factor, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckLogDoublesMasked(
+    const double		factor,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    convertDoubles(CK_LOG, factor, 0.0, &fill, in, count, out);
+}
+
+
+void
+ckLogFloats(
+    const double		factor,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_LOG, factor, 0.0, NULL, in, count, out);
+}
+
+
+void
+ckLogFloatsMasked(
+    const double		factor,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    convertFloats(CK_LOG, factor, 0.0, &fill, in, count, out);
+}
+
+
+/*
+ * Converts an array by pow(base, in[i]).
+ *
+ * Arguments:
+ *	base	The base.  Must be positive.
+ *	fill	Pointer to the fill value or NULL if no values are missing.
+ *	in	Pointer to the values to be converted.
+ *	count	The number of values to be converted.
+ *	out	Pointer to the output array for the converted values.
+ */
+static void
+expDoubles(
+    const double		base,
+    const double* const		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    if (base == 1) {
+	const Mask	mask = fill == NULL
+			    ? CK_UNMASKED
+			    : *fill == *fill ? CK_FILL : CK_NAN;
+	const double	fillValue = fill == NULL ? 0.0 : *fill;
+	size_t		i;
+
+	/*
+	 * Even infinite and NaN values become 1.  As in the kernels, the values
+	 * are converted backwards if the output array follows the input array.
+	 */
+	if (in < out) {
+	    for (i = count; i-- > 0;)
+		out[i] = isMissing(mask, fillValue, in[i]) ? in[i] : 1;
+	}
+	else {
+	    for (i = 0; i < count; i++)
+		out[i] = isMissing(mask, fillValue, in[i]) ? in[i] : 1;
+	}
+    }
+    else {
+	double	a;
+	double	b;
+
+	getExpParameters(base, &a, &b);
+	convertDoubles(CK_EXP, a, b, fill, in, count, out);
+    }
+}
+
+
+void
+ckExpDoubles(
+    const double		base,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    expDoubles(base, NULL, in, count, out);
+}
+
+
+void
+ckExpDoublesMasked(
+    const double		base,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out)
+{
+    expDoubles(base, &fill, in, count, out);
+}
+
+
+/*
+ * Converts an array by pow(base, in[i]).
+ *
+ * Arguments:
+ *	base	The base.  Must be positive.
+ *	fill	Pointer to the fill value or NULL if no values are missing.
+ *	in	Pointer to the values to be converted.
+ *	count	The number of values to be converted.
+ *	out	Pointer to the output array for the converted values.
+ */
+static void
+expFloats(
+    const double		base,
+    const float* const		fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    if (base == 1) {
+	const Mask	mask = fill == NULL
+			    ? CK_UNMASKED
+			    : *fill == *fill ? CK_FILL : CK_NAN;
+	const double	fillValue = fill == NULL ? 0.0 : *fill;
+	size_t		i;
+
+	/*
+	 * Even infinite and NaN values become 1.  As in the kernels, the values
+	 * are converted backwards if the output array follows the input array.
+	 */
+	if (in < out) {
+	    for (i = count; i-- > 0;)
+		out[i] = isMissing(mask, fillValue, in[i]) ? in[i] : 1;
+	}
+	else {
+	    for (i = 0; i < count; i++)
+		out[i] = isMissing(mask, fillValue, in[i]) ? in[i] : 1;
+	}
+    }
+    else {
+	double	a;
+	double	b;
+
+	getExpParameters(base, &a, &b);
+	convertFloats(CK_EXP, a, b, fill, in, count, out);
+    }
+}
+
+
+void
+ckExpFloats(
+    const double		base,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    expFloats(base, NULL, in, count, out);
+}
+
+
+void
+ckExpFloatsMasked(
+    const double		base,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out)
+{
+    expFloats(base, &fill, in, count, out);
+}
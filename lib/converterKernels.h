@@ -0,0 +1,264 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Array-conversion kernels for the converter module.
+ */
+#ifndef UT_CONVERTER_KERNELS_H_INCLUDED
+#define UT_CONVERTER_KERNELS_H_INCLUDED
+
+#include <stddef.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * The following functions convert arrays of values using the best kernel for
+ * the host CPU, which is determined on first use.  The results are bit-for-bit
+ * identical to those of the equivalent scalar loop.  The input and output
+ * arrays may overlap or be identical.
+ *
+ * Arguments:
+ *	slope		The number by which to multiply values.
+ *	intercept	The number to be added.
+ *	offset		The number to be added.
+ *	in		Pointer to the values to be converted.
+ *	count		The number of values to be converted.
+ *	out		Pointer to the output array for the converted values.
+ */
+
+/*
+ * out[i] = slope * in[i]
+ */
+void
+ckScaleDoubles(
+    const double		slope,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckScaleFloats(
+    const double		slope,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+/*
+ * out[i] = offset + in[i]
+ */
+void
+ckOffsetDoubles(
+    const double		offset,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckOffsetFloats(
+    const double		offset,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+/*
+ * out[i] = slope * in[i] + intercept
+ */
+void
+ckGalileanDoubles(
+    const double		slope,
+    const double		intercept,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckGalileanFloats(
+    const double		slope,
+    const double		intercept,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+/*
+ * out[i] = 1 / in[i]
+ */
+void
+ckReciprocalDoubles(
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckReciprocalFloats(
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+/*
+ * The following functions use the library's own logarithm and exponential
+ * rather than those of the C library.  Their accuracy relative to the C
+ * library is the one documented for cv_convert_doubles() in "converter.h"; for
+ * exponentials with bases other than 2, 10, and e, it requires a long double
+ * wider than double.  Float results are computed in double precision and then
+ * rounded.  Zero, negative, infinite, and NaN arguments, overflow, and
+ * underflow are handled as by log() and pow().
+ *
+ * Arguments:
+ *	factor		The number by which to multiply the natural logarithm.
+ *	base		The base of the exponential.  Must be positive.
+ */
+
+/*
+ * out[i] = log(in[i]) * factor
+ */
+void
+ckLogDoubles(
+    const double		factor,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckLogFloats(
+    const double		factor,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+/*
+ * out[i] = pow(base, in[i])
+ */
+void
+ckExpDoubles(
+    const double		base,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckExpFloats(
+    const double		base,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+
+/*
+ * The following functions are like the above but pass missing values through
+ * unchanged: out[i] = in[i] if in[i] equals "fill" or, if "fill" is NaN, if
+ * in[i] is NaN.  The test is part of the vectorized loop.
+ *
+ * Arguments:
+ *	fill		The fill value.
+ */
+
+void
+ckScaleDoublesMasked(
+    const double		slope,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckScaleFloatsMasked(
+    const double		slope,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+void
+ckOffsetDoublesMasked(
+    const double		offset,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckOffsetFloatsMasked(
+    const double		offset,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+void
+ckGalileanDoublesMasked(
+    const double		slope,
+    const double		intercept,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckGalileanFloatsMasked(
+    const double		slope,
+    const double		intercept,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+void
+ckReciprocalDoublesMasked(
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckReciprocalFloatsMasked(
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+void
+ckLogDoublesMasked(
+    const double		factor,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckLogFloatsMasked(
+    const double		factor,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+void
+ckExpDoublesMasked(
+    const double		base,
+    const double		fill,
+    const double* const		in,
+    const size_t		count,
+    double* const		out);
+
+void
+ckExpFloatsMasked(
+    const double		base,
+    const float			fill,
+    const float* const		in,
+    const size_t		count,
+    float* const		out);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
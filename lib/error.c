@@ -6,8 +6,11 @@
  * redistribution conditions.
  */
 /*
- * This module is thread-compatible but not thread-safe.  Multi-threaded
- * access must be externally synchronized.
+ * Error-message handling.  The handler is that of the calling thread's current
+ * context (see "context.c").  A context that hasn't installed a handler uses
+ * "ut_write_to_stderr()".
+ *
+ * This module is thread-safe.
  */
 
 /*LINTLIBRARY*/
@@ -19,6 +22,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include "context.h"
 #include "udunits2.h"
 
 
@@ -65,12 +69,26 @@ ut_ignore(
 }
 
 
-static ut_error_message_handler	errorMessageHandler = ut_write_to_stderr;
+static const ut_error_message_handler	defaultHandler = ut_write_to_stderr;
+
+
+/*
+ * Returns the error-message handler of the calling thread's current context.
+ */
+static ut_error_message_handler
+getHandler(void)
+{
+    ut_error_message_handler	handler = ctxGet()->handler;
+
+    return handler != NULL ? handler : defaultHandler;
+}
 
 
 /*
- * Returns the previously-installed error-message handler and optionally
- * installs a new handler.  The initial handler is "ut_write_to_stderr()".
+ * Returns the previously-installed error-message handler of the calling
+ * thread's current context and optionally installs a new handler in it.  Other
+ * threads and contexts are unaffected.  The initial handler is
+ * "ut_write_to_stderr()".
  *
  * Arguments:
  *      handler		NULL or pointer to the error-message handler.  If NULL,
@@ -83,10 +101,10 @@ ut_error_message_handler
 ut_set_error_message_handler(
     ut_error_message_handler	handler)
 {
-    ut_error_message_handler	prev = errorMessageHandler;
+    ut_error_message_handler	prev = getHandler();
 
     if (handler != NULL)
-	errorMessageHandler = handler;
+	ctxGet()->handler = handler;
 
     return prev;
 }
@@ -113,7 +131,7 @@ ut_handle_error_message(
 
     va_start(args, fmt);
 
-    nbytes = errorMessageHandler(fmt, args);
+    nbytes = getHandler()(fmt, args);
 
     va_end(args);
 
@@ -16,61 +16,157 @@
 #endif
 
 #include <assert.h>
-#ifdef _MSC_VER
-#include "tsearch.h"
-#else
-#include <search.h>
-#endif
-
+#include <ctype.h>
+#include <errno.h>
 #include <stdlib.h>
 
 #include <string.h>
-#ifndef _MSC_VER
-#include <strings.h>
-#endif
 
 #include "udunits2.h"
+#include "bundledDb.h"
+#include "idTrie.h"
 #include "unitAndId.h"
-#include "systemMap.h"
+#include "systemTable.h"
+
+extern int coreIsFrozen(const ut_system* system);
+
+/*
+ * An identifier-to-unit map is an open-addressing hash-table with linear
+ * probing.  Each slot holds the identifier's key -- the identifier itself or,
+ * if the map is case-insensitive, its lowercase copy -- and the hash-code of
+ * the key, so that a lookup usually compares a single string.
+ */
+typedef struct {
+    UnitAndId*		entry;		/* NULL => empty slot */
+    char*		key;		/* "entry->id" or lowercase copy */
+    unsigned long	hash;		/* hash-code of "key" */
+} IdSlot;
 
 typedef struct {
-    int			(*compare)(const void*, const void*);
-    void*		tree;
+    IdSlot*		slots;
+    size_t		slotCount;	/* number of slots; a power of 2 */
+    size_t		count;		/* number of entries */
+    int			isCaseSensitive;
 } IdToUnitMap;
 
-static SystemMap*	systemToNameToUnit;
-static SystemMap*	systemToSymbolToUnit;
+#define ITUM_INITIAL_SIZE	64	/* initial number of slots */
+#define HASH_INIT		2166136261UL
 
 
-static int
-sensitiveCompare(
-    const void* const	node1,
-    const void* const	node2)
+
+/*
+ * Returns the key of an identifier: the identifier itself or, if the map is
+ * case-insensitive, the identifier in lowercase.
+ *
+ * Arguments:
+ *	map	The identifier-to-unit map.
+ *	c	A character of the identifier.
+ * Returns:
+ *	The character of the key.
+ */
+#define KEY_CHAR(map, c) \
+    ((map)->isCaseSensitive ? (c) : (char)tolower((unsigned char)(c)))
+
+
+/*
+ * Returns the hash-code of the key of an identifier.
+ *
+ * Arguments:
+ *	map	The identifier-to-unit map.
+ *	id	The identifier.
+ * Returns:
+ *	The hash-code of the key of "id".
+ */
+static unsigned long
+itumHash(
+    const IdToUnitMap* const	map,
+    const char*			id)
 {
-    return strcmp(((const UnitAndId*)node1)->id, 
-	((const UnitAndId*)node2)->id);
+    unsigned long	hash = HASH_INIT;
+
+    for (; *id != 0; id++) {
+	hash ^= (unsigned char)KEY_CHAR(map, *id);
+	hash *= 16777619UL;
+    }
+
+    return hash;
 }
 
 
+/*
+ * Indicates if the key of an identifier equals a key.
+ *
+ * Arguments:
+ *	map	The identifier-to-unit map.
+ *	id	The identifier.
+ *	key	The key.
+ * Returns:
+ *	0	The key of "id" doesn't equal "key".
+ *	else	The key of "id" equals "key".
+ */
 static int
-insensitiveCompare(
-    const void* const	node1,
-    const void* const	node2)
+itumKeyEquals(
+    const IdToUnitMap* const	map,
+    const char*			id,
+    const char*			key)
 {
-    return strcasecmp(((const UnitAndId*)node1)->id, 
-	((const UnitAndId*)node2)->id);
+    while (*id != 0 && KEY_CHAR(map, *id) == *key) {
+	id++;
+	key++;
+    }
+
+    return *id == 0 && *key == 0;
+}
+
+
+/*
+ * Returns the index of the slot of an identifier-to-unit map that contains an
+ * identifier or, if none does, of the empty slot where it would be added.
+ *
+ * Arguments:
+ *	map	The identifier-to-unit map.
+ *	id	The identifier.
+ *	hash	The hash-code of the key of "id".
+ * Returns:
+ *	The index of the slot.
+ */
+static size_t
+itumProbe(
+    const IdToUnitMap* const	map,
+    const char* const		id,
+    const unsigned long		hash)
+{
+    const size_t	mask = map->slotCount - 1;
+    size_t		i;
+
+    for (i = hash & mask; map->slots[i].entry != NULL; i = (i + 1) & mask) {
+	if (map->slots[i].hash == hash &&
+		itumKeyEquals(map, id, map->slots[i].key))
+	    break;
+    }
+
+    return i;
 }
 
 
 static IdToUnitMap*
 itumNew(
-    int		(*compare)(const void*, const void*))
+    const int	isCaseSensitive)
 {
     IdToUnitMap*	map = (IdToUnitMap*)malloc(sizeof(IdToUnitMap));
 
     if (map != NULL) {
-	map->tree = NULL;
-	map->compare = compare;
+	map->slots = calloc(ITUM_INITIAL_SIZE, sizeof(IdSlot));
+
+	if (map->slots == NULL) {
+	    free(map);
+	    map = NULL;
+	}
+	else {
+	    map->slotCount = ITUM_INITIAL_SIZE;
+	    map->count = 0;
+	    map->isCaseSensitive = isCaseSensitive;
+	}
     }
 
     return map;
@@ -89,18 +185,75 @@ itumFree(
     IdToUnitMap*	map)
 {
     if (map != NULL) {
-	while (map->tree != NULL) {
-	    UnitAndId*	uai = *(UnitAndId**)map->tree;
+	size_t	i;
+
+	for (i = 0; i < map->slotCount; i++) {
+	    IdSlot* const	slot = map->slots + i;
+
+	    if (slot->entry != NULL) {
+		if (slot->key != slot->entry->id)
+		    free(slot->key);
 
-	    (void)tdelete(uai, &map->tree, map->compare);
-	    uaiFree(uai);
+		uaiFree(slot->entry);
+	    }
 	}
 
+	free(map->slots);
 	free(map);
     }					/* valid arguments */
 }
 
 
+/*
+ * Doubles the number of slots of an identifier-to-unit map.
+ *
+ * Arguments:
+ *	map		The identifier-to-unit map.
+ * Returns:
+ *	UT_OS		Operating-system error.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+static ut_status
+itumGrow(
+    IdToUnitMap* const	map)
+{
+    ut_status		status;
+    const size_t	slotCount = 2*map->slotCount;
+    IdSlot* const	slots = calloc(slotCount, sizeof(IdSlot));
+
+    if (slots == NULL) {
+	status = UT_OS;
+	ut_set_status(status);
+	ut_handle_error_message(strerror(errno));
+	ut_handle_error_message("itumGrow(): "
+	    "Couldn't allocate %lu-slot identifier table",
+	    (unsigned long)slotCount);
+    }
+    else {
+	const size_t	mask = slotCount - 1;
+	size_t		i;
+
+	for (i = 0; i < map->slotCount; i++) {
+	    if (map->slots[i].entry != NULL) {
+		size_t	j = map->slots[i].hash & mask;
+
+		while (slots[j].entry != NULL)
+		    j = (j + 1) & mask;
+
+		slots[j] = map->slots[i];
+	    }
+	}
+
+	free(map->slots);
+	map->slots = slots;
+	map->slotCount = slotCount;
+	status = UT_SUCCESS;
+    }
+
+    return status;
+}
+
+
 /*
  * Adds an entry to an identifier-to-unit map.
  *
@@ -120,40 +273,77 @@ itumAdd(
     const ut_unit* const	unit)
 {
     ut_status		status;
-    UnitAndId*		targetEntry;
+    const unsigned long	hash = itumHash(map, id);
+    size_t		i;
 
     assert(map != NULL);
     assert(id != NULL);
     assert(unit != NULL);
 
-    targetEntry = uaiNew(unit, id);
-
-    if (targetEntry == NULL) {
-        status = ut_get_status();
-    }
-    else {
-	UnitAndId**	treeEntry = tsearch(targetEntry, &map->tree,
-	    map->compare);
+    i = itumProbe(map, id, hash);
 
-	if (treeEntry == NULL) {
-	    uaiFree(targetEntry);
-	    status = UT_OS;
+    if (map->slots[i].entry != NULL) {
+	if (ut_compare(map->slots[i].entry->unit, unit) == 0) {
+	    status = UT_SUCCESS;
 	}
 	else {
-	    if (ut_compare((*treeEntry)->unit, unit) == 0) {
-		status = UT_SUCCESS;
+	    status = UT_EXISTS;
+	    ut_set_status(status);
+	    ut_handle_error_message(
+		"\"%s\" already maps to existing but different unit", id);
+	}
+    }
+    else {
+	/*
+	 * The map is kept at most half full so that a lookup takes about one
+	 * probe.
+	 */
+	status = 2*(map->count + 1) > map->slotCount
+	    ? itumGrow(map)
+	    : UT_SUCCESS;
+
+	if (status == UT_SUCCESS) {
+	    UnitAndId*	entry = uaiNew(unit, id);
+
+	    if (entry == NULL) {
+		status = ut_get_status();
 	    }
 	    else {
-		status = UT_EXISTS;
-                ut_set_status(status);
-		ut_handle_error_message(
-		    "\"%s\" already maps to existing but different unit", id);
-	    }
+		char*	key = entry->id;
 
-            if (targetEntry != *treeEntry)
-                uaiFree(targetEntry);
-	}				/* found entry */
-    }					/* "targetEntry" allocated */
+		if (!map->isCaseSensitive) {
+		    key = malloc(strlen(id) + 1);
+
+		    if (key == NULL) {
+			status = UT_OS;
+			ut_set_status(status);
+			ut_handle_error_message(strerror(errno));
+			ut_handle_error_message(
+			    "itumAdd(): Couldn't allocate identifier key");
+			uaiFree(entry);
+		    }
+		    else {
+			size_t	j;
+
+			for (j = 0; id[j] != 0; j++)
+			    key[j] = KEY_CHAR(map, id[j]);
+
+			key[j] = 0;
+		    }
+		}
+
+		if (status == UT_SUCCESS) {
+		    IdSlot* const	slot =
+			map->slots + itumProbe(map, id, hash);
+
+		    slot->entry = entry;
+		    slot->key = key;
+		    slot->hash = hash;
+		    map->count++;
+		}
+	    }				/* "entry" allocated */
+	}				/* map has room */
+    }					/* new identifier */
 
     return status;
 }
@@ -173,20 +363,45 @@ itumRemove(
     IdToUnitMap*	map,
     const char* const	id)
 {
-    UnitAndId		targetEntry;
-    UnitAndId**		treeEntry;
+    size_t		i;
 
     assert(map != NULL);
     assert(id != NULL);
-    
-    targetEntry.id = (char*)id;
-    treeEntry = tfind(&targetEntry, &map->tree, map->compare);
 
-    if (treeEntry != NULL) {
-	UnitAndId*	uai = *treeEntry;
+    i = itumProbe(map, id, itumHash(map, id));
 
-	(void)tdelete(uai, &map->tree, map->compare);
-	uaiFree(uai);
+    if (map->slots[i].entry != NULL) {
+	const size_t	mask = map->slotCount - 1;
+	size_t		j = i;
+
+	if (map->slots[i].key != map->slots[i].entry->id)
+	    free(map->slots[i].key);
+
+	uaiFree(map->slots[i].entry);
+	map->count--;
+
+	/*
+	 * Move subsequent entries of the probe sequence back so that no
+	 * lookup stops at the emptied slot.
+	 */
+	for (;;) {
+	    size_t	home;
+
+	    j = (j + 1) & mask;
+
+	    if (map->slots[j].entry == NULL)
+		break;
+
+	    home = map->slots[j].hash & mask;
+
+	    if (i <= j ? (home <= i || home > j) : (home <= i && home > j)) {
+		map->slots[i] = map->slots[j];
+		i = j;
+	    }
+	}
+
+	map->slots[i].entry = NULL;
+	map->slots[i].key = NULL;
     }
 
     return UT_SUCCESS;
@@ -210,20 +425,10 @@ itumFind(
     IdToUnitMap*	map,
     const char* const	id)
 {
-    UnitAndId*		entry = NULL;	/* failure */
-    UnitAndId		targetEntry;
-    UnitAndId**		treeEntry;
-
     assert(map != NULL);
     assert(id != NULL);
 
-    targetEntry.id = (char*)id;
-    treeEntry = tfind(&targetEntry, &map->tree, map->compare);
-
-    if (treeEntry != NULL)
-	entry = *treeEntry;
-
-    return entry;
+    return map->slots[itumProbe(map, id, itumHash(map, id))].entry;
 }
 
 
@@ -231,10 +436,10 @@ itumFind(
  * Adds to a particular unit-system a mapping from an identifier to a unit.
  *
  * Arguments:
- *	systemMap	Address of the pointer to the system-map.
+ *	table		The identifier-to-unit table of the unit-system.
  *	id		Pointer to the identifier.  May be freed upon return.
  *	unit		Pointer to the unit.  May be freed upon return.
- *	compare		Pointer to comparison function for unit-identifiers.
+ *	isCaseSensitive	Whether identifiers are case-sensitive.
  * Returns:
  *	UT_BAD_ARG	"id" is NULL or "unit" is NULL.
  *	UT_OS		Operating-sytem failure.  See "errno".
@@ -242,10 +447,10 @@ itumFind(
  */
 static ut_status
 mapIdToUnit(
-    SystemMap** const		systemMap,
+    const SystemTable		table,
     const char* const		id,
     const ut_unit* const	unit,
-    int				(*compare)(const void*, const void*))
+    const int			isCaseSensitive)
 {
     ut_status		status = UT_SUCCESS;
 
@@ -255,35 +460,52 @@ mapIdToUnit(
     else if (unit == NULL) {
 	status = UT_BAD_ARG;
     }
+    else if (coreIsFrozen(ut_get_system(unit))) {
+	status = UT_BAD_ARG;
+    }
     else {
-	ut_system*	system = ut_get_system(unit);
-
-	if (*systemMap == NULL) {
-	    *systemMap = smNew();
-
-	    if (*systemMap == NULL)
-		status = UT_OS;
+	ut_system*		system = ut_get_system(unit);
+	const ut_unit* const	bundled = bdbFind(system, id, !isCaseSensitive);
+
+	if (bundled != NULL) {
+	    /*
+	     * The identifier is mapped by the bundled database of the
+	     * unit-system.
+	     */
+	    if (ut_compare(bundled, unit) != 0) {
+		status = UT_EXISTS;
+		ut_set_status(status);
+		ut_handle_error_message(
+		    "\"%s\" already maps to existing but different unit", id);
+	    }
 	}
-
-	if (*systemMap != NULL) {
+	else {
 	    IdToUnitMap** const	idToUnit =
-		(IdToUnitMap**)smSearch(*systemMap, system);
+		(IdToUnitMap**)coreGetTable(system, table);
 
-	    if (idToUnit == NULL) {
-		status = UT_OS;
+	    if (*idToUnit == NULL) {
+		*idToUnit = itumNew(isCaseSensitive);
+
+		if (*idToUnit == NULL)
+		    status = UT_OS;
 	    }
-	    else {
-		if (*idToUnit == NULL) {
-		    *idToUnit = itumNew(compare);
 
-		    if (*idToUnit == NULL)
-			status = UT_OS;
-		}
+	    if (*idToUnit != NULL) {
+		status = itumAdd(*idToUnit, id, unit);
+
+		/*
+		 * The identifier-trie refers to the map's reference to the
+		 * unit.
+		 */
+		if (status == UT_SUCCESS) {
+		    status = idtAddUnit(system, id,
+			itumFind(*idToUnit, id)->unit, !isCaseSensitive);
 
-		if (*idToUnit != NULL)
-		    status = itumAdd(*idToUnit, id, unit);
-	    }				/* have system-map entry */
-	}				/* have system-map */
+		    if (status != UT_SUCCESS)
+			(void)itumRemove(*idToUnit, id);
+		}
+	    }
+	}
     }					/* valid arguments */
 
     return status;
@@ -294,32 +516,38 @@ mapIdToUnit(
  * Removes the mapping from an identifier to a unit.
  *
  * Arguments:
- *	systemMap	Address of the pointer to the system-map.
+ *	table		The identifier-to-unit table of the unit-system.
  *	id		Pointer to the identifier.  May be freed upon return.
  *	system		Pointer to the unit-system associated with the mapping.
  * Returns:
- *	UT_BAD_ARG	"id" is NULL, "system" is NULL, or "compare" is NULL.
+ *	UT_BAD_ARG	"id" is NULL or "system" is NULL.
+ *	UT_OS		Operating-system failure.  See "errno".
  *	UT_SUCCESS	Success.
  */
 static ut_status
 unmapId(
-    SystemMap* const	systemMap,
+    const SystemTable	table,
     const char* const	id,
     ut_system*		system)
 {
     ut_status		status;
 
-    if (systemMap == NULL || id == NULL || system == NULL) {
+    if (id == NULL || system == NULL || coreIsFrozen(system)) {
 	status = UT_BAD_ARG;
     }
     else {
-	IdToUnitMap** const	idToUnit =
-	    (IdToUnitMap**)smFind(systemMap, system);
+	const int		isName = table == ST_NAME_TO_UNIT;
+	IdToUnitMap* const	idToUnit =
+	    *(IdToUnitMap**)coreGetTable(system, table);
+
+	status = bdbRemove(system, id, isName);
 
-	status = 
-	    (idToUnit == NULL || *idToUnit == NULL)
-		? UT_SUCCESS
-		: itumRemove(*idToUnit, id);
+	if (status == UT_SUCCESS) {
+	    idtRemoveUnit(system, id, isName);
+
+	    if (idToUnit != NULL)
+		status = itumRemove(idToUnit, id);
+	}
     }					/* valid arguments */
 
     return status;
@@ -348,7 +576,7 @@ ut_map_name_to_unit(
     const ut_unit* const	unit)
 {
     ut_set_status(
-	mapIdToUnit(&systemToNameToUnit, name, unit, insensitiveCompare));
+	mapIdToUnit(ST_NAME_TO_UNIT, name, unit, 0));
 
     return ut_get_status();
 }
@@ -372,7 +600,7 @@ ut_unmap_name_to_unit(
     const char* const	name,
     const ut_encoding   encoding)
 {
-    ut_set_status(unmapId(systemToNameToUnit, name, system));
+    ut_set_status(unmapId(ST_NAME_TO_UNIT, name, system));
 
     return ut_get_status();
 }
@@ -400,7 +628,7 @@ ut_map_symbol_to_unit(
     const ut_unit* const	unit)
 {
     ut_set_status(
-	mapIdToUnit(&systemToSymbolToUnit, symbol, unit, sensitiveCompare));
+	mapIdToUnit(ST_SYMBOL_TO_UNIT, symbol, unit, 1));
 
     return ut_get_status();
 }
@@ -424,7 +652,7 @@ ut_unmap_symbol_to_unit(
     const char* const	symbol,
     const ut_encoding   encoding)
 {
-    ut_set_status(unmapId(systemToSymbolToUnit, symbol, system));
+    ut_set_status(unmapId(ST_SYMBOL_TO_UNIT, symbol, system));
 
     return ut_get_status();
 }
@@ -434,8 +662,7 @@ ut_unmap_symbol_to_unit(
  * Returns the unit to which an identifier maps in a particular unit-system.
  *
  * Arguments:
- *	systemMap	NULL or pointer to the system-map.  If NULL, then
- *			NULL will be returned.
+ *	table		The identifier-to-unit table of the unit-system.
  *	system		Pointer to the unit-system.
  *	id		Pointer to the identifier.
  * Returns:
@@ -446,7 +673,7 @@ ut_unmap_symbol_to_unit(
  */
 static ut_unit*
 getUnitById(
-    const SystemMap* const	systemMap,
+    const SystemTable		table,
     const ut_system* const	system,
     const char* const		id)
 {
@@ -460,16 +687,21 @@ getUnitById(
 	ut_set_status(UT_BAD_ARG);
 	ut_handle_error_message("getUnitById(): NULL identifier argument");
     }
-    else if (systemMap != NULL) {
-	IdToUnitMap** const	idToUnit =
-	    (IdToUnitMap**)smFind(systemMap, system);
+    else {
+	IdToUnitMap* const	idToUnit =
+	    *(IdToUnitMap**)coreGetTable(system, table);
+	const ut_unit*		found =
+	    bdbFind(system, id, table == ST_NAME_TO_UNIT);
 
-	if (idToUnit != NULL) {
-	    const UnitAndId*	uai = itumFind(*idToUnit, id);
+	if (found == NULL && idToUnit != NULL) {
+	    const UnitAndId*	uai = itumFind(idToUnit, id);
 
 	    if (uai != NULL)
-		unit = ut_clone(uai->unit);
+		found = uai->unit;
 	}
+
+	if (found != NULL)
+	    unit = ut_clone(found);
     }					/* valid arguments */
 
     return unit;
@@ -499,7 +731,7 @@ ut_get_unit_by_name(
 {
     ut_set_status(UT_SUCCESS);
 
-    return getUnitById(systemToNameToUnit, system, name);
+    return getUnitById(ST_NAME_TO_UNIT, system, name);
 }
 
 
@@ -527,7 +759,7 @@ ut_get_unit_by_symbol(
 {
     ut_set_status(UT_SUCCESS);
 
-    return getUnitById(systemToSymbolToUnit, system, symbol);
+    return getUnitById(ST_SYMBOL_TO_UNIT, system, symbol);
 }
 
 
@@ -543,22 +775,14 @@ itumFreeSystem(
     ut_system*	system)
 {
     if (system != NULL) {
-	SystemMap*	systemMaps[2];
-	int		i;
-
-	systemMaps[0] = systemToNameToUnit;
-	systemMaps[1] = systemToSymbolToUnit;
-
-	for (i = 0; i < 2; i++) {
-	    if (systemMaps[i] != NULL) {
-		IdToUnitMap** const	idToUnit =
-		    (IdToUnitMap**)smFind(systemMaps[i], system);
-
-		if (idToUnit != NULL)
-		    itumFree(*idToUnit);
-
-		smRemove(systemMaps[i], system);
-	    }
-	}
+	IdToUnitMap** const	nameToUnit =
+	    (IdToUnitMap**)coreGetTable(system, ST_NAME_TO_UNIT);
+	IdToUnitMap** const	symbolToUnit =
+	    (IdToUnitMap**)coreGetTable(system, ST_SYMBOL_TO_UNIT);
+
+	itumFree(*nameToUnit);
+	*nameToUnit = NULL;
+	itumFree(*symbolToUnit);
+	*symbolToUnit = NULL;
     }					/* valid arguments */
 }
@@ -0,0 +1,870 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Identifier-trie of a unit-system: a single trie over the unit-names,
+ * unit-symbols, name-prefixes, and symbol-prefixes of the unit-system, which
+ * resolves an identifier like "kilometers" in one left-to-right scan per
+ * prefix.
+ *
+ * The nodes of the trie are kept in one array and refer to each other by
+ * index, so the trie is a few contiguous blocks of memory.  Names and
+ * name-prefixes are case-insensitive and are added in lowercase; symbols and
+ * symbol-prefixes are case-sensitive.  A scan follows a string with two
+ * cursors: one along the lowercase characters for names and one along the
+ * actual characters for symbols.  The nodes of a removed identifier are kept
+ * for when it's added again.
+ *
+ * An entry refers to its unit by a slot in an array of units, so the nodes and
+ * entries don't depend on the addresses of units.  This allows the trie of the
+ * bundled database to be compiled into the library and shared, as is, by every
+ * unit-system that's loaded from it; the trie copies the image only when it's
+ * modified (see "idtSetImage()").
+ *
+ * Lookups don't modify the trie.  Functions that add or remove identifiers
+ * must be externally synchronized.
+ */
+
+/*LINTLIBRARY*/
+
+#ifndef	_XOPEN_SOURCE
+#   define _XOPEN_SOURCE 500
+#endif
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#include <string.h>
+
+#include "idTrie.h"			/* this module's API */
+#include "systemTable.h"
+#include "udunits2.h"
+
+typedef struct {
+    TrieNode*		nodes;		/* "nodes[0]" is the root */
+    TrieEntry*		entries;
+    const ut_unit**	units;		/* units of the entries */
+    int			nodeCount;
+    int			nodeMax;
+    int			entryCount;
+    int			entryMax;
+    int			unitCount;
+    int			unitMax;
+    int			isShared;	/* "nodes" and "entries" are an image */
+    int			rootChild[UCHAR_MAX+1];	/* children of the root */
+} IdTrie;
+
+#define IDT_INITIAL_SIZE	256	/* initial number of nodes and entries */
+
+/*
+ * Returns the character of a key.
+ *
+ * Arguments:
+ *	c	A character of an identifier.
+ *	isName	Whether the identifier is a name.
+ * Returns:
+ *	The character of the key: "c" in lowercase if "isName" is true;
+ *	otherwise, "c".
+ */
+#define KEY_CHAR(c, isName) \
+    ((isName) ? tolower((unsigned char)(c)) : (unsigned char)(c))
+
+
+/*
+ * Returns a new identifier-trie.
+ *
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be UT_OS.
+ *	else	Pointer to the new identifier-trie.
+ */
+static IdTrie*
+idtNew(void)
+{
+    IdTrie*	trie = malloc(sizeof(IdTrie));
+
+    if (trie != NULL) {
+	trie->nodes = malloc(IDT_INITIAL_SIZE*sizeof(TrieNode));
+	trie->entries = malloc(IDT_INITIAL_SIZE*sizeof(TrieEntry));
+	trie->units = malloc(IDT_INITIAL_SIZE*sizeof(ut_unit*));
+
+	if (trie->nodes == NULL || trie->entries == NULL ||
+		trie->units == NULL) {
+	    free(trie->nodes);
+	    free(trie->entries);
+	    free(trie->units);
+	    free(trie);
+	    trie = NULL;
+	}
+	else {
+	    int	i;
+
+	    trie->nodes[0].child = -1;
+	    trie->nodes[0].sibling = -1;
+	    trie->nodes[0].entry = -1;
+	    trie->nodes[0].label = 0;
+	    trie->nodeCount = 1;
+	    trie->nodeMax = IDT_INITIAL_SIZE;
+	    trie->entryCount = 0;
+	    trie->entryMax = IDT_INITIAL_SIZE;
+	    trie->unitCount = 0;
+	    trie->unitMax = IDT_INITIAL_SIZE;
+	    trie->isShared = 0;
+
+	    for (i = 0; i <= UCHAR_MAX; i++)
+		trie->rootChild[i] = -1;
+	}
+    }
+
+    if (trie == NULL) {
+	ut_set_status(UT_OS);
+	ut_handle_error_message(strerror(errno));
+	ut_handle_error_message("idtNew(): Couldn't allocate identifier-trie");
+    }
+
+    return trie;
+}
+
+
+/*
+ * Frees an identifier-trie.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie or NULL.
+ */
+static void
+idtFree(
+    IdTrie* const	trie)
+{
+    if (trie != NULL) {
+	if (!trie->isShared) {
+	    free(trie->nodes);
+	    free(trie->entries);
+	}
+
+	free(trie->units);
+	free(trie);
+    }
+}
+
+
+/*
+ * Gives an identifier-trie its own copy of the nodes and entries of the image
+ * that it shares, if any, so that it can be modified.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie.
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+static ut_status
+idtUnshare(
+    IdTrie* const	trie)
+{
+    ut_status	status = UT_SUCCESS;
+
+    if (trie->isShared) {
+	const int	nodeMax = trie->nodeCount + IDT_INITIAL_SIZE;
+	const int	entryMax = trie->entryCount + IDT_INITIAL_SIZE;
+	TrieNode*	nodes = malloc(nodeMax*sizeof(TrieNode));
+	TrieEntry*	entries = malloc(entryMax*sizeof(TrieEntry));
+
+	if (nodes == NULL || entries == NULL) {
+	    free(nodes);
+	    free(entries);
+	    status = UT_OS;
+	    ut_set_status(status);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"idtUnshare(): Couldn't copy identifier-trie");
+	}
+	else {
+	    (void)memcpy(nodes, trie->nodes, trie->nodeCount*sizeof(TrieNode));
+	    (void)memcpy(entries, trie->entries,
+		trie->entryCount*sizeof(TrieEntry));
+	    trie->nodes = nodes;
+	    trie->nodeMax = nodeMax;
+	    trie->entries = entries;
+	    trie->entryMax = entryMax;
+	    trie->isShared = 0;
+	}
+    }
+
+    return status;
+}
+
+
+/*
+ * Returns the identifier-trie of a unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	create	Whether to create the identifier-trie if it doesn't exist.
+ * Returns:
+ *	NULL	The unit-system doesn't have an identifier-trie and "create"
+ *		is false, or an operating-system failure occurred.
+ *	else	Pointer to the identifier-trie of "system".
+ */
+static IdTrie*
+getTrie(
+    const ut_system* const	system,
+    const int			create)
+{
+    IdTrie** const	trie = (IdTrie**)coreGetTable(system, ST_ID_TRIE);
+
+    if (*trie == NULL && create)
+	*trie = idtNew();
+
+    return *trie;
+}
+
+
+/*
+ * Returns the child of a node of an identifier-trie that's led to by a
+ * character.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie.
+ *	node	Index of the node.
+ *	c	The character.
+ * Returns:
+ *	-1	"node" has no such child.
+ *	else	Index of the child.
+ */
+static int
+idtChild(
+    const IdTrie* const	trie,
+    const int		node,
+    const int		c)
+{
+    int		child;
+
+    if (node == 0) {
+	child = trie->rootChild[c];
+    }
+    else {
+	for (child = trie->nodes[node].child;
+		child >= 0 && trie->nodes[child].label != c;
+		child = trie->nodes[child].sibling)
+	    ;
+    }
+
+    return child;
+}
+
+
+/*
+ * Returns the entry of a node of an identifier-trie.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie.
+ *	node	Index of the node or -1.
+ * Returns:
+ *	NULL	"node" is -1 or the root or doesn't end an identifier.
+ *	else	Pointer to the entry of "node".
+ */
+static TrieEntry*
+idtEntry(
+    const IdTrie* const	trie,
+    const int		node)
+{
+    return node > 0 && trie->nodes[node].entry >= 0
+	? trie->entries + trie->nodes[node].entry
+	: NULL;
+}
+
+
+/*
+ * Returns the unit of a slot of an identifier-trie.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie.
+ *	slot	Index of the slot or -1.
+ * Returns:
+ *	NULL	"slot" is -1 or its identifier is unmapped.
+ *	else	Pointer to the unit of "slot".
+ */
+static const ut_unit*
+idtUnit(
+    const IdTrie* const	trie,
+    const int		slot)
+{
+    return slot >= 0 ? trie->units[slot] : NULL;
+}
+
+
+/*
+ * Returns the entry of an identifier.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie.
+ *	id	Pointer to the identifier.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	NULL	"trie" doesn't contain "id".
+ *	else	Pointer to the entry of "id".
+ */
+static TrieEntry*
+idtFind(
+    const IdTrie* const	trie,
+    const char*		id,
+    const int		isName)
+{
+    int		node = 0;
+
+    for (; *id != 0 && node >= 0; id++)
+	node = idtChild(trie, node, KEY_CHAR(*id, isName));
+
+    return idtEntry(trie, node);
+}
+
+
+/*
+ * Returns the entry of an identifier, adding the identifier if necessary.
+ *
+ * Arguments:
+ *	trie	Pointer to the identifier-trie.  Mustn't share an image.
+ *	id	Pointer to the identifier.  Must not be empty.
+ *	isName	Whether "id" is a name rather than a symbol.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be UT_OS.
+ *	else	Pointer to the entry of "id".
+ */
+static TrieEntry*
+idtInsert(
+    IdTrie* const	trie,
+    const char*		id,
+    const int		isName)
+{
+    TrieEntry*	entry = NULL;		/* failure */
+    int		node = 0;
+
+    for (; *id != 0; id++) {
+	const int	c = KEY_CHAR(*id, isName);
+	int		child = idtChild(trie, node, c);
+
+	if (child < 0) {
+	    if (trie->nodeCount == trie->nodeMax) {
+		TrieNode*	nodes = realloc(trie->nodes,
+		    2*trie->nodeMax*sizeof(TrieNode));
+
+		if (nodes == NULL)
+		    break;
+
+		trie->nodes = nodes;
+		trie->nodeMax *= 2;
+	    }
+
+	    child = trie->nodeCount++;
+	    trie->nodes[child].child = -1;
+	    trie->nodes[child].entry = -1;
+	    trie->nodes[child].label = (unsigned char)c;
+
+	    if (node == 0) {
+		trie->nodes[child].sibling = -1;
+		trie->rootChild[c] = child;
+	    }
+	    else {
+		trie->nodes[child].sibling = trie->nodes[node].child;
+		trie->nodes[node].child = child;
+	    }
+	}
+
+	node = child;
+    }
+
+    if (*id == 0) {
+	if (trie->nodes[node].entry >= 0) {
+	    entry = trie->entries + trie->nodes[node].entry;
+	}
+	else {
+	    if (trie->entryCount == trie->entryMax) {
+		TrieEntry*	entries = realloc(trie->entries,
+		    2*trie->entryMax*sizeof(TrieEntry));
+
+		if (entries != NULL) {
+		    trie->entries = entries;
+		    trie->entryMax *= 2;
+		}
+	    }
+
+	    if (trie->entryCount < trie->entryMax) {
+		trie->nodes[node].entry = trie->entryCount++;
+		entry = trie->entries + trie->nodes[node].entry;
+		entry->nameUnit = -1;
+		entry->symbolUnit = -1;
+		entry->namePrefix = 0;
+		entry->symbolPrefix = 0;
+	    }
+	}
+    }
+
+    if (entry == NULL) {
+	ut_set_status(UT_OS);
+	ut_handle_error_message(strerror(errno));
+	ut_handle_error_message("idtInsert(): Couldn't grow identifier-trie");
+    }
+
+    return entry;
+}
+
+
+/******************************************************************************
+ * Internal API:
+ ******************************************************************************/
+
+
+/*
+ * Adds to the identifier-trie of a unit-system a mapping from a unit-name or
+ * unit-symbol to a unit.  An existing mapping of the identifier is replaced.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the identifier.  May be freed upon return.
+ *	unit		Pointer to the unit.  Must remain valid until the
+ *			mapping is removed or the unit-system is freed.
+ *	isName		Whether "id" is a name (case-insensitive) rather than
+ *			a symbol (case-sensitive).
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtAddUnit(
+    const ut_system* const	system,
+    const char* const		id,
+    const ut_unit* const	unit,
+    const int			isName)
+{
+    ut_status		status = UT_OS;
+    IdTrie* const	trie = getTrie(system, 1);
+
+    if (trie != NULL) {
+	TrieEntry*	entry = idtFind(trie, id, isName);
+	int		slot = -1;
+
+	if (entry != NULL)
+	    slot = isName ? entry->nameUnit : entry->symbolUnit;
+
+	if (slot >= 0) {
+	    trie->units[slot] = unit;
+	    status = UT_SUCCESS;
+	}
+	else if (idtUnshare(trie) == UT_SUCCESS) {
+	    entry = idtInsert(trie, id, isName);
+
+	    if (entry != NULL) {
+		if (trie->unitCount == trie->unitMax) {
+		    const ut_unit**	units = realloc(trie->units,
+			2*trie->unitMax*sizeof(ut_unit*));
+
+		    if (units != NULL) {
+			trie->units = units;
+			trie->unitMax *= 2;
+		    }
+		}
+
+		if (trie->unitCount == trie->unitMax) {
+		    ut_set_status(UT_OS);
+		    ut_handle_error_message(strerror(errno));
+		    ut_handle_error_message(
+			"idtAddUnit(): Couldn't grow identifier-trie");
+		}
+		else {
+		    slot = trie->unitCount++;
+		    trie->units[slot] = unit;
+
+		    if (isName) {
+			entry->nameUnit = slot;
+		    }
+		    else {
+			entry->symbolUnit = slot;
+		    }
+
+		    status = UT_SUCCESS;
+		}
+	    }
+	}
+    }
+
+    return status;
+}
+
+
+/*
+ * Removes from the identifier-trie of a unit-system the mapping from a
+ * unit-name or unit-symbol to a unit.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the identifier.  May be freed upon return.
+ *	isName		Whether "id" is a name rather than a symbol.
+ */
+void
+idtRemoveUnit(
+    const ut_system* const	system,
+    const char* const		id,
+    const int			isName)
+{
+    IdTrie* const	trie = getTrie(system, 0);
+
+    if (trie != NULL) {
+	const TrieEntry* const	entry = idtFind(trie, id, isName);
+
+	if (entry != NULL) {
+	    const int	slot = isName ? entry->nameUnit : entry->symbolUnit;
+
+	    if (slot >= 0)
+		trie->units[slot] = NULL;
+	}
+    }
+}
+
+
+/*
+ * Adds a prefix to the identifier-trie of a unit-system.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the prefix (e.g., "mega", "M").  May be freed
+ *			upon return.
+ *	value		The value of the prefix (e.g., 1e6).  Must not be 0.
+ *	isName		Whether "id" is a name-prefix (case-insensitive) rather
+ *			than a symbol-prefix (case-sensitive).
+ * Returns:
+ *	UT_EXISTS	"id" already maps to a different value.
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtAddPrefix(
+    const ut_system* const	system,
+    const char* const		id,
+    const double		value,
+    const int			isName)
+{
+    ut_status		status = UT_OS;
+    IdTrie* const	trie = getTrie(system, 1);
+
+    if (trie != NULL) {
+	TrieEntry*	entry = idtFind(trie, id, isName);
+	double		prefix = 0;
+
+	if (entry != NULL)
+	    prefix = isName ? entry->namePrefix : entry->symbolPrefix;
+
+	if (prefix != 0) {
+	    status = prefix == value ? UT_SUCCESS : UT_EXISTS;
+	}
+	else if (idtUnshare(trie) == UT_SUCCESS) {
+	    entry = idtInsert(trie, id, isName);
+
+	    if (entry != NULL) {
+		if (isName) {
+		    entry->namePrefix = value;
+		}
+		else {
+		    entry->symbolPrefix = value;
+		}
+
+		status = UT_SUCCESS;
+	    }
+	}
+    }
+
+    return status;
+}
+
+
+/*
+ * Returns the longest prefix of a unit-system that begins a string.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	string		Pointer to the string to be examined for a prefix.
+ *	isName		Whether to look for a name-prefix rather than a
+ *			symbol-prefix.
+ *	value		NULL or pointer to the memory location to receive the
+ *			value of the prefix, if one is discovered.
+ *	len		NULL or pointer to the memory location to receive the
+ *			number of characters in the prefix, if one is
+ *			discovered.
+ * Returns:
+ *	UT_UNKNOWN	A prefix was not discovered.
+ *	UT_SUCCESS	Success.  "*value" and "*len" will be set if non-NULL.
+ */
+ut_status
+idtFindPrefix(
+    const ut_system* const	system,
+    const char* const		string,
+    const int			isName,
+    double* const		value,
+    size_t* const		len)
+{
+    ut_status			status = UT_UNKNOWN;
+    const IdTrie* const		trie = getTrie(system, 0);
+
+    if (trie != NULL) {
+	int	node = 0;
+	size_t	i;
+
+	for (i = 0; string[i] != 0 && node >= 0; i++) {
+	    const TrieEntry*	entry;
+
+	    node = idtChild(trie, node, KEY_CHAR(string[i], isName));
+	    entry = idtEntry(trie, node);
+
+	    if (entry != NULL &&
+		    (isName ? entry->namePrefix : entry->symbolPrefix) != 0) {
+		if (value != NULL)
+		    *value = isName ? entry->namePrefix : entry->symbolPrefix;
+
+		if (len != NULL)
+		    *len = i + 1;
+
+		status = UT_SUCCESS;
+	    }
+	}
+    }
+
+    return status;
+}
+
+
+/*
+ * Resolves a unit identifier that might have prefixes (e.g., "kilometers",
+ * "km", "megakm").  At each position, the rest of the identifier is first
+ * looked up as a unit-name and then as a unit-symbol; failing that, the
+ * longest name-prefix or, if no symbol-prefix has been seen, the longest
+ * symbol-prefix is consumed.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the identifier.
+ *	scale		Pointer to the memory location to receive the product
+ *			of the values of the prefixes.
+ * Returns:
+ *	NULL		"id" doesn't resolve to a unit.
+ *	else		Pointer to the unit.  The client must not free it.
+ */
+const ut_unit*
+idtResolve(
+    const ut_system* const	system,
+    const char* const		id,
+    double* const		scale)
+{
+    const ut_unit*	unit = NULL;
+    const IdTrie* const	trie = getTrie(system, 0);
+
+    *scale = 1;
+
+    if (trie != NULL) {
+	const char*	cp = id;
+	int		symbolPrefixSeen = 0;
+
+	while (*cp != 0 && unit == NULL) {
+	    int		nameNode = 0;
+	    int		symbolNode = 0;
+	    size_t	nameLen = 0;
+	    size_t	symbolLen = 0;
+	    double	nameValue = 0;
+	    double	symbolValue = 0;
+	    size_t	i;
+
+	    const TrieEntry*	entry;
+
+	    /*
+	     * Follow the rest of the identifier as a name and as a symbol,
+	     * noting the longest prefix of each kind along the way.
+	     */
+	    for (i = 0; cp[i] != 0 && (nameNode >= 0 || symbolNode >= 0);
+		    i++) {
+		if (nameNode >= 0) {
+		    nameNode = idtChild(trie, nameNode, KEY_CHAR(cp[i], 1));
+		    entry = idtEntry(trie, nameNode);
+
+		    if (entry != NULL && entry->namePrefix != 0) {
+			nameValue = entry->namePrefix;
+			nameLen = i + 1;
+		    }
+		}
+
+		if (symbolNode >= 0) {
+		    symbolNode = idtChild(trie, symbolNode, KEY_CHAR(cp[i], 0));
+		    entry = idtEntry(trie, symbolNode);
+
+		    if (entry != NULL && entry->symbolPrefix != 0) {
+			symbolValue = entry->symbolPrefix;
+			symbolLen = i + 1;
+		    }
+		}
+	    }
+
+	    /*
+	     * A cursor that's still in the trie is at the end of the
+	     * identifier.
+	     */
+	    entry = idtEntry(trie, nameNode);
+
+	    if (entry != NULL)
+		unit = idtUnit(trie, entry->nameUnit);
+
+	    entry = idtEntry(trie, symbolNode);
+
+	    if (unit == NULL && entry != NULL)
+		unit = idtUnit(trie, entry->symbolUnit);
+
+	    if (unit == NULL) {
+		if (nameLen > 0) {
+		    *scale *= nameValue;
+		    cp += nameLen;
+		}
+		else if (!symbolPrefixSeen && symbolLen > 0) {
+		    symbolPrefixSeen = 1;
+		    *scale *= symbolValue;
+		    cp += symbolLen;
+		}
+		else {
+		    break;
+		}
+	    }
+	}
+    }
+
+    return unit;
+}
+
+
+/*
+ * Returns the image of the identifier-trie of a unit-system.  The image is
+ * valid until the trie is modified.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	image		Pointer to the image to be set.  "image->slots" will be
+ *			NULL.
+ *	units		Pointer to the memory location to receive the address
+ *			of the unit of each slot (NULL for an unmapped
+ *			identifier).
+ * Returns:
+ *	UT_UNKNOWN	The unit-system doesn't have an identifier-trie.
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtGetImage(
+    const ut_system* const	system,
+    TrieImage* const		image,
+    const ut_unit* const** const units)
+{
+    ut_status			status = UT_UNKNOWN;
+    const IdTrie* const		trie = getTrie(system, 0);
+
+    if (trie != NULL) {
+	image->nodes = trie->nodes;
+	image->entries = trie->entries;
+	image->rootChild = trie->rootChild;
+	image->slots = NULL;
+	image->nodeCount = trie->nodeCount;
+	image->entryCount = trie->entryCount;
+	image->slotCount = trie->unitCount;
+	*units = trie->units;
+	status = UT_SUCCESS;
+    }
+
+    return status;
+}
+
+
+/*
+ * Sets the identifier-trie of a unit-system from an image.  The nodes and
+ * entries of the image are shared rather than copied until the trie is
+ * modified.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.  Mustn't have an
+ *			identifier-trie.
+ *	image		Pointer to the image.  The nodes and entries must
+ *			remain valid until the unit-system is freed.
+ *	units		Units indexed by "image->slots".  The units must remain
+ *			valid until the unit-system is freed.
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtSetImage(
+    const ut_system* const	system,
+    const TrieImage* const	image,
+    ut_unit* const* const	units)
+{
+    ut_status		status = UT_OS;
+    IdTrie** const	trie = (IdTrie**)coreGetTable(system, ST_ID_TRIE);
+    IdTrie*		newTrie = malloc(sizeof(IdTrie));
+
+    assert(*trie == NULL);
+
+    if (newTrie != NULL) {
+	newTrie->unitMax = image->slotCount + IDT_INITIAL_SIZE;
+	newTrie->units = malloc(newTrie->unitMax*sizeof(ut_unit*));
+
+	if (newTrie->units == NULL) {
+	    free(newTrie);
+	}
+	else {
+	    int	i;
+
+	    for (i = 0; i < image->slotCount; i++)
+		newTrie->units[i] =
+		    image->slots[i] < 0 ? NULL : units[image->slots[i]];
+
+	    (void)memcpy(newTrie->rootChild, image->rootChild,
+		sizeof(newTrie->rootChild));
+	    newTrie->nodes = (TrieNode*)image->nodes;
+	    newTrie->entries = (TrieEntry*)image->entries;
+	    newTrie->nodeCount = image->nodeCount;
+	    newTrie->nodeMax = image->nodeCount;
+	    newTrie->entryCount = image->entryCount;
+	    newTrie->entryMax = image->entryCount;
+	    newTrie->unitCount = image->slotCount;
+	    newTrie->isShared = 1;
+	    *trie = newTrie;
+	    status = UT_SUCCESS;
+	}
+    }
+
+    if (status != UT_SUCCESS) {
+	ut_set_status(status);
+	ut_handle_error_message(strerror(errno));
+	ut_handle_error_message(
+	    "idtSetImage(): Couldn't allocate identifier-trie");
+    }
+
+    return status;
+}
+
+
+/*
+ * Frees the identifier-trie of a unit-system.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system to have its associated
+ *			resources freed.
+ */
+void
+idtFreeSystem(
+    ut_system*	system)
+{
+    if (system != NULL) {
+	IdTrie** const	trie = (IdTrie**)coreGetTable(system, ST_ID_TRIE);
+
+	idtFree(*trie);
+	*trie = NULL;
+    }
+}
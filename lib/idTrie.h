@@ -0,0 +1,230 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+#ifndef UT_ID_TRIE_H_INCLUDED
+#define UT_ID_TRIE_H_INCLUDED
+
+#include <stddef.h>
+
+#include "udunits2.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * A node of an identifier-trie.
+ */
+typedef struct {
+    int			child;		/* index of first child or -1 */
+    int			sibling;	/* index of next sibling or -1 */
+    int			entry;		/* index of entry or -1 */
+    unsigned char	label;		/* character that leads to node */
+} TrieNode;
+
+/*
+ * The entry of a node that ends an identifier.  A unit is referenced by the
+ * index of its slot in the trie's array of units, whose element is NULL while
+ * the identifier is unmapped.
+ */
+typedef struct {
+    int			nameUnit;	/* slot of name's unit or -1 */
+    int			symbolUnit;	/* slot of symbol's unit or -1 */
+    double		namePrefix;	/* value of name-prefix or 0 */
+    double		symbolPrefix;	/* value of symbol-prefix or 0 */
+} TrieEntry;
+
+/*
+ * An image of an identifier-trie, as it's stored in the bundled database (see
+ * "bundledDb.h").
+ */
+typedef struct {
+    const TrieNode*	nodes;		/* "nodes[0]" is the root */
+    const TrieEntry*	entries;
+    const int*		rootChild;	/* UCHAR_MAX+1 children of the root */
+    const int*		slots;		/* index of the unit of each slot */
+    int			nodeCount;
+    int			entryCount;
+    int			slotCount;
+} TrieImage;
+
+
+/*
+ * Adds to the identifier-trie of a unit-system a mapping from a unit-name or
+ * unit-symbol to a unit.  An existing mapping of the identifier is replaced.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the identifier.  May be freed upon return.
+ *	unit		Pointer to the unit.  Must remain valid until the
+ *			mapping is removed or the unit-system is freed.
+ *	isName		Whether "id" is a name (case-insensitive) rather than
+ *			a symbol (case-sensitive).
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtAddUnit(
+    const ut_system* const	system,
+    const char* const		id,
+    const ut_unit* const	unit,
+    const int			isName);
+
+
+/*
+ * Removes from the identifier-trie of a unit-system the mapping from a
+ * unit-name or unit-symbol to a unit.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the identifier.  May be freed upon return.
+ *	isName		Whether "id" is a name rather than a symbol.
+ */
+void
+idtRemoveUnit(
+    const ut_system* const	system,
+    const char* const		id,
+    const int			isName);
+
+
+/*
+ * Adds a prefix to the identifier-trie of a unit-system.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the prefix (e.g., "mega", "M").  May be freed
+ *			upon return.
+ *	value		The value of the prefix (e.g., 1e6).  Must not be 0.
+ *	isName		Whether "id" is a name-prefix (case-insensitive) rather
+ *			than a symbol-prefix (case-sensitive).
+ * Returns:
+ *	UT_EXISTS	"id" already maps to a different value.
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtAddPrefix(
+    const ut_system* const	system,
+    const char* const		id,
+    const double		value,
+    const int			isName);
+
+
+/*
+ * Returns the longest prefix of a unit-system that begins a string.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	string		Pointer to the string to be examined for a prefix.
+ *	isName		Whether to look for a name-prefix rather than a
+ *			symbol-prefix.
+ *	value		NULL or pointer to the memory location to receive the
+ *			value of the prefix, if one is discovered.
+ *	len		NULL or pointer to the memory location to receive the
+ *			number of characters in the prefix, if one is
+ *			discovered.
+ * Returns:
+ *	UT_UNKNOWN	A prefix was not discovered.
+ *	UT_SUCCESS	Success.  "*value" and "*len" will be set if non-NULL.
+ */
+ut_status
+idtFindPrefix(
+    const ut_system* const	system,
+    const char* const		string,
+    const int			isName,
+    double* const		value,
+    size_t* const		len);
+
+
+/*
+ * Resolves a unit identifier that might have prefixes (e.g., "kilometers",
+ * "km", "megakm").  At each position, the rest of the identifier is first
+ * looked up as a unit-name and then as a unit-symbol; failing that, the
+ * longest name-prefix or, if no symbol-prefix has been seen, the longest
+ * symbol-prefix is consumed.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	id		Pointer to the identifier.
+ *	scale		Pointer to the memory location to receive the product
+ *			of the values of the prefixes.
+ * Returns:
+ *	NULL		"id" doesn't resolve to a unit.
+ *	else		Pointer to the unit.  The client must not free it.
+ */
+const ut_unit*
+idtResolve(
+    const ut_system* const	system,
+    const char* const		id,
+    double* const		scale);
+
+
+/*
+ * Returns the image of the identifier-trie of a unit-system.  The image is
+ * valid until the trie is modified.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.
+ *	image		Pointer to the image to be set.  "image->slots" will be
+ *			NULL.
+ *	units		Pointer to the memory location to receive the address
+ *			of the unit of each slot (NULL for an unmapped
+ *			identifier).
+ * Returns:
+ *	UT_UNKNOWN	The unit-system doesn't have an identifier-trie.
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtGetImage(
+    const ut_system* const	system,
+    TrieImage* const		image,
+    const ut_unit* const** const units);
+
+
+/*
+ * Sets the identifier-trie of a unit-system from an image.  The nodes and
+ * entries of the image are shared rather than copied until the trie is
+ * modified.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system.  Mustn't have an
+ *			identifier-trie.
+ *	image		Pointer to the image.  The nodes and entries must
+ *			remain valid until the unit-system is freed.
+ *	units		Units indexed by "image->slots".  The units must remain
+ *			valid until the unit-system is freed.
+ * Returns:
+ *	UT_OS		Operating-system failure.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+ut_status
+idtSetImage(
+    const ut_system* const	system,
+    const TrieImage* const	image,
+    ut_unit* const* const	units);
+
+
+/*
+ * Frees the identifier-trie of a unit-system.
+ *
+ * Arguments:
+ *	system		Pointer to the unit-system to have its associated
+ *			resources freed.
+ */
+void
+idtFreeSystem(
+    ut_system*	system);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
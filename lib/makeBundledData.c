@@ -0,0 +1,894 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Generates the C source-file of the bundled unit database (see "bundledDb.h")
+ * from an XML unit database.  Usage:
+ *
+ *	makeBundledData XML_file C_file
+ *
+ * The XML database is read and the resulting unit-system is written as a
+ * program of unit operations, minimal perfect hash-tables of its unit-names
+ * and unit-symbols, and the image of its identifier-trie.
+ */
+
+#ifndef	_XOPEN_SOURCE
+#   define _XOPEN_SOURCE 500
+#endif
+
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "udunits2.h"
+#include "bundledDb.h"
+#include "idTrie.h"
+#include "unitToIdMap.h"
+
+#define MAX_ID_LEN	1024		/* maximum length of an identifier */
+#define IDS_PER_BUCKET	4		/* average keys per hash-bucket */
+
+/*
+ * A unit of the database and the operation that creates it.
+ */
+typedef struct {
+    const ut_unit*	unit;
+    BundledOp		op;
+    const ut_unit*	underlying;	/* or NULL */
+    double		scale;		/* scale-factor or logarithmic base */
+    double		offset;		/* offset or time-origin */
+    int			count;		/* number of factors of a product */
+    const ut_unit**	factors;	/* basic-units of a product */
+    int*		powers;		/* powers of "factors" */
+} Unit;
+
+/*
+ * A unit-name or unit-symbol of the database.
+ */
+typedef struct {
+    char*		key;
+    const ut_unit*	unit;
+    unsigned long	hash;
+} Id;
+
+static const char*	_progname;
+static Unit*		_units;
+static int		_unitCount;
+static int		_unitMax;
+
+
+/*
+ * Prints an error-message to the standard error stream and exits.
+ *
+ * Arguments:
+ *	format	The format for the error-message.  It shouldn't have a
+ *		trailing newline.
+ *	...	Arguments referenced by the format.
+ */
+static void
+fatal(
+    const char* const	format,
+    ...)
+{
+    va_list	ap;
+
+    (void)fprintf(stderr, "%s: ", _progname);
+    va_start(ap, format);
+    (void)vfprintf(stderr, format, ap);
+    va_end(ap);
+    (void)fputc('\n', stderr);
+
+    exit(EXIT_FAILURE);
+}
+
+
+/*
+ * Allocates memory or exits.
+ *
+ * Arguments:
+ *	size	The number of bytes to allocate.
+ * Returns:
+ *	Pointer to the allocated memory.
+ */
+static void*
+allocate(
+    const size_t	size)
+{
+    void*	ptr = malloc(size == 0 ? 1 : size);
+
+    if (ptr == NULL)
+	fatal("Couldn't allocate %lu bytes: %s", (unsigned long)size,
+	    strerror(errno));
+
+    return ptr;
+}
+
+
+/*
+ * Returns the index of a unit in the list of units.
+ *
+ * Arguments:
+ *	unit	Pointer to the unit.
+ * Returns:
+ *	-1	"unit" isn't in the list.
+ *	else	Index of "unit".
+ */
+static int
+unitIndex(
+    const ut_unit* const	unit)
+{
+    int		i;
+
+    for (i = 0; i < _unitCount && _units[i].unit != unit; i++)
+	;
+
+    return i < _unitCount ? i : -1;
+}
+
+
+static ut_status
+visitBasic(
+    const ut_unit*	unit,
+    void*		arg)
+{
+    Unit* const	u = (Unit*)arg;
+
+    u->op = ut_is_dimensionless(unit) ? BU_DIMENSIONLESS : BU_BASE;
+
+    return UT_SUCCESS;
+}
+
+
+static ut_status
+visitProduct(
+    const ut_unit*		unit,
+    int				count,
+    const ut_unit* const*	basicUnits,
+    const int*			powers,
+    void*			arg)
+{
+    Unit* const	u = (Unit*)arg;
+    int		i;
+
+    u->op = BU_PRODUCT;
+    u->count = count;
+    u->factors = allocate(count*sizeof(ut_unit*));
+    u->powers = allocate(count*sizeof(int));
+
+    for (i = 0; i < count; i++) {
+	u->factors[i] = basicUnits[i];
+	u->powers[i] = powers[i];
+    }
+
+    return UT_SUCCESS;
+}
+
+
+static ut_status
+visitGalilean(
+    const ut_unit*	unit,
+    double		scale,
+    const ut_unit*	underlyingUnit,
+    double		offset,
+    void*		arg)
+{
+    Unit* const	u = (Unit*)arg;
+
+    u->op = BU_GALILEAN;
+    u->underlying = underlyingUnit;
+    u->scale = scale;
+    u->offset = offset;
+
+    return UT_SUCCESS;
+}
+
+
+static ut_status
+visitTimestamp(
+    const ut_unit*	unit,
+    const ut_unit*	timeUnit,
+    double		origin,
+    void*		arg)
+{
+    Unit* const	u = (Unit*)arg;
+
+    u->op = BU_TIMESTAMP;
+    u->underlying = timeUnit;
+    u->offset = origin;
+
+    return UT_SUCCESS;
+}
+
+
+static ut_status
+visitLogarithmic(
+    const ut_unit*	unit,
+    double		base,
+    const ut_unit*	reference,
+    void*		arg)
+{
+    Unit* const	u = (Unit*)arg;
+
+    u->op = BU_LOG;
+    u->underlying = reference;
+    u->scale = base;
+
+    return UT_SUCCESS;
+}
+
+
+static ut_visitor	visitor = {
+    visitBasic,
+    visitProduct,
+    visitGalilean,
+    visitTimestamp,
+    visitLogarithmic
+};
+
+
+/*
+ * Adds a unit to the list of units after the units on which it depends.
+ *
+ * Arguments:
+ *	unit	Pointer to the unit.
+ */
+static void
+addUnit(
+    const ut_unit* const	unit)
+{
+    if (unitIndex(unit) < 0) {
+	Unit	u;
+	int	i;
+
+	u.unit = unit;
+	u.underlying = NULL;
+	u.scale = 1;
+	u.offset = 0;
+	u.count = 0;
+	u.factors = NULL;
+	u.powers = NULL;
+
+	if (ut_accept_visitor(unit, &visitor, &u) != UT_SUCCESS)
+	    fatal("Couldn't visit unit");
+
+	if (u.underlying != NULL)
+	    addUnit(u.underlying);
+
+	for (i = 0; i < u.count; i++)
+	    addUnit(u.factors[i]);
+
+	if (_unitCount == _unitMax) {
+	    _unitMax = _unitMax == 0 ? 256 : 2*_unitMax;
+	    _units = realloc(_units, _unitMax*sizeof(Unit));
+
+	    if (_units == NULL)
+		fatal("Couldn't grow list of units: %s", strerror(errno));
+	}
+
+	_units[_unitCount++] = u;
+    }
+}
+
+
+/*
+ * Compares basic-units by the order of their creation.
+ */
+static int
+compareBasics(
+    const void* const	ptr1,
+    const void* const	ptr2)
+{
+    return ut_compare(((const Unit*)ptr1)->unit, ((const Unit*)ptr2)->unit);
+}
+
+
+/*
+ * Sorts the units so that basic-units come first in the order of their
+ * creation, which gives them the same indexes when the database is loaded.
+ * Other units keep their order, in which a unit follows the units on which it
+ * depends.
+ */
+static void
+sortUnits(void)
+{
+    Unit*	basics = allocate(_unitCount*sizeof(Unit));
+    Unit*	others = allocate(_unitCount*sizeof(Unit));
+    int		basicCount = 0;
+    int		otherCount = 0;
+    int		i;
+
+    for (i = 0; i < _unitCount; i++) {
+	if (_units[i].op == BU_BASE || _units[i].op == BU_DIMENSIONLESS) {
+	    basics[basicCount++] = _units[i];
+	}
+	else {
+	    others[otherCount++] = _units[i];
+	}
+    }
+
+    qsort(basics, basicCount, sizeof(Unit), compareBasics);
+    (void)memcpy(_units, basics, basicCount*sizeof(Unit));
+    (void)memcpy(_units + basicCount, others, otherCount*sizeof(Unit));
+    free(basics);
+    free(others);
+}
+
+
+/*
+ * Adds the identifiers of a node of an identifier-trie and of its descendants
+ * to the lists of names and symbols.
+ *
+ * Arguments:
+ *	image		Pointer to the image of the trie.
+ *	units		The units of the slots of the trie.
+ *	node		Index of the node.
+ *	key		The key of the node.
+ *	len		The length of the key.
+ *	names		The list of names.
+ *	nameCount	The number of names.
+ *	symbols		The list of symbols.
+ *	symbolCount	The number of symbols.
+ */
+static void
+addIds(
+    const TrieImage* const	image,
+    const ut_unit* const*	units,
+    const int			node,
+    char* const			key,
+    const int			len,
+    Id* const			names,
+    int* const			nameCount,
+    Id* const			symbols,
+    int* const			symbolCount)
+{
+    const int	entry = image->nodes[node].entry;
+    int		child;
+    int		i;
+
+    if (entry >= 0) {
+	const TrieEntry* const	e = image->entries + entry;
+
+	key[len] = 0;
+
+	if (e->nameUnit >= 0 && units[e->nameUnit] != NULL) {
+	    names[*nameCount].key = strdup(key);
+
+	    if (names[*nameCount].key == NULL)
+		fatal("Couldn't duplicate identifier: %s", strerror(errno));
+
+	    names[*nameCount].unit = units[e->nameUnit];
+	    names[(*nameCount)++].hash = bdbHash(key, 1);
+	}
+
+	if (e->symbolUnit >= 0 && units[e->symbolUnit] != NULL) {
+	    symbols[*symbolCount].key = strdup(key);
+
+	    if (symbols[*symbolCount].key == NULL)
+		fatal("Couldn't duplicate identifier: %s", strerror(errno));
+
+	    symbols[*symbolCount].unit = units[e->symbolUnit];
+	    symbols[(*symbolCount)++].hash = bdbHash(key, 0);
+	}
+    }
+
+    if (len + 1 >= MAX_ID_LEN)
+	fatal("Identifier longer than %d characters", MAX_ID_LEN - 1);
+
+    /*
+     * The children of the root are only in "image->rootChild".
+     */
+    for (i = 0; node == 0 && i <= UCHAR_MAX; i++) {
+	if (image->rootChild[i] >= 0) {
+	    key[len] = (char)i;
+	    addIds(image, units, image->rootChild[i], key, len + 1, names,
+		nameCount, symbols, symbolCount);
+	}
+    }
+
+    for (child = image->nodes[node].child; child >= 0;
+	    child = image->nodes[child].sibling) {
+	key[len] = (char)image->nodes[child].label;
+	addIds(image, units, child, key, len + 1, names, nameCount, symbols,
+	    symbolCount);
+    }
+}
+
+
+/*
+ * Frees identifiers.
+ *
+ * Arguments:
+ *	ids		The identifiers.
+ *	count		The number of identifiers.
+ */
+static void
+freeIds(
+    Id* const	ids,
+    const int	count)
+{
+    int		i;
+
+    for (i = 0; i < count; i++)
+	free(ids[i].key);
+
+    free(ids);
+}
+
+/*
+ * Computes the displacements of a minimal perfect hash-table and puts the
+ * identifiers in slot order.
+ *
+ * Arguments:
+ *	ids		The identifiers.  Reordered on return.
+ *	count		The number of identifiers.
+ *	bucketCount	The number of buckets.
+ * Returns:
+ *	Pointer to the displacements of the buckets.
+ */
+static int*
+makeHash(
+    Id* const	ids,
+    const int	count,
+    const int	bucketCount)
+{
+    int* const		displacements = allocate(bucketCount*sizeof(int));
+    int* const		bucketSizes = allocate(bucketCount*sizeof(int));
+    int* const		order = allocate(bucketCount*sizeof(int));
+    int* const		members = allocate(count*sizeof(int));
+    int* const		slots = allocate(count*sizeof(int));
+    int* const		idOfSlot = allocate(count*sizeof(int));
+    Id* const		sorted = allocate(count*sizeof(Id));
+    int			size;
+    int			orderCount;
+    int			n = 0;
+    int			i;
+
+    for (i = 0; i < bucketCount; i++) {
+	displacements[i] = 0;
+	bucketSizes[i] = 0;
+    }
+
+    for (i = 0; i < count; i++) {
+	bucketSizes[ids[i].hash % (unsigned long)bucketCount]++;
+	idOfSlot[i] = -1;
+    }
+
+    /*
+     * The buckets are placed from the largest to the smallest so that the
+     * large ones see an almost empty table.
+     */
+    for (size = count; size > 0; size--) {
+	for (i = 0; i < bucketCount; i++) {
+	    if (bucketSizes[i] == size)
+		order[n++] = i;
+	}
+    }
+
+    for (orderCount = n, n = 0; n < orderCount; n++) {
+	const int	bucket = order[n];
+	int		memberCount = 0;
+	int		j;
+
+	for (i = 0; i < count; i++) {
+	    if (ids[i].hash % (unsigned long)bucketCount == bucket)
+		members[memberCount++] = i;
+	}
+
+	if (memberCount == 1) {
+	    /*
+	     * A bucket with one key is given the first free slot.
+	     */
+	    for (i = 0; idOfSlot[i] >= 0; i++)
+		;
+
+	    displacements[bucket] = ~i;
+	    idOfSlot[i] = members[0];
+	}
+	else {
+	    int	displacement;
+	    int	isFree = 0;
+
+	    for (displacement = 0; !isFree && displacement < INT_MAX;
+		    displacement++) {
+		isFree = 1;
+
+		for (i = 0; isFree && i < memberCount; i++) {
+		    slots[i] = bdbSlot(ids[members[i]].hash, displacement,
+			count);
+		    isFree = idOfSlot[slots[i]] < 0;
+
+		    for (j = 0; isFree && j < i; j++)
+			isFree = slots[j] != slots[i];
+		}
+	    }
+
+	    if (!isFree)
+		fatal("Couldn't place hash-bucket of %d identifiers",
+		    memberCount);
+
+	    displacements[bucket] = displacement - 1;
+
+	    for (i = 0; i < memberCount; i++)
+		idOfSlot[slots[i]] = members[i];
+	}
+    }
+
+    for (i = 0; i < count; i++)
+	sorted[i] = ids[idOfSlot[i]];
+
+    (void)memcpy(ids, sorted, count*sizeof(Id));
+
+    free(bucketSizes);
+    free(order);
+    free(members);
+    free(slots);
+    free(idOfSlot);
+    free(sorted);
+
+    return displacements;
+}
+
+
+/*
+ * Writes a string as a C string-literal.
+ *
+ * Arguments:
+ *	file	The output file.
+ *	string	The string.
+ */
+static void
+writeString(
+    FILE* const		file,
+    const char*		string)
+{
+    (void)fputc('"', file);
+
+    for (; *string != 0; string++) {
+	const unsigned char	c = (unsigned char)*string;
+
+	if (c < ' ' || c > '~' || c == '"' || c == '\\' || c == '?') {
+	    (void)fprintf(file, "\\%03o", c);
+	}
+	else {
+	    (void)fputc(c, file);
+	}
+    }
+
+    (void)fputc('"', file);
+}
+
+
+/*
+ * Writes a minimal perfect hash-table of identifiers.
+ *
+ * Arguments:
+ *	file	The output file.
+ *	name	The name of the table (e.g., "names").
+ *	ids	The identifiers.
+ *	count	The number of identifiers.
+ * Returns:
+ *	The number of buckets of the table.
+ */
+static int
+writeHash(
+    FILE* const		file,
+    const char* const	name,
+    Id* const		ids,
+    const int		count)
+{
+    const int	bucketCount = count/IDS_PER_BUCKET + 1;
+    int* const	displacements = makeHash(ids, count, bucketCount);
+    int		i;
+
+    (void)fprintf(file, "\nstatic const BundledId %s[] = {\n", name);
+
+    for (i = 0; i < count; i++) {
+	(void)fputs("    {", file);
+	writeString(file, ids[i].key);
+	(void)fprintf(file, ", %d},\n", unitIndex(ids[i].unit));
+    }
+
+    (void)fprintf(file, "    {NULL, -1}\n};\n");
+    (void)fprintf(file, "\nstatic const int %sDisplacements[] = {", name);
+
+    for (i = 0; i < bucketCount; i++)
+	(void)fprintf(file, "%s%d,", i % 10 == 0 ? "\n    " : " ",
+	    displacements[i]);
+
+    (void)fprintf(file, "\n};\n");
+    free(displacements);
+
+    return bucketCount;
+}
+
+
+/*
+ * Writes the identifiers to which the units map.
+ *
+ * Arguments:
+ *	file	The output file.
+ *	name	The name of the array (e.g., "unitNames").
+ *	isName	Whether to write names rather than symbols.
+ * Returns:
+ *	The number of unit-identifiers.
+ */
+static int
+writeUnitIds(
+    FILE* const		file,
+    const char* const	name,
+    const int		isName)
+{
+    static const char* const	encodings[] = {"UT_ASCII", "UT_LATIN1",
+	"UT_UTF8"};
+    int				count = 0;
+    int				i;
+
+    (void)fprintf(file, "\nstatic const BundledUnitId %s[] = {\n", name);
+
+    for (i = 0; i < _unitCount; i++) {
+	int	encoding;
+
+	for (encoding = UT_ASCII; encoding <= UT_UTF8; encoding++) {
+	    const char* const	id =
+		utimGetId(_units[i].unit, isName, (ut_encoding)encoding);
+
+	    if (id != NULL) {
+		(void)fprintf(file, "    {%d, %s, ", i, encodings[encoding]);
+		writeString(file, id);
+		(void)fputs("},\n", file);
+		count++;
+	    }
+	}
+    }
+
+    (void)fprintf(file, "    {-1, UT_ASCII, NULL}\n};\n");
+
+    return count;
+}
+
+
+/*
+ * Writes the units.
+ *
+ * Arguments:
+ *	file	The output file.
+ */
+static void
+writeUnits(
+    FILE* const		file)
+{
+    static const char* const	ops[] = {"BU_BASE", "BU_DIMENSIONLESS",
+	"BU_PRODUCT", "BU_GALILEAN", "BU_TIMESTAMP", "BU_LOG"};
+    int				factorCount = 0;
+    int				i;
+
+    (void)fprintf(file, "\nstatic const BundledUnit units[] = {\n");
+
+    for (i = 0; i < _unitCount; i++) {
+	const Unit* const	u = _units + i;
+	const char*		id = ut_get_name(u->unit, UT_ASCII);
+
+	if (id == NULL)
+	    id = ut_get_symbol(u->unit, UT_ASCII);
+
+	(void)fprintf(file, "    {%s, %d, %d, %.17g, %.17g},",
+	    ops[u->op],
+	    u->op == BU_PRODUCT
+		? factorCount
+		: u->underlying == NULL ? -1 : unitIndex(u->underlying),
+	    u->count, u->scale, u->offset);
+	(void)fprintf(file, "\t/* %d%s%s */\n", i, id == NULL ? "" : ": ",
+	    id == NULL ? "" : id);
+	factorCount += u->count;
+    }
+
+    (void)fprintf(file, "};\n");
+    (void)fprintf(file, "\nstatic const BundledFactor factors[] = {");
+
+    for (factorCount = 0, i = 0; i < _unitCount; i++) {
+	int	j;
+
+	for (j = 0; j < _units[i].count; j++, factorCount++)
+	    (void)fprintf(file, "%s{%d, %d},",
+		factorCount % 6 == 0 ? "\n    " : " ",
+		unitIndex(_units[i].factors[j]), _units[i].powers[j]);
+    }
+
+    (void)fprintf(file, "\n    {-1, 0}\n};\n");
+}
+
+
+/*
+ * Writes the image of the identifier-trie.
+ *
+ * Arguments:
+ *	file	The output file.
+ *	image	Pointer to the image of the trie.
+ *	units	The units of the slots of the trie.
+ */
+static void
+writeTrie(
+    FILE* const			file,
+    const TrieImage* const	image,
+    const ut_unit* const*	units)
+{
+    int		i;
+
+    (void)fprintf(file, "\nstatic const TrieNode trieNodes[] = {");
+
+    for (i = 0; i < image->nodeCount; i++) {
+	const TrieNode* const	node = image->nodes + i;
+
+	(void)fprintf(file, "%s{%d, %d, %d, %d},", i % 4 == 0 ? "\n    " : " ",
+	    node->child, node->sibling, node->entry, node->label);
+    }
+
+    (void)fprintf(file, "\n};\n");
+    (void)fprintf(file, "\nstatic const TrieEntry trieEntries[] = {\n");
+
+    for (i = 0; i < image->entryCount; i++) {
+	const TrieEntry* const	entry = image->entries + i;
+
+	(void)fprintf(file, "    {%d, %d, %.17g, %.17g},\n",
+	    entry->nameUnit, entry->symbolUnit, entry->namePrefix,
+	    entry->symbolPrefix);
+    }
+
+    (void)fprintf(file, "    {-1, -1, 0, 0}\n};\n");
+    (void)fprintf(file, "\nstatic const int trieRootChild[] = {");
+
+    for (i = 0; i <= UCHAR_MAX; i++)
+	(void)fprintf(file, "%s%d,", i % 10 == 0 ? "\n    " : " ",
+	    image->rootChild[i]);
+
+    (void)fprintf(file, "\n};\n");
+    (void)fprintf(file, "\nstatic const int trieSlots[] = {");
+
+    for (i = 0; i < image->slotCount; i++)
+	(void)fprintf(file, "%s%d,", i % 10 == 0 ? "\n    " : " ",
+	    units[i] == NULL ? -1 : unitIndex(units[i]));
+
+    (void)fprintf(file, "\n    -1\n};\n");
+}
+
+
+int
+main(
+    const int		argc,
+    char**		argv)
+{
+    const char*		xmlPath;
+    const char*		cPath;
+    ut_system*		system;
+    TrieImage		image;
+    const ut_unit* const* slotUnits;
+    ut_unit*		second;
+    Id*			names;
+    Id*			symbols;
+    int			nameCount = 0;
+    int			symbolCount = 0;
+    int			nameBuckets;
+    int			symbolBuckets;
+    int			unitNameCount;
+    int			unitSymbolCount;
+    char		key[MAX_ID_LEN];
+    FILE*		file;
+    int			i;
+
+    _progname = argv[0];
+
+    if (argc != 3)
+	fatal("Usage: %s XML_file C_file", _progname);
+
+    xmlPath = argv[1];
+    cPath = argv[2];
+
+    /*
+     * The XML database overrides some of its own definitions.  Those
+     * messages are of no interest here.
+     */
+    (void)ut_set_error_message_handler(ut_ignore);
+    system = ut_read_xml(xmlPath);
+
+    if (system == NULL)
+	fatal("Couldn't read unit database \"%s\"", xmlPath);
+
+    if (idtGetImage(system, &image, &slotUnits) != UT_SUCCESS)
+	fatal("Unit database \"%s\" has no identifiers", xmlPath);
+
+    for (i = 0; i < image.slotCount; i++) {
+	if (slotUnits[i] != NULL)
+	    addUnit(slotUnits[i]);
+    }
+
+    second = ut_get_unit_by_name(system, "second");
+
+    if (second != NULL)
+	addUnit(second);
+
+    sortUnits();
+
+    names = allocate(image.entryCount*sizeof(Id));
+    symbols = allocate(image.entryCount*sizeof(Id));
+    addIds(&image, slotUnits, 0, key, 0, names, &nameCount, symbols,
+	&symbolCount);
+
+    file = fopen(cPath, "w");
+
+    if (file == NULL)
+	fatal("Couldn't open \"%s\": %s", cPath, strerror(errno));
+
+    (void)fprintf(file,
+"/*\n"
+" * The bundled unit database.  Generated by \"makeBundledData\" from\n"
+" * \"%s\".  Don't edit.\n"
+" */\n"
+"\n"
+"#include <stddef.h>\n"
+"\n"
+"#include \"udunits2.h\"\n"
+"#include \"bundledDb.h\"\n",
+	strrchr(xmlPath, '/') == NULL ? xmlPath : strrchr(xmlPath, '/') + 1);
+
+    writeUnits(file);
+    nameBuckets = writeHash(file, "names", names, nameCount);
+    symbolBuckets = writeHash(file, "symbols", symbols, symbolCount);
+    unitNameCount = writeUnitIds(file, "unitNames", 1);
+    unitSymbolCount = writeUnitIds(file, "unitSymbols", 0);
+    writeTrie(file, &image, slotUnits);
+
+    (void)fprintf(file,
+"\n"
+"static const BundledDb bundledDb = {\n"
+"    units,\n"
+"    factors,\n"
+"    unitNames,\n"
+"    unitSymbols,\n"
+"    {names, namesDisplacements, %d, %d},\n"
+"    {symbols, symbolsDisplacements, %d, %d},\n"
+"    {trieNodes, trieEntries, trieRootChild, trieSlots, %d, %d, %d},\n"
+"    %d,\n"
+"    %d,\n"
+"    %d,\n"
+"    %d\n"
+"};\n"
+"\n"
+"\n"
+"/*\n"
+" * Returns the unit-system of the unit database that was bundled with the\n"
+" * package.  See \"udunits2.h\".\n"
+" */\n"
+"ut_system*\n"
+"ut_read_bundled(void)\n"
+"{\n"
+"    return bdbLoad(&bundledDb);\n"
+"}\n",
+	nameCount, nameBuckets, symbolCount, symbolBuckets,
+	image.nodeCount, image.entryCount, image.slotCount,
+	_unitCount, unitNameCount, unitSymbolCount,
+	second == NULL ? -1 : unitIndex(second));
+
+    if (fclose(file) != 0)
+	fatal("Couldn't write \"%s\": %s", cPath, strerror(errno));
+
+    freeIds(names, nameCount);
+    freeIds(symbols, symbolCount);
+
+    for (i = 0; i < _unitCount; i++) {
+	free(_units[i].factors);
+	free(_units[i].powers);
+    }
+
+    free(_units);
+    ut_free(second);
+    ut_free_system(system);
+
+    return EXIT_SUCCESS;
+}
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -55,57 +57,23 @@
 /* Pure parsers.  */
 #define YYPURE 0
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
-/* Substitute the variable and function names.  */
-#define yyparse utparse
-#define yylex   utlex
-#define yyerror uterror
-#define yylval  utlval
-#define yychar  utchar
-#define yydebug utdebug
-#define yynerrs utnerrs
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     ERR = 258,
-     SHIFT = 259,
-     MULTIPLY = 260,
-     DIVIDE = 261,
-     INT = 262,
-     EXPONENT = 263,
-     REAL = 264,
-     ID = 265,
-     DATE = 266,
-     CLOCK = 267,
-     TIMESTAMP = 268,
-     LOGREF = 269
-   };
-#endif
-/* Tokens.  */
-#define ERR 258
-#define SHIFT 259
-#define MULTIPLY 260
-#define DIVIDE 261
-#define INT 262
-#define EXPONENT 263
-#define REAL 264
-#define ID 265
-#define DATE 266
-#define CLOCK 267
-#define TIMESTAMP 268
-#define LOGREF 269
-
+/* Push parsers.  */
+#define YYPUSH 0
 
+/* Pull parsers.  */
+#define YYPULL 1
 
 
-/* Copy the first part of user declarations.  */
+/* Substitute the variable and function names.  */
+#define yyparse         utparse
+#define yylex           utlex
+#define yyerror         uterror
+#define yydebug         utdebug
+#define yynerrs         utnerrs
+#define yylval          utlval
+#define yychar          utchar
+
+/* First part of user prologue.  */
 #line 1 "parser.y"
 
 /*
@@ -133,13 +101,18 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <string.h>
-
 #ifndef _MSC_VER
+#include <string.h>
+// Add a declaration to suppress a compiler warning when
+// compiling on Mountain Lion because the declaration is
+// ifdef'd out in string.h
+#if __DARWIN_C_LEVEL < 200112L
+char *strdup(const char *);
+#endif /* __DARWIN_C_LEVEL < 200112L */
 #include <strings.h>
 #endif
-
 #include "udunits2.h"
+#include "idTrie.h" /* For 'idtResolve' declaration */
 
 static ut_unit*		_finalUnit;	/* fully-parsed specification */
 static ut_system*	_unitSystem;	/* The unit-system to use */
@@ -147,6 +120,9 @@ static char*		_errorMessage;	/* last error-message */
 static ut_encoding	_encoding;	/* encoding of string to be parsed */
 static int		_restartScanner;/* restart scanner? */
 static int		_isTime;        /* product_exp is time? */
+static ut_product_builder* _builders;	/* parse's product-builder stack */
+static int		_builderCount;	/* number of builders in use */
+static int		_builderMax;	/* number of builders allocated */
 
 
 /*
@@ -310,80 +286,304 @@ static int isTime(
     return isTime;
 }
 
+/*
+ * Starts a product of units.  Product builders are kept on a stack because
+ * products can be nested by parentheses.  The stack belongs to the current
+ * call of "ut_parse()", which frees it before returning.
+ *
+ * Returns:
+ *	-1	Failure.  "ut_get_status()" will be:
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	The index of the product builder on the stack.
+ */
+static int
+beginProduct(void)
+{
+    int		index = -1;		/* failure */
+
+    if (_builderCount == _builderMax) {
+	int			max = _builderMax == 0 ? 4 : 2*_builderMax;
+	ut_product_builder*	builders = realloc(_builders,
+	    max*sizeof(ut_product_builder));
+
+	if (builders == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"beginProduct(): Couldn't allocate %d product builders", max);
+	}
+	else {
+	    _builders = builders;
+	    _builderMax = max;
+	}
+    }
+
+    if (_builderCount < _builderMax &&
+	    ut_init_product(&_builders[_builderCount], _unitSystem)
+		== UT_SUCCESS)
+	index = _builderCount++;
 
+    return index;
+}
 
-/* Enabling traces.  */
+/*
+ * Ends the product of units that's on the top of the stack.
+ *
+ * Arguments:
+ *	index	The index of the product builder on the stack.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be that of
+ *		"ut_finish_product()".
+ *	else	The product.
+ */
+static ut_unit*
+endProduct(
+    const int	index)
+{
+    assert(index == _builderCount - 1);
+
+    _builderCount = index;
+
+    return ut_finish_product(&_builders[index]);
+}
+
+/*
+ * Multiplies the product of units that's on the top of the stack by a factor.
+ *
+ * Arguments:
+ *	index	The index of the product builder on the stack.
+ *	unit	The factor.  Freed upon return.
+ *	power	The power of the factor.
+ * Returns:
+ *	-1	Failure.  "ut_get_status()" will be that of
+ *		"ut_multiply_product()".
+ *	 0	Success.
+ */
+static int
+multiplyProduct(
+    const int	index,
+    ut_unit*	unit,
+    const int	power)
+{
+    int		status = ut_multiply_product(&_builders[index], unit, power);
+
+    ut_free(unit);
+    ut_set_status(status);
+
+    return status == UT_SUCCESS ? 0 : -1;
+}
+
+
+#line 378 "parser.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 1
 #endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
+#if YYDEBUG
+extern int utdebug;
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ERR = 258,                     /* ERR  */
+    SHIFT = 259,                   /* SHIFT  */
+    MULTIPLY = 260,                /* MULTIPLY  */
+    DIVIDE = 261,                  /* DIVIDE  */
+    INT = 262,                     /* INT  */
+    EXPONENT = 263,                /* EXPONENT  */
+    REAL = 264,                    /* REAL  */
+    ID = 265,                      /* ID  */
+    DATE = 266,                    /* DATE  */
+    CLOCK = 267,                   /* CLOCK  */
+    TIMESTAMP = 268,               /* TIMESTAMP  */
+    LOGREF = 269                   /* LOGREF  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 203 "parser.y"
+union YYSTYPE
 {
+#line 301 "parser.y"
+
     char*	id;			/* identifier */
     ut_unit*	unit;			/* "unit" structure */
     double	rval;			/* floating-point numerical value */
     long	ival;			/* integer numerical value */
-}
-/* Line 193 of yacc.c.  */
-#line 341 "parser.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+    int		product;		/* index of product builder */
+    struct {
+	ut_unit*	unit;		/* factor */
+	int		power;		/* power of factor */
+    }		factor;			/* factor of product */
+
+#line 451 "parser.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
 
+extern YYSTYPE utlval;
+
+
+int utparse (void);
+
+
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ERR = 3,                        /* ERR  */
+  YYSYMBOL_SHIFT = 4,                      /* SHIFT  */
+  YYSYMBOL_MULTIPLY = 5,                   /* MULTIPLY  */
+  YYSYMBOL_DIVIDE = 6,                     /* DIVIDE  */
+  YYSYMBOL_INT = 7,                        /* INT  */
+  YYSYMBOL_EXPONENT = 8,                   /* EXPONENT  */
+  YYSYMBOL_REAL = 9,                       /* REAL  */
+  YYSYMBOL_ID = 10,                        /* ID  */
+  YYSYMBOL_DATE = 11,                      /* DATE  */
+  YYSYMBOL_CLOCK = 12,                     /* CLOCK  */
+  YYSYMBOL_TIMESTAMP = 13,                 /* TIMESTAMP  */
+  YYSYMBOL_LOGREF = 14,                    /* LOGREF  */
+  YYSYMBOL_15_ = 15,                       /* '('  */
+  YYSYMBOL_16_ = 16,                       /* ')'  */
+  YYSYMBOL_YYACCEPT = 17,                  /* $accept  */
+  YYSYMBOL_unit_spec = 18,                 /* unit_spec  */
+  YYSYMBOL_shift_exp = 19,                 /* shift_exp  */
+  YYSYMBOL_product_exp = 20,               /* product_exp  */
+  YYSYMBOL_product_list = 21,              /* product_list  */
+  YYSYMBOL_power_exp = 22,                 /* power_exp  */
+  YYSYMBOL_basic_exp = 23,                 /* basic_exp  */
+  YYSYMBOL_number = 24,                    /* number  */
+  YYSYMBOL_timestamp = 25                  /* timestamp  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 216 of yacc.c.  */
-#line 354 "parser.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -391,55 +591,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -456,11 +707,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -468,8 +719,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -483,111 +734,117 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  15
+#define YYFINAL  16
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   95
+#define YYLAST   78
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  17
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  8
+#define YYNNTS  9
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  35
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  43
+#define YYNRULES  36
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  44
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   269
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -619,251 +876,178 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     4,     6,     8,    10,    14,    18,    22,
-      26,    28,    31,    34,    38,    42,    46,    50,    52,    55,
-      58,    61,    63,    67,    71,    75,    79,    81,    83,    85,
-      87,    90,    94,    98,   100,   103
+       0,   337,   337,   341,   345,   350,   353,   359,   365,   371,
+     379,   387,   402,   411,   417,   426,   432,   441,   449,   453,
+     457,   461,   469,   485,   488,   494,   500,   506,   512,   515,
+     520,   523,   526,   529,   548,   551,   554
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      18,     0,    -1,    -1,    19,    -1,     1,    -1,    20,    -1,
-      20,     4,     9,    -1,    20,     4,     7,    -1,    20,     4,
-      24,    -1,    20,     4,     1,    -1,    21,    -1,    20,    21,
-      -1,    20,     1,    -1,    20,     5,    21,    -1,    20,     5,
-       1,    -1,    20,     6,    21,    -1,    20,     6,     1,    -1,
-      22,    -1,    22,     7,    -1,    22,     8,    -1,    22,     1,
-      -1,    10,    -1,    15,    19,    16,    -1,    15,    19,     1,
-      -1,    14,    20,    16,    -1,    14,    20,     1,    -1,    23,
-      -1,     7,    -1,     9,    -1,    11,    -1,    11,    12,    -1,
-      11,    12,    12,    -1,    11,    12,    10,    -1,    13,    -1,
-      13,    12,    -1,    13,    10,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   233,   233,   237,   241,   246,   249,   255,   261,   267,
-     275,   279,   287,   293,   301,   307,   315,   323,   326,   332,
-     338,   346,   399,   402,   408,   414,   420,   426,   429,   434,
-     437,   440,   443,   462,   465,   468
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "ERR", "SHIFT", "MULTIPLY", "DIVIDE",
-  "INT", "EXPONENT", "REAL", "ID", "DATE", "CLOCK", "TIMESTAMP", "LOGREF",
-  "'('", "')'", "$accept", "unit_spec", "shift_exp", "product_exp",
-  "power_exp", "basic_exp", "number", "timestamp", 0
+  "\"end of file\"", "error", "\"invalid token\"", "ERR", "SHIFT",
+  "MULTIPLY", "DIVIDE", "INT", "EXPONENT", "REAL", "ID", "DATE", "CLOCK",
+  "TIMESTAMP", "LOGREF", "'('", "')'", "$accept", "unit_spec", "shift_exp",
+  "product_exp", "product_list", "power_exp", "basic_exp", "number",
+  "timestamp", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,    40,    41
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-9)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-19)
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
 {
-       0,    17,    18,    18,    18,    19,    19,    19,    19,    19,
-      20,    20,    20,    20,    20,    20,    20,    21,    21,    21,
-      21,    22,    22,    22,    22,    22,    22,    23,    23,    24,
-      24,    24,    24,    24,    24,    24
+      28,    -9,    -9,    -9,    -9,    63,    63,     3,    -9,     9,
+      17,    -9,     0,    -9,    18,    24,    -9,    58,    -9,    38,
+      48,    -9,    -9,    -9,    -9,    -9,    -9,    -9,    -9,    -9,
+      -9,    -9,     8,    34,    -9,    -9,    -9,    -9,    -9,    44,
+      -9,    -9,    -9,    -9
 };
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
 {
-       0,     2,     0,     1,     1,     1,     3,     3,     3,     3,
-       1,     2,     2,     3,     3,     3,     3,     1,     2,     2,
-       2,     1,     3,     3,     3,     3,     1,     1,     1,     1,
-       2,     3,     3,     1,     2,     2
+       0,     4,    28,    29,    22,     0,     0,     0,     3,     5,
+       0,    11,     0,    27,     0,     0,     1,     0,    13,     0,
+       0,    12,    21,    19,    20,    26,    25,    24,    23,     9,
+       7,     6,    30,    34,     8,    15,    14,    17,    16,    31,
+      36,    35,    33,    32
 };
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
 {
-       0,     4,    27,    28,    21,     0,     0,     0,     3,     0,
-      10,     0,    26,     0,     0,     1,    12,     0,     0,     0,
-      11,    20,    18,    19,    12,    24,    23,    22,     9,     7,
-       6,    29,    33,     8,    14,    13,    16,    15,    30,    35,
-      34,    32,    31
+      -9,    -9,    30,    25,    -9,    -8,    -9,    -9,    -9
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,     7,     8,     9,    10,    11,    12,    33
+       0,     7,     8,     9,    10,    11,    12,    13,    34
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -10
-static const yytype_int8 yypact[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
 {
-      40,   -10,   -10,   -10,   -10,    80,    80,     2,   -10,    17,
-     -10,     0,   -10,    29,    12,   -10,   -10,    70,    50,    60,
-     -10,   -10,   -10,   -10,    48,   -10,   -10,   -10,   -10,   -10,
-     -10,    -9,    56,   -10,   -10,   -10,   -10,   -10,    72,   -10,
-     -10,   -10,   -10
+     -18,    22,    21,    16,   -18,   -18,   -18,    23,    24,   -18,
+     -18,    36,    38,    17,   -18,   -18,   -18,   -10,    18,    25,
+      39,   -10,    19,    20,     2,    27,     3,     4,    -2,     1,
+      14,     5,     6,   -10,    26,     2,    15,     3,     4,    35,
+      28,     0,     5,     6,    40,     2,    41,     3,     4,    37,
+       0,     0,     5,     6,    42,     2,    43,     3,     4,    29,
+       0,     0,     5,     6,     0,    30,     0,    31,     0,    32,
+       2,    33,     3,     4,     0,     0,     0,     5,     6
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int8 yypgoto[] =
+static const yytype_int8 yycheck[] =
 {
-     -10,   -10,     5,     7,    67,   -10,   -10,   -10
+       0,     1,    10,     0,     4,     5,     6,     7,     8,     9,
+      10,    19,    20,     4,    14,    15,    16,     0,     1,     1,
+      12,     4,     5,     6,     7,     1,     9,    10,     0,     1,
+       5,    14,    15,    16,    16,     7,     6,     9,    10,     1,
+      16,    -1,    14,    15,    10,     7,    12,     9,    10,     1,
+      -1,    -1,    14,    15,    10,     7,    12,     9,    10,     1,
+      -1,    -1,    14,    15,    -1,     7,    -1,     9,    -1,    11,
+       7,    13,     9,    10,    -1,    -1,    -1,    14,    15
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -26
-static const yytype_int8 yytable[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
-     -17,    21,    15,    38,   -17,   -17,   -17,    22,    23,   -17,
-     -17,    14,    13,    26,   -17,   -17,   -17,    -5,    16,     0,
-       0,    17,    18,    19,     2,     0,     3,     4,    27,     0,
-      24,     5,     6,    -5,    18,    19,     2,     0,     3,     4,
-      -2,     1,     0,     5,     6,    25,     0,     2,   -25,     3,
-       4,    34,   -25,     0,     5,     6,   -25,     2,     0,     3,
-       4,    36,     0,     0,     5,     6,    39,     2,    40,     3,
-       4,    28,     0,     0,     5,     6,    20,    29,     0,    30,
-      20,    31,    41,    32,    42,    35,    37,     2,     0,     3,
-       4,     0,     0,     0,     5,     6
+       0,     1,     7,     9,    10,    14,    15,    18,    19,    20,
+      21,    22,    23,    24,    20,    19,     0,     4,     1,     5,
+       6,    22,     1,     7,     8,     1,    16,     1,    16,     1,
+       7,     9,    11,    13,    25,     1,    22,     1,    22,    12,
+      10,    12,    10,    12
 };
 
-static const yytype_int8 yycheck[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
 {
-       0,     1,     0,    12,     4,     5,     6,     7,     8,     9,
-      10,     6,     5,     1,    14,    15,    16,     0,     1,    -1,
-      -1,     4,     5,     6,     7,    -1,     9,    10,    16,    -1,
-       1,    14,    15,    16,     5,     6,     7,    -1,     9,    10,
-       0,     1,    -1,    14,    15,    16,    -1,     7,     0,     9,
-      10,     1,     4,    -1,    14,    15,     8,     7,    -1,     9,
-      10,     1,    -1,    -1,    14,    15,    10,     7,    12,     9,
-      10,     1,    -1,    -1,    14,    15,     9,     7,    -1,     9,
-      13,    11,    10,    13,    12,    18,    19,     7,    -1,     9,
-      10,    -1,    -1,    -1,    14,    15
+       0,    17,    18,    18,    18,    19,    19,    19,    19,    19,
+      20,    21,    21,    21,    21,    21,    21,    21,    22,    22,
+      22,    22,    23,    23,    23,    23,    23,    23,    24,    24,
+      25,    25,    25,    25,    25,    25,    25
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
-       0,     1,     7,     9,    10,    14,    15,    18,    19,    20,
-      21,    22,    23,    20,    19,     0,     1,     4,     5,     6,
-      21,     1,     7,     8,     1,    16,     1,    16,     1,     7,
-       9,    11,    13,    24,     1,    21,     1,    21,    12,    10,
-      12,    10,    12
+       0,     2,     0,     1,     1,     1,     3,     3,     3,     3,
+       1,     1,     2,     2,     3,     3,     3,     3,     1,     2,
+       2,     2,     1,     3,     3,     3,     3,     1,     1,     1,
+       1,     2,     3,     3,     1,     2,     2
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
 
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#define YYFAIL		goto yyerrlab
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
-
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
-
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
-
-
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -873,80 +1057,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -954,80 +1116,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1042,478 +1192,219 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
-
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
-
-
-/* The look-ahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
+/* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
 
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
-
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
-
-  YYSIZE_T yystacksize = YYINITDEPTH;
-
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1528,30 +1419,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1566,14 +1453,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1586,229 +1473,235 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 233 "parser.y"
-    {
+  case 2: /* unit_spec: %empty  */
+#line 337 "parser.y"
+                              {
 		    _finalUnit = ut_get_dimensionless_unit_one(_unitSystem);
 		    YYACCEPT;
 		}
+#line 1483 "parser.c"
     break;
 
-  case 3:
-#line 237 "parser.y"
-    {
-		    _finalUnit = (yyvsp[(1) - (1)].unit);
+  case 3: /* unit_spec: shift_exp  */
+#line 341 "parser.y"
+                          {
+		    _finalUnit = (yyvsp[0].unit);
 		    YYACCEPT;
 		}
+#line 1492 "parser.c"
     break;
 
-  case 4:
-#line 241 "parser.y"
-    {
+  case 4: /* unit_spec: error  */
+#line 345 "parser.y"
+                      {
 		    YYABORT;
 		}
+#line 1500 "parser.c"
     break;
 
-  case 5:
-#line 246 "parser.y"
-    {
-		    (yyval.unit) = (yyvsp[(1) - (1)].unit);
+  case 5: /* shift_exp: product_exp  */
+#line 350 "parser.y"
+                            {
+		    (yyval.unit) = (yyvsp[0].unit);
 		}
+#line 1508 "parser.c"
     break;
 
-  case 6:
-#line 249 "parser.y"
-    {
-		    (yyval.unit) = ut_offset((yyvsp[(1) - (3)].unit), (yyvsp[(3) - (3)].rval));
-		    ut_free((yyvsp[(1) - (3)].unit));
+  case 6: /* shift_exp: product_exp SHIFT REAL  */
+#line 353 "parser.y"
+                                       {
+		    (yyval.unit) = ut_offset((yyvsp[-2].unit), (yyvsp[0].rval));
+		    ut_free((yyvsp[-2].unit));
 		    if ((yyval.unit) == NULL)
 			YYERROR;
 		}
+#line 1519 "parser.c"
     break;
 
-  case 7:
-#line 255 "parser.y"
-    {
-		    (yyval.unit) = ut_offset((yyvsp[(1) - (3)].unit), (yyvsp[(3) - (3)].ival));
-		    ut_free((yyvsp[(1) - (3)].unit));
+  case 7: /* shift_exp: product_exp SHIFT INT  */
+#line 359 "parser.y"
+                                      {
+		    (yyval.unit) = ut_offset((yyvsp[-2].unit), (yyvsp[0].ival));
+		    ut_free((yyvsp[-2].unit));
 		    if ((yyval.unit) == NULL)
 			YYERROR;
 		}
+#line 1530 "parser.c"
     break;
 
-  case 8:
-#line 261 "parser.y"
-    {
-		    (yyval.unit) = ut_offset_by_time((yyvsp[(1) - (3)].unit), (yyvsp[(3) - (3)].rval));
-		    ut_free((yyvsp[(1) - (3)].unit));
+  case 8: /* shift_exp: product_exp SHIFT timestamp  */
+#line 365 "parser.y"
+                                            {
+		    (yyval.unit) = ut_offset_by_time((yyvsp[-2].unit), (yyvsp[0].rval));
+		    ut_free((yyvsp[-2].unit));
 		    if ((yyval.unit) == NULL)
 			YYERROR;
 		}
+#line 1541 "parser.c"
     break;
 
-  case 9:
-#line 267 "parser.y"
-    {
+  case 9: /* shift_exp: product_exp SHIFT error  */
+#line 371 "parser.y"
+                                        {
 		    ut_status	prev = ut_get_status();
-		    ut_free((yyvsp[(1) - (3)].unit));
+		    ut_free((yyvsp[-2].unit));
 		    ut_set_status(prev);
 		    YYERROR;
 		}
+#line 1552 "parser.c"
     break;
 
-  case 10:
-#line 275 "parser.y"
-    {
-		    (yyval.unit) = (yyvsp[(1) - (1)].unit);
+  case 10: /* product_exp: product_list  */
+#line 379 "parser.y"
+                             {
+		    (yyval.unit) = endProduct((yyvsp[0].product));
+		    if ((yyval.unit) == NULL)
+			YYERROR;
                     _isTime = isTime((yyval.unit));
 		}
+#line 1563 "parser.c"
     break;
 
-  case 11:
-#line 279 "parser.y"
-    {
-		    (yyval.unit) = ut_multiply((yyvsp[(1) - (2)].unit), (yyvsp[(2) - (2)].unit));
-                    _isTime = isTime((yyval.unit));
-		    ut_free((yyvsp[(1) - (2)].unit));
-		    ut_free((yyvsp[(2) - (2)].unit));
-		    if ((yyval.unit) == NULL)
+  case 11: /* product_list: power_exp  */
+#line 387 "parser.y"
+                          {
+		    (yyval.product) = beginProduct();
+		    if ((yyval.product) < 0) {
+			ut_status	prev = ut_get_status();
+			ut_free((yyvsp[0].factor).unit);
+			ut_set_status(prev);
 			YYERROR;
+		    }
+		    if (multiplyProduct((yyval.product), (yyvsp[0].factor).unit, (yyvsp[0].factor).power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct((yyval.product)));
+			ut_set_status(prev);
+			YYERROR;
+		    }
 		}
+#line 1583 "parser.c"
     break;
 
-  case 12:
-#line 287 "parser.y"
-    {
+  case 12: /* product_list: product_list power_exp  */
+#line 402 "parser.y"
+                                        {
+		    (yyval.product) = (yyvsp[-1].product);
+		    if (multiplyProduct((yyval.product), (yyvsp[0].factor).unit, (yyvsp[0].factor).power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct((yyval.product)));
+			ut_set_status(prev);
+			YYERROR;
+		    }
+		}
+#line 1597 "parser.c"
+    break;
+
+  case 13: /* product_list: product_list error  */
+#line 411 "parser.y"
+                                        {
 		    ut_status	prev = ut_get_status();
-		    ut_free((yyvsp[(1) - (2)].unit));
+		    ut_free(endProduct((yyvsp[-1].product)));
 		    ut_set_status(prev);
 		    YYERROR;
 		}
+#line 1608 "parser.c"
     break;
 
-  case 13:
-#line 293 "parser.y"
-    {
-		    (yyval.unit) = ut_multiply((yyvsp[(1) - (3)].unit), (yyvsp[(3) - (3)].unit));
-                    _isTime = isTime((yyval.unit));
-		    ut_free((yyvsp[(1) - (3)].unit));
-		    ut_free((yyvsp[(3) - (3)].unit));
-		    if ((yyval.unit) == NULL)
+  case 14: /* product_list: product_list MULTIPLY power_exp  */
+#line 417 "parser.y"
+                                                {
+		    (yyval.product) = (yyvsp[-2].product);
+		    if (multiplyProduct((yyval.product), (yyvsp[0].factor).unit, (yyvsp[0].factor).power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct((yyval.product)));
+			ut_set_status(prev);
 			YYERROR;
+		    }
 		}
+#line 1622 "parser.c"
     break;
 
-  case 14:
-#line 301 "parser.y"
-    {
+  case 15: /* product_list: product_list MULTIPLY error  */
+#line 426 "parser.y"
+                                                {
 		    ut_status	prev = ut_get_status();
-		    ut_free((yyvsp[(1) - (3)].unit));
+		    ut_free(endProduct((yyvsp[-2].product)));
 		    ut_set_status(prev);
 		    YYERROR;
 		}
+#line 1633 "parser.c"
     break;
 
-  case 15:
-#line 307 "parser.y"
-    {
-		    (yyval.unit) = ut_divide((yyvsp[(1) - (3)].unit), (yyvsp[(3) - (3)].unit));
-                    _isTime = isTime((yyval.unit));
-		    ut_free((yyvsp[(1) - (3)].unit));
-		    ut_free((yyvsp[(3) - (3)].unit));
-		    if ((yyval.unit) == NULL)
+  case 16: /* product_list: product_list DIVIDE power_exp  */
+#line 432 "parser.y"
+                                                {
+		    (yyval.product) = (yyvsp[-2].product);
+		    if (multiplyProduct((yyval.product), (yyvsp[0].factor).unit, -(yyvsp[0].factor).power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct((yyval.product)));
+			ut_set_status(prev);
 			YYERROR;
+		    }
 		}
+#line 1647 "parser.c"
     break;
 
-  case 16:
-#line 315 "parser.y"
-    {
+  case 17: /* product_list: product_list DIVIDE error  */
+#line 441 "parser.y"
+                                                {
 		    ut_status	prev = ut_get_status();
-		    ut_free((yyvsp[(1) - (3)].unit));
+		    ut_free(endProduct((yyvsp[-2].product)));
 		    ut_set_status(prev);
 		    YYERROR;
 		}
+#line 1658 "parser.c"
     break;
 
-  case 17:
-#line 323 "parser.y"
-    {
-		    (yyval.unit) = (yyvsp[(1) - (1)].unit);
+  case 18: /* power_exp: basic_exp  */
+#line 449 "parser.y"
+                          {
+		    (yyval.factor).unit = (yyvsp[0].unit);
+		    (yyval.factor).power = 1;
 		}
+#line 1667 "parser.c"
     break;
 
-  case 18:
-#line 326 "parser.y"
-    {
-		    (yyval.unit) = ut_raise((yyvsp[(1) - (2)].unit), (yyvsp[(2) - (2)].ival));
-		    ut_free((yyvsp[(1) - (2)].unit));
-		    if ((yyval.unit) == NULL)
-			YYERROR;
+  case 19: /* power_exp: basic_exp INT  */
+#line 453 "parser.y"
+                              {
+		    (yyval.factor).unit = (yyvsp[-1].unit);
+		    (yyval.factor).power = (yyvsp[0].ival);
 		}
+#line 1676 "parser.c"
     break;
 
-  case 19:
-#line 332 "parser.y"
-    {
-		    (yyval.unit) = ut_raise((yyvsp[(1) - (2)].unit), (yyvsp[(2) - (2)].ival));
-		    ut_free((yyvsp[(1) - (2)].unit));
-		    if ((yyval.unit) == NULL)
-			YYERROR;
+  case 20: /* power_exp: basic_exp EXPONENT  */
+#line 457 "parser.y"
+                                   {
+		    (yyval.factor).unit = (yyvsp[-1].unit);
+		    (yyval.factor).power = (yyvsp[0].ival);
 		}
+#line 1685 "parser.c"
     break;
 
-  case 20:
-#line 338 "parser.y"
-    {
+  case 21: /* power_exp: basic_exp error  */
+#line 461 "parser.y"
+                                {
 		    ut_status	prev = ut_get_status();
-		    ut_free((yyvsp[(1) - (2)].unit));
+		    ut_free((yyvsp[-1].unit));
 		    ut_set_status(prev);
 		    YYERROR;
 		}
+#line 1696 "parser.c"
     break;
 
-  case 21:
-#line 346 "parser.y"
-    {
-		    double	prefix = 1;
-		    ut_unit*	unit = NULL;
-		    char*	cp = (yyvsp[(1) - (1)].id);
-		    int		symbolPrefixSeen = 0;
-
-		    while (*cp) {
-			size_t	nchar;
-			double	value;
-
-			unit = ut_get_unit_by_name(_unitSystem, cp);
-
-			if (unit != NULL)
-			    break;
-
-			unit = ut_get_unit_by_symbol(_unitSystem, cp);
-
-			if (unit != NULL)
-			    break;
-
-			if (utGetPrefixByName(_unitSystem, cp, &value, &nchar)
-				== UT_SUCCESS) {
-			    prefix *= value;
-			    cp += nchar;
-			}
-			else {
-			    if (!symbolPrefixSeen &&
-				    utGetPrefixBySymbol(_unitSystem, cp, &value,
-					&nchar) == UT_SUCCESS) {
-				symbolPrefixSeen = 1;
-				prefix *= value;
-				cp += nchar;
-			    }
-			    else {
-				break;
-			    }
-			}
-		    }
+  case 22: /* basic_exp: ID  */
+#line 469 "parser.y"
+                   {
+		    double		prefix;
+		    const ut_unit*	unit = idtResolve(_unitSystem, (yyvsp[0].id), &prefix);
 
-		    free((yyvsp[(1) - (1)].id));
+		    free((yyvsp[0].id));
 
 		    if (unit == NULL) {
 			ut_set_status(UT_UNKNOWN);
@@ -1817,249 +1710,237 @@ yyreduce:
 
 		    (yyval.unit) = ut_scale(prefix, unit);
 
-		    ut_free(unit);
-
 		    if ((yyval.unit) == NULL)
 			YYERROR;
 		}
+#line 1717 "parser.c"
     break;
 
-  case 22:
-#line 399 "parser.y"
-    {
-		    (yyval.unit) = (yyvsp[(2) - (3)].unit);
+  case 23: /* basic_exp: '(' shift_exp ')'  */
+#line 485 "parser.y"
+                                  {
+		    (yyval.unit) = (yyvsp[-1].unit);
 		}
+#line 1725 "parser.c"
     break;
 
-  case 23:
-#line 402 "parser.y"
-    {
+  case 24: /* basic_exp: '(' shift_exp error  */
+#line 488 "parser.y"
+                                    {
 		    ut_status	status = ut_get_status();
-		    ut_free((yyvsp[(2) - (3)].unit));
+		    ut_free((yyvsp[-1].unit));
 		    ut_set_status(status);
 		    YYERROR;
 		}
+#line 1736 "parser.c"
     break;
 
-  case 24:
-#line 408 "parser.y"
-    {
-		    (yyval.unit) = ut_log((yyvsp[(1) - (3)].rval), (yyvsp[(2) - (3)].unit));
-		    ut_free((yyvsp[(2) - (3)].unit));
+  case 25: /* basic_exp: LOGREF product_exp ')'  */
+#line 494 "parser.y"
+                                       {
+		    (yyval.unit) = ut_log((yyvsp[-2].rval), (yyvsp[-1].unit));
+		    ut_free((yyvsp[-1].unit));
 		    if ((yyval.unit) == NULL)
 			YYERROR;
 		}
+#line 1747 "parser.c"
     break;
 
-  case 25:
-#line 414 "parser.y"
-    {
+  case 26: /* basic_exp: LOGREF product_exp error  */
+#line 500 "parser.y"
+                                         {
 		    ut_status	status = ut_get_status();
-		    ut_free((yyvsp[(2) - (3)].unit));
+		    ut_free((yyvsp[-1].unit));
 		    ut_set_status(status);
 		    YYERROR;
 		}
+#line 1758 "parser.c"
     break;
 
-  case 26:
-#line 420 "parser.y"
-    {
-		    (yyval.unit) = ut_scale((yyvsp[(1) - (1)].rval),
+  case 27: /* basic_exp: number  */
+#line 506 "parser.y"
+                       {
+		    (yyval.unit) = ut_scale((yyvsp[0].rval),
                         ut_get_dimensionless_unit_one(_unitSystem));
 		}
+#line 1767 "parser.c"
     break;
 
-  case 27:
-#line 426 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (1)].ival);
+  case 28: /* number: INT  */
+#line 512 "parser.y"
+                    {
+		    (yyval.rval) = (yyvsp[0].ival);
 		}
+#line 1775 "parser.c"
     break;
 
-  case 28:
-#line 429 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (1)].rval);
+  case 29: /* number: REAL  */
+#line 515 "parser.y"
+                     {
+		    (yyval.rval) = (yyvsp[0].rval);
 		}
+#line 1783 "parser.c"
     break;
 
-  case 29:
-#line 434 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (1)].rval);
+  case 30: /* timestamp: DATE  */
+#line 520 "parser.y"
+                     {
+		    (yyval.rval) = (yyvsp[0].rval);
 		}
+#line 1791 "parser.c"
     break;
 
-  case 30:
-#line 437 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (2)].rval) + (yyvsp[(2) - (2)].rval);
+  case 31: /* timestamp: DATE CLOCK  */
+#line 523 "parser.y"
+                           {
+		    (yyval.rval) = (yyvsp[-1].rval) + (yyvsp[0].rval);
 		}
+#line 1799 "parser.c"
     break;
 
-  case 31:
-#line 440 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (3)].rval) + ((yyvsp[(2) - (3)].rval) - (yyvsp[(3) - (3)].rval));
+  case 32: /* timestamp: DATE CLOCK CLOCK  */
+#line 526 "parser.y"
+                                 {
+		    (yyval.rval) = (yyvsp[-2].rval) + ((yyvsp[-1].rval) - (yyvsp[0].rval));
 		}
+#line 1807 "parser.c"
     break;
 
-  case 32:
-#line 443 "parser.y"
-    {
+  case 33: /* timestamp: DATE CLOCK ID  */
+#line 529 "parser.y"
+                              {
 		    int	error = 0;
 
-		    if (strcasecmp((yyvsp[(3) - (3)].id), "UTC") != 0 &&
-			    strcasecmp((yyvsp[(3) - (3)].id), "GMT") != 0 &&
-			    strcasecmp((yyvsp[(3) - (3)].id), "Z") != 0) {
+		    if (strcasecmp((yyvsp[0].id), "UTC") != 0 &&
+			    strcasecmp((yyvsp[0].id), "GMT") != 0 &&
+			    strcasecmp((yyvsp[0].id), "Z") != 0) {
 			ut_set_status(UT_UNKNOWN);
 			error = 1;
 		    }
 
-		    free((yyvsp[(3) - (3)].id));
+		    free((yyvsp[0].id));
 
 		    if (!error) {
-			(yyval.rval) = (yyvsp[(1) - (3)].rval) + (yyvsp[(2) - (3)].rval);
+			(yyval.rval) = (yyvsp[-2].rval) + (yyvsp[-1].rval);
 		    }
 		    else {
 			YYERROR;
 		    }
 		}
+#line 1831 "parser.c"
     break;
 
-  case 33:
-#line 462 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (1)].rval);
+  case 34: /* timestamp: TIMESTAMP  */
+#line 548 "parser.y"
+                          {
+		    (yyval.rval) = (yyvsp[0].rval);
 		}
+#line 1839 "parser.c"
     break;
 
-  case 34:
-#line 465 "parser.y"
-    {
-		    (yyval.rval) = (yyvsp[(1) - (2)].rval) - (yyvsp[(2) - (2)].rval);
+  case 35: /* timestamp: TIMESTAMP CLOCK  */
+#line 551 "parser.y"
+                                {
+		    (yyval.rval) = (yyvsp[-1].rval) - (yyvsp[0].rval);
 		}
+#line 1847 "parser.c"
     break;
 
-  case 35:
-#line 468 "parser.y"
-    {
+  case 36: /* timestamp: TIMESTAMP ID  */
+#line 554 "parser.y"
+                             {
 		    int	error = 0;
 
-		    if (strcasecmp((yyvsp[(2) - (2)].id), "UTC") != 0 &&
-			    strcasecmp((yyvsp[(2) - (2)].id), "GMT") != 0 &&
-			    strcasecmp((yyvsp[(2) - (2)].id), "Z") != 0) {
+		    if (strcasecmp((yyvsp[0].id), "UTC") != 0 &&
+			    strcasecmp((yyvsp[0].id), "GMT") != 0 &&
+			    strcasecmp((yyvsp[0].id), "Z") != 0) {
 			ut_set_status(UT_UNKNOWN);
 			error = 1;
 		    }
 
-		    free((yyvsp[(2) - (2)].id));
+		    free((yyvsp[0].id));
 
 		    if (!error) {
-			(yyval.rval) = (yyvsp[(1) - (2)].rval);
+			(yyval.rval) = (yyvsp[-1].rval);
 		    }
 		    else {
 			YYERROR;
 		    }
 		}
+#line 1871 "parser.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 1967 "parser.c"
+#line 1875 "parser.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -2068,14 +1949,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -2088,42 +1968,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2134,53 +2014,57 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval);
-  /* Do not reclaim the symbols of the rule which action triggered
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-#line 489 "parser.y"
+#line 575 "parser.y"
 
 
 #define yymaxdepth	utmaxdepth
@@ -2343,6 +2227,9 @@ ut_parse(
 #endif
 
             _finalUnit = NULL;
+            _builders = NULL;
+            _builderCount = 0;
+            _builderMax = 0;
 
             if (utparse() == 0) {
                 int     status;
@@ -2363,10 +2250,25 @@ ut_parse(
                 ut_set_status(status);
             }
 
+            if (_builderCount > 0) {
+                /*
+                 * Release any products abandoned by error recovery.
+                 */
+                ut_status       status = ut_get_status();
+
+                while (_builderCount > 0)
+                    ut_free(endProduct(_builderCount - 1));
+
+                ut_set_status(status);
+            }
+
+            free(_builders);
+            _builders = NULL;
+            _builderMax = 0;
+
             ut_delete_buffer(buf);
         }                               /* utf8String != NULL */
     }                                   /* valid arguments */
 
     return unit;
 }
-
@@ -35,7 +35,7 @@ char *strdup(const char *);
 #include <strings.h>
 #endif
 #include "udunits2.h"
-#include "prefix.h" /* For 'utGetPrefixByName' and 'utGetPrefixBySymbol' declarations */
+#include "idTrie.h" /* For 'idtResolve' declaration */
 
 static ut_unit*		_finalUnit;	/* fully-parsed specification */
 static ut_system*	_unitSystem;	/* The unit-system to use */
@@ -43,6 +43,9 @@ static char*		_errorMessage;	/* last error-message */
 static ut_encoding	_encoding;	/* encoding of string to be parsed */
 static int		_restartScanner;/* restart scanner? */
 static int		_isTime;        /* product_exp is time? */
+static ut_product_builder* _builders;	/* parse's product-builder stack */
+static int		_builderCount;	/* number of builders in use */
+static int		_builderMax;	/* number of builders allocated */
 
 
 /*
@@ -206,6 +209,93 @@ static int isTime(
     return isTime;
 }
 
+/*
+ * Starts a product of units.  Product builders are kept on a stack because
+ * products can be nested by parentheses.  The stack belongs to the current
+ * call of "ut_parse()", which frees it before returning.
+ *
+ * Returns:
+ *	-1	Failure.  "ut_get_status()" will be:
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	The index of the product builder on the stack.
+ */
+static int
+beginProduct(void)
+{
+    int		index = -1;		/* failure */
+
+    if (_builderCount == _builderMax) {
+	int			max = _builderMax == 0 ? 4 : 2*_builderMax;
+	ut_product_builder*	builders = realloc(_builders,
+	    max*sizeof(ut_product_builder));
+
+	if (builders == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"beginProduct(): Couldn't allocate %d product builders", max);
+	}
+	else {
+	    _builders = builders;
+	    _builderMax = max;
+	}
+    }
+
+    if (_builderCount < _builderMax &&
+	    ut_init_product(&_builders[_builderCount], _unitSystem)
+		== UT_SUCCESS)
+	index = _builderCount++;
+
+    return index;
+}
+
+/*
+ * Ends the product of units that's on the top of the stack.
+ *
+ * Arguments:
+ *	index	The index of the product builder on the stack.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be that of
+ *		"ut_finish_product()".
+ *	else	The product.
+ */
+static ut_unit*
+endProduct(
+    const int	index)
+{
+    assert(index == _builderCount - 1);
+
+    _builderCount = index;
+
+    return ut_finish_product(&_builders[index]);
+}
+
+/*
+ * Multiplies the product of units that's on the top of the stack by a factor.
+ *
+ * Arguments:
+ *	index	The index of the product builder on the stack.
+ *	unit	The factor.  Freed upon return.
+ *	power	The power of the factor.
+ * Returns:
+ *	-1	Failure.  "ut_get_status()" will be that of
+ *		"ut_multiply_product()".
+ *	 0	Success.
+ */
+static int
+multiplyProduct(
+    const int	index,
+    ut_unit*	unit,
+    const int	power)
+{
+    int		status = ut_multiply_product(&_builders[index], unit, power);
+
+    ut_free(unit);
+    ut_set_status(status);
+
+    return status == UT_SUCCESS ? 0 : -1;
+}
+
 %}
 
 %union {
@@ -213,6 +303,11 @@ static int isTime(
     ut_unit*	unit;			/* "unit" structure */
     double	rval;			/* floating-point numerical value */
     long	ival;			/* integer numerical value */
+    int		product;		/* index of product builder */
+    struct {
+	ut_unit*	unit;		/* factor */
+	int		power;		/* power of factor */
+    }		factor;			/* factor of product */
 }
 
 %token  	ERR
@@ -231,7 +326,8 @@ static int isTime(
 %type	<unit>	unit_spec
 %type   <unit>	shift_exp
 %type   <unit>	product_exp
-%type   <unit>	power_exp
+%type   <product>	product_list
+%type   <factor>	power_exp
 %type   <unit>	basic_exp
 %type   <rval>	timestamp
 %type   <rval>	number
@@ -280,68 +376,87 @@ shift_exp:	product_exp {
 		}
 		;
 
-product_exp:	power_exp {
-		    $$ = $1;
+product_exp:	product_list {
+		    $$ = endProduct($1);
+		    if ($$ == NULL)
+			YYERROR;
                     _isTime = isTime($$);
+		}
+		;
+
+product_list:	power_exp {
+		    $$ = beginProduct();
+		    if ($$ < 0) {
+			ut_status	prev = ut_get_status();
+			ut_free($1.unit);
+			ut_set_status(prev);
+			YYERROR;
+		    }
+		    if (multiplyProduct($$, $1.unit, $1.power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct($$));
+			ut_set_status(prev);
+			YYERROR;
+		    }
 		} |
-		product_exp power_exp	{
-		    $$ = ut_multiply($1, $2);
-                    _isTime = isTime($$);
-		    ut_free($1);
-		    ut_free($2);
-		    if ($$ == NULL)
+		product_list power_exp	{
+		    $$ = $1;
+		    if (multiplyProduct($$, $2.unit, $2.power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct($$));
+			ut_set_status(prev);
 			YYERROR;
+		    }
 		} |
-		product_exp error	{
+		product_list error	{
 		    ut_status	prev = ut_get_status();
-		    ut_free($1);
+		    ut_free(endProduct($1));
 		    ut_set_status(prev);
 		    YYERROR;
 		} |
-		product_exp MULTIPLY power_exp	{
-		    $$ = ut_multiply($1, $3);
-                    _isTime = isTime($$);
-		    ut_free($1);
-		    ut_free($3);
-		    if ($$ == NULL)
+		product_list MULTIPLY power_exp	{
+		    $$ = $1;
+		    if (multiplyProduct($$, $3.unit, $3.power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct($$));
+			ut_set_status(prev);
 			YYERROR;
+		    }
 		} |
-		product_exp MULTIPLY error	{
+		product_list MULTIPLY error	{
 		    ut_status	prev = ut_get_status();
-		    ut_free($1);
+		    ut_free(endProduct($1));
 		    ut_set_status(prev);
 		    YYERROR;
 		} |
-		product_exp DIVIDE power_exp	{
-		    $$ = ut_divide($1, $3);
-                    _isTime = isTime($$);
-		    ut_free($1);
-		    ut_free($3);
-		    if ($$ == NULL)
+		product_list DIVIDE power_exp	{
+		    $$ = $1;
+		    if (multiplyProduct($$, $3.unit, -$3.power)) {
+			ut_status	prev = ut_get_status();
+			ut_free(endProduct($$));
+			ut_set_status(prev);
 			YYERROR;
+		    }
 		} |
-		product_exp DIVIDE error	{
+		product_list DIVIDE error	{
 		    ut_status	prev = ut_get_status();
-		    ut_free($1);
+		    ut_free(endProduct($1));
 		    ut_set_status(prev);
 		    YYERROR;
 		}
 		;
 
 power_exp:	basic_exp {
-		    $$ = $1;
+		    $$.unit = $1;
+		    $$.power = 1;
 		} |
 		basic_exp INT {
-		    $$ = ut_raise($1, $2);
-		    ut_free($1);
-		    if ($$ == NULL)
-			YYERROR;
+		    $$.unit = $1;
+		    $$.power = $2;
 		} |
 		basic_exp EXPONENT {
-		    $$ = ut_raise($1, $2);
-		    ut_free($1);
-		    if ($$ == NULL)
-			YYERROR;
+		    $$.unit = $1;
+		    $$.power = $2;
 		} |
 		basic_exp error {
 		    ut_status	prev = ut_get_status();
@@ -352,43 +467,8 @@ power_exp:	basic_exp {
 		;
 
 basic_exp:	ID {
-		    double	prefix = 1;
-		    ut_unit*	unit = NULL;
-		    char*	cp = $1;
-		    int		symbolPrefixSeen = 0;
-
-		    while (*cp) {
-			size_t	nchar;
-			double	value;
-
-			unit = ut_get_unit_by_name(_unitSystem, cp);
-
-			if (unit != NULL)
-			    break;
-
-			unit = ut_get_unit_by_symbol(_unitSystem, cp);
-
-			if (unit != NULL)
-			    break;
-
-			if (utGetPrefixByName(_unitSystem, cp, &value, &nchar)
-				== UT_SUCCESS) {
-			    prefix *= value;
-			    cp += nchar;
-			}
-			else {
-			    if (!symbolPrefixSeen &&
-				    utGetPrefixBySymbol(_unitSystem, cp, &value,
-					&nchar) == UT_SUCCESS) {
-				symbolPrefixSeen = 1;
-				prefix *= value;
-				cp += nchar;
-			    }
-			    else {
-				break;
-			    }
-			}
-		    }
+		    double		prefix;
+		    const ut_unit*	unit = idtResolve(_unitSystem, $1, &prefix);
 
 		    free($1);
 
@@ -399,8 +479,6 @@ basic_exp:	ID {
 
 		    $$ = ut_scale(prefix, unit);
 
-		    ut_free(unit);
-
 		    if ($$ == NULL)
 			YYERROR;
 		} |
@@ -656,6 +734,9 @@ ut_parse(
 #endif
 
             _finalUnit = NULL;
+            _builders = NULL;
+            _builderCount = 0;
+            _builderMax = 0;
 
             if (utparse() == 0) {
                 int     status;
@@ -676,6 +757,22 @@ ut_parse(
                 ut_set_status(status);
             }
 
+            if (_builderCount > 0) {
+                /*
+                 * Release any products abandoned by error recovery.
+                 */
+                ut_status       status = ut_get_status();
+
+                while (_builderCount > 0)
+                    ut_free(endProduct(_builderCount - 1));
+
+                ut_set_status(status);
+            }
+
+            free(_builders);
+            _builders = NULL;
+            _builderMax = 0;
+
             ut_delete_buffer(buf);
         }                               /* utf8String != NULL */
     }                                   /* valid arguments */
@@ -6,7 +6,8 @@
  * redistribution conditions.
  */
 /*
- * Status of the last operation by the UDUNITS2(3) library.
+ * Status of the last operation by the UDUNITS2(3) library.  The status is
+ * that of the calling thread's current context (see "context.c").
  */
 
 /*LINTLIBRARY*/
@@ -15,25 +16,25 @@
 #   define _XOPEN_SOURCE 500
 #endif
 
+#include "context.h"
 #include "udunits2.h"
 
-static ut_status		_status = UT_SUCCESS;
-
 
 /*
- * Returns the status of the last operation by the units module.  This function
- * will not change the status.
+ * Returns the status of the last operation by the units module in the calling
+ * thread's current context.  This function will not change the status.
  */
 ut_status
 ut_get_status()
 {
-    return _status;
+    return ctxGet()->status;
 }
 
 
 /*
- * Sets the status of the units module.  This function would not normally be
- * called by the user unless they were doing their own parsing or formatting.
+ * Sets the status of the units module in the calling thread's current
+ * context.  This function would not normally be called by the user unless
+ * they were doing their own parsing or formatting.
  *
  * Arguments:
  *	status	The status of the units module.
@@ -42,5 +43,5 @@ void
 ut_set_status(
     const ut_status	status)
 {
-    _status = status;
+    ctxGet()->status = status;
 }
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2013 University Corporation for Atmospheric Research
+ *
+ * This file is part of the UDUNITS-2 package.  See the file COPYRIGHT
+ * in the top-level source-directory of the package for copying and
+ * redistribution conditions.
+ */
+/*
+ * Lookup tables that other modules of the library keep in a unit-system.
+ */
+#ifndef UT_SYSTEM_TABLE_H_INCLUDED
+#define UT_SYSTEM_TABLE_H_INCLUDED
+
+#include "udunits2.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+typedef enum {
+    ST_NAME_TO_UNIT,			/* see "idToUnitMap.c" */
+    ST_SYMBOL_TO_UNIT,			/* see "idToUnitMap.c" */
+    ST_UNIT_TO_NAME,			/* see "unitToIdMap.c" */
+    ST_UNIT_TO_SYMBOL,			/* see "unitToIdMap.c" */
+    ST_ID_TRIE,				/* see "idTrie.c" */
+    ST_BUNDLED_DB,			/* see "bundledDb.c" */
+    ST_COUNT				/* number of tables */
+} SystemTable;
+
+
+/*
+ * Returns the address of the pointer to a lookup table of a unit-system.  The
+ * pointer is NULL until the module that owns the table sets it.  The owning
+ * module must free the table when the unit-system is freed (see
+ * "ut_free_system()").  Implemented in "unitcore.c".
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.  Mustn't be NULL.
+ *	table	The lookup table.
+ * Returns:
+ *	Address of the pointer to the table.
+ */
+void**
+coreGetTable(
+    const ut_system* const	system,
+    const SystemTable		table);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
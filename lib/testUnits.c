@@ -12,6 +12,7 @@
 
 #include <float.h>
 #include <glob.h>
+#include <limits.h>
 #include <math.h>
 #include <stdarg.h>
 #include <stdlib.h>
@@ -103,6 +104,31 @@ test_unitSystem(void)
     ut_free(unit);
     ut_free_system(system);
     CU_ASSERT_EQUAL(ut_get_status(), UT_SUCCESS);
+
+    /* The identifiers and prefixes of a unit-system are its own */
+    {
+	ut_system*	system1 = ut_new_system();
+	ut_system*	system2 = ut_new_system();
+	ut_unit*	base1 = ut_new_base_unit(system1);
+	ut_unit*	base2 = ut_new_base_unit(system2);
+
+	CU_ASSERT_EQUAL(ut_map_name_to_unit("name", UT_ASCII, base1),
+	    UT_SUCCESS);
+	CU_ASSERT_EQUAL(ut_add_symbol_prefix(system1, "k", 1e3), UT_SUCCESS);
+	CU_ASSERT_PTR_NULL(ut_get_unit_by_name(system2, "name"));
+	CU_ASSERT_EQUAL(ut_map_name_to_unit("name", UT_ASCII, base2),
+	    UT_SUCCESS);
+	CU_ASSERT_EQUAL(ut_map_symbol_to_unit("n", UT_ASCII, base2),
+	    UT_SUCCESS);
+	CU_ASSERT_PTR_NULL(ut_parse(system2, "kn", UT_ASCII));
+	ut_free(base1);
+	ut_free_system(system1);
+	unit = ut_get_unit_by_name(system2, "name");
+	CU_ASSERT_EQUAL(ut_compare(unit, base2), 0);
+	ut_free(unit);
+	ut_free(base2);
+	ut_free_system(system2);
+    }
 }
 
 
@@ -262,6 +288,45 @@ test_utMapNameToUnit(void)
     CU_ASSERT_PTR_NOT_NULL(metre);
     CU_ASSERT_EQUAL(ut_compare(metre, meter), 0);
     ut_free(metre);
+
+    /* Names are case-insensitive */
+    metre = ut_get_unit_by_name(unitSystem, "MeTrE");
+    CU_ASSERT_PTR_NOT_NULL(metre);
+    CU_ASSERT_EQUAL(ut_compare(metre, meter), 0);
+    ut_free(metre);
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("METRE", UT_ASCII, second), UT_EXISTS);
+
+    /* Enough names to grow the table and to shift entries upon removal */
+    {
+	char	name[32];
+	int	i;
+
+	for (i = 0; i < 200; i++) {
+	    (void)sprintf(name, "name%d", i);
+	    CU_ASSERT_EQUAL(ut_map_name_to_unit(name, UT_ASCII, meter),
+		UT_SUCCESS);
+	}
+	for (i = 0; i < 200; i += 2) {
+	    (void)sprintf(name, "NAME%d", i);
+	    CU_ASSERT_EQUAL(ut_unmap_name_to_unit(unitSystem, name, UT_ASCII),
+		UT_SUCCESS);
+	}
+	for (i = 0; i < 200; i++) {
+	    ut_unit*	unit;
+
+	    (void)sprintf(name, "name%d", i);
+	    unit = ut_get_unit_by_name(unitSystem, name);
+	    if (i % 2 == 0) {
+		CU_ASSERT_PTR_NULL(unit);
+	    }
+	    else {
+		CU_ASSERT_PTR_NOT_NULL(unit);
+		ut_free(unit);
+		CU_ASSERT_EQUAL(ut_unmap_name_to_unit(unitSystem, name,
+		    UT_ASCII), UT_SUCCESS);
+	    }
+	}
+    }
 }
 
 
@@ -282,6 +347,9 @@ test_utMapSymbolToUnit(void)
     CU_ASSERT_EQUAL(ut_compare(degK, kelvin), 0);
     ut_free(degK);
 
+    /* Symbols are case-sensitive */
+    CU_ASSERT_PTR_NULL(ut_get_unit_by_symbol(unitSystem, "\xb0k"));
+
     /* "\xc2\xb0" is the degree symbol in UTF-8 */
     CU_ASSERT_EQUAL(ut_map_symbol_to_unit("\xc2\xb0K", UT_UTF8, kelvin), UT_SUCCESS);
     CU_ASSERT_EQUAL(ut_map_symbol_to_unit("\xc2\xb0K", UT_UTF8, kelvin), UT_SUCCESS);
@@ -501,6 +569,47 @@ test_utGetSymbol(void)
     CU_ASSERT_STRING_EQUAL(ut_get_symbol(second, UT_ASCII), "s");
     CU_ASSERT_STRING_EQUAL(ut_get_symbol(radian, UT_ASCII), "rad");
     CU_ASSERT_STRING_EQUAL(ut_get_symbol(hertz, UT_ASCII), "Hz");
+
+    /* ASCII and Latin-1 symbols serve the wider encodings */
+    CU_ASSERT_STRING_EQUAL(ut_get_symbol(meter, UT_LATIN1), "m");
+    CU_ASSERT_STRING_EQUAL(ut_get_symbol(meter, UT_UTF8), "m");
+    CU_ASSERT_EQUAL(ut_map_unit_to_symbol(celsius, "\xb0" "C", UT_LATIN1),
+	UT_SUCCESS);
+    CU_ASSERT_PTR_NULL(ut_get_symbol(celsius, UT_ASCII));
+    CU_ASSERT_STRING_EQUAL(ut_get_symbol(celsius, UT_LATIN1), "\xb0" "C");
+    CU_ASSERT_STRING_EQUAL(ut_get_symbol(celsius, UT_UTF8), "\xc2\xb0" "C");
+    CU_ASSERT_EQUAL(ut_unmap_unit_to_symbol(celsius, UT_LATIN1), UT_SUCCESS);
+    CU_ASSERT_PTR_NULL(ut_get_symbol(celsius, UT_UTF8));
+
+    /* Enough units to grow the table and to shift entries upon removal */
+    {
+	ut_unit*	units[200];
+	char		symbol[32];
+	int		i;
+
+	for (i = 0; i < 200; i++) {
+	    units[i] = ut_scale(i + 2, meter);
+	    (void)sprintf(symbol, "m%d", i);
+	    CU_ASSERT_EQUAL(ut_map_unit_to_symbol(units[i], symbol, UT_ASCII),
+		UT_SUCCESS);
+	}
+	for (i = 0; i < 200; i += 2)
+	    CU_ASSERT_EQUAL(ut_unmap_unit_to_symbol(units[i], UT_ASCII),
+		UT_SUCCESS);
+	for (i = 0; i < 200; i++) {
+	    if (i % 2 == 0) {
+		CU_ASSERT_PTR_NULL(ut_get_symbol(units[i], UT_ASCII));
+	    }
+	    else {
+		(void)sprintf(symbol, "m%d", i);
+		CU_ASSERT_STRING_EQUAL(ut_get_symbol(units[i], UT_ASCII),
+		    symbol);
+		CU_ASSERT_EQUAL(ut_unmap_unit_to_symbol(units[i], UT_ASCII),
+		    UT_SUCCESS);
+	    }
+	    ut_free(units[i]);
+	}
+    }
 }
 
 
@@ -594,6 +703,182 @@ test_utMultiply(void)
 }
 
 
+static void
+test_utMultiplyManyBaseUnits(void)
+{
+    ut_system*	system = ut_new_system();
+    ut_unit*	bases[40];
+    ut_unit*	product;
+    ut_unit*	unit;
+    int		i;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(system);
+
+    for (i = 0; i < 40; i++)
+	bases[i] = ut_new_base_unit(system);
+
+    /*
+     * Products of more basic-units than fit in the scratch buffer of
+     * "productMultiply()".
+     */
+    product = ut_clone(bases[0]);
+    for (i = 1; i < 40; i++) {
+	unit = ut_multiply(product, bases[i]);
+	ut_free(product);
+	product = unit;
+    }
+    CU_ASSERT_PTR_NOT_NULL_FATAL(product);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_SUCCESS);
+
+    unit = ut_multiply(product, product);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    ut_free(unit);
+
+    /*
+     * A product of more basic-units than fit in a product builder.
+     */
+    {
+	ut_product_builder	builder;
+
+	(void)ut_init_product(&builder, system);
+	for (i = 0; i < 40; i++)
+	    CU_ASSERT_EQUAL(ut_multiply_product(&builder, bases[i], 1),
+		UT_SUCCESS);
+	unit = ut_finish_product(&builder);
+	CU_ASSERT_PTR_EQUAL(unit, product);
+	ut_free(unit);
+    }
+
+    for (i = 0; i < 40; i++) {
+	unit = ut_divide(product, bases[i]);
+	ut_free(product);
+	product = unit;
+    }
+    CU_ASSERT_PTR_EQUAL(product, ut_get_dimensionless_unit_one(system));
+
+    ut_free(product);
+    for (i = 0; i < 40; i++)
+	ut_free(bases[i]);
+    ut_free_system(system);
+}
+
+
+static void
+test_utSetArena(void)
+{
+    ut_system*		system = ut_new_system();
+    ut_unit*		base;
+    ut_unit*		squared;
+    ut_unit*		scaled;
+    ut_unit*		logarithmic;
+    cv_converter*	converter;
+    int			i;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(system);
+    CU_ASSERT_EQUAL(ut_set_arena(system, 1), 0);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_SUCCESS);
+
+    base = ut_new_base_unit(system);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(base);
+
+    /* Freed units in the arena are reused */
+    for (i = 0; i < 1000; i++) {
+	squared = ut_raise(base, 2 + i % 7);
+	scaled = ut_scale(1 + i, squared);
+	logarithmic = ut_log(10, scaled);
+	ut_free(logarithmic);
+	ut_free(scaled);
+	ut_free(squared);
+    }
+
+    squared = ut_multiply(base, base);
+    scaled = ut_scale(1000, squared);
+    CU_ASSERT_EQUAL(ut_set_arena(system, 0), 1);
+    logarithmic = ut_log(10, scaled);
+    CU_ASSERT_PTR_NOT_NULL(logarithmic);
+    converter = ut_get_converter(scaled, squared);
+    CU_ASSERT_PTR_NOT_NULL(converter);
+    CU_ASSERT_EQUAL(cv_convert_double(converter, 1), 1000);
+    cv_free(converter);
+
+    /* The arena is released with the unit-system */
+    ut_free_system(system);
+
+    CU_ASSERT_EQUAL(ut_set_arena(NULL, 1), 0);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
+}
+
+
+static void
+test_utFreezeSystem(void)
+{
+    ut_system*		system = ut_new_system();
+    ut_unit*		base;
+    ut_unit*		kilo;
+    ut_unit*		unit;
+    cv_converter*	converter;
+    int			i;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(system);
+    base = ut_new_base_unit(system);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(base);
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("base", UT_ASCII, base), UT_SUCCESS);
+    kilo = ut_scale(1000, base);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(kilo);
+
+    CU_ASSERT_EQUAL(ut_freeze_system(system), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_freeze_system(system), UT_SUCCESS);
+
+    /* The unit-system can't be modified */
+    CU_ASSERT_PTR_NULL(ut_new_base_unit(system));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_set_second(base), UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("other", UT_ASCII, base), UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_unmap_name_to_unit(system, "base", UT_ASCII),
+	UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_map_unit_to_name(kilo, "kilo", UT_ASCII), UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_add_name_prefix(system, "kilo", 1000), UT_BAD_ARG);
+
+    /* Its units are permanent */
+    for (i = 0; i < 3; i++) {
+	unit = ut_get_unit_by_name(system, "base");
+	CU_ASSERT_PTR_EQUAL(unit, base);
+	ut_free(unit);
+	ut_free(base);
+    }
+    converter = ut_get_converter(kilo, base);
+    CU_ASSERT_PTR_NOT_NULL(converter);
+    CU_ASSERT_EQUAL(cv_convert_double(converter, 1), 1000);
+    cv_free(converter);
+
+    /* Converters are cached, even more than fit in the fixed cache */
+    for (i = 1; i <= 2000; i++) {
+	cv_converter*	other;
+
+	unit = ut_scale(i, base);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(unit);
+	converter = ut_get_converter(unit, base);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+	CU_ASSERT_EQUAL(cv_convert_double(converter, 1), i);
+	other = ut_get_converter(unit, base);
+	CU_ASSERT_PTR_EQUAL(other, converter);
+	cv_free(other);
+	cv_free(converter);
+	ut_free(unit);
+    }
+
+    /* New units can still be created */
+    unit = ut_multiply(kilo, base);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    CU_ASSERT_TRUE(ut_are_convertible(unit, kilo) == 0);
+    ut_free(unit);
+
+    ut_free_system(system);
+
+    CU_ASSERT_EQUAL(ut_freeze_system(NULL), UT_BAD_ARG);
+}
+
+
 static void
 test_utInvert(void)
 {
@@ -1023,6 +1308,118 @@ areCloseDoubles(
 }
 
 
+static void
+test_utProductBuilder(void)
+{
+    ut_product_builder	builder;
+    ut_unit*		unit;
+    ut_unit*		expected;
+    ut_unit*		tmp;
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    CU_ASSERT_EQUAL(ut_compare(unit,
+	ut_get_dimensionless_unit_one(unitSystem)), 0);
+    ut_free(unit);
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, kilogram, 1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, -2), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, second, -1), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_SUCCESS);
+    expected = ut_parse(unitSystem, "kg.m-2.s-1", UT_ASCII);
+    CU_ASSERT_PTR_EQUAL(unit, expected);
+    ut_free(expected);
+    ut_free(unit);
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, kilometer, 2), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, minute, -1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, -2), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_scale_product(&builder, 3), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    tmp = ut_invert(second);
+    expected = ut_scale(3e6/60, tmp);
+    ut_free(tmp);
+    {
+	cv_converter*	converter = ut_get_converter(unit, expected);
+
+	CU_ASSERT_PTR_NOT_NULL(converter);
+	CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(converter, 1), 1));
+	cv_free(converter);
+    }
+    ut_free(expected);
+    ut_free(unit);
+
+    /* A sole factor keeps its offset; otherwise, offsets are ignored */
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, celsius, 1), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    CU_ASSERT_PTR_EQUAL(unit, celsius);
+    ut_free(unit);
+    /* A factor raised to the power zero doesn't change the product */
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, celsius, 1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 0), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    CU_ASSERT_PTR_EQUAL(unit, celsius);
+    ut_free(unit);
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 0), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, celsius, 1), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    CU_ASSERT_PTR_EQUAL(unit, celsius);
+    ut_free(unit);
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, celsius, 1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, second, -1), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    expected = ut_divide(celsius, second);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    CU_ASSERT_PTR_EQUAL(unit, expected);
+    ut_free(expected);
+    ut_free(unit);
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, dBZ, 1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, -1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, radian, 1), UT_SUCCESS);
+    unit = ut_finish_product(&builder);
+    tmp = ut_multiply(dBZ, radian);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    CU_ASSERT_PTR_EQUAL(unit, tmp);
+    ut_free(tmp);
+    ut_free(unit);
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, dBZ, 2), UT_MEANINGLESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 1), UT_MEANINGLESS);
+    CU_ASSERT_PTR_NULL(ut_finish_product(&builder));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_MEANINGLESS);
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 1), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 256), UT_BAD_ARG);
+    CU_ASSERT_PTR_NULL(ut_finish_product(&builder));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
+    CU_ASSERT_PTR_NULL(ut_finish_product(&builder));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, unitSystem), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_scale_product(&builder, 0), UT_BAD_ARG);
+    CU_ASSERT_PTR_NULL(ut_finish_product(&builder));
+
+    CU_ASSERT_EQUAL(ut_init_product(&builder, NULL), UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_multiply_product(&builder, meter, 1), UT_BAD_ARG);
+    CU_ASSERT_EQUAL(ut_init_product(NULL, unitSystem), UT_BAD_ARG);
+}
+
+
 static void
 test_utGetDimensionlessUnitOne(void)
 {
@@ -1092,6 +1489,43 @@ test_utClone(void)
 }
 
 
+static void
+test_utUniqueUnits(void)
+{
+    ut_unit*	squared = ut_multiply(meter, meter);
+    ut_unit*	unit;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(squared);
+
+    /* Equal units are identical */
+    unit = ut_raise(meter, 2);
+    CU_ASSERT_PTR_EQUAL(unit, squared);
+    ut_free(unit);
+    unit = ut_divide(squared, meter);
+    CU_ASSERT_PTR_EQUAL(unit, meter);
+    ut_free(unit);
+    unit = ut_divide(meter, meter);
+    CU_ASSERT_PTR_EQUAL(unit, ut_get_dimensionless_unit_one(unitSystem));
+    ut_free(unit);
+    unit = ut_scale(1000, meter);
+    CU_ASSERT_PTR_EQUAL(unit, kilometer);
+    ut_free(unit);
+    unit = ut_offset(kelvin, 273.15);
+    CU_ASSERT_PTR_EQUAL(unit, celsius);
+    CU_ASSERT_EQUAL(ut_compare(unit, celsius), 0);
+    ut_free(unit);
+
+    /* A clone outlives the original */
+    unit = ut_clone(squared);
+    CU_ASSERT_PTR_EQUAL(unit, squared);
+    ut_free(squared);
+    CU_ASSERT_EQUAL(ut_compare(unit, meter), 1);
+    squared = ut_raise(meter, 2);
+    CU_ASSERT_PTR_EQUAL(squared, unit);
+    ut_free(unit);
+    ut_free(squared);
+}
+
 static void
 test_utAreConvertible(void)
 {
@@ -1117,6 +1551,17 @@ test_utAreConvertible(void)
     CU_ASSERT_EQUAL(ut_are_convertible(radian, unit), 1);
     ut_free(unit);
 
+    unit = ut_multiply(meter, radian);
+    CU_ASSERT_EQUAL(ut_are_convertible(meter, unit), 1);
+    CU_ASSERT_EQUAL(ut_are_convertible(unit, cubicMeter), 0);
+    ut_free(unit);
+
+    unit = ut_invert(meterPerSecondSquared);
+    CU_ASSERT_EQUAL(ut_are_convertible(meterPerSecondSquared, unit), 1);
+    CU_ASSERT_EQUAL(ut_are_convertible(unit, meterSquaredPerSecondSquared),
+	0);
+    ut_free(unit);
+
     CU_ASSERT_EQUAL(ut_are_convertible(NULL, meter), 0);
     CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
 }
@@ -1441,6 +1886,833 @@ test_utGetConverter(void)
 }
 
 
+static void
+test_utGetConverterCache(void)
+{
+    cv_converter*	converter1 = ut_get_converter(kilometer, meter);
+    cv_converter*	converter2 = ut_get_converter(kilometer, meter);
+    cv_converter*	clone;
+    int			i;
+    int			nwrong = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter1);
+    CU_ASSERT_PTR_EQUAL(converter1, converter2);
+    CU_ASSERT_EQUAL(cv_convert_double(converter2, 1), 1000);
+
+    clone = cv_clone(converter1);
+    CU_ASSERT_PTR_EQUAL(clone, converter1);
+    cv_free(clone);
+    CU_ASSERT_PTR_NULL(cv_clone(NULL));
+
+    /* Evict the cached converter */
+    for (i = 2; i < 3000; i++) {
+	ut_unit*	unit = ut_scale(i, meter);
+	cv_converter*	converter;
+
+	converter = ut_get_converter(unit, meter);
+
+	if (converter == NULL || cv_convert_double(converter, 1) != i)
+	    nwrong++;
+
+	cv_free(converter);
+	ut_free(unit);
+    }
+
+    CU_ASSERT_EQUAL(nwrong, 0);
+
+    CU_ASSERT_EQUAL(cv_convert_double(converter1, 1), 1000);
+    cv_free(converter1);
+    cv_free(converter2);
+
+    converter1 = ut_get_converter(kilometer, meter);
+    CU_ASSERT_EQUAL(cv_convert_double(converter1, 2), 2000);
+    cv_free(converter1);
+
+    /* Failures aren't cached */
+    CU_ASSERT_PTR_NULL(ut_get_converter(meter, kilogram));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_MEANINGLESS);
+    CU_ASSERT_PTR_NULL(ut_get_converter(meter, kilogram));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_MEANINGLESS);
+}
+
+static void
+test_cvCompile(void)
+{
+    cv_converter*	converter = ut_get_converter(cubicMicron, dBZ);
+    cv_converter*	compiled;
+    double		doubles[1500];
+    double		expected[1500];
+    float		floats[1500];
+    size_t		i;
+    int			allClose;
+    char		buf[132];
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    compiled = cv_compile(converter);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(compiled);
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(compiled, 1000), 30.0));
+    CU_ASSERT_TRUE(areCloseFloats(cv_convert_float(compiled, 10), 10.0));
+    CU_ASSERT_TRUE(cv_get_expression(compiled, buf, sizeof(buf), "x") > 0);
+
+    /* More values than are converted in one block */
+    for (i = 0; i < 1500; i++)
+	doubles[i] = expected[i] = 1 + i;
+    CU_ASSERT_EQUAL(cv_convert_doubles(converter, expected, 1500, expected),
+	expected);
+    CU_ASSERT_EQUAL(cv_convert_doubles(compiled, doubles, 1500, doubles),
+	doubles);
+    for (allClose = 1, i = 0; i < 1500; i++)
+	allClose &= areCloseDoubles(doubles[i], expected[i]);
+    CU_ASSERT_TRUE(allClose);
+
+    /* Overlapping arrays with the output following the input */
+    for (i = 0; i < 1500; i++)
+	doubles[i] = 1 + i;
+    CU_ASSERT_EQUAL(cv_convert_doubles(compiled, doubles, 1400, doubles+100),
+	doubles+100);
+    for (allClose = 1, i = 0; i < 1400; i++)
+	allClose &= areCloseDoubles(doubles[100+i], expected[i]);
+    CU_ASSERT_TRUE(allClose);
+
+    /* Overlapping arrays with the output preceding the input */
+    for (i = 0; i < 1500; i++)
+	floats[i] = 1 + i;
+    CU_ASSERT_EQUAL(cv_convert_floats(compiled, floats+100, 1400, floats),
+	floats);
+    for (allClose = 1, i = 0; i < 1400; i++)
+	allClose &= areCloseFloats(floats[i], expected[100+i]);
+    CU_ASSERT_TRUE(allClose);
+
+    cv_free(compiled);
+    cv_free(converter);
+
+    converter = ut_get_converter(second, megahertz);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    compiled = cv_compile(converter);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(compiled);
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(compiled, 1e-6), 1.0));
+    cv_free(compiled);
+    cv_free(converter);
+
+    CU_ASSERT_PTR_NULL(cv_compile(NULL));
+}
+
+
+static void
+test_cvConvertArrays(void)
+{
+    cv_converter*	converters[4];
+    double		doubles[40];
+    double		expected[40];
+    float		floats[40];
+    float		expectedFloats[40];
+    size_t		i;
+    int			j;
+    int			allEqual;
+
+    converters[0] = cv_get_scale(1.8);
+    converters[1] = cv_get_offset(-273.15);
+    converters[2] = cv_get_galilean(1.8, 32);
+    converters[3] = cv_get_inverse();
+
+    for (j = 0; j < 4; j++) {
+	CU_ASSERT_PTR_NOT_NULL_FATAL(converters[j]);
+
+	/*
+	 * Array results must equal scalar results exactly, whatever kernel
+	 * the host CPU uses.  The input is overlapped by an output that
+	 * follows it by less than a vector's width.
+	 */
+	for (i = 0; i < 40; i++) {
+	    doubles[i] = i % 3 == 0 ? -0.1 * i : 1.0 / (i + 1);
+	    floats[i] = (float)doubles[i];
+	}
+	for (i = 0; i < 37; i++) {
+	    expected[3+i] = cv_convert_double(converters[j], doubles[i]);
+	    expectedFloats[3+i] = cv_convert_float(converters[j], floats[i]);
+	}
+	CU_ASSERT_EQUAL(cv_convert_doubles(converters[j], doubles, 37,
+	    doubles+3), doubles+3);
+	CU_ASSERT_EQUAL(cv_convert_floats(converters[j], floats, 37, floats+3),
+	    floats+3);
+	for (allEqual = 1, i = 3; i < 40; i++)
+	    allEqual &= doubles[i] == expected[i] &&
+		floats[i] == expectedFloats[i];
+	CU_ASSERT_TRUE(allEqual);
+
+	/* Output preceding the input */
+	CU_ASSERT_EQUAL(cv_convert_doubles(converters[j], doubles+3, 37,
+	    doubles), doubles);
+	for (allEqual = 1, i = 0; i < 37; i++)
+	    allEqual &= doubles[i] ==
+		cv_convert_double(converters[j], expected[3+i]);
+	CU_ASSERT_TRUE(allEqual);
+
+	cv_free(converters[j]);
+    }
+}
+
+
+/*
+ * Indicates if two double values differ by no more than two ULP.
+ */
+static int
+withinTwoUlp(
+    double	x,
+    double	y)
+{
+    return x == y || x == nextafter(y, x) || x == nextafter(nextafter(y, x), x);
+}
+
+
+static void
+test_cvLogExpArrays(void)
+{
+    cv_converter*	converters[4];
+    double		doubles[37];
+    float		floats[37];
+    double		specials[3];
+    size_t		i;
+    int			j;
+    int			allClose;
+
+    converters[0] = cv_get_log(10);
+    converters[1] = cv_get_log(M_E);
+    converters[2] = cv_get_pow(10);
+    converters[3] = cv_get_pow(2);
+
+    for (j = 0; j < 4; j++) {
+	CU_ASSERT_PTR_NOT_NULL_FATAL(converters[j]);
+
+	for (i = 0; i < 37; i++)
+	    floats[i] = (float)(doubles[i] = j < 2 ? 1e-3 * (i + 1) * (i + 1)
+		: 9.5 * i - 170);
+	CU_ASSERT_EQUAL(cv_convert_doubles(converters[j], doubles, 37,
+	    doubles), doubles);
+	CU_ASSERT_EQUAL(cv_convert_floats(converters[j], floats, 37, floats),
+	    floats);
+	for (allClose = 1, i = 0; i < 37; i++) {
+	    const double	x = j < 2 ? 1e-3 * (i + 1) * (i + 1)
+				    : 9.5 * i - 170;
+	    const float		y = cv_convert_float(converters[j], (float)x);
+
+	    allClose &= withinTwoUlp(doubles[i],
+		cv_convert_double(converters[j], x));
+	    allClose &= floats[i] == y || floats[i] == nextafterf(y, floats[i]);
+	}
+	CU_ASSERT_TRUE(allClose);
+    }
+
+    specials[0] = 0;
+    specials[1] = -1;
+    specials[2] = HUGE_VAL;
+    (void)cv_convert_doubles(converters[0], specials, 3, specials);
+    CU_ASSERT_TRUE(specials[0] == -HUGE_VAL);
+    CU_ASSERT_TRUE(isnan(specials[1]));
+    CU_ASSERT_TRUE(specials[2] == HUGE_VAL);
+
+    specials[0] = -HUGE_VAL;
+    specials[1] = 400;
+    specials[2] = HUGE_VAL;
+    (void)cv_convert_doubles(converters[2], specials, 3, specials);
+    CU_ASSERT_TRUE(specials[0] == 0);
+    CU_ASSERT_TRUE(specials[1] == HUGE_VAL);
+    CU_ASSERT_TRUE(specials[2] == HUGE_VAL);
+
+    for (j = 0; j < 4; j++)
+	cv_free(converters[j]);
+}
+
+
+static void
+test_cvConvertStrided(void)
+{
+    struct {
+	double	time;
+	float	speed;
+	double	temperature;
+    }			records[600];
+    double		grid[4][5];
+    double		transpose[3][2];
+    double		reversed[2][3];
+    float		floats[4][5];
+    const size_t	shape[2] = {2, 3};
+    const size_t	rows[2] = {2, 5};
+    ptrdiff_t		inStrides[2];
+    ptrdiff_t		outStrides[2];
+    cv_converter*	celsiusToKelvin = cv_get_offset(273.15);
+    cv_converter*	toMilli = cv_get_scale(1000);
+    size_t		i;
+    size_t		j;
+    int			allEqual;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(celsiusToKelvin);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(toMilli);
+
+    /* One member of an array of structures, in place (more than a block) */
+    for (i = 0; i < 600; i++) {
+	records[i].time = i;
+	records[i].speed = (float)i;
+	records[i].temperature = i - 300.0;
+    }
+    CU_ASSERT_EQUAL(cv_convert_doubles_strided(celsiusToKelvin,
+	&records[0].temperature, sizeof(records[0]), 600,
+	&records[0].temperature, sizeof(records[0])), &records[0].temperature);
+    CU_ASSERT_EQUAL(cv_convert_floats_strided(toMilli, &records[0].speed,
+	sizeof(records[0]), 600, &records[0].speed, sizeof(records[0])),
+	&records[0].speed);
+    for (allEqual = 1, i = 0; i < 600; i++)
+	allEqual &= records[i].time == i &&
+	    records[i].speed == (float)(1000.0 * i) &&
+	    records[i].temperature == (i - 300.0) + 273.15;
+    CU_ASSERT_TRUE(allEqual);
+
+    /* Reversal by a negative stride */
+    CU_ASSERT_EQUAL(cv_convert_doubles_strided(toMilli,
+	&records[599].time, -(ptrdiff_t)sizeof(records[0]), 3,
+	&grid[0][0], sizeof(double)), &grid[0][0]);
+    CU_ASSERT_EQUAL(grid[0][0], 599000.0);
+    CU_ASSERT_EQUAL(grid[0][2], 597000.0);
+
+    /* A 2x3 hyperslab of a 4x5 grid, in place */
+    for (i = 0; i < 4; i++)
+	for (j = 0; j < 5; j++)
+	    floats[i][j] = (float)(grid[i][j] = 10*i + j);
+    inStrides[0] = 2*sizeof(grid[0]);
+    inStrides[1] = sizeof(grid[0][0]);
+    CU_ASSERT_EQUAL(cv_convert_doubles_nd(toMilli, 2, shape, &grid[1][1],
+	inStrides, &grid[1][1], inStrides), &grid[1][1]);
+    for (allEqual = 1, i = 0; i < 4; i++)
+	for (j = 0; j < 5; j++)
+	    allEqual &= grid[i][j] == ((i == 1 || i == 3) && j >= 1 && j <= 3
+		? 1000.0 * (10*i + j)
+		: 10.0*i + j);
+    CU_ASSERT_TRUE(allEqual);
+
+    /* The same hyperslab transposed into another array */
+    outStrides[0] = sizeof(transpose[0][0]);
+    outStrides[1] = sizeof(transpose[0]);
+    inStrides[0] = 2*sizeof(floats[0]);
+    inStrides[1] = sizeof(floats[0][0]);
+    CU_ASSERT_PTR_NULL(cv_convert_doubles_nd(toMilli, 2, NULL, &grid[0][0],
+	inStrides, &transpose[0][0], outStrides));
+    CU_ASSERT_PTR_NOT_NULL(cv_convert_floats_nd(celsiusToKelvin, 2, shape,
+	&floats[1][1], inStrides, &floats[1][1], inStrides));
+    CU_ASSERT_EQUAL(floats[3][3], (float)(33 + 273.15));
+    CU_ASSERT_EQUAL(floats[2][3], 23.0f);
+    inStrides[0] = 2*sizeof(grid[0]);
+    inStrides[1] = sizeof(grid[0][0]);
+    CU_ASSERT_EQUAL(cv_convert_doubles_nd(cv_get_trivial(), 2, shape,
+	&grid[1][1], inStrides, &transpose[0][0], outStrides),
+	&transpose[0][0]);
+    CU_ASSERT_EQUAL(transpose[0][1], 31000.0);
+    CU_ASSERT_EQUAL(transpose[2][0], 13000.0);
+
+    /* Whole rows, which are converted as a single run */
+    inStrides[0] = sizeof(grid[0]);
+    CU_ASSERT_EQUAL(cv_convert_doubles_nd(toMilli, 2, rows, &grid[0][0],
+	inStrides, &grid[0][0], inStrides), &grid[0][0]);
+    CU_ASSERT_EQUAL(grid[0][4], 4000.0);
+    CU_ASSERT_EQUAL(grid[1][2], 12000000.0);
+    CU_ASSERT_EQUAL(grid[2][0], 20.0);
+
+    /* Rows in reverse order by negative strides */
+    for (i = 0; i < 4; i++)
+	for (j = 0; j < 5; j++)
+	    grid[i][j] = 10*i + j;
+    inStrides[0] = -2*(ptrdiff_t)sizeof(grid[0]);
+    inStrides[1] = sizeof(grid[0][0]);
+    outStrides[0] = -(ptrdiff_t)sizeof(reversed[0]);
+    outStrides[1] = -(ptrdiff_t)sizeof(reversed[0][0]);
+    CU_ASSERT_EQUAL(cv_convert_doubles_nd(toMilli, 2, shape, &grid[3][1],
+	inStrides, &reversed[1][2], outStrides), &reversed[1][2]);
+    CU_ASSERT_EQUAL(reversed[1][2], 31000.0);
+    CU_ASSERT_EQUAL(reversed[1][0], 33000.0);
+    CU_ASSERT_EQUAL(reversed[0][2], 11000.0);
+    CU_ASSERT_EQUAL(reversed[0][0], 13000.0);
+
+    cv_free(toMilli);
+    cv_free(celsiusToKelvin);
+}
+
+
+static void
+test_cvPackUnpack(void)
+{
+    cv_converter*	kelvinToCelsius = cv_get_offset(-273.15);
+    cv_converter*	celsiusToKelvin = cv_get_offset(273.15);
+    cv_converter*	toDecibels = cv_get_log(10);
+    short		shorts[700];
+    signed char		schars[6];
+    int			ints[3];
+    double		doubles[700];
+    float		floats[700];
+    size_t		i;
+    int			allClose;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(kelvinToCelsius);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(celsiusToKelvin);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(toDecibels);
+
+    /* Temperatures in kelvin packed as 0.01*i + 273.15 (more than a block) */
+    for (i = 0; i < 700; i++)
+	shorts[i] = (short)(i*50 - 17500);
+    CU_ASSERT_EQUAL(cv_unpack_doubles(kelvinToCelsius, CV_SHORT, shorts, 700,
+	0.01, 273.15, doubles), doubles);
+    CU_ASSERT_EQUAL(cv_unpack_floats(kelvinToCelsius, CV_SHORT, shorts, 700,
+	0.01, 273.15, floats), floats);
+    for (allClose = 1, i = 0; i < 700; i++) {
+	allClose &= areCloseDoubles(doubles[i], 0.5*i - 175);
+	allClose &= areCloseFloats(floats[i], (float)(0.5*i - 175));
+    }
+    CU_ASSERT_TRUE(allClose);
+
+    /* Round trip */
+    CU_ASSERT_EQUAL(cv_pack_doubles(celsiusToKelvin, doubles, 700, 0.01,
+	273.15, CV_SHORT, shorts), shorts);
+    for (allClose = 1, i = 0; i < 700; i++)
+	allClose &= shorts[i] == (short)(i*50 - 17500);
+    CU_ASSERT_TRUE(allClose);
+
+    /* A non-Galilean converter */
+    ints[0] = 1;
+    ints[1] = 10;
+    ints[2] = 100;
+    CU_ASSERT_EQUAL(cv_unpack_doubles(toDecibels, CV_INT, ints, 3, 10, 0,
+	doubles), doubles);
+    CU_ASSERT_TRUE(areCloseDoubles(doubles[0], 1));
+    CU_ASSERT_TRUE(areCloseDoubles(doubles[2], 3));
+    CU_ASSERT_EQUAL(cv_pack_doubles(toDecibels, doubles, 3, 0.5, 0, CV_INT,
+	ints), ints);
+    CU_ASSERT_EQUAL(ints[0], 0);	/* log10(1)/0.5 */
+    CU_ASSERT_EQUAL(ints[1], 1);	/* log10(2)/0.5 = 0.60 */
+    CU_ASSERT_EQUAL(ints[2], 1);	/* log10(3)/0.5 = 0.95 */
+
+    /* Rounding, saturation, and NaN */
+    floats[0] = 0.5f;
+    floats[1] = -0.5f;
+    floats[2] = 1.49f;
+    floats[3] = 1000;
+    floats[4] = -1000;
+    floats[5] = (float)(0.0 / 0.0);
+    CU_ASSERT_EQUAL(cv_pack_floats(cv_get_trivial(), floats, 6, 1, 0, CV_SCHAR,
+	schars), schars);
+    CU_ASSERT_EQUAL(schars[0], 1);
+    CU_ASSERT_EQUAL(schars[1], -1);
+    CU_ASSERT_EQUAL(schars[2], 1);
+    CU_ASSERT_EQUAL(schars[3], SCHAR_MAX);
+    CU_ASSERT_EQUAL(schars[4], SCHAR_MIN);
+    CU_ASSERT_EQUAL(schars[5], 0);
+
+    CU_ASSERT_PTR_NULL(cv_pack_floats(cv_get_trivial(), floats, 6, 0, 0,
+	CV_SCHAR, schars));
+    CU_ASSERT_PTR_NULL(cv_unpack_floats(NULL, CV_SCHAR, schars, 6, 1, 0,
+	floats));
+
+    cv_free(toDecibels);
+    cv_free(celsiusToKelvin);
+    cv_free(kelvinToCelsius);
+}
+
+
+/*
+ * An executor that executes the tasks in reverse order and counts them.
+ */
+static void
+reverseExecutor(
+    cv_task	task,
+    void*	arg,
+    size_t	count,
+    void*	context)
+{
+    while (count-- > 0) {
+	task(arg, count);
+	++*(size_t*)context;
+    }
+}
+
+
+static void
+test_cvConvertParallel(void)
+{
+    const size_t	count = 100000;
+    cv_converter*	celsiusToFahrenheit = cv_get_galilean(1.8, 32);
+    double*		in = malloc(count * sizeof(double));
+    double*		out = malloc(count * sizeof(double));
+    float*		floats = malloc(count * sizeof(float));
+    size_t		ntasks;
+    size_t		i;
+    int			allEqual;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(celsiusToFahrenheit);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(in);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(out);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(floats);
+
+    for (i = 0; i < count; i++) {
+	in[i] = i * 0.01 - 500;
+	floats[i] = (float)in[i];
+    }
+
+    ntasks = 0;
+    CU_ASSERT_EQUAL(cv_convert_doubles_parallel(celsiusToFahrenheit, in,
+	count, out, reverseExecutor, &ntasks), out);
+    CU_ASSERT_TRUE(ntasks > 1);
+    for (allEqual = 1, i = 0; i < count; i++)
+	allEqual &= out[i] == cv_convert_double(celsiusToFahrenheit, in[i]);
+    CU_ASSERT_TRUE(allEqual);
+
+    /* In place */
+    ntasks = 0;
+    CU_ASSERT_EQUAL(cv_convert_floats_parallel(celsiusToFahrenheit, floats,
+	count, floats, reverseExecutor, &ntasks), floats);
+    CU_ASSERT_TRUE(ntasks > 1);
+    for (allEqual = 1, i = 0; i < count; i++)
+	allEqual &= floats[i] ==
+	    cv_convert_float(celsiusToFahrenheit, (float)in[i]);
+    CU_ASSERT_TRUE(allEqual);
+
+    /* Overlapping arrays are converted serially */
+    (void)memcpy(out, in, count * sizeof(double));
+    ntasks = 0;
+    CU_ASSERT_EQUAL(cv_convert_doubles_parallel(celsiusToFahrenheit, out,
+	count - 1, out + 1, reverseExecutor, &ntasks), out + 1);
+    CU_ASSERT_EQUAL(ntasks, 0);
+    for (allEqual = 1, i = 1; i < count; i++)
+	allEqual &= out[i] == cv_convert_double(celsiusToFahrenheit, in[i-1]);
+    CU_ASSERT_TRUE(allEqual);
+
+    /* No executor */
+    CU_ASSERT_EQUAL(cv_convert_doubles_parallel(celsiusToFahrenheit, in,
+	count, out, NULL, NULL), out);
+    CU_ASSERT_EQUAL(out[count-1],
+	cv_convert_double(celsiusToFahrenheit, in[count-1]));
+
+    CU_ASSERT_PTR_NULL(cv_convert_doubles_parallel(NULL, in, count, out,
+	NULL, NULL));
+
+    free(floats);
+    free(out);
+    free(in);
+    cv_free(celsiusToFahrenheit);
+}
+
+
+static void
+test_cvConvertMasked(void)
+{
+    cv_converter*	celsiusToKelvin = cv_get_offset(273.15);
+    cv_converter*	toDecibels = cv_get_log(10);
+    cv_converter*	fromDecibels = cv_get_pow(10);
+    cv_converter*	toOne = cv_get_pow(1);
+    cv_converter*	converters[5];
+    double		doubles[1000];
+    double		out[1000];
+    float		floats[1000];
+    float		floatOut[1000];
+    const double	nan = 0.0 / 0.0;
+    size_t		i;
+    int			j;
+    int			allOk;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(celsiusToKelvin);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(toDecibels);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(fromDecibels);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(toOne);
+
+    converters[0] = cv_get_trivial();
+    converters[1] = celsiusToKelvin;
+    converters[2] = toDecibels;
+    converters[3] = cv_combine(toDecibels, celsiusToKelvin);
+    converters[4] = cv_compile(converters[3]);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converters[3]);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converters[4]);
+
+    for (i = 0; i < 1000; i++) {
+	doubles[i] = i % 7 == 0 ? -999 : i + 0.5;
+	floats[i] = (float)doubles[i];
+    }
+
+    for (j = 0; j < 5; j++) {
+	CU_ASSERT_EQUAL(cv_convert_doubles_masked(converters[j], doubles, 1000,
+	    -999, out), out);
+	CU_ASSERT_EQUAL(cv_convert_floats_masked(converters[j], floats, 1000,
+	    -999, floatOut), floatOut);
+	for (allOk = 1, i = 0; i < 1000; i++) {
+	    if (i % 7 == 0) {
+		allOk &= out[i] == -999 && floatOut[i] == -999;
+	    }
+	    else {
+		allOk &= areCloseDoubles(out[i],
+		    cv_convert_double(converters[j], doubles[i]));
+		allOk &= areCloseFloats(floatOut[i],
+		    cv_convert_float(converters[j], floats[i]));
+	    }
+	}
+	CU_ASSERT_TRUE(allOk);
+    }
+
+    /* NaN policy, in place */
+    for (i = 0; i < 1000; i++)
+	out[i] = i % 3 == 0 ? nan : (i % 50) * 0.1;
+    CU_ASSERT_EQUAL(cv_convert_doubles_masked(fromDecibels, out, 1000, nan,
+	out), out);
+    for (allOk = 1, i = 0; i < 1000; i++)
+	allOk &= i % 3 == 0
+	    ? isnan(out[i])
+	    : areCloseDoubles(out[i], pow(10, (i % 50) * 0.1));
+    CU_ASSERT_TRUE(allOk);
+
+    /* Overlapping arrays */
+    (void)memcpy(out, doubles, sizeof(out));
+    CU_ASSERT_EQUAL(cv_convert_doubles_masked(converters[3], out, 999, -999,
+	out + 1), out + 1);
+    for (allOk = 1, i = 1; i < 1000; i++)
+	allOk &= (i - 1) % 7 == 0
+	    ? out[i] == -999
+	    : areCloseDoubles(out[i],
+		cv_convert_double(converters[3], doubles[i-1]));
+    CU_ASSERT_TRUE(allOk);
+    (void)memcpy(out, doubles, sizeof(out));
+    CU_ASSERT_EQUAL(cv_convert_doubles_masked(toOne, out, 999, -999,
+	out + 1), out + 1);
+    (void)memcpy(floatOut, floats, sizeof(floatOut));
+    CU_ASSERT_EQUAL(cv_convert_floats_masked(toOne, floatOut, 999, -999,
+	floatOut + 1), floatOut + 1);
+    for (allOk = 1, i = 1; i < 1000; i++)
+	allOk &= (i - 1) % 7 == 0
+	    ? out[i] == -999 && floatOut[i] == -999
+	    : out[i] == 1 && floatOut[i] == 1;
+    CU_ASSERT_TRUE(allOk);
+
+    CU_ASSERT_PTR_NULL(cv_convert_doubles_masked(NULL, doubles, 1000, -999,
+	out));
+
+    cv_free(converters[4]);
+    cv_free(converters[3]);
+    cv_free(toOne);
+    cv_free(fromDecibels);
+    cv_free(toDecibels);
+    cv_free(celsiusToKelvin);
+}
+
+
+static void
+test_cvCombineSimplify(void)
+{
+    cv_converter*	log10 = cv_get_log(10);
+    cv_converter*	pow10 = cv_get_pow(10);
+    cv_converter*	galilean = cv_get_galilean(2, 3);
+    cv_converter*	scale = cv_get_scale(1000);
+    cv_converter*	converter;
+    cv_converter*	tmp;
+    char		buf[132];
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(log10);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pow10);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(galilean);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(scale);
+
+    /* pow(10, lg(x)) = x */
+    CU_ASSERT_PTR_EQUAL(cv_combine(log10, pow10), cv_get_trivial());
+
+    /* lg(pow(10, x)) = x */
+    CU_ASSERT_PTR_EQUAL(cv_combine(pow10, log10), cv_get_trivial());
+
+    /* lg(1000*pow(10, x)) = x + 3 */
+    tmp = cv_combine(pow10, scale);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(tmp);
+    converter = cv_combine(tmp, log10);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    CU_ASSERT_TRUE(cv_get_expression(converter, buf, sizeof(buf), "x") > 0);
+    CU_ASSERT_STRING_EQUAL(buf, "x + 3");
+    cv_free(converter);
+    cv_free(tmp);
+
+    /* 1/(2/x + 3) = x/(3*x + 2) has a single reciprocal */
+    tmp = cv_combine(cv_get_inverse(), galilean);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(tmp);
+    converter = cv_combine(tmp, cv_get_inverse());
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(converter, 1), 0.2));
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(converter, 2), 0.25));
+    CU_ASSERT_TRUE(cv_get_expression(converter, buf, sizeof(buf), "x") > 0);
+    CU_ASSERT_PTR_NOT_NULL(strchr(buf, '/'));
+    CU_ASSERT_PTR_NULL(strchr(strchr(buf, '/') + 1, '/'));
+    cv_free(converter);
+    cv_free(tmp);
+
+    /* lg(1/x) = -lg(x) */
+    converter = cv_combine(cv_get_inverse(), log10);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(converter, 100), -2));
+    CU_ASSERT_TRUE(cv_get_expression(converter, buf, sizeof(buf), "x") > 0);
+    CU_ASSERT_PTR_NULL(strchr(buf, '/'));
+    cv_free(converter);
+
+    /* No canonical form */
+    tmp = cv_get_log(3);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(tmp);
+    converter = cv_combine(tmp, tmp);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(converter, 81),
+	log(4) / log(3)));
+    cv_free(converter);
+    cv_free(tmp);
+
+    /* Between logarithmic units */
+    converter = ut_get_converter(dBZ, BZ);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(converter);
+    CU_ASSERT_TRUE(cv_get_expression(converter, buf, sizeof(buf), "x") > 0);
+    CU_ASSERT_STRING_EQUAL(buf, "0.1*x");
+    cv_free(converter);
+
+    cv_free(scale);
+    cv_free(galilean);
+    cv_free(pow10);
+    cv_free(log10);
+}
+
+
+static void
+test_cvSerialize(void)
+{
+    cv_converter*	log3 = cv_get_log(3);
+    cv_converter*	converters[5];
+    cv_converter*	copy;
+    unsigned char	buf[256];
+    size_t		nbytes;
+    int			i;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(log3);
+
+    converters[0] = cv_get_trivial();
+    converters[1] = cv_get_galilean(1.8, 32);
+    converters[2] = ut_get_converter(cubicMicron, dBZ);
+    converters[3] = cv_combine(log3, log3);
+    converters[4] = cv_compile(converters[2]);
+
+    for (i = 0; i < 5; i++) {
+	double	x = 1234.5;
+
+	CU_ASSERT_PTR_NOT_NULL_FATAL(converters[i]);
+
+	nbytes = cv_serialize(converters[i], NULL, 0);
+	CU_ASSERT_TRUE(nbytes > 3 && nbytes <= sizeof(buf));
+	CU_ASSERT_EQUAL(cv_serialize(converters[i], buf, sizeof(buf)), nbytes);
+	CU_ASSERT_EQUAL(buf[0], 'c');
+	CU_ASSERT_EQUAL(buf[1], 'v');
+
+	copy = cv_deserialize(buf, nbytes);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(copy);
+	CU_ASSERT_EQUAL(cv_convert_double(copy, x),
+	    cv_convert_double(converters[i], x));
+	CU_ASSERT_EQUAL(cv_serialize(copy, NULL, 0), nbytes);
+	cv_free(copy);
+
+	/* Truncated and extended encodings */
+	CU_ASSERT_PTR_NULL(cv_deserialize(buf, nbytes - 1));
+	CU_ASSERT_PTR_NULL(cv_deserialize(buf, nbytes + 1));
+    }
+
+    /* A buffer that's too small isn't written */
+    (void)memset(buf, 0, sizeof(buf));
+    CU_ASSERT_EQUAL(cv_serialize(converters[2], buf, 4), nbytes);
+    CU_ASSERT_EQUAL(buf[0], 0);
+
+    /* An unsupported version */
+    nbytes = cv_serialize(converters[1], buf, sizeof(buf));
+    buf[2] = 0;
+    CU_ASSERT_PTR_NULL(cv_deserialize(buf, nbytes));
+
+    CU_ASSERT_EQUAL(cv_serialize(NULL, buf, sizeof(buf)), 0);
+    CU_ASSERT_PTR_NULL(cv_deserialize(NULL, 0));
+
+    /* Composites nested to the limit round-trip; deeper ones don't serialize */
+    {
+	cv_converter*	nested = cv_clone(log3);
+	unsigned char*	bytes;
+
+	for (i = 0; nested != NULL && i < 256; i++) {
+	    cv_converter*	outer = cv_combine(log3, nested);
+
+	    cv_free(nested);
+	    nested = outer;
+	}
+	CU_ASSERT_PTR_NOT_NULL_FATAL(nested);
+
+	nbytes = cv_serialize(nested, NULL, 0);
+	CU_ASSERT_TRUE_FATAL(nbytes > 3);
+	bytes = malloc(nbytes);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(bytes);
+	CU_ASSERT_EQUAL(cv_serialize(nested, bytes, nbytes), nbytes);
+	copy = cv_deserialize(bytes, nbytes);
+	CU_ASSERT_PTR_NOT_NULL(copy);
+	CU_ASSERT_EQUAL(cv_serialize(copy, NULL, 0), nbytes);
+	cv_free(copy);
+	free(bytes);
+
+	copy = cv_combine(log3, nested);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(copy);
+	CU_ASSERT_EQUAL(cv_serialize(copy, NULL, 0), 0);
+	cv_free(copy);
+	cv_free(nested);
+    }
+
+    for (i = 0; i < 5; i++)
+	cv_free(converters[i]);
+    cv_free(log3);
+}
+
+
+static void
+test_cvStorageAndRefcount(void)
+{
+    cv_converter*	log10 = cv_get_log(10);
+    cv_converter*	scale = cv_get_scale(2);
+    cv_converter*	combined;
+    cv_converter*	clone;
+    cv_storage		storages[2];
+    cv_converter*	fahrenheit;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(log10);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(scale);
+
+    /* Converters in client storage */
+    fahrenheit = cv_init_galilean(&storages[0], 1.8, 32);
+    CU_ASSERT_PTR_EQUAL(fahrenheit, (cv_converter*)&storages[0]);
+    CU_ASSERT_EQUAL(cv_convert_double(fahrenheit, 100), 212);
+    cv_free(fahrenheit);
+    CU_ASSERT_EQUAL(cv_convert_double(fahrenheit, 0), 32);
+
+    CU_ASSERT_PTR_EQUAL(cv_init_scale(&storages[1], 1), cv_get_trivial());
+    CU_ASSERT_PTR_NULL(cv_init_scale(NULL, 2));
+    CU_ASSERT_PTR_NULL(cv_init_log(&storages[1], 1));
+    CU_ASSERT_EQUAL(cv_convert_double(cv_init_log(&storages[1], 10), 100), 2);
+    CU_ASSERT_EQUAL(cv_convert_double(cv_init_pow(&storages[1], 2), 3), 8);
+    CU_ASSERT_EQUAL(cv_convert_double(cv_init_offset(&storages[1], 1), 1), 2);
+
+    /* Combinations don't refer to client storage */
+    combined = cv_combine(log10, fahrenheit);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(combined);
+    (void)memset(storages, 0, sizeof(storages));
+    CU_ASSERT_DOUBLE_EQUAL(cv_convert_double(combined, 100), 35.6, 1e-12);
+    clone = cv_combine(cv_init_galilean(&storages[0], 1, 0), combined);
+    CU_ASSERT_PTR_EQUAL(clone, combined);
+    cv_free(clone);
+
+    /* Copies of heap converters are shared */
+    clone = cv_combine(cv_get_trivial(), scale);
+    CU_ASSERT_PTR_EQUAL(clone, scale);
+    cv_free(scale);
+    CU_ASSERT_EQUAL(cv_convert_double(clone, 3), 6);
+    cv_free(clone);
+
+    CU_ASSERT_DOUBLE_EQUAL(cv_convert_double(combined, 1000), 37.4, 1e-12);
+    cv_free(combined);
+    cv_free(log10);
+}
+
 static void
 test_utOffsetByTime(void)
 {
@@ -1563,6 +2835,17 @@ test_utOffsetByTime(void)
     CU_ASSERT_TRUE(areCloseDoubles(doubles[0], 86400));
     cv_free(converter);
 
+    converter = ut_get_converter(minutesSinceTheMillenium, daysSinceTheEpoch);
+    CU_ASSERT_PTR_NOT_NULL(converter);
+    CU_ASSERT_TRUE(areCloseDoubles(cv_convert_double(converter, 1440),
+	11323 + 1));
+    cv_free(converter);
+
+    CU_ASSERT_PTR_NULL(ut_get_converter(secondsSinceTheEpoch, second));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_MEANINGLESS);
+    CU_ASSERT_PTR_NULL(ut_get_converter(second, secondsSinceTheEpoch));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_MEANINGLESS);
+
     ut_free(daysSinceTheEpoch);
 
     {
@@ -1705,6 +2988,51 @@ test_utCompare(void)
 }
 
 
+static int	messageCount;
+
+static int
+countMessage(
+    const char* const	fmt,
+    va_list		args)
+{
+    messageCount++;
+
+    return 0;
+}
+
+
+static void
+test_utContext(void)
+{
+    ut_context*			context = ut_new_context();
+    ut_error_message_handler	prevHandler;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(context);
+
+    ut_set_status(UT_SUCCESS);
+    CU_ASSERT_PTR_NULL(ut_set_context(context));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_SUCCESS);
+
+    messageCount = 0;
+    prevHandler = ut_set_error_message_handler(countMessage);
+    CU_ASSERT_PTR_NULL(ut_scale(1.0, NULL));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
+    CU_ASSERT_TRUE(messageCount > 0);
+
+    /* The thread's own context is unaffected */
+    CU_ASSERT_PTR_EQUAL(ut_set_context(NULL), context);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_SUCCESS);
+
+    CU_ASSERT_PTR_NULL(ut_set_context(context));
+    CU_ASSERT_EQUAL(ut_get_status(), UT_BAD_ARG);
+    CU_ASSERT_PTR_EQUAL(ut_set_error_message_handler(prevHandler),
+	countMessage);
+    CU_ASSERT_PTR_EQUAL(ut_set_context(NULL), context);
+
+    ut_free_context(context);
+}
+
+
 static void
 test_parsing(void)
 {
@@ -1984,6 +3312,29 @@ test_parsing(void)
     CU_ASSERT_EQUAL(ut_compare(unit, hertz), 0);
     ut_free(unit);
 
+    spec = "kkm"; /* at most one symbol-prefix */
+    unit = ut_parse(unitSystem, spec, UT_ASCII);
+    CU_ASSERT_PTR_NULL(unit);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_UNKNOWN);
+
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("quatloo", UT_ASCII, kilogram),
+	UT_SUCCESS);
+    spec = "MegaQuatloo";
+    unit = ut_parse(unitSystem, spec, UT_ASCII);
+    CU_ASSERT_PTR_NOT_NULL(unit);
+    {
+	ut_unit*	megaquatloo = ut_scale(1e6, kilogram);
+
+	CU_ASSERT_EQUAL(ut_compare(unit, megaquatloo), 0);
+	ut_free(megaquatloo);
+    }
+    ut_free(unit);
+    CU_ASSERT_EQUAL(ut_unmap_name_to_unit(unitSystem, "quatloo", UT_ASCII),
+	UT_SUCCESS);
+    unit = ut_parse(unitSystem, spec, UT_ASCII);
+    CU_ASSERT_PTR_NULL(unit);
+    CU_ASSERT_EQUAL(ut_get_status(), UT_UNKNOWN);
+
     spec = "meter @ 100 @ 10";
     unit = ut_parse(unitSystem, spec, UT_LATIN1);
     CU_ASSERT_PTR_NULL(unit);
@@ -2232,6 +3583,113 @@ test_xml(void)
     ut_free_system(xmlSystem);
 }
 
+
+static void
+test_bundled(void)
+{
+    static const char*	specs[] = {
+	"meter", "METERS", "m", "km", "kilometers", "megakm", "degC",
+	"degree_celsius", "\xc2\xb5K", "\xe2\x84\xa6", "lg(re mW)",
+	"m/s2", "kg.m2.s-3", "seconds since 1970-01-01T00:00:00Z",
+	"100 feet", "hour", NULL};
+    ut_system*		xmlSystem;
+    ut_system*		bundledSystem;
+    ut_unit*		xmlUnit;
+    ut_unit*		bundledUnit;
+    ut_unit*		unit;
+    char		xmlBuf[128];
+    char		bundledBuf[128];
+    const char**	spec;
+
+    ut_set_error_message_handler(ut_ignore);
+    xmlSystem = ut_read_xml(xmlPath);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(xmlSystem);
+    bundledSystem = ut_read_bundled();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(bundledSystem);
+
+    for (spec = specs; *spec != NULL; spec++) {
+	xmlUnit = ut_parse(xmlSystem, *spec, UT_UTF8);
+	CU_ASSERT_PTR_NOT_NULL(xmlUnit);
+	bundledUnit = ut_parse(bundledSystem, *spec, UT_UTF8);
+	CU_ASSERT_PTR_NOT_NULL(bundledUnit);
+
+	if (xmlUnit != NULL && bundledUnit != NULL) {
+	    CU_ASSERT_TRUE(ut_format(xmlUnit, xmlBuf, sizeof(xmlBuf),
+		UT_UTF8 | UT_NAMES) > 0);
+	    CU_ASSERT_TRUE(ut_format(bundledUnit, bundledBuf,
+		sizeof(bundledBuf), UT_UTF8 | UT_NAMES) > 0);
+	    CU_ASSERT_STRING_EQUAL(bundledBuf, xmlBuf);
+	    CU_ASSERT_TRUE(ut_format(xmlUnit, xmlBuf, sizeof(xmlBuf),
+		UT_ASCII | UT_DEFINITION) > 0);
+	    CU_ASSERT_TRUE(ut_format(bundledUnit, bundledBuf,
+		sizeof(bundledBuf), UT_ASCII | UT_DEFINITION) > 0);
+	    CU_ASSERT_STRING_EQUAL(bundledBuf, xmlBuf);
+	}
+
+	ut_free(xmlUnit);
+	ut_free(bundledUnit);
+    }
+
+    unit = ut_get_unit_by_name(bundledSystem, "Watt");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(unit);
+    CU_ASSERT_STRING_EQUAL(ut_get_name(unit, UT_ASCII), "watt");
+    CU_ASSERT_STRING_EQUAL(ut_get_symbol(unit, UT_ASCII), "W");
+    bundledUnit = ut_get_unit_by_symbol(bundledSystem, "W");
+    CU_ASSERT_EQUAL(ut_compare(unit, bundledUnit), 0);
+    ut_free(bundledUnit);
+    CU_ASSERT_PTR_NULL(ut_get_unit_by_symbol(bundledSystem, "w"));
+    CU_ASSERT_PTR_NULL(ut_get_unit_by_name(bundledSystem, "blivet"));
+
+    /*
+     * The identifiers of the bundled database behave like any others.
+     */
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("meter", UT_ASCII, unit), UT_EXISTS);
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("watt", UT_ASCII, unit), UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_unmap_name_to_unit(bundledSystem, "watt", UT_ASCII),
+	UT_SUCCESS);
+    CU_ASSERT_PTR_NULL(ut_get_unit_by_name(bundledSystem, "watt"));
+    CU_ASSERT_PTR_NULL(ut_parse(bundledSystem, "kilowatt", UT_ASCII));
+    CU_ASSERT_EQUAL(ut_unmap_symbol_to_unit(bundledSystem, "W", UT_ASCII),
+	UT_SUCCESS);
+    CU_ASSERT_PTR_NULL(ut_parse(bundledSystem, "kW", UT_ASCII));
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("watt", UT_ASCII, unit), UT_SUCCESS);
+    bundledUnit = ut_parse(bundledSystem, "kilowatt", UT_ASCII);
+    CU_ASSERT_PTR_NOT_NULL(bundledUnit);
+    ut_free(bundledUnit);
+
+    CU_ASSERT_EQUAL(ut_map_name_to_unit("blivet", UT_ASCII, unit),
+	UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_add_name_prefix(bundledSystem, "umpteen", 1e42),
+	UT_SUCCESS);
+    CU_ASSERT_EQUAL(ut_add_name_prefix(bundledSystem, "mega", 1e5),
+	UT_EXISTS);
+    bundledUnit = ut_parse(bundledSystem, "umpteenblivet", UT_ASCII);
+    CU_ASSERT_PTR_NOT_NULL(bundledUnit);
+    xmlUnit = ut_parse(bundledSystem, "1e42 watt", UT_ASCII);
+    CU_ASSERT_EQUAL(ut_compare(bundledUnit, xmlUnit), 0);
+    ut_free(xmlUnit);
+    ut_free(bundledUnit);
+
+    /*
+     * Modifying one unit-system mustn't affect another.
+     */
+    bundledUnit = ut_parse(xmlSystem, "kW", UT_ASCII);
+    CU_ASSERT_PTR_NOT_NULL(bundledUnit);
+    ut_free(bundledUnit);
+    ut_free(unit);
+    ut_free_system(bundledSystem);
+
+    bundledSystem = ut_read_bundled();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(bundledSystem);
+    CU_ASSERT_PTR_NULL(ut_parse(bundledSystem, "umpteenblivet", UT_ASCII));
+    bundledUnit = ut_parse(bundledSystem, "kW", UT_ASCII);
+    CU_ASSERT_PTR_NOT_NULL(bundledUnit);
+    ut_free(bundledUnit);
+    ut_free_system(bundledSystem);
+
+    ut_free_system(xmlSystem);
+}
+
 int
 main(
     const int		    argc,
@@ -2261,11 +3719,15 @@ main(
 	    CU_ADD_TEST(testSuite, test_utOffsetByTime);
 	    CU_ADD_TEST(testSuite, test_ut_decode_time);
 	    CU_ADD_TEST(testSuite, test_utMultiply);
+	    CU_ADD_TEST(testSuite, test_utMultiplyManyBaseUnits);
+	    CU_ADD_TEST(testSuite, test_utSetArena);
+	    CU_ADD_TEST(testSuite, test_utFreezeSystem);
 	    CU_ADD_TEST(testSuite, test_utInvert);
 	    CU_ADD_TEST(testSuite, test_utDivide);
 	    CU_ADD_TEST(testSuite, test_utRaise);
 	    CU_ADD_TEST(testSuite, test_utRoot);
 	    CU_ADD_TEST(testSuite, test_utLog);
+	    CU_ADD_TEST(testSuite, test_utProductBuilder);
 	    CU_ADD_TEST(testSuite, test_utMapUnitToName);
 	    CU_ADD_TEST(testSuite, test_utGetName);
 	    CU_ADD_TEST(testSuite, test_utGetSymbol);
@@ -2275,13 +3737,27 @@ main(
 	    CU_ADD_TEST(testSuite, test_utSameSystem);
 	    CU_ADD_TEST(testSuite, test_utIsDimensionless);
 	    CU_ADD_TEST(testSuite, test_utClone);
+	    CU_ADD_TEST(testSuite, test_utUniqueUnits);
 	    CU_ADD_TEST(testSuite, test_utAreConvertible);
 	    CU_ADD_TEST(testSuite, test_utGetConverter);
+	    CU_ADD_TEST(testSuite, test_utGetConverterCache);
+	    CU_ADD_TEST(testSuite, test_cvCompile);
+	    CU_ADD_TEST(testSuite, test_cvConvertArrays);
+	    CU_ADD_TEST(testSuite, test_cvLogExpArrays);
+	    CU_ADD_TEST(testSuite, test_cvConvertStrided);
+	    CU_ADD_TEST(testSuite, test_cvPackUnpack);
+	    CU_ADD_TEST(testSuite, test_cvConvertParallel);
+	    CU_ADD_TEST(testSuite, test_cvConvertMasked);
+	    CU_ADD_TEST(testSuite, test_cvCombineSimplify);
+	    CU_ADD_TEST(testSuite, test_cvSerialize);
+	    CU_ADD_TEST(testSuite, test_cvStorageAndRefcount);
 	    CU_ADD_TEST(testSuite, test_utSetEncoding);
 	    CU_ADD_TEST(testSuite, test_utCompare);
+	    CU_ADD_TEST(testSuite, test_utContext);
 	    CU_ADD_TEST(testSuite, test_parsing);
 	    CU_ADD_TEST(testSuite, test_visitor);
 	    CU_ADD_TEST(testSuite, test_xml);
+	    CU_ADD_TEST(testSuite, test_bundled);
 	    /*
 	    */
 
@@ -69,6 +69,7 @@ char* str,
 
 typedef struct ut_system	ut_system;
 typedef union ut_unit		ut_unit;
+typedef struct ut_context	ut_context;
 
 enum utStatus {
     UT_SUCCESS = 0,	/* Success */
@@ -101,6 +102,30 @@ typedef enum utEncoding        ut_encoding;
 #define UT_NAMES	4
 #define UT_DEFINITION	8
 
+/*
+ * The maximum number of basic-units that a product builder holds without
+ * creating a unit.
+ */
+#define UT_PRODUCT_SIZE	32
+
+/*
+ * Data-structure for building a product of units (e.g., "kg m-2 s-1") without
+ * creating the intermediate units.  The client may allocate it anywhere (e.g.,
+ * on the stack) but should only access it via "ut_init_product()",
+ * "ut_multiply_product()", "ut_scale_product()", and "ut_finish_product()".
+ */
+typedef struct ut_product_builder {
+    ut_system*	system;		/* unit-system of the product */
+    ut_unit*	pending;	/* sole factor so far or NULL */
+    ut_unit*	other;		/* factors that aren't basic-units or NULL */
+    double	scale;		/* numeric factor */
+    ut_status	status;		/* status of first failure */
+    int		factorCount;	/* number of units multiplied */
+    int		count;		/* number of basic-units */
+    short	indexes[UT_PRODUCT_SIZE];	/* basic-units in order */
+    short	powers[UT_PRODUCT_SIZE];	/* powers of basic-units */
+} ut_product_builder;
+
 
 /*
  * Data-structure for a visitor to a unit:
@@ -249,6 +274,23 @@ ut_read_xml(
     const char*	path);
 
 
+/*
+ * Returns the unit-system of the unit database that's bundled with the
+ * package.  The unit-system is the same as the one returned by ut_read_xml()
+ * for that database, but no file is read: the units and the lookup tables of
+ * the database are compiled into the library, so the unit-system is ready for
+ * lookups without further work.  Changes to the installed database or to the
+ * environment variable UDUNITS2_XML_PATH have no effect on it.
+ *
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	Pointer to the unit-system of the bundled database.
+ */
+EXTERNL ut_system*
+ut_read_bundled(void);
+
+
 /*
  * Returns a new unit-system.  On success, the unit-system will only contain
  * the dimensionless unit one.  See "ut_get_dimensionless_unit_one()".
@@ -264,17 +306,67 @@ ut_new_system(void);
 
 /*
  * Frees a unit-system.  All unit-to-identifier and identifier-to-unit mappings
- * will be removed.
+ * will be removed and all units of the unit-system will be freed.
  *
  * Arguments:
  *	system		Pointer to the unit-system to be freed.  Use of "system"
- *			upon return results in undefined behavior.
+ *			or any of its units upon return results in undefined
+ *			behavior.
  */
 EXTERNL void
 ut_free_system(
     ut_system*	system);
 
 
+/*
+ * Sets whether or not the new units of a unit-system are allocated from the
+ * unit-system's arena.  Units in the arena are allocated contiguously, and
+ * the arena is released as a whole by ut_free_system().  Arena mode is
+ * initially off; ut_read_xml() uses it while reading the database.  This
+ * function modifies the unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	enable	Whether or not to allocate new units from the arena.
+ * Returns:
+ *	0	Arena mode was off or "system" is NULL.  "ut_get_status()"
+ *		will be:
+ *		    UT_BAD_ARG	"system" is NULL.
+ *		    UT_SUCCESS	Success.
+ *	1	Arena mode was on.  "ut_get_status()" will be UT_SUCCESS.
+ */
+EXTERNL int
+ut_set_arena(
+    ut_system* const	system,
+    const int		enable);
+
+
+/*
+ * Freezes a unit-system.  The converters of every unit of the unit-system are
+ * computed, the units become permanent (cloning and freeing them no longer
+ * changes them), and functions that would modify the unit-system (e.g.,
+ * ut_new_base_unit(), ut_map_name_to_unit(), ut_add_name_prefix()) fail with
+ * status UT_BAD_ARG.  Consequently, lookups and other read-only operations on
+ * the existing units don't write to them and may be performed by any number
+ * of threads.  ut_get_converter() reads its cache of converters without
+ * locking, but a converter it returns is reference-counted and so is written
+ * when it's returned and when it's freed.  New units may still be created
+ * from the existing ones.  The units are freed by ut_free_system().  This
+ * function modifies the unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ * Returns:
+ *	UT_SUCCESS	Success.  The unit-system is frozen.
+ *	UT_BAD_ARG	"system" is NULL.
+ *	UT_OS		Operating-system error.  See "errno".  The unit-system
+ *			isn't frozen.
+ */
+EXTERNL ut_status
+ut_freeze_system(
+    ut_system* const	system);
+
+
 /*
  * Returns the unit-system to which a unit belongs.
  *
@@ -467,7 +559,8 @@ ut_new_dimensionless_unit(
 
 
 /*
- * Returns a clone of a unit.
+ * Returns a clone of a unit.  Because equal units are identical, the clone is
+ * "unit" itself with an additional reference.
  *
  * Arguments:
  *	unit	Pointer to the unit to be cloned.
@@ -756,7 +849,8 @@ ut_same_system(
  * Compares two units.  Returns a value less than, equal to, or greater than
  * zero as the first unit is considered less than, equal to, or greater than
  * the second unit, respectively.  Units from different unit-systems never
- * compare equal.
+ * compare equal.  Equal units of a unit-system are identical (i.e., have the
+ * same address).
  *
  * Arguments:
  *	unit1		Pointer to a unit or NULL.
@@ -1061,6 +1155,104 @@ ut_log(
     const ut_unit* const	reference);
 
 
+/*
+ * Initializes a product builder.  The product is initially the dimensionless
+ * unit one.  A product builder accumulates the factors of a product of units
+ * so that only the final unit is created, e.g.,
+ *
+ *     ut_product_builder builder;
+ *
+ *     (void)ut_init_product(&builder, system);
+ *     (void)ut_multiply_product(&builder, kilogram, 1);
+ *     (void)ut_multiply_product(&builder, meter, -2);
+ *     (void)ut_multiply_product(&builder, second, -1);
+ *     unit = ut_finish_product(&builder);
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ *	system	Pointer to the unit-system of the product.
+ * Returns:
+ *	UT_SUCCESS	Success.
+ *	UT_BAD_ARG	"builder" or "system" is NULL.
+ */
+EXTERNL ut_status
+ut_init_product(
+    ut_product_builder* const	builder,
+    ut_system* const		system);
+
+
+/*
+ * Multiplies the product of a product builder by a unit raised to a power.
+ * The first unit that's multiplied with a power of one is kept as is; for the
+ * other units, any offset or time-origin is ignored, as in "ut_multiply()".
+ * A unit raised to the power zero is the dimensionless unit one, so it doesn't
+ * change the product.  After a failure, this function does nothing and returns
+ * the status of the failure.
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ *	unit	Pointer to the unit.  May be freed upon return.
+ *	power	The power to which to raise "unit".  Must be greater than or
+ *		equal to -255 and less than or equal to 255.
+ * Returns:
+ *	UT_SUCCESS		Success.
+ *	UT_BAD_ARG		"builder" isn't initialized, "unit" is NULL,
+ *				or "power" is invalid.
+ *	UT_NOT_SAME_SYSTEM	"unit" doesn't belong to the unit-system of
+ *				the builder.
+ *	UT_MEANINGLESS		The operation on the units is meaningless.
+ *	UT_OS			Operating-system error.  See "errno".
+ */
+EXTERNL ut_status
+ut_multiply_product(
+    ut_product_builder* const	builder,
+    const ut_unit* const	unit,
+    const int			power);
+
+
+/*
+ * Multiplies the product of a product builder by a numeric factor.  The factor
+ * is applied to the final product, as in "ut_scale()".  After a failure, this
+ * function does nothing and returns the status of the failure.
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ *	factor	The numeric factor.  Must not be zero.
+ * Returns:
+ *	UT_SUCCESS	Success.
+ *	UT_BAD_ARG	"builder" isn't initialized or "factor" is zero.
+ */
+EXTERNL ut_status
+ut_scale_product(
+    ut_product_builder* const	builder,
+    const double		factor);
+
+
+/*
+ * Returns the product of a product builder and releases the resources of the
+ * builder.  The builder must be initialized again before it's reused.  This
+ * function must be called for every initialized builder -- even after a
+ * failure.
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be:
+ *		    UT_BAD_ARG		"builder" isn't initialized.
+ *		    else		The status of the first failure of
+ *					"ut_multiply_product()" or
+ *					"ut_scale_product()" or one of:
+ *		    UT_MEANINGLESS	The operation on the units is
+ *					meaningless.
+ *		    UT_OS		Operating-system error.  See "errno".
+ *	else	Pointer to the resulting unit.  The pointer should be passed to
+ *		ut_free() when the unit is no longer needed by the client.
+ */
+EXTERNL ut_unit*
+ut_finish_product(
+    ut_product_builder* const	builder);
+
+
 /******************************************************************************
  * Parsing and Formatting Units:
  ******************************************************************************/
@@ -1270,16 +1462,17 @@ ut_decode_time(
 
 
 /*
- * Returns the status of the last operation by the units module.  This function
- * will not change the status.
+ * Returns the status of the last operation by the units module in the calling
+ * thread's current context.  This function will not change the status.
  */
 EXTERNL ut_status
 ut_get_status(void);
 
 
 /*
- * Sets the status of the units module.  This function would not normally be
- * called by the user unless they were doing their own parsing or formatting.
+ * Sets the status of the units module in the calling thread's current
+ * context.  This function would not normally be called by the user unless
+ * they were doing their own parsing or formatting.
  *
  * Arguments:
  *	status	The status of the units module.
@@ -1307,8 +1500,10 @@ ut_handle_error_message(
 
 
 /*
- * Returns the previously-installed error-message handler and optionally
- * installs a new handler.  The initial handler is "ut_write_to_stderr()".
+ * Returns the previously-installed error-message handler of the calling
+ * thread's current context and optionally installs a new handler in it.  Other
+ * threads and contexts are unaffected.  The initial handler is
+ * "ut_write_to_stderr()".
  *
  * Arguments:
  *      handler		NULL or pointer to the error-message handler.  If NULL,
@@ -1355,6 +1550,54 @@ ut_ignore(
     va_list		args);
 
 
+/*
+ * Returns a new error-handling context.  Each thread has its own context; a
+ * client-created context can be installed in whichever thread executes a task
+ * (e.g., in a thread pool) so that the status and error-message handler of the
+ * task follow it from thread to thread.  The status of the new context is
+ * UT_SUCCESS and its error-message handler is that of the calling thread's
+ * current context.
+ *
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be:
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	Pointer to the new context.  The client should pass it to
+ *		ut_free_context() when it's no longer needed.
+ */
+EXTERNL ut_context*
+ut_new_context(void);
+
+
+/*
+ * Frees an error-handling context.  The context mustn't be installed in any
+ * thread.
+ *
+ * Arguments:
+ *	context	Pointer to the context to be freed or NULL.
+ */
+EXTERNL void
+ut_free_context(
+    ut_context* const	context);
+
+
+/*
+ * Installs an error-handling context in the calling thread.  Until another
+ * context is installed, ut_get_status(), ut_set_status(),
+ * ut_handle_error_message(), and ut_set_error_message_handler() use the
+ * context.  A context should be installed in at most one thread at a time.
+ *
+ * Arguments:
+ *	context	Pointer to the context to be installed or NULL.  If NULL, then
+ *		the thread's own context is installed.
+ * Returns:
+ *	Pointer to the previously-installed context or NULL if it was the
+ *	thread's own.
+ */
+EXTERNL ut_context*
+ut_set_context(
+    ut_context* const	context);
+
+
 #ifdef __cplusplus
 }
 #endif
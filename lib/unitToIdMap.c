@@ -17,30 +17,38 @@
 
 #include <assert.h>
 #include <errno.h>
-
-#ifdef _MSC_VER
-#include "tsearch.h"
-#else
-#include <search.h>
-#endif
-
 #include <stdlib.h>
 
 #include <string.h>
 
 #include "udunits2.h"
-#include "unitAndId.h"
 #include "unitToIdMap.h"		/* this module's API */
-#include "systemMap.h"
+#include "systemTable.h"
+
+extern int coreIsFrozen(const ut_system* system);
 
+/*
+ * A unit-to-identifier map is an open-addressing hash-table with linear
+ * probing that's keyed by the address of the unit: because units are unique
+ * within their unit-system, finding a unit's identifier compares no units.
+ */
 typedef struct {
-    void*		ascii;
-    void*		latin1;
-    void*		utf8;
+    ut_unit*		unit;		/* NULL => empty slot */
+    char*		ascii;		/* ASCII identifier or NULL */
+    char*		latin1;		/* Latin-1 identifier or NULL */
+    char*		utf8;		/* UTF-8 identifier or NULL */
+    char*		latin1AsUtf8;	/* "latin1" in UTF-8 or NULL */
+} UnitIds;
+
+typedef struct {
+    UnitIds*		slots;
+    size_t		slotCount;	/* number of slots; a power of 2 */
+    size_t		count;		/* number of entries */
 } UnitToIdMap;
 
-static SystemMap*	systemToUnitToName = NULL;
-static SystemMap*	systemToUnitToSymbol = NULL;
+#define UTIM_INITIAL_SIZE	64	/* initial number of slots */
+#define HASH_INIT		2166136261UL
+
 
 
 /******************************************************************************
@@ -78,7 +86,7 @@ latin1ToUtf8(
 		*outp = *inp;
 	    }
 	    else {
-		*outp++ = (char)(0xC0U | ((unsigned)*inp >> 6));
+		*outp++ = (char)(0xC0U | ((unsigned char)*inp >> 6));
 		*outp = (char)(0x80U | (*inp & 0x3FU));
 	    }
 	}
@@ -167,37 +175,80 @@ adjustEncoding(
  * Internal Map Functions:
  ******************************************************************************/
 
-static int
-compareUnits(
-    const void* const	entry1,
-    const void* const	entry2)
+/*
+ * Returns the hash-code of a unit.  Because units are unique within their
+ * unit-system, the unit's address is used.
+ *
+ * Arguments:
+ *	unit	The unit.
+ * Returns:
+ *	The hash-code of "unit".
+ */
+static unsigned long
+hashUnit(
+    const ut_unit* const	unit)
 {
-    return ut_compare(((const UnitAndId*)entry1)->unit,
-	((const UnitAndId*)entry2)->unit);
+    const unsigned char*	byte = (const unsigned char*)&unit;
+    unsigned long		hash = HASH_INIT;
+    size_t			i;
+
+    for (i = 0; i < sizeof(unit); i++) {
+	hash ^= byte[i];
+	hash *= 16777619UL;
+    }
+
+    return hash;
 }
 
 
 /*
- * Selects a unit-and-identifier tree corresponding to a given encoding.
+ * Selects the identifier of an entry corresponding to a given encoding.
  *
  * Arguments:
- *	map		The unit-to-id map.
+ *	entry		The entry.
  *	encoding	The encoding.
  * Returns:
- *	Pointer to the root of the unit-and-identifier tree in "map" that
- *	corresponds to "encoding".
+ *	Pointer to the identifier in "entry" that corresponds to "encoding".
  */
-static void**
-selectTree(
-    UnitToIdMap* const	unitToIdMap,
+static char**
+selectId(
+    UnitIds* const	entry,
     const ut_encoding	encoding)
 {
     return
 	encoding == UT_ASCII
-	    ? &unitToIdMap->ascii
+	    ? &entry->ascii
 	    : encoding == UT_LATIN1
-		? &unitToIdMap->latin1
-		: &unitToIdMap->utf8;
+		? &entry->latin1
+		: &entry->utf8;
+}
+
+
+/*
+ * Returns the index of the slot of a unit-to-identifier map that contains a
+ * unit or, if none does, of the empty slot where it would be added.
+ *
+ * Arguments:
+ *	map	The unit-to-identifier map.
+ *	unit	The unit.
+ * Returns:
+ *	The index of the slot.
+ */
+static size_t
+utimProbe(
+    const UnitToIdMap* const	map,
+    const ut_unit* const	unit)
+{
+    const size_t	mask = map->slotCount - 1;
+    size_t		i;
+
+    for (i = hashUnit(unit) & mask; map->slots[i].unit != NULL;
+	    i = (i + 1) & mask) {
+	if (map->slots[i].unit == unit)
+	    break;
+    }
+
+    return i;
 }
 
 
@@ -211,18 +262,44 @@ selectTree(
 static UnitToIdMap*
 utimNew(void)
 {
-    UnitToIdMap* const	map = malloc(sizeof(UnitToIdMap));
+    UnitToIdMap*	map = malloc(sizeof(UnitToIdMap));
 
     if (map != NULL) {
-	map->ascii = NULL;
-	map->latin1 = NULL;
-	map->utf8 = NULL;
+	map->slots = calloc(UTIM_INITIAL_SIZE, sizeof(UnitIds));
+
+	if (map->slots == NULL) {
+	    free(map);
+	    map = NULL;
+	}
+	else {
+	    map->slotCount = UTIM_INITIAL_SIZE;
+	    map->count = 0;
+	}
     }
 
     return map;
 }
 
 
+/*
+ * Frees the identifiers of an entry of a unit-to-identifier map and releases
+ * its unit.
+ *
+ * Arguments:
+ *	entry		Pointer to the entry.
+ */
+static void
+utimFreeEntry(
+    UnitIds* const	entry)
+{
+    free(entry->ascii);
+    free(entry->latin1);
+    free(entry->utf8);
+    free(entry->latin1AsUtf8);
+    ut_free(entry->unit);
+}
+
+
 /*
  * Frees a unit-to-identifier map.  All entries in all encodings are freed.
  *
@@ -234,22 +311,105 @@ utimFree(
     UnitToIdMap*	map)
 {
     if (map != NULL) {
-	ut_encoding	encodings[] = {UT_ASCII, UT_LATIN1, UT_UTF8};
-	int		i;
+	size_t	i;
+
+	for (i = 0; i < map->slotCount; i++) {
+	    if (map->slots[i].unit != NULL)
+		utimFreeEntry(map->slots + i);
+	}
+
+	free(map->slots);
+	free(map);
+    }
+}
 
-	for (i = 0; i < sizeof(encodings)/sizeof(encodings[0]); ++i) {
-	    void**	rootp = selectTree(map, encodings[i]);
 
-	    while (*rootp != NULL) {
-		UnitAndId*	uai = **(UnitAndId***)rootp;
+/*
+ * Doubles the number of slots of a unit-to-identifier map.
+ *
+ * Arguments:
+ *	map		The unit-to-identifier map.
+ * Returns:
+ *	UT_OS		Operating-system error.  See "errno".
+ *	UT_SUCCESS	Success.
+ */
+static ut_status
+utimGrow(
+    UnitToIdMap* const	map)
+{
+    ut_status		status;
+    const size_t	slotCount = 2*map->slotCount;
+    UnitIds* const	slots = calloc(slotCount, sizeof(UnitIds));
+
+    if (slots == NULL) {
+	status = UT_OS;
+	ut_set_status(status);
+	ut_handle_error_message(strerror(errno));
+	ut_handle_error_message("utimGrow(): "
+	    "Couldn't allocate %lu-slot unit table", (unsigned long)slotCount);
+    }
+    else {
+	const size_t	mask = slotCount - 1;
+	size_t		i;
+
+	for (i = 0; i < map->slotCount; i++) {
+	    if (map->slots[i].unit != NULL) {
+		size_t	j = hashUnit(map->slots[i].unit) & mask;
 
-		(void)tdelete(uai, rootp, compareUnits);
-		uaiFree(uai);
+		while (slots[j].unit != NULL)
+		    j = (j + 1) & mask;
+
+		slots[j] = map->slots[i];
 	    }
 	}
 
-	free(map);
+	free(map->slots);
+	map->slots = slots;
+	map->slotCount = slotCount;
+	status = UT_SUCCESS;
     }
+
+    return status;
+}
+
+
+/*
+ * Removes the entry in a slot of a unit-to-identifier map.  Subsequent entries
+ * of the probe sequence are moved back so that no lookup stops at the emptied
+ * slot.
+ *
+ * Arguments:
+ *	map		The unit-to-identifier map.
+ *	i		The index of the slot.
+ */
+static void
+utimRemoveSlot(
+    UnitToIdMap* const	map,
+    size_t		i)
+{
+    const size_t	mask = map->slotCount - 1;
+    size_t		j = i;
+
+    utimFreeEntry(map->slots + i);
+    map->count--;
+
+    for (;;) {
+	size_t	home;
+
+	j = (j + 1) & mask;
+
+	if (map->slots[j].unit == NULL)
+	    break;
+
+	home = hashUnit(map->slots[j].unit) & mask;
+
+	if (i <= j ? (home <= i || home > j) : (home <= i && home > j)) {
+	    map->slots[i] = map->slots[j];
+	    i = j;
+	}
+    }
+
+    (void)memset(map->slots + i, 0, sizeof(UnitIds));
 }
 
 
@@ -286,38 +446,77 @@ utimAdd(
 	ut_handle_error_message("Identifier not in given encoding");
     }
     else {
-	UnitAndId*	targetEntry = uaiNew(unit, id);
-
-	if (targetEntry == NULL) {
-            status = ut_get_status();
-        }
-        else {
-	    void**	rootp = selectTree(map, encoding);
+	size_t	i = utimProbe(map, unit);
+
+	/*
+	 * The map is kept at most half full so that a lookup takes about one
+	 * probe.
+	 */
+	if (map->slots[i].unit != NULL || 2*(map->count + 1) <= map->slotCount) {
+	    status = UT_SUCCESS;
+	}
+	else {
+	    status = utimGrow(map);
+	    i = utimProbe(map, unit);
+	}
 
-	    UnitAndId**	treeEntry = tsearch(targetEntry, rootp, compareUnits);
+	if (status == UT_SUCCESS) {
+	    UnitIds* const	entry = map->slots + i;
+	    const char* const	oldId = entry->unit == NULL
+		? NULL
+		: *selectId(entry, encoding);
 
-	    if (treeEntry == NULL) {
-		status = UT_OS;
-                ut_set_status(status);
-		ut_handle_error_message(strerror(errno));
-		ut_handle_error_message("Couldn't add search-tree entry");
-		uaiFree(targetEntry);
-	    }
-	    else {
-		if (strcmp((*treeEntry)->id, id) != 0) {
+	    if (oldId != NULL) {
+		if (strcmp(oldId, id) != 0) {
 		    status = UT_EXISTS;
-                    ut_set_status(status);
+		    ut_set_status(status);
 		    ut_handle_error_message("Unit already maps to \"%s\"",
-			(*treeEntry)->id);
+			oldId);
 		}
-		else {
-		    status = UT_SUCCESS;
+	    }
+	    else {
+		char*	newId = strdup(id);
+		/*
+		 * A Latin-1 identifier is also converted to UTF-8 now, rather
+		 * than when it's first requested, so that lookups don't modify
+		 * the map.
+		 */
+		char*	utf8Id = encoding == UT_LATIN1 && newId != NULL
+		    ? latin1ToUtf8(id)
+		    : NULL;
+
+		if (newId == NULL || (encoding == UT_LATIN1 && utf8Id == NULL)) {
+		    status = UT_OS;
+		    ut_set_status(status);
+		    ut_handle_error_message(strerror(errno));
+		    ut_handle_error_message("Couldn't duplicate identifier");
+		    free(newId);
 		}
+		else {
+		    if (entry->unit == NULL) {
+			entry->unit = ut_clone(unit);
+
+			if (entry->unit == NULL) {
+			    status = ut_get_status();
+			}
+			else {
+			    map->count++;
+			}
+		    }
 
-                if (targetEntry != *treeEntry)
-                    uaiFree(targetEntry);
-	    }
-	}				/* "targetEntry" allocated */
+		    if (status == UT_SUCCESS) {
+			*selectId(entry, encoding) = newId;
+
+			if (utf8Id != NULL)
+			    entry->latin1AsUtf8 = utf8Id;
+		    }
+		    else {
+			free(newId);
+			free(utf8Id);
+		    }
+		}
+	    }				/* new identifier */
+	}				/* map has room */
     }					/* valid arguments */
 
     return status;
@@ -340,148 +539,73 @@ utimRemove(
     const ut_unit*	unit,
     ut_encoding		encoding)
 {
-    UnitAndId		targetEntry;
-    UnitAndId**		treeEntry;
+    size_t		i;
+    UnitIds*		entry;
 
     assert(map != NULL);
     assert(unit != NULL);
 
-    targetEntry.unit = (ut_unit*)unit;
-    treeEntry = tfind(&targetEntry, selectTree(map, encoding), compareUnits);
-
-    if (treeEntry != NULL && *treeEntry != NULL) {
-	UnitAndId*	uai = *treeEntry;
-
-	(void)tdelete(uai, selectTree(map, encoding), compareUnits);
-	uaiFree(uai);
-    }
-
-    return UT_SUCCESS;
-}
+    i = utimProbe(map, unit);
+    entry = map->slots + i;
 
+    if (entry->unit != NULL) {
+	char** const	id = selectId(entry, encoding);
 
-/*
- * Returns the unit-and-identifier whose ASCII identifier corresponding to a
- * unit.
- *
- * Arguments:
- *	map	The unit-to-identifier map.
- *	unit	The unit to be used as the key in the search.
- * Returns:
- *	NULL	The map doesn't contain an entry corresponding to "unit" whose
- *		identifier is in ASCII.
- *	else	Pointer to the entry corresponding to "unit" whose identifier is
- *		in ASCII.
- */
-static UnitAndId*
-utimFindAsciiByUnit(
-    UnitToIdMap* const	map,
-    const ut_unit* const	unit)
-{
-    UnitAndId	targetEntry;
-    UnitAndId**	treeEntry;
-
-    targetEntry.unit = (ut_unit*)unit;
-    treeEntry = tfind(&targetEntry, &map->ascii, compareUnits);
-
-    return treeEntry == NULL ? NULL : *treeEntry;
-}
+	free(*id);
+	*id = NULL;
 
+	if (encoding == UT_LATIN1) {
+	    free(entry->latin1AsUtf8);
+	    entry->latin1AsUtf8 = NULL;
+	}
 
-/*
- * Finds a unit-search-entry with a Latin-1 identifier correcponding to a unit.
- *
- * Arguments:
- *	map	The unit-to-identifier map.
- *	unit	The unit to be used as the key in the search.
- * Returns:
- *	NULL	The map doesn't contain an entry corresponding to "unit" whose
- *		identifier is in Latin-1.
- *	else	Pointer to the entry corresponding to "unit" whose identifier is
- *		in Latin-1 (and might, actually, be in ASCII).
- */
-static UnitAndId*
-utimFindLatin1ByUnit(
-    UnitToIdMap* const	map,
-    const ut_unit* const	unit)
-{
-    UnitAndId	targetEntry;
-    UnitAndId**	treeEntry;
-
-    targetEntry.unit = (ut_unit*)unit;
-    treeEntry = tfind(&targetEntry, &map->latin1, compareUnits);
-
-    if (treeEntry == NULL)
-	treeEntry = tfind(&targetEntry, &map->ascii, compareUnits);
+	if (entry->ascii == NULL && entry->latin1 == NULL &&
+		entry->utf8 == NULL)
+	    utimRemoveSlot(map, i);
+    }
 
-    return treeEntry == NULL ? NULL : *treeEntry;
+    return UT_SUCCESS;
 }
 
 
 /*
- * Finds an entry with a UTF-8 identifier corresponding to a unit.
+ * Returns the identifier in a given encoding to which a unit maps.  A Latin-1
+ * request is satisfied by an ASCII identifier and a UTF-8 request by a Latin-1
+ * (converted to UTF-8) or ASCII identifier.
  *
  * Arguments:
- *	map	The unit-to-identifier map.
- *	unit	The unit to be used as the key in the search.
+ *	map		The unit-to-identifier map.
+ *	unit		The unit to be used as the key in the search.
+ *	encoding	The desired encoding of the identifier.
  * Returns:
- *	NULL	The map doesn't contain an entry corresponding to "unit" whose
- *		identifier is in UTF-8.
- *	else	Pointer to the entry corresponding to "unit" whose identifier is
- *		in UTF-8 (and might, actually, be in ASCII).
+ *	NULL	The map doesn't contain an identifier for "unit" in the given
+ *		encoding.
+ *	else	Pointer to the identifier.
  */
-static UnitAndId*
-utimFindUtf8ByUnit(
-    UnitToIdMap* const	        map,
-    const ut_unit* const	unit)
+static const char*
+utimFind(
+    const UnitToIdMap* const	map,
+    const ut_unit* const	unit,
+    const ut_encoding		encoding)
 {
-    UnitAndId	targetEntry;
-    UnitAndId**	treeEntry = NULL;	/* failure */
-
-    targetEntry.unit = (ut_unit*)unit;
-    treeEntry = tfind(&targetEntry, &map->utf8, compareUnits);
-
-    if (treeEntry == NULL) {
-	treeEntry = tfind(&targetEntry, &map->latin1, compareUnits);
+    const UnitIds* const	entry = map->slots + utimProbe(map, unit);
+    const char*			id;
 
-	if (treeEntry == NULL) {
-	    treeEntry = tfind(&targetEntry, &map->ascii, compareUnits);
-	}
-	else {
-	    /*
-	     * Create the UTF-8 version of the Latin-1 identifier and add it to
-	     * the UTF-8 unit-to-id map so that it will be found next time.
-	     */
-	    char* const	id = latin1ToUtf8((*treeEntry)->id);
-
-	    if (id == NULL) {
-		ut_set_status(UT_OS);
-		ut_handle_error_message(strerror(errno));
-		ut_handle_error_message(
-		    "Couldn't convert identifier from ISO-8859-1 to UTF-8");
-		treeEntry = NULL;
-	    }
-	    else {
-		UnitAndId*	newEntry = uaiNew(unit, id);
-
-		if (newEntry != NULL) {
-		    treeEntry = tsearch(newEntry, &map->utf8, compareUnits);
-
-		    if (treeEntry == NULL) {
-			uaiFree(newEntry);
-			ut_set_status(UT_OS);
-			ut_handle_error_message(strerror(errno));
-			ut_handle_error_message(
-                            "Couldn't add unit-and-identifier to search-tree");
-		    }
-		}
-
-		free(id);
-	    }				/* UTF-8 identifier created */
-	}				/* found Latin-1 identifier */
-    }					/* no UTF-8 identifier */
+    if (encoding == UT_LATIN1) {
+	id = entry->latin1 != NULL ? entry->latin1 : entry->ascii;
+    }
+    else if (encoding == UT_UTF8) {
+	id = entry->utf8 != NULL
+	    ? entry->utf8
+	    : entry->latin1AsUtf8 != NULL
+		? entry->latin1AsUtf8
+		: entry->ascii;
+    }
+    else {
+	id = entry->ascii;
+    }
 
-    return treeEntry == NULL ? NULL : *treeEntry;
+    return id;
 }
 
 
@@ -489,8 +613,7 @@ utimFindUtf8ByUnit(
  * Adds an entry to the unit-to-identifier map associated with a unit-system.
  *
  * Arguments:
- *	sytemMap	Address of the pointer to the
- *			system-to-unit-to-identifier map.
+ *	table		The unit-to-identifier table of the unit-system.
  *	unit		The unit.  May be freed upon return.
  *	id		The identifier.  May be freed upon return.
  *	encoding	The ostensible encoding of "id".
@@ -503,45 +626,29 @@ utimFindUtf8ByUnit(
  */
 static ut_status
 mapUnitToId(
-    SystemMap** const		systemMap,
+    const SystemTable		table,
     const ut_unit* const	unit,
     const char* const		id,
     ut_encoding			encoding)
 {
     ut_status		status;
 
-    assert(systemMap != NULL);
-
-    if (unit == NULL || id == NULL) {
+    if (unit == NULL || id == NULL || coreIsFrozen(ut_get_system(unit))) {
 	status = UT_BAD_ARG;
     }
     else {
-	if (*systemMap == NULL) {
-	    *systemMap = smNew();
-
-	    if (*systemMap == NULL)
-		status = UT_OS;
-	}
+	UnitToIdMap** const	unitToIdMap =
+	    (UnitToIdMap**)coreGetTable(ut_get_system(unit), table);
 
-	if (*systemMap != NULL) {
-	    UnitToIdMap** const	unitToIdMap =
-		(UnitToIdMap**)smSearch(*systemMap, ut_get_system(unit));
+	if (*unitToIdMap == NULL) {
+	    *unitToIdMap = utimNew();
 
-	    if (unitToIdMap == NULL) {
+	    if (*unitToIdMap == NULL)
 		status = UT_OS;
-	    }
-	    else {
-		if (*unitToIdMap == NULL) {
-		    *unitToIdMap = utimNew();
-
-		    if (*unitToIdMap == NULL)
-			status = UT_OS;
-		}
-
-		if (*unitToIdMap != NULL)
-		    status = utimAdd(*unitToIdMap, unit, id, encoding);
-	    }
 	}
+
+	if (*unitToIdMap != NULL)
+	    status = utimAdd(*unitToIdMap, unit, id, encoding);
     }
 
     return status;
@@ -553,33 +660,32 @@ mapUnitToId(
  * unit-system.
  *
  * Arguments:
- *	sytemMap	Pointer to the system-to-unit-to-identifier map.
+ *	table		The unit-to-identifier table of the unit-system.
  *	unit		The unit.  May be freed upon return.
  *	encoding	The ostensible encoding of "id".
  * Returns:
- *	UT_BAD_ARG	"systemMap" is NULL.
  *	UT_BAD_ARG	"unit" is NULL.
  *	UT_SUCCESS	Success.
  */
 static ut_status
 unmapUnitToId(
-    SystemMap* const		systemMap,
+    const SystemTable		table,
     const ut_unit* const	unit,
     ut_encoding			encoding)
 {
     ut_status		status;
 
-    if (systemMap == NULL || unit == NULL) {
+    if (unit == NULL || coreIsFrozen(ut_get_system(unit))) {
 	status = UT_BAD_ARG;
     }
     else {
-	UnitToIdMap** const	unitToIdMap =
-	    (UnitToIdMap**)smFind(systemMap, ut_get_system(unit));
+	UnitToIdMap* const	unitToIdMap =
+	    *(UnitToIdMap**)coreGetTable(ut_get_system(unit), table);
 
 	status =
-	    (unitToIdMap == NULL || *unitToIdMap == NULL)
+	    unitToIdMap == NULL
 		? UT_SUCCESS
-		: utimRemove(*unitToIdMap, unit, encoding);
+		: utimRemove(unitToIdMap, unit, encoding);
     }
 
     return status;
@@ -591,7 +697,7 @@ unmapUnitToId(
  * a unit-system maps.
  *
  * Arguments:
- *	systemMap	Pointer to the system-to-unit-to-id map.
+ *	table		The unit-to-identifier table of the unit-system.
  *	unit		Pointer to the unit whose identifier should be returned.
  *	encoding	The desired encoding of the identifier.
  * Returns:
@@ -602,7 +708,7 @@ unmapUnitToId(
  */
 static const char*
 getId(
-    SystemMap* const	systemMap,
+    const SystemTable		table,
     const ut_unit* const	unit,
     const ut_encoding	encoding)
 {
@@ -613,20 +719,11 @@ getId(
 	ut_handle_error_message("NULL unit argument");
     }
     else {
-	UnitToIdMap** const	unitToId = 
-	    (UnitToIdMap**)smFind(systemMap, ut_get_system(unit));
-
-	if (unitToId != NULL) {
-	    UnitAndId*	mapEntry = 
-		encoding == UT_LATIN1
-		    ? utimFindLatin1ByUnit(*unitToId, unit)
-		    : encoding == UT_UTF8
-			? utimFindUtf8ByUnit(*unitToId, unit)
-			: utimFindAsciiByUnit(*unitToId, unit);
-
-	    if (mapEntry != NULL)
-		id = mapEntry->id;
-	}
+	const UnitToIdMap* const	unitToId =
+	    *(UnitToIdMap**)coreGetTable(ut_get_system(unit), table);
+
+	if (unitToId != NULL)
+	    id = utimFind(unitToId, unit, encoding);
     }
 
     return id;
@@ -660,7 +757,7 @@ ut_map_unit_to_name(
     const char* const		name,
     ut_encoding			encoding)
 {
-    ut_set_status(mapUnitToId(&systemToUnitToName, unit, name, encoding));
+    ut_set_status(mapUnitToId(ST_UNIT_TO_NAME, unit, name, encoding));
 
     return ut_get_status();
 }
@@ -682,7 +779,7 @@ ut_unmap_unit_to_name(
     const ut_unit* const	unit,
     ut_encoding			encoding)
 {
-    ut_set_status(unmapUnitToId(systemToUnitToName, unit, encoding));
+    ut_set_status(unmapUnitToId(ST_UNIT_TO_NAME, unit, encoding));
 
     return ut_get_status();
 }
@@ -709,7 +806,7 @@ ut_map_unit_to_symbol(
     const char* const		symbol,
     ut_encoding			encoding)
 {
-    ut_set_status(mapUnitToId(&systemToUnitToSymbol, unit, symbol, encoding));
+    ut_set_status(mapUnitToId(ST_UNIT_TO_SYMBOL, unit, symbol, encoding));
 
     return ut_get_status();
 }
@@ -732,7 +829,7 @@ ut_unmap_unit_to_symbol(
     const ut_unit* const	unit,
     ut_encoding			encoding)
 {
-    ut_set_status(unmapUnitToId(systemToUnitToSymbol, unit, encoding));
+    ut_set_status(unmapUnitToId(ST_UNIT_TO_SYMBOL, unit, encoding));
 
     return ut_get_status();
 }
@@ -759,7 +856,7 @@ ut_get_name(
 {
     ut_set_status(UT_SUCCESS);
 
-    return getId(systemToUnitToName, unit, encoding);
+    return getId(ST_UNIT_TO_NAME, unit, encoding);
 }
 
 
@@ -784,7 +881,41 @@ ut_get_symbol(
 {
     ut_set_status(UT_SUCCESS);
 
-    return getId(systemToUnitToSymbol, unit, encoding);
+    return getId(ST_UNIT_TO_SYMBOL, unit, encoding);
+}
+
+
+/*
+ * Returns the identifier to which a unit was mapped in a given encoding.
+ * Unlike "ut_get_name()" and "ut_get_symbol()", an identifier in another
+ * encoding isn't returned instead.
+ *
+ * Arguments:
+ *	unit		Pointer to the unit.
+ *	isName		Whether to return the name rather than the symbol.
+ *	encoding	The encoding in which the identifier was mapped.
+ * Returns:
+ *	NULL		"unit" wasn't mapped to an identifier in "encoding".
+ *	else		Pointer to the identifier.
+ */
+const char*
+utimGetId(
+    const ut_unit* const	unit,
+    const int			isName,
+    const ut_encoding		encoding)
+{
+    const char*			id = NULL;
+    const UnitToIdMap* const	unitToId = *(UnitToIdMap**)coreGetTable(
+	ut_get_system(unit), isName ? ST_UNIT_TO_NAME : ST_UNIT_TO_SYMBOL);
+
+    if (unitToId != NULL) {
+	UnitIds* const	entry = unitToId->slots + utimProbe(unitToId, unit);
+
+	if (entry->unit != NULL)
+	    id = *selectId(entry, encoding);
+    }
+
+    return id;
 }
 
 
@@ -800,22 +931,14 @@ utimFreeSystem(
     ut_system*	system)
 {
     if (system != NULL) {
-	SystemMap*	systemMaps[2];
-	int		i;
-
-	systemMaps[0] = systemToUnitToName;
-	systemMaps[1] = systemToUnitToSymbol;
-
-	for (i = 0; i < 2; i++) {
-	    if (systemMaps[i] != NULL) {
-		UnitToIdMap** const	unitToId =
-		    (UnitToIdMap**)smFind(systemMaps[i], system);
-
-		if (unitToId != NULL)
-		    utimFree(*unitToId);
-
-		smRemove(systemMaps[i], system);
-	    }
-	}
+	UnitToIdMap** const	unitToName =
+	    (UnitToIdMap**)coreGetTable(system, ST_UNIT_TO_NAME);
+	UnitToIdMap** const	unitToSymbol =
+	    (UnitToIdMap**)coreGetTable(system, ST_UNIT_TO_SYMBOL);
+
+	utimFree(*unitToName);
+	*unitToName = NULL;
+	utimFree(*unitToSymbol);
+	*unitToSymbol = NULL;
     }
 }
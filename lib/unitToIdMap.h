@@ -13,6 +13,26 @@ extern "C" {
 #endif
 
 
+/*
+ * Returns the identifier to which a unit was mapped in a given encoding.
+ * Unlike "ut_get_name()" and "ut_get_symbol()", an identifier in another
+ * encoding isn't returned instead.
+ *
+ * Arguments:
+ *	unit		Pointer to the unit.
+ *	isName		Whether to return the name rather than the symbol.
+ *	encoding	The encoding in which the identifier was mapped.
+ * Returns:
+ *	NULL		"unit" wasn't mapped to an identifier in "encoding".
+ *	else		Pointer to the identifier.
+ */
+const char*
+utimGetId(
+    const ut_unit* const	unit,
+    const int			isName,
+    const ut_encoding		encoding);
+
+
 /*
  * Frees resources associated with a unit-system.
  *
@@ -29,8 +29,22 @@
  *	ut_unit		A data-structure that encapsulates ProductUnit, 
  *			GalileanUnit, LogUnit, and TimestampUnit.
  *
- * This module is thread-compatible but not thread-safe: multi-thread access to
- * this module must be externally synchronized.
+ * Units are hash-consed: each unit-system has a table of its units and a unit
+ * is only created if an equal one isn't already in the table.  Consequently,
+ * equal units are identical, units are immutable (except for their lazily-
+ * initialized converters), cloning a unit increments its reference-count, and
+ * freeing a unit decrements it.  A product of a single basic-unit raised to the
+ * first power is represented by the basic-unit.
+ *
+ * This module is thread-safe for the operations on units of a unit-system
+ * that's no longer being modified: several threads may share one unit-system
+ * and concurrently create, operate on, compare, free, and obtain converters
+ * for its units.  Scratch space is per-call, the table of units and the
+ * converter-cache have their own spin-locks, and lazily-initialized converters
+ * are published atomically (see "atomics.h").  Functions that modify the
+ * unit-system itself (e.g., "ut_new_base_unit()", "ut_set_second()",
+ * "ut_free_system()") must be externally synchronized.  The status returned by
+ * "ut_get_status()" is per-thread (see "context.c").
  */
 
 /*LINTLIBRARY*/
@@ -73,6 +87,8 @@
 
 #include "udunits2.h"		/* this module's API */
 #include "converter.h"
+#include "atomics.h"
+#include "systemTable.h"
 
 typedef enum {
     PRODUCT_EQUAL = 0,		/* The units are equal -- ignoring dimensionless
@@ -85,11 +101,47 @@ typedef enum {
 typedef struct BasicUnit	BasicUnit;
 typedef struct ProductUnit	ProductUnit;
 
+/*
+ * An entry in the cache of converters of a unit-system.  The entry holds a
+ * reference to each unit and to the converter.
+ */
+typedef struct {
+    ut_unit*		from;
+    ut_unit*		to;
+    cv_converter*	converter;
+} CacheEntry;
+
+/*
+ * A block of memory in the arena of a unit-system.  The units allocated from
+ * the block follow this header.
+ */
+typedef union ArenaBlock {
+    union ArenaBlock*	next;		/* next block of the arena */
+    double		align;		/* aligns the units that follow */
+} ArenaBlock;
+
+#define UNIT_TYPE_COUNT	5	/* number of unit types */
+
 struct ut_system {
     ut_unit*		second;
     ut_unit*		one;		/* the dimensionless-unit one */
     BasicUnit**		basicUnits;
     int			basicCount;
+    ut_unit**		buckets;	/* hash-table of all units */
+    size_t		bucketCount;	/* number of buckets; a power of 2 */
+    size_t		unitCount;	/* number of units in "buckets" */
+    long		unitLock;	/* spin-lock for "buckets" */
+    CacheEntry*		cache;		/* converter cache or NULL */
+    long		cacheLock;	/* spin-lock for "cache" */
+    CacheEntry**	fixedCache;	/* frozen system's cache or NULL */
+    ArenaBlock*		arenaBlocks;	/* blocks of the arena or NULL */
+    char*		arenaNext;	/* next free byte of first block */
+    char*		arenaEnd;	/* end of first block */
+    ut_unit*		arenaFree[UNIT_TYPE_COUNT]; /* freed units by type */
+    int			useArena;	/* allocate new units from arena? */
+    long		arenaLock;	/* spin-lock for the arena */
+    int			isFrozen;	/* can't be modified? */
+    void*		tables[ST_COUNT]; /* see "systemTable.h" */
 };
 
 typedef struct {
@@ -108,6 +160,13 @@ typedef struct {
     int			(*initConverterFromProduct)(ut_unit*);
     ut_status		(*acceptVisitor)(const ut_unit*, const ut_visitor*,
 			    void*);
+    /*
+     * The following functions are used to find a unit in the table of its
+     * unit-system.  The equality function is called if and only if the two
+     * units are of the same type.
+     */
+    unsigned long	(*hash)(const ut_unit*);
+    int			(*equal)(const ut_unit*, const ut_unit*);
 } UnitOps;
 
 typedef enum {
@@ -138,13 +197,47 @@ typedef enum {
 #define COMPARE(unit1, unit2) \
 			((unit1)->common.ops->compare(unit1, unit2))
 #define ENSURE_CONVERTER_TO_PRODUCT(unit) \
-			((unit)->common.toProduct != NULL || \
+			(UT_LOAD_POINTER((unit)->common.toProduct) != NULL || \
 			(unit)->common.ops->initConverterToProduct(unit) == 0)
 #define ENSURE_CONVERTER_FROM_PRODUCT(unit) \
-			((unit)->common.fromProduct != NULL || \
+			(UT_LOAD_POINTER((unit)->common.fromProduct) != NULL || \
 			(unit)->common.ops->initConverterFromProduct(unit) == 0)
 #define ACCEPT_VISITOR(unit, visitor, arg) \
 			((unit)->common.ops->acceptVisitor(unit, visitor, arg))
+#define HASH(unit)	((unit)->common.ops->hash(unit))
+#define EQUAL(unit1, unit2) \
+			((unit1)->common.ops->equal(unit1, unit2))
+
+#define UNIT_TABLE_SIZE	64	/* initial number of buckets per unit-system */
+#define HASH_INIT	2166136261UL
+
+/*
+ * The converter cache of a unit-system is a 2-way set-associative table with
+ * least-recently-used replacement.  A frozen unit-system also has a fixed
+ * cache of the same shape whose entries, once set, are never changed, so it's
+ * read without locking; the other cache only holds the converters for which
+ * the fixed cache has no room.
+ */
+#define CACHE_SETS	512	/* number of sets; a power of 2 */
+#define CACHE_WAYS	2	/* number of entries per set */
+
+/*
+ * The maximum number of basic-units in a product that's computed without
+ * allocating memory.
+ */
+#define PRODUCT_BUFFER_SIZE	32
+
+/*
+ * The maximum number of basic-units in a product-unit whose indexes and powers
+ * are stored in the product-unit itself rather than in separately-allocated
+ * memory.  Enough for the SI base units and a dimensionless unit.
+ */
+#define PRODUCT_INLINE_SIZE	8
+
+/*
+ * The number of bytes of units in each block of the arena of a unit-system.
+ */
+#define ARENA_BLOCK_SIZE	32768
 
 typedef struct {
     ut_system*		system;
@@ -152,6 +245,10 @@ typedef struct {
     UnitType		type;
     cv_converter*	toProduct;
     cv_converter*	fromProduct;
+    ut_unit*		next;		/* next unit in the same bucket */
+    unsigned long	hash;		/* hash-code of the unit */
+    long		refCount;	/* number of references */
+    int			inArena;	/* allocated from the system's arena? */
 } Common;
 
 struct BasicUnit {
@@ -163,9 +260,13 @@ struct BasicUnit {
 
 struct ProductUnit {
     Common		common;
-    short*		indexes;
-    short*		powers;
+    short*		indexes;	/* "storage" or allocated */
+    short*		powers;		/* "indexes + count" */
     int			count;
+    int			dimCount;	/* number of dimensionful factors */
+    unsigned long	dimHash;	/* hash of dimensionful factors */
+    unsigned long	inverseHash;	/* "dimHash" of reciprocal */
+    short		storage[2*PRODUCT_INLINE_SIZE];
 };
 
 typedef struct {
@@ -179,6 +280,9 @@ typedef struct {
     Common		common;
     ut_unit*		unit;
     double		origin;
+    double		slope;		/* seconds per "unit" */
+    double		intercept;	/* seconds at zero "unit" */
+    int			isGalilean;	/* "slope" and "intercept" set? */
 } TimestampUnit;
 
 typedef struct {
@@ -222,6 +326,13 @@ static ut_unit*		productRaise(
 static ut_unit*		productRoot(
     const ut_unit* const	unit,
     const int			root);
+/*
+ * The following function is declared here because it's used in the
+ * timestamp-unit section before it's defined.
+ */
+static cv_converter*	getConverter(
+    ut_unit* const		from,
+    ut_unit* const		to);
 
 
 /*
@@ -369,12 +480,7 @@ gregorianDateToJulianDay(year, month, day)
 static long
 getJuldayOrigin()
 {
-    static long juldayOrigin;
-
-    if (juldayOrigin == 0)
-	juldayOrigin = gregorianDateToJulianDay(2001, 1, 1);
-
-    return juldayOrigin;
+    return gregorianDateToJulianDay(2001, 1, 1);
 }
 
 
@@ -579,6 +685,9 @@ ut_decode_time(
 
 
 /*
+ * Initializes the common-area of a unit.  The "inArena" member isn't changed
+ * because it's set by "unitAlloc()".
+ *
  * Arguments:
  *	common	Pointer to unit common-area.
  *	ops	Pointer to unit-specific function-structure.
@@ -603,11 +712,388 @@ commonInit(
     common->type = type;
     common->toProduct = NULL;
     common->fromProduct = NULL;
+    common->next = NULL;
+    common->hash = 0;
+    common->refCount = 1;
 
     return 0;
 }
 
 
+/*
+ * Allocates memory for a unit.  If the unit-system is in arena mode, then the
+ * memory comes from the system's arena -- either a previously-freed unit of
+ * the same type or the next free bytes of the arena; otherwise, it comes from
+ * "malloc()".
+ *
+ * Arguments:
+ *	system	The unit-system of the unit.
+ *	type	The type of the unit.
+ *	size	The size of the unit in bytes.
+ * Returns:
+ *	NULL	Failure.  "errno" will be set.
+ *	else	Pointer to the memory.  Its "common.inArena" member is set.
+ */
+static void*
+unitAlloc(
+    ut_system* const	system,
+    const UnitType	type,
+    const size_t	size)
+{
+    Common*		common;
+
+    if (!system->useArena) {
+	common = malloc(size);
+
+	if (common != NULL)
+	    common->inArena = 0;
+    }
+    else {
+	const size_t	nbytes = (size + sizeof(ArenaBlock) - 1) /
+	    sizeof(ArenaBlock) * sizeof(ArenaBlock);
+
+	assert(nbytes <= ARENA_BLOCK_SIZE);
+
+	UT_LOCK(system->arenaLock);
+
+	common = (Common*)system->arenaFree[type];
+
+	if (common != NULL) {
+	    system->arenaFree[type] = common->next;
+	}
+	else {
+	    if (system->arenaEnd - system->arenaNext < (ptrdiff_t)nbytes) {
+		ArenaBlock*	block =
+		    malloc(sizeof(ArenaBlock) + ARENA_BLOCK_SIZE);
+
+		if (block != NULL) {
+		    block->next = system->arenaBlocks;
+		    system->arenaBlocks = block;
+		    system->arenaNext = (char*)(block + 1);
+		    system->arenaEnd = system->arenaNext + ARENA_BLOCK_SIZE;
+		}
+	    }
+
+	    if (system->arenaEnd - system->arenaNext >= (ptrdiff_t)nbytes) {
+		common = (Common*)system->arenaNext;
+		system->arenaNext += nbytes;
+	    }
+	}
+
+	UT_UNLOCK(system->arenaLock);
+
+	if (common != NULL)
+	    common->inArena = 1;
+    }
+
+    return common;
+}
+
+
+/*
+ * Frees the memory of a unit that was allocated by "unitAlloc()".  A unit
+ * from the arena of its unit-system is kept for reuse by a unit of the same
+ * type.
+ *
+ * Arguments:
+ *	unit	The unit.
+ */
+static void
+unitDealloc(
+    ut_unit* const	unit)
+{
+    if (!unit->common.inArena) {
+	free(unit);
+    }
+    else {
+	ut_system* const	system = unit->common.system;
+
+	UT_LOCK(system->arenaLock);
+
+	unit->common.next = system->arenaFree[unit->common.type];
+	system->arenaFree[unit->common.type] = unit;
+
+	UT_UNLOCK(system->arenaLock);
+    }
+}
+
+
+/*
+ * Returns a hash-code that includes a sequence of bytes.
+ *
+ * Arguments:
+ *	hash	The hash-code of the preceding bytes or HASH_INIT.
+ *	bytes	Pointer to the bytes.
+ *	nbytes	The number of bytes.
+ * Returns:
+ *	The hash-code of the preceding bytes and "bytes".
+ */
+static unsigned long
+hashBytes(
+    unsigned long		hash,
+    const void* const		bytes,
+    const size_t		nbytes)
+{
+    const unsigned char*	byte = bytes;
+    size_t			i;
+
+    for (i = 0; i < nbytes; i++) {
+	hash ^= byte[i];
+	hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+
+/*
+ * Returns a hash-code that includes a double-precision value.  Values that
+ * compare equal have the same hash-code.
+ */
+static unsigned long
+hashDouble(
+    const unsigned long	hash,
+    const double	value)
+{
+    const double	canonical = value == 0 ? 0.0 : value;
+
+    return hashBytes(hash, &canonical, sizeof(canonical));
+}
+
+
+/*
+ * Returns a hash-code that includes a unit.  Because units are unique, the
+ * unit's address is used.
+ */
+static unsigned long
+hashUnit(
+    const unsigned long		hash,
+    const ut_unit* const	unit)
+{
+    return hashBytes(hash, &unit, sizeof(unit));
+}
+
+
+/*
+ * Returns a new reference to a unit.  The units of a frozen unit-system have
+ * a reference-count of zero and aren't counted.
+ */
+static ut_unit*
+unitRetain(
+    const ut_unit* const	unit)
+{
+    if (UT_LOAD_LONG(unit->common.refCount) != 0)
+	(void)UT_INCREMENT(((ut_unit*)unit)->common.refCount);
+
+    return (ut_unit*)unit;
+}
+
+
+/*
+ * Returns the unit in the table of a unit-system that's equal to a given unit.
+ * The table must be locked.
+ *
+ * Arguments:
+ *	key	The unit to be found.  Only its common-area and value need be
+ *		set.
+ *	hash	The hash-code of "key".
+ * Returns:
+ *	NULL	There's no such unit.
+ *	else	The equal unit.  Its reference-count is unchanged.
+ */
+static ut_unit*
+unitFind(
+    const ut_unit* const	key,
+    const unsigned long		hash)
+{
+    const ut_system* const	system = key->common.system;
+    ut_unit*			unit;
+
+    for (unit = system->buckets[hash & (system->bucketCount - 1)];
+	    unit != NULL; unit = unit->common.next) {
+	if (unit->common.hash == hash &&
+		unit->common.type == key->common.type && EQUAL(unit, key))
+	    break;
+    }
+
+    return unit;
+}
+
+
+/*
+ * Returns the unit in the table of a unit-system that's equal to a given unit.
+ *
+ * Arguments:
+ *	key	The unit to be found.  Only its common-area and value need be
+ *		set.
+ *	hash	The hash-code of "key".
+ * Returns:
+ *	NULL	There's no such unit.
+ *	else	A new reference to the equal unit.
+ */
+static ut_unit*
+unitLookup(
+    const ut_unit* const	key,
+    const unsigned long		hash)
+{
+    ut_system* const	system = key->common.system;
+    ut_unit*		unit;
+
+    UT_LOCK(system->unitLock);
+
+    unit = unitFind(key, hash);
+
+    if (unit != NULL)
+	(void)unitRetain(unit);
+
+    UT_UNLOCK(system->unitLock);
+
+    return unit;
+}
+
+
+/*
+ * Adds a new unit to the table of its unit-system.  The table is enlarged if
+ * necessary and possible.  Because another thread might have added an equal
+ * unit after this thread's "unitLookup()", the table is searched again.
+ *
+ * Arguments:
+ *	unit	The unit to be added.
+ *	hash	The hash-code of "unit".
+ * Returns:
+ *	NULL	"unit" was added to the table.
+ *	else	A new reference to the equal unit that's already in the table.
+ *		"unit" wasn't added and should be freed by the caller.
+ */
+static ut_unit*
+unitAdd(
+    ut_unit* const		unit,
+    const unsigned long		hash)
+{
+    ut_system* const	system = unit->common.system;
+    ut_unit*		existing;
+
+    UT_LOCK(system->unitLock);
+
+    existing = unitFind(unit, hash);
+
+    if (existing != NULL) {
+	(void)unitRetain(existing);
+    }
+    else {
+	ut_unit**	bucket;
+
+	if (system->unitCount >= system->bucketCount) {
+	    const size_t	newCount = 2 * system->bucketCount;
+	    ut_unit**		newBuckets = calloc(newCount, sizeof(ut_unit*));
+
+	    if (newBuckets != NULL) {
+		size_t	i;
+
+		for (i = 0; i < system->bucketCount; i++) {
+		    ut_unit*	entry = system->buckets[i];
+
+		    while (entry != NULL) {
+			ut_unit*	next = entry->common.next;
+			ut_unit**	newBucket =
+			    newBuckets + (entry->common.hash & (newCount - 1));
+
+			entry->common.next = *newBucket;
+			*newBucket = entry;
+			entry = next;
+		    }
+		}
+
+		free(system->buckets);
+		system->buckets = newBuckets;
+		system->bucketCount = newCount;
+	    }				/* "newBuckets" allocated */
+	}				/* table should be enlarged */
+
+	bucket = system->buckets + (hash & (system->bucketCount - 1));
+	unit->common.hash = hash;
+	unit->common.next = *bucket;
+	*bucket = unit;
+	system->unitCount++;
+    }					/* "unit" isn't in table */
+
+    UT_UNLOCK(system->unitLock);
+
+    return existing;
+}
+
+
+/*
+ * Releases a reference to a unit.  The last reference removes the unit from
+ * the table of its unit-system.  A reference that isn't the last is released
+ * without locking the table; the last is released with the table locked so
+ * that a concurrent "unitLookup()" can't resurrect the unit.  The units of a
+ * frozen unit-system aren't counted and are never released.
+ *
+ * Arguments:
+ *	unit	The unit.
+ * Returns:
+ *	0	The unit is still referenced.
+ *	1	That was the last reference: the unit should be freed.
+ */
+static int
+unitRelease(
+    ut_unit* const	unit)
+{
+    int			isLast = 0;
+    int			isReleased = 0;
+    long		count = UT_LOAD_LONG(unit->common.refCount);
+
+    while (count > 1 && !isReleased) {
+	isReleased = UT_CAS_LONG(unit->common.refCount, count, count - 1);
+
+	if (!isReleased)
+	    count = UT_LOAD_LONG(unit->common.refCount);
+    }
+
+    if (count != 0 && !isReleased) {
+	ut_system* const	system = unit->common.system;
+
+	UT_LOCK(system->unitLock);
+
+	isLast = UT_DECREMENT(unit->common.refCount) == 0;
+
+	if (isLast) {
+	    ut_unit**	link = system->buckets +
+		(unit->common.hash & (system->bucketCount - 1));
+
+	    while (*link != unit)
+		link = &(*link)->common.next;
+
+	    *link = unit->common.next;
+	    system->unitCount--;
+	}
+
+	UT_UNLOCK(system->unitLock);
+    }
+
+    return isLast;
+}
+
+
+/*
+ * Sets a lazily-initialized converter of a unit.  If another thread has
+ * already set the converter, then the given one is freed.
+ *
+ * Arguments:
+ *	field		Pointer to the unit's converter field.
+ *	converter	The converter.
+ */
+static void
+setConverter(
+    cv_converter** const	field,
+    cv_converter* const		converter)
+{
+    if (!UT_CAS_POINTER(*field, NULL, converter))
+	cv_free(converter);
+}
+
+
 /******************************************************************************
  * Basic-Unit:
  ******************************************************************************/
@@ -617,17 +1103,17 @@ static UnitOps	basicOps;
 
 
 /*
- * Returns a new instance of a basic-unit.
+ * Returns an instance of a basic-unit.
  *
  * Arguments:
- *	system		The unit-system to be associated with the new instance.
+ *	system		The unit-system to be associated with the instance.
  *	isDimensionless	Whether or not the unit is dimensionless (e.g., 
  *			"radian").
  *	index		The index of the basic-unit in "system".
  * Returns:
  *	NULL	Failure.  "ut_get_status()" will be:
  *		    UT_OS	Operating-system error.  See "errno".
- *	else	Pointer to newly-allocated basic-unit.
+ *	else	Pointer to the basic-unit.
  */
 static BasicUnit*
 basicNew(
@@ -640,37 +1126,67 @@ basicNew(
     short		power = 1;
     short		shortIndex = (short)index;
     ProductUnit*	product;
+    BasicUnit		key;
+    unsigned long	hash;
 
     assert(system != NULL);
 
-    product = productNew(system, &shortIndex, &power, 1);
+    (void)commonInit(&key.common, &basicOps, system, BASIC);
+    key.index = index;
+    hash = HASH((ut_unit*)&key);
+    basicUnit = (BasicUnit*)unitLookup((ut_unit*)&key, hash);
 
-    if (product == NULL) {
-	ut_set_status(UT_OS);
-	ut_handle_error_message(
-	    "basicNew(): Couldn't create new product-unit");
-    }
-    else {
-	basicUnit = malloc(sizeof(BasicUnit));
+    if (basicUnit == NULL) {
+	product = productNew(system, &shortIndex, &power, 1);
 
-	if (basicUnit == NULL) {
+	if (product == NULL) {
 	    ut_set_status(UT_OS);
-	    ut_handle_error_message(strerror(errno));
 	    ut_handle_error_message(
-		"basicNew(): Couldn't allocate %lu-byte basic-unit",
-		sizeof(BasicUnit));
+		"basicNew(): Couldn't create new product-unit");
 	}
-	else if (commonInit(&basicUnit->common, &basicOps, system,
-		BASIC) == 0) {
-	    basicUnit->index = index;
-	    basicUnit->isDimensionless = isDimensionless;
-	    basicUnit->product = product;
-	    error = 0;
-	}				/* "basicUnit" allocated */
+	else {
+	    if (isDimensionless) {
+		/*
+		 * The basic-unit isn't yet in the unit-system, so
+		 * "productNew()" considered it dimensionful.
+		 */
+		product->dimCount = 0;
+		product->dimHash = HASH_INIT;
+		product->inverseHash = HASH_INIT;
+	    }
+
+	    basicUnit = unitAlloc(system, BASIC, sizeof(BasicUnit));
 
-	if (error)
-	    productFree((ut_unit*)product);
-    }				/* "product" allocated */
+	    if (basicUnit == NULL) {
+		ut_set_status(UT_OS);
+		ut_handle_error_message(strerror(errno));
+		ut_handle_error_message(
+		    "basicNew(): Couldn't allocate %lu-byte basic-unit",
+		    sizeof(BasicUnit));
+	    }
+	    else if (commonInit(&basicUnit->common, &basicOps, system,
+		    BASIC) == 0) {
+		BasicUnit*	existing;
+
+		basicUnit->index = index;
+		basicUnit->isDimensionless = isDimensionless;
+		basicUnit->product = product;
+		existing = (BasicUnit*)unitAdd((ut_unit*)basicUnit, hash);
+
+		if (existing == NULL) {
+		    error = 0;
+		}
+		else {
+		    /* Another thread added an equal basic-unit */
+		    unitDealloc((ut_unit*)basicUnit);
+		    basicUnit = existing;
+		}
+	    }				/* "basicUnit" allocated */
+
+	    if (error)
+		productFree((ut_unit*)product);
+	}				/* "product" allocated */
+    }					/* new basic-unit */
 
     return basicUnit;
 }
@@ -692,8 +1208,7 @@ basicClone(
 {
     assert(IS_BASIC(unit));
 
-    return (ut_unit*)basicNew(unit->common.system, unit->basic.isDimensionless,
-	unit->basic.index);
+    return unitRetain(unit);
 }
 
 
@@ -703,9 +1218,12 @@ basicFree(
 {
     if (unit != NULL) {
 	assert(IS_BASIC(unit));
-	productFree((ut_unit*)unit->basic.product);
-	unit->basic.product = NULL;
-	free(unit);
+
+	if (unitRelease(unit)) {
+	    productFree((ut_unit*)unit->basic.product);
+	    unit->basic.product = NULL;
+	    unitDealloc(unit);
+	}
     }
 }
 
@@ -832,8 +1350,7 @@ basicInitConverterToProduct(
     assert(unit != NULL);
     assert(IS_BASIC(unit));
 
-    if (unit->common.toProduct == NULL)
-	unit->common.toProduct = cv_get_trivial();
+    setConverter(&unit->common.toProduct, cv_get_trivial());
 
     return 0;
 }
@@ -855,8 +1372,7 @@ basicInitConverterFromProduct(
     assert(unit != NULL);
     assert(IS_BASIC(unit));
 
-    if (unit->common.fromProduct == NULL)
-	unit->common.fromProduct = cv_get_trivial();
+    setConverter(&unit->common.fromProduct, cv_get_trivial());
 
     return 0;
 }
@@ -876,6 +1392,29 @@ basicAcceptVisitor(
 }
 
 
+static unsigned long
+basicHash(
+    const ut_unit* const	unit)
+{
+    assert(unit != NULL);
+    assert(IS_BASIC(unit));
+
+    return hashBytes(HASH_INIT, &unit->basic.index, sizeof(int));
+}
+
+
+static int
+basicEqual(
+    const ut_unit* const	unit1,
+    const ut_unit* const	unit2)
+{
+    assert(IS_BASIC(unit1));
+    assert(IS_BASIC(unit2));
+
+    return unit1->basic.index == unit2->basic.index;
+}
+
+
 static UnitOps	basicOps = {
     basicGetProduct,
     basicClone,
@@ -886,7 +1425,9 @@ static UnitOps	basicOps = {
     basicRoot,
     basicInitConverterToProduct,
     basicInitConverterFromProduct,
-    basicAcceptVisitor
+    basicAcceptVisitor,
+    basicHash,
+    basicEqual
 };
 
 
@@ -898,76 +1439,163 @@ static UnitOps	productOps;
 
 
 /*
- * Arguments:
- *	system	The unit-system for the new unit.
- *	indexes	Pointer to array of indexes of basic-units.  May be freed upon
- *		return.
- *	powers	Pointer to array of powers.  Client may free upon return.
- *	count	The number of elements in "indexes" and "powers".  May be zero.
- * Returns:
- *	NULL	Failure.  "ut_get_status()" will be:
- *		    UT_OS	Operating-system error.  See "errno".
- *	else	The newly-allocated, product-unit.
+ * Frees the indexes and powers of a product-unit if they're not stored in the
+ * product-unit itself.
  */
-static ProductUnit*
-productNew(
-    ut_system* const	system,
-    const short* const	indexes,
-    const short* const	powers,
-    const int		count)
+static void
+productFreeArrays(
+    ProductUnit* const	product)
 {
-    ProductUnit*	productUnit;
+    if (product->indexes != product->storage)
+	free(product->indexes);
 
-    assert(system != NULL);
+    product->indexes = NULL;
+    product->powers = NULL;
+}
+
+
+/*
+ * Sets the dimension signature of a product-unit: the number of its
+ * dimensionful basic-units and hash-codes of their indexes and powers and of
+ * those of the reciprocal.  Products with the same dimensions have the same
+ * signature, so products whose signatures differ are unconvertible.
+ * Basic-units that aren't yet in the unit-system are considered dimensionful.
+ *
+ * Arguments:
+ *	product	The product-unit.  Its indexes and powers must be set.
+ */
+static void
+productInitSignature(
+    ProductUnit* const	product)
+{
+    const ut_system* const	system = product->common.system;
+    unsigned long		hash = HASH_INIT;
+    unsigned long		inverseHash = HASH_INIT;
+    int				dimCount = 0;
+    int				i;
+
+    for (i = 0; i < product->count; i++) {
+	const short	index = product->indexes[i];
+
+	if (index >= system->basicCount ||
+		!system->basicUnits[index]->isDimensionless) {
+	    const short	power = product->powers[i];
+	    const short	inversePower = (short)-power;
+
+	    hash = hashBytes(hash, &index, sizeof(index));
+	    hash = hashBytes(hash, &power, sizeof(power));
+	    inverseHash = hashBytes(inverseHash, &index, sizeof(index));
+	    inverseHash = hashBytes(inverseHash, &inversePower,
+		sizeof(inversePower));
+	    dimCount++;
+	}
+    }
+
+    product->dimCount = dimCount;
+    product->dimHash = hash;
+    product->inverseHash = inverseHash;
+}
+
+
+/*
+ * Arguments:
+ *	system	The unit-system for the unit.
+ *	indexes	Pointer to array of indexes of basic-units.  May be freed upon
+ *		return.
+ *	powers	Pointer to array of powers.  Client may free upon return.
+ *	count	The number of elements in "indexes" and "powers".  May be zero.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be:
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	The product-unit.
+ */
+static ProductUnit*
+productNew(
+    ut_system* const	system,
+    const short* const	indexes,
+    const short* const	powers,
+    const int		count)
+{
+    ProductUnit*	productUnit;
+    ProductUnit		key;
+    unsigned long	hash;
+
+    assert(system != NULL);
     assert(count >= 0);
     assert(count == 0 || (indexes != NULL && powers != NULL));
 
-    productUnit = malloc(sizeof(ProductUnit));
+    (void)commonInit(&key.common, &productOps, system, PRODUCT);
+    key.indexes = (short*)indexes;
+    key.powers = (short*)powers;
+    key.count = count;
+    hash = HASH((ut_unit*)&key);
+    productUnit = (ProductUnit*)unitLookup((ut_unit*)&key, hash);
 
     if (productUnit == NULL) {
-	ut_set_status(UT_OS);
-	ut_handle_error_message(strerror(errno));
-	ut_handle_error_message(
-	    "productNew(): Couldn't allocate %d-byte product-unit",
-	    sizeof(ProductUnit));
-    }
-    else {
-	int	error = 1;
-
-	if (commonInit(&productUnit->common, &productOps, system, PRODUCT)
-		== 0) {
-            if (count == 0) {
-                productUnit->count = count;
-                productUnit->indexes = NULL;
-                productUnit->powers = NULL;
-                error = 0;
-            }
-            else {
-                size_t	nbytes = sizeof(short)*count;
-                short*	newIndexes = malloc(nbytes*2);
-
-                if (count > 0 && newIndexes == NULL) {
-                    ut_set_status(UT_OS);
-                    ut_handle_error_message(strerror(errno));
-                    ut_handle_error_message("productNew(): "
-                        "Couldn't allocate %d-element index array", count);
-                }
-                else {
-                    short*	newPowers = newIndexes + count;
+	productUnit = unitAlloc(system, PRODUCT, sizeof(ProductUnit));
 
-                    productUnit->count = count;
-                    productUnit->indexes = memcpy(newIndexes, indexes, nbytes);
-                    productUnit->powers = memcpy(newPowers, powers, nbytes);
-                    error = 0;
-                }
-	    }                           /* "count > 0" */
-	}                               /* "productUnit->common" initialized */
-
-	if (error) {
-	    free(productUnit);
-	    productUnit = NULL;
+	if (productUnit == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"productNew(): Couldn't allocate %d-byte product-unit",
+		sizeof(ProductUnit));
 	}
-    }				        /* "productUnit" allocated */
+	else {
+	    int	error = 1;
+
+	    if (commonInit(&productUnit->common, &productOps, system, PRODUCT)
+		    == 0) {
+		if (count == 0) {
+		    productUnit->count = count;
+		    productUnit->indexes = NULL;
+		    productUnit->powers = NULL;
+		    error = 0;
+		}
+		else {
+		    size_t	nbytes = sizeof(short)*count;
+		    short*	newIndexes = count <= PRODUCT_INLINE_SIZE
+			? productUnit->storage
+			: malloc(nbytes*2);
+
+		    if (newIndexes == NULL) {
+			ut_set_status(UT_OS);
+			ut_handle_error_message(strerror(errno));
+			ut_handle_error_message("productNew(): "
+			    "Couldn't allocate %d-element index array", count);
+		    }
+		    else {
+			short*	newPowers = newIndexes + count;
+
+			productUnit->count = count;
+			productUnit->indexes =
+			    memcpy(newIndexes, indexes, nbytes);
+			productUnit->powers = memcpy(newPowers, powers,
+			    nbytes);
+			error = 0;
+		    }
+		}			/* "count > 0" */
+	    }				/* "productUnit->common" initialized */
+
+	    if (error) {
+		unitDealloc((ut_unit*)productUnit);
+		productUnit = NULL;
+	    }
+	    else {
+		ProductUnit*	existing;
+
+		productInitSignature(productUnit);
+		existing = (ProductUnit*)unitAdd((ut_unit*)productUnit, hash);
+
+		if (existing != NULL) {
+		    /* Another thread added an equal product-unit */
+		    productFreeArrays(productUnit);
+		    unitDealloc((ut_unit*)productUnit);
+		    productUnit = existing;
+		}
+	    }
+	}				/* "productUnit" allocated */
+    }					/* new product-unit */
 
     return productUnit;
 }
@@ -993,14 +1621,9 @@ productClone(
     assert(unit != NULL);
     assert(IS_PRODUCT(unit));
 
-    if (unit == unit->common.system->one) {
-	clone = unit->common.system->one;
-    }
-    else {
-	clone = (ut_unit*)productNew(unit->common.system,
-	    unit->product.indexes, unit->product.powers,
-	    unit->product.count);
-    }
+    clone = unit == unit->common.system->one
+	? unit->common.system->one
+	: unitRetain(unit);
 
     return clone;
 }
@@ -1060,13 +1683,12 @@ productReallyFree(
 {
     if (unit != NULL) {
 	assert(IS_PRODUCT(unit));
-	free(unit->product.indexes);
-	unit->product.indexes = NULL;
+	productFreeArrays(&unit->product);
 	cv_free(unit->common.toProduct);
 	unit->common.toProduct = NULL;
 	cv_free(unit->common.fromProduct);
 	unit->common.fromProduct = NULL;
-	free(unit);
+	unitDealloc(unit);
     }
 }
 
@@ -1075,11 +1697,44 @@ static void
 productFree(
     ut_unit* const	unit)
 {
-    if (unit != unit->common.system->one)
+    if (unit != unit->common.system->one && unitRelease(unit))
 	productReallyFree(unit);
 }
 
 
+/*
+ * Returns the unit that's equal to a product of basic-units.  A single
+ * basic-unit raised to the first power is returned as the basic-unit and an
+ * empty product as the dimensionless unit one so that equal units are
+ * identical.
+ *
+ * Arguments:
+ *	system	The unit-system for the unit.
+ *	indexes	Pointer to array of indexes of basic-units.  May be freed upon
+ *		return.
+ *	powers	Pointer to array of powers.  May be freed upon return.
+ *	count	The number of elements in "indexes" and "powers".  May be zero.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be:
+ *		    UT_OS	Operating-system error.  See "errno".
+ *	else	The unit.
+ */
+static ut_unit*
+productGet(
+    ut_system* const	system,
+    const short* const	indexes,
+    const short* const	powers,
+    const int		count)
+{
+    return
+	count == 0
+	    ? system->one
+	    : count == 1 && powers[0] == 1
+		? unitRetain((ut_unit*)system->basicUnits[indexes[0]])
+		: (ut_unit*)productNew(system, indexes, powers, count);
+}
+
+
 /*
  * Multiplies a product-unit by another unit.
  *
@@ -1122,9 +1777,10 @@ productMultiply(
 	    result = unit1->common.system->one;
 	}
 	else {
-	    static short*		indexes = NULL;
-
-	    indexes = realloc(indexes, sizeof(short)*sumCount);
+	    short		buffer[2*PRODUCT_BUFFER_SIZE] = {0};
+	    short*		indexes = sumCount <= PRODUCT_BUFFER_SIZE
+		? buffer
+		: calloc(2*(size_t)sumCount, sizeof(short));
 
 	    if (indexes == NULL) {
 		ut_set_status(UT_OS);
@@ -1133,54 +1789,45 @@ productMultiply(
 		    "Couldn't allocate %d-element index array", sumCount);
 	    }
 	    else {
-		static short*	powers = NULL;
-		
-		powers = realloc(powers, sizeof(short)*sumCount);
-
-		if (powers == NULL) {
-		    ut_set_status(UT_OS);
-		    ut_handle_error_message(strerror(errno));
-		    ut_handle_error_message("productMultiply(): "
-			"Couldn't allocate %d-element power array",
-			sumCount);
-		}
-		else {
-		    int				count = 0;
-		    int				i1 = 0;
-		    int				i2 = 0;
-
-		    while (i1 < count1 || i2 < count2) {
-			if (i1 >= count1) {
-			    indexes[count] = indexes2[i2];
-			    powers[count++] = powers2[i2++];
-			}
-			else if (i2 >= count2) {
-			    indexes[count] = indexes1[i1];
-			    powers[count++] = powers1[i1++];
-			}
-			else if (indexes1[i1] > indexes2[i2]) {
-			    indexes[count] = indexes2[i2];
-			    powers[count++] = powers2[i2++];
-			}
-			else if (indexes1[i1] < indexes2[i2]) {
+		short*		powers = indexes + sumCount;
+		int		count = 0;
+		int		i1 = 0;
+		int		i2 = 0;
+
+		while (i1 < count1 || i2 < count2) {
+		    if (i1 >= count1) {
+			indexes[count] = indexes2[i2];
+			powers[count++] = powers2[i2++];
+		    }
+		    else if (i2 >= count2) {
+			indexes[count] = indexes1[i1];
+			powers[count++] = powers1[i1++];
+		    }
+		    else if (indexes1[i1] > indexes2[i2]) {
+			indexes[count] = indexes2[i2];
+			powers[count++] = powers2[i2++];
+		    }
+		    else if (indexes1[i1] < indexes2[i2]) {
+			indexes[count] = indexes1[i1];
+			powers[count++] = powers1[i1++];
+		    }
+		    else {
+			if (powers1[i1] != -powers2[i2]) {
 			    indexes[count] = indexes1[i1];
-			    powers[count++] = powers1[i1++];
+			    powers[count++] = powers1[i1] + powers2[i2];
 			}
-			else {
-			    if (powers1[i1] != -powers2[i2]) {
-				indexes[count] = indexes1[i1];
-				powers[count++] = powers1[i1] + powers2[i2];
-			    }
 
-			    i1++;
-			    i2++;
-			}
+			i1++;
+			i2++;
 		    }
+		}
 
-		    result = (ut_unit*)productNew(unit1->common.system,
-			indexes, powers, count);
-		}			/* "powers" re-allocated */
-	    }				/* "indexes" re-allocated */
+		result = productGet(unit1->common.system, indexes, powers,
+		    count);
+
+		if (indexes != buffer)
+		    free(indexes);
+	    }				/* "indexes" allocated */
 	}				/* "sumCount > 0" */
     }					/* "unit2" is a product-unit */
 
@@ -1208,6 +1855,7 @@ productRaise(
     ut_unit*		result = NULL;	/* failure */
     const ProductUnit*	product;
     int			count;
+    short		buffer[PRODUCT_BUFFER_SIZE];
     short*		newPowers;
 
     assert(unit != NULL);
@@ -1223,7 +1871,9 @@ productRaise(
         result = unit->common.system->one;
     }
     else {
-        newPowers = malloc(sizeof(short)*count);
+        newPowers = count <= PRODUCT_BUFFER_SIZE
+            ? buffer
+            : malloc(sizeof(short)*count);
 
         if (newPowers == NULL) {
             ut_set_status(UT_OS);
@@ -1238,10 +1888,11 @@ productRaise(
             for (i = 0; i < count; i++)
                 newPowers[i] = (short)(oldPowers[i] * power);
 
-            result = (ut_unit*)productNew(unit->common.system,
-                product->indexes, newPowers, count);
+            result = productGet(unit->common.system, product->indexes,
+                newPowers, count);
 
-            free(newPowers);
+            if (newPowers != buffer)
+                free(newPowers);
         }				/* "newPowers" allocated */
     }				        /* "count > 0" */
 
@@ -1269,6 +1920,7 @@ productRoot(
     ut_unit*		result = NULL;	/* failure */
     const ProductUnit*	product;
     int			count;
+    short		buffer[PRODUCT_BUFFER_SIZE];
     short*		newPowers;
 
     assert(unit != NULL);
@@ -1282,7 +1934,9 @@ productRoot(
         result = unit->common.system->one;
     }
     else {
-        newPowers = malloc(sizeof(short)*count);
+        newPowers = count <= PRODUCT_BUFFER_SIZE
+            ? buffer
+            : malloc(sizeof(short)*count);
 
         if (newPowers == NULL) {
             ut_set_status(UT_OS);
@@ -1319,11 +1973,12 @@ productRoot(
                 }
             }
             else {
-                result = (ut_unit*)productNew(unit->common.system,
+                result = productGet(unit->common.system,
                     product->indexes, newPowers, count);
             }
 
-            free(newPowers);
+            if (newPowers != buffer)
+                free(newPowers);
         }				/* "newPowers" allocated */
     }				        /* "count > 0" */
 
@@ -1346,7 +2001,7 @@ productInitConverter(
 {
     assert(converter != NULL);
 
-    *converter = cv_get_trivial();
+    setConverter(converter, cv_get_trivial());
 
     return 0;
 }
@@ -1416,7 +2071,18 @@ productRelationship(
     assert(unit1 != NULL);
     assert(unit2 != NULL);
 
-    {
+    if (unit1 == unit2) {
+	relationship = PRODUCT_EQUAL;
+    }
+    else if (unit1->dimCount != unit2->dimCount ||
+	    (unit1->dimHash != unit2->dimHash &&
+	     unit1->dimHash != unit2->inverseHash)) {
+	relationship = PRODUCT_UNCONVERTIBLE;
+    }
+    else {
+	/*
+	 * The signatures match, so the units are probably convertible.
+	 */
 	const short* const	indexes1 = unit1->indexes;
 	const short* const	indexes2 = unit2->indexes;
 	const short* const	powers1 = unit1->powers;
@@ -1544,6 +2210,47 @@ productAcceptVisitor(
 }
 
 
+static unsigned long
+productHash(
+    const ut_unit* const	unit)
+{
+    const ProductUnit*	product;
+    unsigned long	hash;
+
+    assert(unit != NULL);
+    assert(IS_PRODUCT(unit));
+
+    product = &unit->product;
+    hash = hashBytes(HASH_INIT, &product->count, sizeof(int));
+    hash = hashBytes(hash, product->indexes, sizeof(short)*product->count);
+
+    return hashBytes(hash, product->powers, sizeof(short)*product->count);
+}
+
+
+static int
+productEqual(
+    const ut_unit* const	unit1,
+    const ut_unit* const	unit2)
+{
+    const ProductUnit*	product1;
+    const ProductUnit*	product2;
+    size_t		nbytes;
+
+    assert(IS_PRODUCT(unit1));
+    assert(IS_PRODUCT(unit2));
+
+    product1 = &unit1->product;
+    product2 = &unit2->product;
+    nbytes = sizeof(short)*product1->count;
+
+    return product1->count == product2->count &&
+	(nbytes == 0 || (
+	    memcmp(product1->indexes, product2->indexes, nbytes) == 0 &&
+	    memcmp(product1->powers, product2->powers, nbytes) == 0));
+}
+
+
 static UnitOps	productOps = {
     productGetProduct,
     productClone,
@@ -1554,7 +2261,9 @@ static UnitOps	productOps = {
     productRoot,
     productInitConverterToProduct,
     productInitConverterFromProduct,
-    productAcceptVisitor
+    productAcceptVisitor,
+    productHash,
+    productEqual
 };
 
 
@@ -1571,27 +2280,10 @@ static int
 productIsDimensionless(
     const ProductUnit* const	unit)
 {
-    int			isDimensionless = 1;
-    int			count;
-    const short*	indexes;
-    ut_system*		system;
-    int			i;
-
     assert(unit != NULL);
     assert(IS_PRODUCT(unit));
 
-    count = unit->count;
-    indexes = unit->indexes;
-    system = unit->common.system;
-
-    for (i = 0; i < count; ++i) {
-	if (!system->basicUnits[indexes[i]]->isDimensionless) {
-	    isDimensionless = 0;
-	    break;
-	}
-    }
-
-    return isDimensionless;
+    return unit->dimCount == 0;
 }
 
 
@@ -1614,7 +2306,7 @@ static UnitOps	galileanOps;
  * Returns:
  *	NULL	Failure.  "ut_get_status()" will be:
  *		    UT_OS	Operating-system error.  See "errno".
- *	else	The newly-allocated, galilean-unit.
+ *	else	The galilean-unit.
  */
 static ut_unit*
 galileanNew(
@@ -1622,7 +2314,9 @@ galileanNew(
     const ut_unit*	unit,
     double		offset)
 {
-    ut_unit*	newUnit = NULL;	/* failure */
+    ut_unit*		newUnit = NULL;	/* failure */
+    GalileanUnit	key;
+    unsigned long	hash;
 
     assert(scale != 0);
     assert(unit != NULL);
@@ -1637,32 +2331,49 @@ galileanNew(
 	newUnit = CLONE(unit);
     }
     else {
-	GalileanUnit*	galileanUnit = malloc(sizeof(GalileanUnit));
-
-	if (galileanUnit == NULL) {
-	    ut_set_status(UT_OS);
-	    ut_handle_error_message("galileanNew(): "
-		"Couldn't allocate %lu-byte Galilean unit",
-		sizeof(GalileanUnit));
-	}
-	else {
-	    int	error = 1;
-
-	    if (commonInit(&galileanUnit->common, &galileanOps,
-		    unit->common.system, GALILEAN) == 0) {
-		galileanUnit->scale = scale;
-		galileanUnit->offset = offset;
-		galileanUnit->unit = CLONE(unit);
-		error = 0;
+	(void)commonInit(&key.common, &galileanOps, unit->common.system,
+	    GALILEAN);
+	key.scale = scale;
+	key.offset = offset;
+	key.unit = (ut_unit*)unit;
+	hash = HASH((ut_unit*)&key);
+	newUnit = unitLookup((ut_unit*)&key, hash);
+
+	if (newUnit == NULL) {
+	    GalileanUnit*	galileanUnit = unitAlloc(unit->common.system,
+		GALILEAN, sizeof(GalileanUnit));
+
+	    if (galileanUnit == NULL) {
+		ut_set_status(UT_OS);
+		ut_handle_error_message("galileanNew(): "
+		    "Couldn't allocate %lu-byte Galilean unit",
+		    sizeof(GalileanUnit));
 	    }
+	    else {
+		int	error = 1;
+
+		if (commonInit(&galileanUnit->common, &galileanOps,
+			unit->common.system, GALILEAN) == 0) {
+		    galileanUnit->scale = scale;
+		    galileanUnit->offset = offset;
+		    galileanUnit->unit = CLONE(unit);
+		    newUnit = unitAdd((ut_unit*)galileanUnit, hash);
+		    error = 0;
 
-	    if (error) {
-		free(galileanUnit);
-		galileanUnit = NULL;
-	    }
-	}				/* "galileanUnit" allocated */
+		    if (newUnit != NULL) {
+			/* Another thread added an equal Galilean unit */
+			FREE(galileanUnit->unit);
+			unitDealloc((ut_unit*)galileanUnit);
+		    }
+		    else {
+			newUnit = (ut_unit*)galileanUnit;
+		    }
+		}
 
-	newUnit = (ut_unit*)galileanUnit;
+		if (error)
+		    unitDealloc((ut_unit*)galileanUnit);
+	    }				/* "galileanUnit" allocated */
+	}				/* new Galilean unit */
     }					/* Galilean unit necessary */
 
     return newUnit;
@@ -1684,15 +2395,10 @@ static ut_unit*
 galileanClone(
     const ut_unit* const	unit)
 {
-    const GalileanUnit*	galileanUnit;
-
     assert(unit != NULL);
     assert(IS_GALILEAN(unit));
 
-    galileanUnit = &unit->galilean;
-
-    return galileanNew(galileanUnit->scale, galileanUnit->unit,
-	galileanUnit->offset);
+    return unitRetain(unit);
 }
 
 
@@ -1745,12 +2451,15 @@ galileanFree(
 {
     if (unit != NULL) {
 	assert(IS_GALILEAN(unit));
-	FREE(unit->galilean.unit);
-	cv_free(unit->common.toProduct);
-	unit->common.toProduct = NULL;
-	cv_free(unit->common.fromProduct);
-	unit->common.fromProduct = NULL;
-	free((void*)unit);
+
+	if (unitRelease(unit)) {
+	    FREE(unit->galilean.unit);
+	    cv_free(unit->common.toProduct);
+	    unit->common.toProduct = NULL;
+	    cv_free(unit->common.fromProduct);
+	    unit->common.fromProduct = NULL;
+	    unitDealloc((ut_unit*)unit);
+	}
     }
 }
 
@@ -1921,18 +2630,17 @@ galileanInitConverterToProduct(
     }
     else {
 	if (ENSURE_CONVERTER_TO_PRODUCT(unit->galilean.unit)) {
-	    assert(unit->common.toProduct == NULL);
-
-	    unit->common.toProduct = cv_combine(
-		toUnderlying, unit->galilean.unit->common.toProduct);
+	    cv_converter*	toProduct = cv_combine(toUnderlying,
+		UT_LOAD_POINTER(unit->galilean.unit->common.toProduct));
 
-	    if (unit->common.toProduct == NULL) {
+	    if (toProduct == NULL) {
 		ut_set_status(UT_OS);
 		ut_handle_error_message(strerror(errno));
 		ut_handle_error_message("galileanInitConverterToProduct(): "
 		    "Couldn't combine converters");
 	    }
 	    else {
+		setConverter(&unit->common.toProduct, toProduct);
 		retCode = 0;
 	    }
 	}
@@ -1976,18 +2684,18 @@ galileanInitConverterFromProduct(
     }
     else {
 	if (ENSURE_CONVERTER_FROM_PRODUCT(unit->galilean.unit)) {
-	    assert(unit->common.fromProduct == NULL);
+	    cv_converter*	fromProduct = cv_combine(
+		UT_LOAD_POINTER(unit->galilean.unit->common.fromProduct),
+		fromUnderlying);
 
-	    unit->common.fromProduct = cv_combine(
-		unit->galilean.unit->common.fromProduct, fromUnderlying);
-
-	    if (unit->common.fromProduct == NULL) {
+	    if (fromProduct == NULL) {
 		ut_set_status(UT_OS);
 		ut_handle_error_message(strerror(errno));
 		ut_handle_error_message("galileanInitConverterFromProduct(): "
 		    "Couldn't combine converters");
 	    }
 	    else {
+		setConverter(&unit->common.fromProduct, fromProduct);
 		retCode = 0;
 	    }
 	}
@@ -2014,6 +2722,32 @@ galileanAcceptVisitor(
 }
 
 
+static unsigned long
+galileanHash(
+    const ut_unit* const	unit)
+{
+    assert(unit != NULL);
+    assert(IS_GALILEAN(unit));
+
+    return hashUnit(hashDouble(hashDouble(HASH_INIT, unit->galilean.scale),
+	unit->galilean.offset), unit->galilean.unit);
+}
+
+
+static int
+galileanEqual(
+    const ut_unit* const	unit1,
+    const ut_unit* const	unit2)
+{
+    assert(IS_GALILEAN(unit1));
+    assert(IS_GALILEAN(unit2));
+
+    return unit1->galilean.scale == unit2->galilean.scale &&
+	unit1->galilean.offset == unit2->galilean.offset &&
+	unit1->galilean.unit == unit2->galilean.unit;
+}
+
+
 static UnitOps	galileanOps = {
     galileanGetProduct,
     galileanClone,
@@ -2024,7 +2758,9 @@ static UnitOps	galileanOps = {
     galileanRoot,
     galileanInitConverterToProduct,
     galileanInitConverterFromProduct,
-    galileanAcceptVisitor
+    galileanAcceptVisitor,
+    galileanHash,
+    galileanEqual
 };
 
 
@@ -2049,15 +2785,17 @@ static UnitOps	timestampOps;
  *					"unit" is not meaningful.
  *		    UT_NO_SECOND	The associated unit-system doesn't
  *					contain a second unit.
- *	else	The newly-allocated, timestamp-unit.
+ *	else	The timestamp-unit.
  */
 static ut_unit*
 timestampNewOrigin(
     const ut_unit*	unit,
     const double	origin)
 {
-    ut_unit*    newUnit = NULL;         /* failure */
-    ut_unit*    secondUnit;
+    ut_unit*		newUnit = NULL;         /* failure */
+    ut_unit*		secondUnit;
+    TimestampUnit	key;
+    unsigned long	hash;
 
     assert(unit != NULL);
     assert(!IS_TIMESTAMP(unit));
@@ -2070,28 +2808,60 @@ timestampNewOrigin(
 	    "No \"second\" unit defined");
     }
     else if (ut_are_convertible(secondUnit, unit)) {
-	TimestampUnit*	timestampUnit = malloc(sizeof(TimestampUnit));
-
-	if (timestampUnit == NULL) {
-	    ut_set_status(UT_OS);
-	    ut_handle_error_message(strerror(errno));
-	    ut_handle_error_message("timestampNewOrigin(): "
-		"Couldn't allocate %lu-byte timestamp-unit",
-		sizeof(TimestampUnit));
-	}
-	else {
-	    if (commonInit(&timestampUnit->common, &timestampOps,
-		    unit->common.system, TIMESTAMP) == 0) {
-		timestampUnit->origin = origin;
-		timestampUnit->unit = CLONE(unit);
+	(void)commonInit(&key.common, &timestampOps, unit->common.system,
+	    TIMESTAMP);
+	key.origin = origin;
+	key.unit = (ut_unit*)unit;
+	hash = HASH((ut_unit*)&key);
+	newUnit = unitLookup((ut_unit*)&key, hash);
+
+	if (newUnit == NULL) {
+	    TimestampUnit*	timestampUnit = unitAlloc(unit->common.system,
+		TIMESTAMP, sizeof(TimestampUnit));
+
+	    if (timestampUnit == NULL) {
+		ut_set_status(UT_OS);
+		ut_handle_error_message(strerror(errno));
+		ut_handle_error_message("timestampNewOrigin(): "
+		    "Couldn't allocate %lu-byte timestamp-unit",
+		    sizeof(TimestampUnit));
 	    }
 	    else {
-		free(timestampUnit);
-		timestampUnit = NULL;
-	    }
-	}			/* "timestampUnit" allocated */
+		int	error = 1;
+
+		if (commonInit(&timestampUnit->common, &timestampOps,
+			unit->common.system, TIMESTAMP) == 0) {
+		    cv_converter*	toSeconds =
+			getConverter((ut_unit*)unit, secondUnit);
+
+		    if (toSeconds != NULL) {
+			/*
+			 * Conversion between timestamp-units is a single
+			 * Galilean conversion if conversion to seconds is.
+			 */
+			timestampUnit->isGalilean = cvGetGalilean(toSeconds,
+			    &timestampUnit->slope, &timestampUnit->intercept);
+			cv_free(toSeconds);
+			timestampUnit->origin = origin;
+			timestampUnit->unit = CLONE(unit);
+			newUnit = unitAdd((ut_unit*)timestampUnit, hash);
+			error = 0;
+
+			if (newUnit != NULL) {
+			    /* Another thread added an equal timestamp-unit */
+			    FREE(timestampUnit->unit);
+			    unitDealloc((ut_unit*)timestampUnit);
+			}
+			else {
+			    newUnit = (ut_unit*)timestampUnit;
+			}
+		    }
+		}
 
-	newUnit = (ut_unit*)timestampUnit;
+		if (error)
+		    unitDealloc((ut_unit*)timestampUnit);
+	    }			/* "timestampUnit" allocated */
+	}			/* new timestamp-unit */
     }				/* "secondUnit != NULL" && time unit */
 
     return newUnit;
@@ -2155,7 +2925,7 @@ timestampClone(
     assert(unit != NULL);
     assert(IS_TIMESTAMP(unit));
 
-    return timestampNewOrigin(unit->timestamp.unit, unit->timestamp.origin);
+    return unitRetain(unit);
 }
 
 
@@ -2200,13 +2970,16 @@ timestampFree(
 {
     if (unit != NULL) {
 	assert(IS_TIMESTAMP(unit));
-	FREE(unit->timestamp.unit);
-	unit->timestamp.unit = NULL;
-	cv_free(unit->common.toProduct);
-	unit->common.toProduct = NULL;
-	cv_free(unit->common.fromProduct);
-	unit->common.fromProduct = NULL;
-	free((void*)unit);
+
+	if (unitRelease(unit)) {
+	    FREE(unit->timestamp.unit);
+	    unit->timestamp.unit = NULL;
+	    cv_free(unit->common.toProduct);
+	    unit->common.toProduct = NULL;
+	    cv_free(unit->common.fromProduct);
+	    unit->common.fromProduct = NULL;
+	    unitDealloc((ut_unit*)unit);
+	}
     }
 }
 
@@ -2348,6 +3121,31 @@ timestampAcceptVisitor(
 }
 
 
+static unsigned long
+timestampHash(
+    const ut_unit* const	unit)
+{
+    assert(unit != NULL);
+    assert(IS_TIMESTAMP(unit));
+
+    return hashUnit(hashDouble(HASH_INIT, unit->timestamp.origin),
+	unit->timestamp.unit);
+}
+
+
+static int
+timestampEqual(
+    const ut_unit* const	unit1,
+    const ut_unit* const	unit2)
+{
+    assert(IS_TIMESTAMP(unit1));
+    assert(IS_TIMESTAMP(unit2));
+
+    return unit1->timestamp.origin == unit2->timestamp.origin &&
+	unit1->timestamp.unit == unit2->timestamp.unit;
+}
+
+
 static UnitOps	timestampOps = {
     timestampGetProduct,
     timestampClone,
@@ -2358,7 +3156,9 @@ static UnitOps	timestampOps = {
     timestampRoot,
     timestampInitConverterToProduct,
     timestampInitConverterFromProduct,
-    timestampAcceptVisitor
+    timestampAcceptVisitor,
+    timestampHash,
+    timestampEqual
 };
 
 
@@ -2380,44 +3180,65 @@ static UnitOps	logOps;
  * Returns:
  *	NULL	Failure.  "ut_get_status()" will be:
  *		    UT_OS	Operating-system error.  See "errno".
- *	else	The newly-allocated, logarithmic-unit.
+ *	else	The logarithmic-unit.
  */
 static ut_unit*
 logNew(
     const double		base,
     const ut_unit* const	reference)
 {
-    LogUnit*	logUnit;
+    LogUnit*		logUnit;
+    LogUnit		key;
+    unsigned long	hash;
 
     assert(base > 1);
     assert(reference != NULL);
 
-    logUnit = malloc(sizeof(LogUnit));
+    (void)commonInit(&key.common, &logOps, reference->common.system, LOG);
+    key.base = base;
+    key.reference = (ut_unit*)reference;
+    hash = HASH((ut_unit*)&key);
+    logUnit = (LogUnit*)unitLookup((ut_unit*)&key, hash);
 
     if (logUnit == NULL) {
-	ut_set_status(UT_OS);
-	ut_handle_error_message(strerror(errno));
-	ut_handle_error_message(
-	    "logNew(): Couldn't allocate %lu-byte logarithmic-unit",
-	    sizeof(LogUnit));
-    }
-    else {
-	if (commonInit(&logUnit->common, &logOps, reference->common.system,
-		LOG) != 0) {
-	    free(logUnit);
+	logUnit = unitAlloc(reference->common.system, LOG, sizeof(LogUnit));
+
+	if (logUnit == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"logNew(): Couldn't allocate %lu-byte logarithmic-unit",
+		sizeof(LogUnit));
 	}
 	else {
-	    logUnit->reference = CLONE(reference);
-
-	    if (logUnit->reference != NULL) {
-		logUnit->base = base;
+	    if (commonInit(&logUnit->common, &logOps,
+		    reference->common.system, LOG) != 0) {
+		unitDealloc((ut_unit*)logUnit);
+		logUnit = NULL;
 	    }
 	    else {
-		free(logUnit);
-		logUnit = NULL;
+		logUnit->reference = CLONE(reference);
+
+		if (logUnit->reference != NULL) {
+		    LogUnit*	existing;
+
+		    logUnit->base = base;
+		    existing = (LogUnit*)unitAdd((ut_unit*)logUnit, hash);
+
+		    if (existing != NULL) {
+			/* Another thread added an equal logarithmic-unit */
+			FREE(logUnit->reference);
+			unitDealloc((ut_unit*)logUnit);
+			logUnit = existing;
+		    }
+		}
+		else {
+		    unitDealloc((ut_unit*)logUnit);
+		    logUnit = NULL;
+		}
 	    }
-	}
-    }
+	}				/* "logUnit" allocated */
+    }					/* new logarithmic-unit */
 
     return (ut_unit*)logUnit;
 }
@@ -2441,7 +3262,7 @@ logClone(
     assert(unit != NULL);
     assert(IS_LOG(unit));
 
-    return logNew(unit->log.base, unit->log.reference);
+    return unitRetain(unit);
 }
 
 
@@ -2486,13 +3307,16 @@ logFree(
 {
     if (unit != NULL) {
 	assert(IS_LOG(unit));
-	FREE(unit->log.reference);
-	unit->log.reference = NULL;
-	cv_free(unit->common.toProduct);
-	unit->common.toProduct = NULL;
-	cv_free(unit->common.fromProduct);
-	unit->common.fromProduct = NULL;
-	free((void*)unit);
+
+	if (unitRelease(unit)) {
+	    FREE(unit->log.reference);
+	    unit->log.reference = NULL;
+	    cv_free(unit->common.toProduct);
+	    unit->common.toProduct = NULL;
+	    cv_free(unit->common.fromProduct);
+	    unit->common.fromProduct = NULL;
+	    unitDealloc((ut_unit*)unit);
+	}
     }
 }
 
@@ -2635,18 +3459,17 @@ logInitConverterToProduct(
     }
     else {
 	if (ENSURE_CONVERTER_TO_PRODUCT(unit->log.reference)) {
-	    assert(unit->common.toProduct == NULL);
-
-	    unit->common.toProduct = cv_combine(
-		toUnderlying, unit->log.reference->common.toProduct);
+	    cv_converter*	toProduct = cv_combine(toUnderlying,
+		UT_LOAD_POINTER(unit->log.reference->common.toProduct));
 
-	    if (unit->common.toProduct == NULL) {
+	    if (toProduct == NULL) {
 		ut_set_status(UT_OS);
 		ut_handle_error_message(strerror(errno));
 		ut_handle_error_message("logInitConverterToProduct(): "
 		    "Couldn't combine converters");
 	    }
 	    else {
+		setConverter(&unit->common.toProduct, toProduct);
 		retCode = 0;
 	    }
 	}
@@ -2689,18 +3512,18 @@ logInitConverterFromProduct(
     }
     else {
 	if (ENSURE_CONVERTER_FROM_PRODUCT(unit->log.reference)) {
-	    assert(unit->common.fromProduct == NULL);
+	    cv_converter*	fromProduct = cv_combine(
+		UT_LOAD_POINTER(unit->log.reference->common.fromProduct),
+		fromUnderlying);
 
-	    unit->common.fromProduct = cv_combine(
-		unit->log.reference->common.fromProduct, fromUnderlying);
-
-	    if (unit->common.fromProduct == NULL) {
+	    if (fromProduct == NULL) {
 		ut_set_status(UT_OS);
 		ut_handle_error_message(strerror(errno));
 		ut_handle_error_message("logInitConverterFromProduct(): "
 		    "Couldn't combine converters");
 	    }
 	    else {
+		setConverter(&unit->common.fromProduct, fromProduct);
 		retCode = 0;
 	    }
 	}
@@ -2727,6 +3550,30 @@ logAcceptVisitor(
 }
 
 
+static unsigned long
+logHash(
+    const ut_unit* const	unit)
+{
+    assert(unit != NULL);
+    assert(IS_LOG(unit));
+
+    return hashUnit(hashDouble(HASH_INIT, unit->log.base), unit->log.reference);
+}
+
+
+static int
+logEqual(
+    const ut_unit* const	unit1,
+    const ut_unit* const	unit2)
+{
+    assert(IS_LOG(unit1));
+    assert(IS_LOG(unit2));
+
+    return unit1->log.base == unit2->log.base &&
+	unit1->log.reference == unit2->log.reference;
+}
+
+
 static UnitOps	logOps = {
     logGetProduct,
     logClone,
@@ -2737,7 +3584,9 @@ static UnitOps	logOps = {
     logRoot,
     logInitConverterToProduct,
     logInitConverterFromProduct,
-    logAcceptVisitor
+    logAcceptVisitor,
+    logHash,
+    logEqual
 };
 
 
@@ -2773,15 +3622,42 @@ ut_new_system(void)
 	system->second = NULL;
 	system->basicUnits = NULL;
 	system->basicCount = 0;
-
-	system->one = (ut_unit*)productNew(system, NULL, NULL, 0);
-
-	if (ut_get_status() != UT_SUCCESS) {
+	system->bucketCount = UNIT_TABLE_SIZE;
+	system->unitCount = 0;
+	system->unitLock = 0;
+	system->cache = NULL;
+	system->cacheLock = 0;
+	system->fixedCache = NULL;
+	system->arenaBlocks = NULL;
+	system->arenaNext = NULL;
+	system->arenaEnd = NULL;
+	(void)memset(system->arenaFree, 0, sizeof(system->arenaFree));
+	system->useArena = 0;
+	system->arenaLock = 0;
+	system->isFrozen = 0;
+	(void)memset(system->tables, 0, sizeof(system->tables));
+	system->buckets = calloc(system->bucketCount, sizeof(ut_unit*));
+
+	if (system->buckets == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
 	    ut_handle_error_message(
-		"ut_new_system(): Couldn't create dimensionless unit one");
+		"ut_new_system(): Couldn't allocate %lu-element unit-table",
+		(unsigned long)system->bucketCount);
 	    free(system);
             system = NULL;
 	}
+	else {
+	    system->one = (ut_unit*)productNew(system, NULL, NULL, 0);
+
+	    if (ut_get_status() != UT_SUCCESS) {
+		ut_handle_error_message(
+		    "ut_new_system(): Couldn't create dimensionless unit one");
+		free(system->buckets);
+		free(system);
+		system = NULL;
+	    }
+	}
     }
 
     return system;
@@ -2789,7 +3665,8 @@ ut_new_system(void)
 
 
 /*
- * Frees resources associated with a unit-system by this module.
+ * Frees resources associated with a unit-system by this module.  All units of
+ * the unit-system are freed -- including any that the client hasn't freed.
  *
  * Arguments:
  *	system		Pointer to the unit-system.
@@ -2799,24 +3676,219 @@ coreFreeSystem(
     ut_system*	system)
 {
     if (system != NULL) {
-	int	i;
+	size_t	i;
 
-	for (i = 0; i < system->basicCount; ++i)
-	    basicFree((ut_unit*)system->basicUnits[i]);
+	if (system->cache != NULL) {
+	    for (i = 0; i < CACHE_SETS*CACHE_WAYS; ++i)
+		cv_free(system->cache[i].converter);
 
-	free(system->basicUnits);
+	    free(system->cache);
+	}
+
+	if (system->fixedCache != NULL) {
+	    for (i = 0; i < CACHE_SETS*CACHE_WAYS; ++i) {
+		if (system->fixedCache[i] != NULL) {
+		    cv_free(system->fixedCache[i]->converter);
+		    free(system->fixedCache[i]);
+		}
+	    }
+
+	    free(system->fixedCache);
+	}
+
+	/*
+	 * Because every unit is in the table, the units are freed
+	 * individually rather than by releasing the units they refer to.
+	 * Units in the arena are freed with it, but they're still visited
+	 * because their converters to and from their product-units and the
+	 * dimensions of large product-units are allocated separately.
+	 */
+	for (i = 0; i < system->bucketCount; ++i) {
+	    ut_unit*	unit = system->buckets[i];
+
+	    while (unit != NULL) {
+		ut_unit*	next = unit->common.next;
+
+		cv_free(unit->common.toProduct);
+		cv_free(unit->common.fromProduct);
+
+		if (IS_PRODUCT(unit))
+		    productFreeArrays(&unit->product);
+
+		if (!unit->common.inArena)
+		    free(unit);
+
+		unit = next;
+	    }
+	}
 
-	if (system->second != NULL)
-	    FREE(system->second);
+	while (system->arenaBlocks != NULL) {
+	    ArenaBlock*	next = system->arenaBlocks->next;
 
-	if (system->one != NULL)
-	    productReallyFree(system->one);
+	    free(system->arenaBlocks);
+	    system->arenaBlocks = next;
+	}
 
+	free(system->buckets);
+	free(system->basicUnits);
 	free(system);
     }
 }
 
 
+/*
+ * Sets whether or not the new units of a unit-system are allocated from the
+ * unit-system's arena.  Units in the arena are allocated contiguously, and
+ * the arena is released as a whole by "ut_free_system()".  Freed units in the
+ * arena are reused by new units in the arena.  Arena mode is initially off.
+ * This function modifies the unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ *	enable	Whether or not to allocate new units from the arena.
+ * Returns:
+ *	0	Arena mode was off or "system" is NULL.  "ut_get_status()"
+ *		will be:
+ *		    UT_BAD_ARG	"system" is NULL.
+ *		    UT_SUCCESS	Success.
+ *	1	Arena mode was on.  "ut_get_status()" will be UT_SUCCESS.
+ */
+int
+ut_set_arena(
+    ut_system* const	system,
+    const int		enable)
+{
+    int		wasEnabled = 0;
+
+    if (system == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("ut_set_arena(): NULL unit-system argument");
+    }
+    else {
+	ut_set_status(UT_SUCCESS);
+	wasEnabled = system->useArena;
+	system->useArena = enable != 0;
+    }
+
+    return wasEnabled;
+}
+
+
+/*
+ * Freezes a unit-system.  The converters of every unit of the unit-system to
+ * and from its product-unit are computed, the units become permanent (cloning
+ * and freeing them no longer changes them), and functions that would modify
+ * the unit-system (e.g., "ut_new_base_unit()", "ut_map_name_to_unit()",
+ * "ut_add_name_prefix()") fail with status UT_BAD_ARG.  Consequently, lookups
+ * and other read-only operations on the existing units don't write to them.
+ * "ut_get_converter()" reads cached converters without locking (see
+ * "fixedCacheGet()") but still counts the reference to the converter it
+ * returns.  New units may still be created from the existing ones.  The units
+ * are freed by "ut_free_system()".  This function modifies the unit-system.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.
+ * Returns:
+ *	UT_SUCCESS	Success.  The unit-system is frozen.
+ *	UT_BAD_ARG	"system" is NULL.
+ *	UT_OS		Operating-system error.  See "errno".  The unit-system
+ *			isn't frozen.
+ */
+ut_status
+ut_freeze_system(
+    ut_system* const	system)
+{
+    ut_set_status(UT_SUCCESS);
+
+    if (system == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("ut_freeze_system(): NULL unit-system argument");
+    }
+    else if (!system->isFrozen) {
+	size_t	i;
+
+	for (i = 0; i < system->bucketCount && ut_get_status() == UT_SUCCESS;
+		++i) {
+	    ut_unit*	unit;
+
+	    for (unit = system->buckets[i]; unit != NULL;
+		    unit = unit->common.next) {
+		if (!IS_TIMESTAMP(unit) &&
+			!(ENSURE_CONVERTER_TO_PRODUCT(unit) &&
+			  ENSURE_CONVERTER_FROM_PRODUCT(unit))) {
+		    ut_handle_error_message("ut_freeze_system(): "
+			"Couldn't compute converters of unit");
+		    break;
+		}
+	    }
+	}
+
+	if (ut_get_status() == UT_SUCCESS) {
+	    system->fixedCache =
+		calloc(CACHE_SETS*CACHE_WAYS, sizeof(CacheEntry*));
+
+	    if (system->fixedCache == NULL) {
+		ut_set_status(UT_OS);
+		ut_handle_error_message(strerror(errno));
+		ut_handle_error_message("ut_freeze_system(): "
+		    "Couldn't allocate converter cache");
+	    }
+	}
+
+	if (ut_get_status() == UT_SUCCESS) {
+	    for (i = 0; i < system->bucketCount; ++i) {
+		ut_unit*	unit;
+
+		for (unit = system->buckets[i]; unit != NULL;
+			unit = unit->common.next)
+		    unit->common.refCount = 0;
+	    }
+
+	    system->isFrozen = 1;
+	}
+    }
+
+    return ut_get_status();
+}
+
+
+/*
+ * Indicates if a unit-system is frozen.  For use by the other modules of the
+ * library.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.  Mustn't be NULL.
+ * Returns:
+ *	0	The unit-system isn't frozen.
+ *	1	The unit-system is frozen.  See "ut_freeze_system()".
+ */
+int
+coreIsFrozen(
+    const ut_system* const	system)
+{
+    return system->isFrozen;
+}
+
+
+/*
+ * Returns the address of the pointer to a lookup table of a unit-system.  For
+ * use by the other modules of the library.
+ *
+ * Arguments:
+ *	system	Pointer to the unit-system.  Mustn't be NULL.
+ *	table	The lookup table.
+ * Returns:
+ *	Address of the pointer to the table.
+ */
+void**
+coreGetTable(
+    const ut_system* const	system,
+    const SystemTable		table)
+{
+    return ((ut_system*)system)->tables + table;
+}
+
+
 /*
  * Returns the dimensionless-unit one of a unit-system.
  *
@@ -2941,6 +4013,10 @@ newBasicUnit(
 	ut_set_status(UT_BAD_ARG);
 	ut_handle_error_message("newBasicUnit(): NULL unit-system argument");
     }
+    else if (system->isFrozen) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("newBasicUnit(): Unit-system is frozen");
+    }
     else {
 	basicUnit = basicNew(system, isDimensionless, system->basicCount);
 
@@ -3058,6 +4134,10 @@ ut_set_second(
 	ut_handle_error_message(
             "ut_set_second(): NULL \"second\" unit argument");
     }
+    else if (second->common.system->isFrozen) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("ut_set_second(): Unit-system is frozen");
+    }
     else {
 	ut_system*	system = second->common.system;
 
@@ -3082,7 +4162,8 @@ ut_set_second(
  * Compares two units.  Returns a value less than, equal to, or greater than
  * zero as the first unit is considered less than, equal to, or greater than
  * the second unit, respectively.  Units from different unit-systems never
- * compare equal.
+ * compare equal.  Equal units of a unit-system are identical (i.e., have the
+ * same address).
  *
  * Arguments:
  *	unit1		Pointer to a unit or NULL.
@@ -3107,6 +4188,13 @@ ut_compare(
     else if (unit2 == NULL) {
 	cmp = 1;
     }
+    else if (unit1 == unit2) {
+	/*
+	 * Because units are unique, this is the only way that they can be
+	 * equal.
+	 */
+	cmp = 0;
+    }
     else if (unit1->common.system < unit2->common.system) {
 	cmp = -1;
     }
@@ -3524,212 +4612,955 @@ ut_log(
 
 
 /*
- * Indicates if numeric values in one unit are convertible to numeric values in
- * another unit via "ut_get_converter()".  In making this determination, 
- * dimensionless units are ignored.
+ * Multiplies the basic-units of a product builder by a basic-unit raised to a
+ * power.  The indexes of the builder remain sorted and a basic-unit whose power
+ * becomes zero is removed.
  *
  * Arguments:
- *	unit1		Pointer to a unit.
- *	unit2		Pointer to another unit.
+ *	builder	The product builder.
+ *	index	The index of the basic-unit.
+ *	power	The power.  Must not be zero.
  * Returns:
- *	0		Failure.  "ut_get_status()" will be
- *	    		    UT_BAD_ARG		"unit1" or "unit2" is NULL.
- *			    UT_NOT_SAME_SYSTEM	"unit1" and "unit2" belong to
- *						different unit-sytems.
- *			    UT_SUCCESS		Conversion between the units is
- *						not possible (e.g., "unit1" is
- *						"meter" and "unit2" is
- *						"kilogram").
- *	else	Numeric values can be converted between the units.
+ *	-1	The builder is full and doesn't contain the basic-unit.
+ *	 0	Success.
  */
-int
-ut_are_convertible(
-    const ut_unit* const	unit1,
-    const ut_unit* const	unit2)
+static int
+builderAddPower(
+    ut_product_builder* const	builder,
+    const short			index,
+    const short			power)
 {
-    int			areConvertible = 0;
+    short* const	indexes = builder->indexes;
+    short* const	powers = builder->powers;
+    const int		count = builder->count;
+    int			retCode = 0;	/* success */
+    int			i;
 
-    if (unit1 == NULL || unit2 == NULL) {
-	ut_set_status(UT_BAD_ARG);
-	ut_handle_error_message("ut_are_convertible(): NULL unit argument");
-    }
-    else if (unit1->common.system != unit2->common.system) {
-	ut_set_status(UT_NOT_SAME_SYSTEM);
-	ut_handle_error_message(
-	    "ut_are_convertible(): Units in different unit-systems");
-    }
-    else {
-	ut_set_status(UT_SUCCESS);
+    for (i = 0; i < count && indexes[i] < index; i++)
+	continue;
 
-	if (IS_TIMESTAMP(unit1) || IS_TIMESTAMP(unit2)) {
-	    areConvertible = IS_TIMESTAMP(unit1) && IS_TIMESTAMP(unit2);
-	}
-	else {
-	    ProductRelationship	relationship =
-		productRelationship(GET_PRODUCT(unit1), GET_PRODUCT(unit2));
+    if (i < count && indexes[i] == index) {
+	powers[i] = (short)(powers[i] + power);
 
-	    areConvertible = relationship == PRODUCT_EQUAL ||
-		relationship == PRODUCT_INVERSE;
+	if (powers[i] == 0) {
+	    (void)memmove(indexes + i, indexes + i + 1,
+		sizeof(short)*(count - i - 1));
+	    (void)memmove(powers + i, powers + i + 1,
+		sizeof(short)*(count - i - 1));
+	    builder->count--;
 	}
     }
+    else if (count == UT_PRODUCT_SIZE) {
+	retCode = -1;
+    }
+    else {
+	(void)memmove(indexes + i + 1, indexes + i, sizeof(short)*(count - i));
+	(void)memmove(powers + i + 1, powers + i, sizeof(short)*(count - i));
+	indexes[i] = index;
+	powers[i] = power;
+	builder->count++;
+    }
 
-    return areConvertible;
+    return retCode;
 }
 
 
 /*
- * Returns a converter of numeric values in one unit to numeric values in
- * another unit.  The returned converter should be passed to cv_free() when it
- * is no longer needed by the client.
- *
- * NOTE:  Leap seconds are not taken into account when converting between
- * timestamp units.
+ * Multiplies the other factors of a product builder by a unit.
  *
  * Arguments:
- *	from		Pointer to the unit from which to convert values.
- *	to		Pointer to the unit to which to convert values.
+ *	builder	The product builder.
+ *	unit	The unit.  Upon return, the builder owns it.
  * Returns:
- *	NULL		Failure.  "ut_get_status()" will be:
- *			    UT_BAD_ARG		"from" or "to" is NULL.
- *			    UT_NOT_SAME_SYSTEM	"from" and "to" belong to
- *						different unit-systems.
- *			    UT_MEANINGLESS	Conversion between the units is
- *						not possible.  See
- *						"ut_are_convertible()".
- *	else		Pointer to the appropriate converter.  The pointer
- *			should be passed to cv_free() when no longer needed by
- *			the client.
+ *	-1	Failure.  "ut_get_status()" will be:
+ *		    UT_MEANINGLESS	The operation on the units is
+ *					meaningless.
+ *		    UT_OS		Operating-system error.  See "errno".
+ *	 0	Success.
  */
-cv_converter*
-ut_get_converter(
-    ut_unit* const	from,
-    ut_unit* const	to)
+static int
+builderAddOther(
+    ut_product_builder* const	builder,
+    ut_unit* const		unit)
 {
-    cv_converter*	converter = NULL;	/* failure */
+    int		retCode = 0;		/* success */
 
-    if (from == NULL || to == NULL) {
-	ut_set_status(UT_BAD_ARG);
-	ut_handle_error_message("ut_get_converter(): NULL unit argument");
-    }
-    else if (from->common.system != to->common.system) {
-	ut_set_status(UT_NOT_SAME_SYSTEM);
-	ut_handle_error_message(
-	    "ut_get_converter(): Units in different unit-systems");
+    if (builder->other == NULL) {
+	builder->other = unit;
     }
     else {
-	ut_set_status(UT_SUCCESS);
-
-	if (!IS_TIMESTAMP(from) && !IS_TIMESTAMP(to)) {
-	    ProductRelationship	relationship =
-		productRelationship(GET_PRODUCT(from), GET_PRODUCT(to));
+	ut_unit*	product = MULTIPLY(builder->other, unit);
 
-	    if (relationship == PRODUCT_UNCONVERTIBLE) {
-		ut_set_status(UT_MEANINGLESS);
-		ut_handle_error_message(
-                    "ut_get_converter(): Units not convertible");
-	    }
-	    else if (ENSURE_CONVERTER_TO_PRODUCT(from) &&
-			ENSURE_CONVERTER_FROM_PRODUCT(to)) {
-		if (relationship == PRODUCT_EQUAL) {
-		    converter = cv_combine(
-			from->common.toProduct, to->common.fromProduct);
-		}
-		else {
-		    /*
-		     * The underlying product-units are reciprocals of each
-		     * other.
-		     */
-		    cv_converter*	invert = cv_get_inverse();
+	FREE(builder->other);
+	FREE(unit);
+	builder->other = product;
 
-		    if (invert != NULL) {
-			cv_converter*	phase1 =
-			    cv_combine(from->common.toProduct, invert);
+	if (product == NULL)
+	    retCode = -1;
+    }
 
-			if (phase1 != NULL) {
-			    converter =
-				cv_combine(phase1, to->common.fromProduct);
+    return retCode;
+}
 
-			    cv_free(phase1);
-			}		/* "phase1" allocated */
 
-			cv_free(invert);
-		    }			/* "invert" allocated */
-		}			/* reciprocal product-units */
+/*
+ * Moves the basic-units of a product builder into its other factors so that
+ * more basic-units can be added.
+ *
+ * Arguments:
+ *	builder	The product builder.
+ * Returns:
+ *	-1	Failure.  "ut_get_status()" will be:
+ *		    UT_MEANINGLESS	The operation on the units is
+ *					meaningless.
+ *		    UT_OS		Operating-system error.  See "errno".
+ *	 0	Success.
+ */
+static int
+builderFlush(
+    ut_product_builder* const	builder)
+{
+    int		retCode = -1;		/* failure */
+    ut_unit*	product = productGet(builder->system, builder->indexes,
+	builder->powers, builder->count);
 
-		if (converter == NULL) {
-		    ut_set_status(UT_OS);
-		    ut_handle_error_message(strerror(errno));
-		    ut_handle_error_message(
-			"ut_get_converter(): Couldn't get converter");
-		}
-	    }				/* got necessary product converters */
-	}				/* neither unit is a timestamp */
-	else {
-	    cv_converter*	toSeconds =
-                ut_get_converter(from->timestamp.unit,
-                    from->common.system->second);
+    if (product != NULL) {
+	builder->count = 0;
+	retCode = builderAddOther(builder, product);
+    }
 
-	    if (toSeconds == NULL) {
-		ut_set_status(UT_OS);
-		ut_handle_error_message(strerror(errno));
-		ut_handle_error_message(
-		    "ut_get_converter(): Couldn't get converter to seconds");
-	    }
-	    else {
-		cv_converter*	shiftOrigin =
-		    cv_get_offset(
-			from->timestamp.origin - to->timestamp.origin);
+    return retCode;
+}
 
-		if (shiftOrigin == NULL) {
-		    ut_set_status(UT_OS);
-		    ut_handle_error_message(strerror(errno));
-		    ut_handle_error_message(
-			"ut_get_converter(): Couldn't get offset-converter");
-		}
-		else {
-		    cv_converter*	toToUnit =
-			cv_combine(toSeconds, shiftOrigin);
 
-		    if (toToUnit == NULL) {
-			ut_set_status(UT_OS);
-			ut_handle_error_message(strerror(errno));
-			ut_handle_error_message(
-			    "ut_get_converter(): Couldn't combine converters");
-		    }
+/*
+ * Multiplies a product builder by a unit raised to a power.  The unit is
+ * reduced to a numeric factor and basic-units if possible; any offset or
+ * time-origin is ignored, as in "ut_multiply()".
+ *
+ * Arguments:
+ *	builder	The product builder.
+ *	unit	The unit.
+ *	power	The power.  Must not be zero.
+ * Returns:
+ *	-1	Failure.  "ut_get_status()" will be:
+ *		    UT_MEANINGLESS	The operation on the units is
+ *					meaningless.
+ *		    UT_OS		Operating-system error.  See "errno".
+ *	 0	Success.
+ */
+static int
+builderMultiply(
+    ut_product_builder* const	builder,
+    const ut_unit* const	unit,
+    const int			power)
+{
+    int		retCode = 0;		/* success */
+
+    assert(power != 0);
+
+    if (IS_BASIC(unit)) {
+	if (builderAddPower(builder, (short)unit->basic.index, (short)power)) {
+	    retCode = builderFlush(builder);
+
+	    if (retCode == 0)
+		(void)builderAddPower(builder, (short)unit->basic.index,
+		    (short)power);
+	}
+    }
+    else if (IS_PRODUCT(unit)) {
+	const ProductUnit* const	product = &unit->product;
+	int				i;
+
+	for (i = 0; retCode == 0 && i < product->count; i++) {
+	    const short	index = product->indexes[i];
+	    const short	newPower = (short)(product->powers[i] * power);
+
+	    if (builderAddPower(builder, index, newPower)) {
+		retCode = builderFlush(builder);
+
+		if (retCode == 0)
+		    (void)builderAddPower(builder, index, newPower);
+	    }
+	}
+    }
+    else if (IS_GALILEAN(unit)) {
+	builder->scale *= pow(unit->galilean.scale, power);
+	retCode = builderMultiply(builder, unit->galilean.unit, power);
+    }
+    else if (IS_TIMESTAMP(unit)) {
+	retCode = builderMultiply(builder, unit->timestamp.unit, power);
+    }
+    else {
+	ut_unit*	factor = power == 1
+	    ? CLONE(unit)
+	    : RAISE(unit, power);
+
+	retCode = factor == NULL
+	    ? -1
+	    : builderAddOther(builder, factor);
+    }
+
+    return retCode;
+}
+
+
+/*
+ * Initializes a product builder.  The product is initially the dimensionless
+ * unit one.  The builder accumulates the factors of a product of units so that
+ * only the final unit is created.  It may be allocated by the client (e.g., on
+ * the stack) and must be finished by "ut_finish_product()".
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ *	system	Pointer to the unit-system of the product.
+ * Returns:
+ *	UT_SUCCESS	Success.
+ *	UT_BAD_ARG	"builder" or "system" is NULL.
+ */
+ut_status
+ut_init_product(
+    ut_product_builder* const	builder,
+    ut_system* const		system)
+{
+    ut_set_status(UT_SUCCESS);
+
+    if (builder == NULL || system == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("ut_init_product(): NULL argument");
+
+	if (builder != NULL)
+	    builder->system = NULL;
+    }
+    else {
+	builder->system = system;
+	builder->pending = NULL;
+	builder->other = NULL;
+	builder->scale = 1;
+	builder->status = UT_SUCCESS;
+	builder->factorCount = 0;
+	builder->count = 0;
+    }
+
+    return ut_get_status();
+}
+
+
+/*
+ * Multiplies the product of a product builder by a unit raised to a power.
+ * The first unit that's multiplied with a power of one is kept as is; for the
+ * other units, any offset or time-origin is ignored, as in "ut_multiply()".
+ * A unit raised to the power zero is the dimensionless unit one, so it doesn't
+ * change the product.  After a failure, this function does nothing and returns
+ * the status of the failure.
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ *	unit	Pointer to the unit.  May be freed upon return.
+ *	power	The power to which to raise "unit".  Must be greater than or
+ *		equal to -255 and less than or equal to 255.
+ * Returns:
+ *	UT_SUCCESS		Success.
+ *	UT_BAD_ARG		"builder" isn't initialized, "unit" is NULL,
+ *				or "power" is invalid.
+ *	UT_NOT_SAME_SYSTEM	"unit" doesn't belong to the unit-system of
+ *				the builder.
+ *	UT_MEANINGLESS		The operation on the units is meaningless.
+ *	UT_OS			Operating-system error.  See "errno".
+ */
+ut_status
+ut_multiply_product(
+    ut_product_builder* const	builder,
+    const ut_unit* const	unit,
+    const int			power)
+{
+    ut_set_status(UT_SUCCESS);
+
+    if (builder == NULL || builder->system == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message(
+	    "ut_multiply_product(): Uninitialized product builder");
+    }
+    else if (builder->status != UT_SUCCESS) {
+	ut_set_status(builder->status);
+    }
+    else {
+	if (unit == NULL) {
+	    ut_set_status(UT_BAD_ARG);
+	    ut_handle_error_message("ut_multiply_product(): NULL unit argument");
+	}
+	else if (power < -255 || power > 255) {
+	    ut_set_status(UT_BAD_ARG);
+	    ut_handle_error_message(
+		"ut_multiply_product(): Invalid power argument");
+	}
+	else if (unit->common.system != builder->system) {
+	    ut_set_status(UT_NOT_SAME_SYSTEM);
+	    ut_handle_error_message(
+		"ut_multiply_product(): Unit in different unit-system");
+	}
+	else if (power != 0) {
+	    ut_unit*	pending = builder->pending;
+	    int		error = 0;
+
+	    if (pending != NULL) {
+		builder->pending = NULL;
+		error = builderMultiply(builder, pending, 1);
+		FREE(pending);
+	    }
+
+	    if (!error) {
+		if (builder->factorCount == 0 && power == 1) {
+		    builder->pending = CLONE(unit);
+		}
+		else {
+		    (void)builderMultiply(builder, unit, power);
+		}
+	    }
+
+	    builder->factorCount++;
+	}
+
+	builder->status = ut_get_status();
+    }
+
+    return ut_get_status();
+}
+
+
+/*
+ * Multiplies the product of a product builder by a numeric factor.  The factor
+ * is applied to the final product, as in "ut_scale()".  After a failure, this
+ * function does nothing and returns the status of the failure.
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ *	factor	The numeric factor.  Must not be zero.
+ * Returns:
+ *	UT_SUCCESS	Success.
+ *	UT_BAD_ARG	"builder" isn't initialized or "factor" is zero.
+ */
+ut_status
+ut_scale_product(
+    ut_product_builder* const	builder,
+    const double		factor)
+{
+    ut_set_status(UT_SUCCESS);
+
+    if (builder == NULL || builder->system == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message(
+	    "ut_scale_product(): Uninitialized product builder");
+    }
+    else if (builder->status != UT_SUCCESS) {
+	ut_set_status(builder->status);
+    }
+    else {
+	if (factor == 0) {
+	    ut_set_status(UT_BAD_ARG);
+	    ut_handle_error_message("ut_scale_product(): Zero factor argument");
+	}
+	else {
+	    builder->scale *= factor;
+	}
+
+	builder->status = ut_get_status();
+    }
+
+    return ut_get_status();
+}
+
+
+/*
+ * Returns the product of a product builder and releases the resources of the
+ * builder.  The builder must be initialized again before it's reused.  This
+ * function must be called for every initialized builder -- even after a
+ * failure.
+ *
+ * Arguments:
+ *	builder	Pointer to the product builder.
+ * Returns:
+ *	NULL	Failure.  "ut_get_status()" will be:
+ *		    UT_BAD_ARG		"builder" isn't initialized.
+ *		    else		The status of the first failure of
+ *					"ut_multiply_product()" or
+ *					"ut_scale_product()" or one of:
+ *		    UT_MEANINGLESS	The operation on the units is
+ *					meaningless.
+ *		    UT_OS		Operating-system error.  See "errno".
+ *	else	Pointer to the resulting unit.  The pointer should be passed to
+ *		ut_free() when the unit is no longer needed by the client.
+ */
+ut_unit*
+ut_finish_product(
+    ut_product_builder* const	builder)
+{
+    ut_unit*	result = NULL;		/* failure */
+
+    ut_set_status(UT_SUCCESS);
+
+    if (builder == NULL || builder->system == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message(
+	    "ut_finish_product(): Uninitialized product builder");
+    }
+    else {
+	if (builder->status != UT_SUCCESS) {
+	    ut_set_status(builder->status);
+	}
+	else {
+	    ut_unit*	product = builder->pending;
+
+	    if (product != NULL) {
+		builder->pending = NULL;
+	    }
+	    else {
+		product = productGet(builder->system, builder->indexes,
+		    builder->powers, builder->count);
+
+		if (product != NULL && builder->other != NULL) {
+		    ut_unit*	tmp = MULTIPLY(builder->other, product);
+
+		    FREE(product);
+		    product = tmp;
+		}
+	    }
+
+	    if (product != NULL) {
+		if (builder->scale == 1) {
+		    result = product;
+		}
+		else {
+		    result = galileanNew(builder->scale, product, 0);
+
+		    FREE(product);
+		}
+	    }
+	}
+
+	if (builder->pending != NULL)
+	    FREE(builder->pending);
+
+	if (builder->other != NULL)
+	    FREE(builder->other);
+
+	builder->pending = NULL;
+	builder->other = NULL;
+	builder->system = NULL;
+    }
+
+    return result;
+}
+
+
+/*
+ * Indicates if numeric values in one unit are convertible to numeric values in
+ * another unit via "ut_get_converter()".  In making this determination, 
+ * dimensionless units are ignored.
+ *
+ * Arguments:
+ *	unit1		Pointer to a unit.
+ *	unit2		Pointer to another unit.
+ * Returns:
+ *	0		Failure.  "ut_get_status()" will be
+ *	    		    UT_BAD_ARG		"unit1" or "unit2" is NULL.
+ *			    UT_NOT_SAME_SYSTEM	"unit1" and "unit2" belong to
+ *						different unit-sytems.
+ *			    UT_SUCCESS		Conversion between the units is
+ *						not possible (e.g., "unit1" is
+ *						"meter" and "unit2" is
+ *						"kilogram").
+ *	else	Numeric values can be converted between the units.
+ */
+int
+ut_are_convertible(
+    const ut_unit* const	unit1,
+    const ut_unit* const	unit2)
+{
+    int			areConvertible = 0;
+
+    if (unit1 == NULL || unit2 == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("ut_are_convertible(): NULL unit argument");
+    }
+    else if (unit1->common.system != unit2->common.system) {
+	ut_set_status(UT_NOT_SAME_SYSTEM);
+	ut_handle_error_message(
+	    "ut_are_convertible(): Units in different unit-systems");
+    }
+    else {
+	ut_set_status(UT_SUCCESS);
+
+	if (IS_TIMESTAMP(unit1) || IS_TIMESTAMP(unit2)) {
+	    areConvertible = IS_TIMESTAMP(unit1) && IS_TIMESTAMP(unit2);
+	}
+	else {
+	    ProductRelationship	relationship =
+		productRelationship(GET_PRODUCT(unit1), GET_PRODUCT(unit2));
+
+	    areConvertible = relationship == PRODUCT_EQUAL ||
+		relationship == PRODUCT_INVERSE;
+	}
+    }
+
+    return areConvertible;
+}
+
+
+/*
+ * Returns a new converter of numeric values in one unit to numeric values in
+ * another unit.
+ *
+ * Arguments:
+ *	from		Pointer to the unit from which to convert values.
+ *	to		Pointer to the unit to which to convert values.  Must be
+ *			in the same unit-system as "from".
+ * Returns:
+ *	NULL		Failure.  "ut_get_status()" will be:
+ *			    UT_MEANINGLESS	Conversion between the units is
+ *						not possible.  See
+ *						"ut_are_convertible()".
+ *			    UT_OS		Operating-system error.  See
+ *						"errno".
+ *	else		Pointer to the converter.
+ */
+static cv_converter*
+getConverter(
+    ut_unit* const	from,
+    ut_unit* const	to)
+{
+    cv_converter*	converter = NULL;	/* failure */
+
+    if (!IS_TIMESTAMP(from) && !IS_TIMESTAMP(to)) {
+	ProductRelationship	relationship =
+	    productRelationship(GET_PRODUCT(from), GET_PRODUCT(to));
+
+	if (relationship == PRODUCT_UNCONVERTIBLE) {
+	    ut_set_status(UT_MEANINGLESS);
+	    ut_handle_error_message(
+		"ut_get_converter(): Units not convertible");
+	}
+	else if (ENSURE_CONVERTER_TO_PRODUCT(from) &&
+		    ENSURE_CONVERTER_FROM_PRODUCT(to)) {
+	    cv_converter* const	toProduct =
+		UT_LOAD_POINTER(from->common.toProduct);
+	    cv_converter* const	fromProduct =
+		UT_LOAD_POINTER(to->common.fromProduct);
+
+	    if (relationship == PRODUCT_EQUAL) {
+		converter = cv_combine(toProduct, fromProduct);
+	    }
+	    else {
+		/*
+		 * The underlying product-units are reciprocals of each
+		 * other.
+		 */
+		cv_converter*	invert = cv_get_inverse();
+
+		if (invert != NULL) {
+		    cv_converter*	phase1 =
+			cv_combine(toProduct, invert);
+
+		    if (phase1 != NULL) {
+			converter =
+			    cv_combine(phase1, fromProduct);
+
+			cv_free(phase1);
+		    }		/* "phase1" allocated */
+
+		    cv_free(invert);
+		}			/* "invert" allocated */
+	    }			/* reciprocal product-units */
+
+	    if (converter == NULL) {
+		ut_set_status(UT_OS);
+		ut_handle_error_message(strerror(errno));
+		ut_handle_error_message(
+		    "ut_get_converter(): Couldn't get converter");
+	    }
+	}				/* got necessary product converters */
+    }				/* neither unit is a timestamp */
+    else if (!IS_TIMESTAMP(from) || !IS_TIMESTAMP(to)) {
+	ut_set_status(UT_MEANINGLESS);
+	ut_handle_error_message("ut_get_converter(): Units not convertible");
+    }
+    else if (from->timestamp.isGalilean && to->timestamp.isGalilean) {
+	/*
+	 * Convert to seconds, shift the origin, and convert from seconds in
+	 * one step.  The origins are subtracted first because they're large.
+	 */
+	const TimestampUnit* const	fromTimestamp = &from->timestamp;
+	const TimestampUnit* const	toTimestamp = &to->timestamp;
+
+	converter = cv_get_galilean(fromTimestamp->slope / toTimestamp->slope,
+	    ((fromTimestamp->origin - toTimestamp->origin) +
+		(fromTimestamp->intercept - toTimestamp->intercept)) /
+		toTimestamp->slope);
+
+	if (converter == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"ut_get_converter(): Couldn't get timestamp converter");
+	}
+    }
+    else {
+	cv_converter*	toSeconds =
+	    ut_get_converter(from->timestamp.unit,
+		from->common.system->second);
+
+	if (toSeconds == NULL) {
+	    ut_set_status(UT_OS);
+	    ut_handle_error_message(strerror(errno));
+	    ut_handle_error_message(
+		"ut_get_converter(): Couldn't get converter to seconds");
+	}
+	else {
+	    cv_converter*	shiftOrigin =
+		cv_get_offset(
+		    from->timestamp.origin - to->timestamp.origin);
+
+	    if (shiftOrigin == NULL) {
+		ut_set_status(UT_OS);
+		ut_handle_error_message(strerror(errno));
+		ut_handle_error_message(
+		    "ut_get_converter(): Couldn't get offset-converter");
+	    }
+	    else {
+		cv_converter*	toToUnit =
+		    cv_combine(toSeconds, shiftOrigin);
+
+		if (toToUnit == NULL) {
+		    ut_set_status(UT_OS);
+		    ut_handle_error_message(strerror(errno));
+		    ut_handle_error_message(
+			"ut_get_converter(): Couldn't combine converters");
+		}
+		else {
+		    cv_converter*	fromSeconds = ut_get_converter(
+			to->common.system->second, to->timestamp.unit); 
+
+		    if (fromSeconds == NULL) {
+			ut_set_status(UT_OS);
+			ut_handle_error_message(strerror(errno));
+			ut_handle_error_message(
+			    "ut_get_converter(): Couldn't get converter "
+			    "from seconds");
+		    }
 		    else {
-			cv_converter*	fromSeconds = ut_get_converter(
-			    to->common.system->second, to->timestamp.unit); 
+			converter = cv_combine(toToUnit, fromSeconds);
 
-			if (fromSeconds == NULL) {
+			if (converter == NULL) {
 			    ut_set_status(UT_OS);
 			    ut_handle_error_message(strerror(errno));
-			    ut_handle_error_message(
-				"ut_get_converter(): Couldn't get converter "
-				"from seconds");
+			    ut_handle_error_message("ut_get_converter(): "
+				"Couldn't combine converters");
 			}
-			else {
-			    converter = cv_combine(toToUnit, fromSeconds);
 
-			    if (converter == NULL) {
-				ut_set_status(UT_OS);
-				ut_handle_error_message(strerror(errno));
-				ut_handle_error_message("ut_get_converter(): "
-				    "Couldn't combine converters");
-			    }
+			cv_free(fromSeconds);
+		    }		/* "fromSeconds" allocated */
 
-			    cv_free(fromSeconds);
-			}		/* "fromSeconds" allocated */
+		    cv_free(toToUnit);
+		}			/* "toToUnit" allocated */
 
-			cv_free(toToUnit);
-		    }			/* "toToUnit" allocated */
+		cv_free(shiftOrigin);
+	    }			/* "shiftOrigin" allocated */
 
-		    cv_free(shiftOrigin);
-		}			/* "shiftOrigin" allocated */
+	    cv_free(toSeconds);
+	}				/* "toSeconds" allocated */
+    }				/* units are timestamps */
 
-		cv_free(toSeconds);
-	    }				/* "toSeconds" allocated */
-	}				/* units are timestamps */
-    }					/* valid arguments */
+    return converter;
+}
+
+
+/*
+ * Returns the converter between two units from the fixed cache of a frozen
+ * unit-system.  Doesn't lock or write to the cache.
+ *
+ * Arguments:
+ *	from		Pointer to the unit from which to convert values.
+ *	to		Pointer to the unit to which to convert values.
+ *	isFull		Pointer to the memory location to receive whether the
+ *			set of the units is full.
+ * Returns:
+ *	NULL		The converter isn't in the fixed cache.
+ *	else		A new reference to the converter.
+ */
+static cv_converter*
+fixedCacheGet(
+    const ut_unit* const	from,
+    const ut_unit* const	to,
+    int* const			isFull)
+{
+    CacheEntry** const	set = from->common.system->fixedCache + CACHE_WAYS *
+	(hashUnit(hashUnit(HASH_INIT, from), to) & (CACHE_SETS - 1));
+    cv_converter*	converter = NULL;
+    int			i;
+
+    *isFull = 1;
+
+    for (i = 0; i < CACHE_WAYS; i++) {
+	const CacheEntry* const	entry = UT_LOAD_POINTER(set[i]);
+
+	if (entry == NULL) {
+	    *isFull = 0;
+	    break;
+	}
+
+	if (entry->from == from && entry->to == to) {
+	    converter = cv_clone(entry->converter);
+	    break;
+	}
+    }
+
+    return converter;
+}
+
+
+/*
+ * Adds a converter between two units to the fixed cache of a frozen
+ * unit-system if both units are permanent (i.e., they existed when the
+ * unit-system was frozen) and the set of the units has an empty entry.  Because
+ * entries are never evicted, units that are created after the freeze are left
+ * to the least-recently-used cache so that they can still be freed.  The entry
+ * holds a reference to the converter.
+ *
+ * Arguments:
+ *	from		Pointer to the unit from which to convert values.
+ *	to		Pointer to the unit to which to convert values.
+ *	converter	Pointer to the converter between the units.
+ * Returns:
+ *	0		The converter wasn't added because a unit isn't permanent,
+ *			the set is full, or memory couldn't be allocated.
+ *	1		The converter was added (or another thread added it).
+ */
+static int
+fixedCachePut(
+    ut_unit* const		from,
+    ut_unit* const		to,
+    cv_converter* const		converter)
+{
+    CacheEntry** const	set = from->common.system->fixedCache + CACHE_WAYS *
+	(hashUnit(hashUnit(HASH_INIT, from), to) & (CACHE_SETS - 1));
+    CacheEntry*		entry = NULL;
+    int			wasAdded = 0;
+
+    if (UT_LOAD_LONG(from->common.refCount) == 0 &&
+	    UT_LOAD_LONG(to->common.refCount) == 0)
+	entry = malloc(sizeof(CacheEntry));
+
+    if (entry != NULL) {
+	entry->converter = cv_clone(converter);
+
+	if (entry->converter != NULL) {
+	    int		i;
+
+	    entry->from = from;
+	    entry->to = to;
+
+	    for (i = 0; i < CACHE_WAYS; i++) {
+		const CacheEntry*	other;
+
+		if (UT_CAS_POINTER(set[i], NULL, entry)) {
+		    wasAdded = 1;
+		    entry = NULL;
+		    break;
+		}
+
+		other = UT_LOAD_POINTER(set[i]);
+
+		if (other->from == from && other->to == to) {
+		    wasAdded = 1;
+		    break;
+		}
+	    }
+
+	    if (entry != NULL)
+		cv_free(entry->converter);
+	}
+
+	free(entry);
+    }
+
+    return wasAdded;
+}
+
+
+/*
+ * Returns the cached converter between two units.
+ *
+ * Arguments:
+ *	from		Pointer to the unit from which to convert values.
+ *	to		Pointer to the unit to which to convert values.
+ * Returns:
+ *	NULL		The converter isn't in the cache.
+ *	else		A new reference to the converter.
+ */
+static cv_converter*
+cacheGet(
+    const ut_unit* const	from,
+    const ut_unit* const	to)
+{
+    ut_system* const	system = from->common.system;
+    cv_converter*	converter = NULL;
+
+    UT_LOCK(system->cacheLock);
+
+    if (system->cache != NULL) {
+	CacheEntry*	set = system->cache + CACHE_WAYS *
+	    (hashUnit(hashUnit(HASH_INIT, from), to) & (CACHE_SETS - 1));
+	int		i;
+
+	for (i = 0; i < CACHE_WAYS; i++) {
+	    if (set[i].from == from && set[i].to == to) {
+		CacheEntry	entry = set[i];
+
+		/*
+		 * Make the entry the most-recently-used one of its set.
+		 */
+		for (; i > 0; i--)
+		    set[i] = set[i-1];
+
+		set[0] = entry;
+		converter = cv_clone(entry.converter);
+		break;
+	    }
+	}
+    }
+
+    UT_UNLOCK(system->cacheLock);
+
+    return converter;
+}
+
+
+/*
+ * Adds a converter between two units to the cache, which holds references to
+ * the units and the converter.  The least-recently-used entry of the
+ * converter's set is evicted.  The cache is unchanged if the necessary memory
+ * can't be allocated.
+ *
+ * Arguments:
+ *	from		Pointer to the unit from which to convert values.
+ *	to		Pointer to the unit to which to convert values.
+ *	converter	Pointer to the converter between the units.
+ */
+static void
+cachePut(
+    ut_unit* const		from,
+    ut_unit* const		to,
+    cv_converter* const		converter)
+{
+    ut_system* const	system = from->common.system;
+    CacheEntry		evicted = {NULL, NULL, NULL};
+    CacheEntry		entry;
+
+    entry.converter = cv_clone(converter);
+
+    if (entry.converter != NULL) {
+	entry.from = CLONE(from);
+	entry.to = CLONE(to);
+
+	UT_LOCK(system->cacheLock);
+
+	if (system->cache == NULL)
+	    system->cache = calloc(CACHE_SETS*CACHE_WAYS, sizeof(CacheEntry));
+
+	if (system->cache == NULL) {
+	    evicted = entry;
+	}
+	else {
+	    CacheEntry*	set = system->cache + CACHE_WAYS *
+		(hashUnit(hashUnit(HASH_INIT, from), to) & (CACHE_SETS - 1));
+	    int		i;
+
+	    evicted = set[CACHE_WAYS-1];
+
+	    for (i = CACHE_WAYS-1; i > 0; i--)
+		set[i] = set[i-1];
+
+	    set[0] = entry;
+	}
+
+	UT_UNLOCK(system->cacheLock);
+
+	/*
+	 * The evicted entry is released outside the lock.
+	 */
+	if (evicted.converter != NULL) {
+	    cv_free(evicted.converter);
+	    FREE(evicted.from);
+	    FREE(evicted.to);
+	}
+    }
+}
+
+
+/*
+ * Returns a converter of numeric values in one unit to numeric values in
+ * another unit.  The returned converter should be passed to cv_free() when it
+ * is no longer needed by the client.  Converters are cached by the unit-system,
+ * so repeated requests for the same pair of units share one converter.
+ *
+ * NOTE:  Leap seconds are not taken into account when converting between
+ * timestamp units.
+ *
+ * Arguments:
+ *	from		Pointer to the unit from which to convert values.
+ *	to		Pointer to the unit to which to convert values.
+ * Returns:
+ *	NULL		Failure.  "ut_get_status()" will be:
+ *			    UT_BAD_ARG		"from" or "to" is NULL.
+ *			    UT_NOT_SAME_SYSTEM	"from" and "to" belong to
+ *						different unit-systems.
+ *			    UT_MEANINGLESS	Conversion between the units is
+ *						not possible.  See
+ *						"ut_are_convertible()".
+ *	else		Pointer to the appropriate converter.  The pointer
+ *			should be passed to cv_free() when no longer needed by
+ *			the client.
+ */
+cv_converter*
+ut_get_converter(
+    ut_unit* const	from,
+    ut_unit* const	to)
+{
+    cv_converter*	converter = NULL;	/* failure */
+
+    if (from == NULL || to == NULL) {
+	ut_set_status(UT_BAD_ARG);
+	ut_handle_error_message("ut_get_converter(): NULL unit argument");
+    }
+    else if (from->common.system != to->common.system) {
+	ut_set_status(UT_NOT_SAME_SYSTEM);
+	ut_handle_error_message(
+	    "ut_get_converter(): Units in different unit-systems");
+    }
+    else {
+	const int	isFrozen = from->common.system->isFrozen;
+	int		isFull = 1;
+
+	ut_set_status(UT_SUCCESS);
+
+	/*
+	 * The fixed cache of a frozen unit-system is tried first and the
+	 * locked cache only if the fixed cache's set is full.
+	 */
+	if (isFrozen)
+	    converter = fixedCacheGet(from, to, &isFull);
+
+	if (converter == NULL && isFull)
+	    converter = cacheGet(from, to);
+
+	if (converter == NULL) {
+	    converter = getConverter(from, to);
+
+	    if (converter != NULL &&
+		    !(isFrozen && fixedCachePut(from, to, converter)))
+		cachePut(from, to, converter);
+	}
+    }
 
     return converter;
 }
@@ -3776,7 +5607,8 @@ ut_is_dimensionless(
 
 
 /*
- * Returns a clone of a unit.
+ * Returns a clone of a unit.  Because equal units are identical, the clone is
+ * "unit" itself with an additional reference.
  *
  * Arguments:
  *	unit	Pointer to the unit to be cloned.
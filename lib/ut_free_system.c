@@ -13,7 +13,9 @@
 #endif
 
 #include "udunits2.h"
+#include "bundledDb.h"
 #include "idToUnitMap.h"
+#include "idTrie.h"
 #include "unitToIdMap.h"
 
 extern void coreFreeSystem(ut_system* system);
@@ -21,11 +23,12 @@ extern void coreFreeSystem(ut_system* system);
 
 /*
  * Frees a unit-system.  All unit-to-identifier and identifier-to-unit mappings
- * will be removed.
+ * will be removed and all units of the unit-system will be freed.
  *
  * Arguments:
  *	system		Pointer to the unit-system to be freed.  Use of "system"
- *			upon return results in undefined behavior.
+ *			or any of its units upon return results in undefined
+ *			behavior.
  */
 void
 ut_free_system(
@@ -34,6 +37,8 @@ ut_free_system(
     if (system != NULL) {
 	itumFreeSystem(system);
 	utimFreeSystem(system);
+	idtFreeSystem(system);
+	bdbFreeSystem(system);
 	coreFreeSystem(system);
     }
 }
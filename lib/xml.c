@@ -2184,7 +2184,12 @@ ut_read_xml(
         ut_status       status;
         ut_status       openError;
 
+        /*
+         * The units of the database are allocated contiguously.
+         */
+        (void)ut_set_arena(unitSystem, 1);
         status = readXml(ut_get_path_xml(path, &openError));
+        (void)ut_set_arena(unitSystem, 0);
 
         if (status == UT_OPEN_ARG) {
             status = openError;